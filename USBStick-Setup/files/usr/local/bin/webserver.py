@@ -37,10 +37,17 @@ _ALLOWED_HOSTNAME_PATTERN = re.compile(r"[^A-Za-z0-9._-]+")
 
 SAFE_IP_PLACEHOLDER = "0.0.0.0"
 
-_FIRMWARE_LETTERS = tuple("ABCDEFGHIJKLMNOPQRSTUVWXYZ*#~&?01234567")
+_FIRMWARE_LETTERS = tuple("ABCDEFGHIJKLMNOPQRSTUVWXYZ*#~&?")
 _ALLOWED_LETTERS = set(_FIRMWARE_LETTERS)
+# Zusatz-Symbole des Katalogs heißen "@<Id>"; ältere Firmware kannte nur "0".."7" (= Id 0..7).
+CUSTOM_SYMBOL_COUNT = 64
+_LEGACY_CUSTOM_SYMBOLS = "01234567"
+_CUSTOM_SYMBOL_PATTERN = re.compile(r"@(\d{1,2})")
 _ALLOWED_COLOR_MODES = {"fixed", "random_selected", "random_all"}
 _SYMBOL_BITMAP_HEX_PATTERN = re.compile(r"^[0-9A-Fa-f]{256}$")
+# POST /api/symbols/bulk der Firmware: höchstens 94 Records (30 eingebaute + 64 Zusatz-Symbole)
+SYMBOL_BULK_MAX_RECORDS = 94
+SYMBOL_BULK_FLAG_ENABLED = 0x01
 
 MAX_HOSTNAME_LENGTH = 64
 
@@ -325,12 +332,19 @@ def sanitize_letter(value, *, default: str = "") -> str:
     if not candidate:
         return default
 
+    custom_match = _CUSTOM_SYMBOL_PATTERN.match(candidate)
+    if custom_match:
+        symbol_id = int(custom_match.group(1))
+        return f"@{symbol_id}" if symbol_id < CUSTOM_SYMBOL_COUNT else default
+
     first_char = candidate[0]
     if "a" <= first_char <= "z":
         first_char = first_char.upper()
 
     if first_char in _ALLOWED_LETTERS:
         return first_char
+    if first_char in _LEGACY_CUSTOM_SYMBOLS:
+        return f"@{first_char}"
 
     return default
 
@@ -649,6 +663,7 @@ def migrate_config(data):
     return changed
 
 
+# Nur noch für Boxen, deren Firmware /api/state nicht kennt.
 def extract_box_state_from_soup(soup):
     letters = {day: ["" for _ in range(TRIGGER_SLOTS)] for day in DAYS}
     colors = {day: [DEFAULT_COLOR for _ in range(TRIGGER_SLOTS)] for day in DAYS}
@@ -849,6 +864,62 @@ def fetch_trigger_delays(ip):
     return normalized
 
 
+def _normalize_day_matrix(payload, normalize_list):
+    normalized = {}
+    for day in DAYS:
+        day_payload = None
+        if isinstance(payload, dict):
+            day_payload = payload.get(day)
+            if day_payload is None:
+                day_payload = payload.get(str(DAY_TO_FIRMWARE_INDEX[day]))
+        normalized[day] = normalize_list(day_payload)
+    return normalized
+
+
+def fetch_box_state(ip):
+    """Liest Belegung, Farben und Delays über GET /api/state.
+
+    Liefert None, wenn die Box keinen gültigen Zustand schickt, etwa weil ihre Firmware den
+    Endpunkt noch nicht kennt. Aufrufer lesen dann wie bisher die Startseite aus.
+    """
+    ip = sanitize_ipv4(ip)
+    if ip == SAFE_IP_PLACEHOLDER:
+        return None
+    try:
+        response = requests.get(
+            f"http://{ip}/api/state",
+            headers=box_manager_headers(),
+            timeout=3,
+            allow_redirects=False,
+        )
+    except requests.RequestException:
+        return None
+
+    _ensure_no_redirect(response, action="Zustandsabfrage", host=ip)
+
+    if not response.ok:
+        return None
+
+    try:
+        data = response.json()
+    except ValueError:
+        return None
+
+    if not isinstance(data, dict) or not isinstance(data.get("letters"), dict):
+        return None
+
+    return {
+        "letters": _normalize_day_matrix(data.get("letters"), _normalize_letter_list),
+        "colors": _normalize_day_matrix(data.get("colors"), _normalize_color_list),
+        "delays": _normalize_day_matrix(data.get("delays"), _normalize_delay_list),
+        "colorModes": _normalize_day_matrix(data.get("color_modes"), _normalize_color_mode_list),
+        "colorPaletteMasks": _normalize_day_matrix(
+            data.get("color_palette_masks"), _normalize_color_palette_mask_list
+        ),
+    }
+
+
+
 def _ping_host(ip: str) -> bool:
     command = ["ping", "-n", "1", "-w", "1000", ip] if os.name == "nt" else ["ping", "-c", "1", "-W", "1", ip]
     try:
@@ -1148,24 +1219,7 @@ def get_hostname_from_web(ip):
                     return value
     return "Unbekannt"
 
-def learn_box(ip, identifier):
-    ip = sanitize_ipv4(ip)
-    if ip == SAFE_IP_PLACEHOLDER:
-        return
-    identifier = sanitize_hostname(identifier)
-    config = load_config()
-    if identifier in config["boxen"]:
-        box = config["boxen"][identifier]
-        changed = False
-        if box.get("ip") != ip:
-            box["ip"] = ip
-            changed = True
-        if ensure_box_structure(box, remove_legacy=True):
-            changed = True
-        if changed:
-            save_config(config)
-        return
-
+def _learn_box_state_from_html(ip):
     try:
         r = requests.get(
             f"http://{ip}/",
@@ -1174,7 +1228,7 @@ def learn_box(ip, identifier):
             allow_redirects=False,
         )
     except requests.RequestException:
-        return
+        return None
 
     _ensure_no_redirect(r, action="Box-Lernvorgang", host=ip)
 
@@ -1196,14 +1250,50 @@ def learn_box(ip, identifier):
     except Exception:
         delays = None
 
-    if delays is None:
-        delays = html_delays
+    return {
+        "letters": letters,
+        "colors": colors,
+        "delays": delays if delays is not None else html_delays,
+        "colorModes": color_modes,
+        "colorPaletteMasks": color_palette_masks,
+    }
+
+
+def learn_box(ip, identifier):
+    ip = sanitize_ipv4(ip)
+    if ip == SAFE_IP_PLACEHOLDER:
+        return
+    identifier = sanitize_hostname(identifier)
+    config = load_config()
+    if identifier in config["boxen"]:
+        box = config["boxen"][identifier]
+        changed = False
+        if box.get("ip") != ip:
+            box["ip"] = ip
+            changed = True
+        if ensure_box_structure(box, remove_legacy=True):
+            changed = True
+        if changed:
+            save_config(config)
+        return
+
+    state = fetch_box_state(ip)
+    if state is None:
+        state = _learn_box_state_from_html(ip)
+        if state is None:
+            return
+
+    letters = state["letters"]
+    colors = state["colors"]
+    delays = state["delays"]
+    color_modes = state["colorModes"]
+    color_palette_masks = state["colorPaletteMasks"]
 
     box = {
         "ip": ip,
         "letters": letters,
         "colors": colors,
-        "delays": delays if delays is not None else _default_delay_matrix(),
+        "delays": delays,
     }
     if color_modes != _default_color_mode_matrix():
         box["colorModes"] = color_modes
@@ -1694,39 +1784,51 @@ def transfer_box():
         return jsonify({"status": "❌ IP unbekannt"})
 
     try:
-        r = requests.get(f"http://{ip}/", headers=box_manager_headers(), timeout=3, allow_redirects=False)
-    except requests.RequestException:
-        return jsonify({"status": "❌ Box nicht erreichbar"})
-    if (
-        getattr(r, "is_redirect", False)
-        or getattr(r, "is_permanent_redirect", False)
-        or 300 <= getattr(r, "status_code", 0) < 400
-    ):
-        app.logger.warning(
-            "Transfer-Box für %s abgebrochen: unerwartete Weiterleitung (HTTP %s)",
-            hostname,
-            r.status_code,
-        )
-        return (
-            jsonify(
-                {
-                    "status": "❌ Unerwartete Weiterleitung",
-                    "details": f"Box antwortete mit HTTP {r.status_code} und Weiterleitung",
-                }
-            ),
-            502,
-        )
-    if not r.ok:
-        return jsonify({"status": "❌ Box nicht erreichbar"})
-
-    soup = BeautifulSoup(r.text, "html.parser")
-    remote_letters, remote_colors, _ = extract_box_state_from_soup(soup)
-    remote_color_modes, remote_color_palette_masks = extract_box_color_settings_from_soup(soup)
-    try:
-        remote_delays = fetch_trigger_delays(ip)
+        remote_state = fetch_box_state(ip)
     except RedirectResponseError as exc:
         return _redirect_error_response(exc)
 
+    if remote_state is not None:
+        remote_letters = remote_state["letters"]
+        remote_colors = remote_state["colors"]
+        remote_delays = remote_state["delays"]
+        remote_color_modes = remote_state["colorModes"]
+        remote_color_palette_masks = remote_state["colorPaletteMasks"]
+    else:
+        try:
+            r = requests.get(f"http://{ip}/", headers=box_manager_headers(), timeout=3, allow_redirects=False)
+        except requests.RequestException:
+            return jsonify({"status": "❌ Box nicht erreichbar"})
+        if (
+            getattr(r, "is_redirect", False)
+            or getattr(r, "is_permanent_redirect", False)
+            or 300 <= getattr(r, "status_code", 0) < 400
+        ):
+            app.logger.warning(
+                "Transfer-Box für %s abgebrochen: unerwartete Weiterleitung (HTTP %s)",
+                hostname,
+                r.status_code,
+            )
+            return (
+                jsonify(
+                    {
+                        "status": "❌ Unerwartete Weiterleitung",
+                        "details": f"Box antwortete mit HTTP {r.status_code} und Weiterleitung",
+                    }
+                ),
+                502,
+            )
+        if not r.ok:
+            return jsonify({"status": "❌ Box nicht erreichbar"})
+
+        soup = BeautifulSoup(r.text, "html.parser")
+        remote_letters, remote_colors, _ = extract_box_state_from_soup(soup)
+        remote_color_modes, remote_color_palette_masks = extract_box_color_settings_from_soup(soup)
+        try:
+            remote_delays = fetch_trigger_delays(ip)
+        except RedirectResponseError as exc:
+            return _redirect_error_response(exc)
+
     stored_letters = {day: list(box["letters"][day]) for day in DAYS}
     stored_colors = {day: list(box["colors"][day]) for day in DAYS}
     stored_delays = {day: [_coerce_delay_value(value) for value in box["delays"][day]] for day in DAYS}
@@ -1789,55 +1891,90 @@ def transfer_box():
 
     return jsonify({"status": "✅ Übertragen"})
 
+
+def _normalize_transfer_symbol(value) -> Optional[str]:
+    """Einzelzeichen eines editierbaren Symbols oder "@<id>" eines Zusatz-Symbols, sonst None."""
+    symbol = str(value or "").strip()
+    if len(symbol) == 1 and symbol in _LEGACY_CUSTOM_SYMBOLS:
+        symbol = f"@{symbol}"
+    custom_match = _CUSTOM_SYMBOL_PATTERN.fullmatch(symbol)
+    if custom_match:
+        if int(custom_match.group(1)) >= CUSTOM_SYMBOL_COUNT:
+            return None
+        return f"@{int(custom_match.group(1))}"
+    if len(symbol) != 1 or symbol == "*" or symbol not in _ALLOWED_LETTERS:
+        return None
+    return symbol
+
+
+def _symbol_bulk_record(symbol: str, bitmap: str, enabled: bool) -> bytes:
+    """Record für POST /api/symbols/bulk: Symbolcode | Flags | Bitmap."""
+    code = 0x80 + int(symbol[1:]) if symbol.startswith("@") else ord(symbol)
+    flags = SYMBOL_BULK_FLAG_ENABLED if enabled else 0
+    return bytes((code, flags)) + bytes.fromhex(bitmap)
+
+
+def _post_symbol_to_box(ip: str, symbol: str, bitmap: str, enabled: bool):
+    response = requests.post(
+        f"http://{ip}/api/symbol-bitmap",
+        headers=box_manager_headers(),
+        data={
+            "char": symbol,
+            "enabled": "1" if enabled else "0",
+            "bitmap": bitmap,
+        },
+        timeout=3,
+        allow_redirects=False,
+    )
+    if not response.ok and symbol.startswith("@"):
+        response = requests.post(
+            f"http://{ip}/api/custom-symbol",
+            headers=box_manager_headers(),
+            data={
+                "slot": symbol[1:],
+                "enabled": "1" if enabled else "0",
+                "bitmap": bitmap,
+            },
+            timeout=3,
+            allow_redirects=False,
+        )
+    return response
+
+
+def _symbol_transfer_box_ip(raw_hostname):
+    """IP der Box oder (Fehlertext, Status) für die Antwort."""
+    hostname = sanitize_hostname(raw_hostname)
+    config = load_config()
+    box = config["boxen"].get(hostname) or config["boxen"].get(raw_hostname)
+    if not box:
+        return None, ("Box unbekannt", 404)
+    ip = sanitize_ipv4(box.get("ip"))
+    if ip == SAFE_IP_PLACEHOLDER:
+        return None, ("IP unbekannt", 400)
+    return ip, None
+
+
 @app.route("/transfer_symbol", methods=["POST"])
 def transfer_symbol():
     payload = request.get_json(silent=True) or {}
     raw_hostname = payload.get("hostname")
-    symbol = str(payload.get("char") or payload.get("slot", "")).strip()
+    symbol = _normalize_transfer_symbol(payload.get("char") or payload.get("slot", ""))
     bitmap = str(payload.get("bitmap", "")).strip()
     enabled = bool(payload.get("enabled", True))
 
     if not raw_hostname:
         return "Hostname fehlt", 400
-    if len(symbol) != 1 or symbol not in "ABCDEFGHIJKLMNOPQRSTUVWXYZ#~&?01234567":
+    if symbol is None:
         return "Ungültiges Zeichen/Symbol", 400
     if not _SYMBOL_BITMAP_HEX_PATTERN.fullmatch(bitmap):
         return "Bitmap muss 256 Hex-Zeichen enthalten", 400
 
-    hostname = sanitize_hostname(raw_hostname)
-    config = load_config()
-    box = config["boxen"].get(hostname) or config["boxen"].get(raw_hostname)
-    if not box:
-        return "Box unbekannt", 404
-
-    ip = sanitize_ipv4(box.get("ip"))
-    if ip == SAFE_IP_PLACEHOLDER:
-        return "IP unbekannt", 400
+    ip, error = _symbol_transfer_box_ip(raw_hostname)
+    if error:
+        return error
 
     try:
-        response = requests.post(
-            f"http://{ip}/api/symbol-bitmap",
-            headers=box_manager_headers(),
-            data={
-                "char": symbol,
-                "enabled": "1" if enabled else "0",
-                "bitmap": bitmap,
-            },
-            timeout=3,
-            allow_redirects=False,
-        )
-        if not response.ok and symbol in "01234567":
-            response = requests.post(
-                f"http://{ip}/api/custom-symbol",
-                headers=box_manager_headers(),
-                data={
-                    "slot": symbol,
-                    "enabled": "1" if enabled else "0",
-                    "bitmap": bitmap,
-                },
-                timeout=3,
-                allow_redirects=False,
-            )
+        response = _post_symbol_to_box(ip, symbol, bitmap, enabled)
     except requests.RequestException:
         return "Box nicht erreichbar", 503
 
@@ -1852,6 +1989,91 @@ def transfer_symbol():
 
     return "Symbol übertragen", 200
 
+
+class SymbolTransferError(Exception):
+    def __init__(self, message: str, status: int):
+        super().__init__(message)
+        self.status = status
+
+
+def _transfer_symbols_bulk(ip: str, symbols) -> Optional[List[str]]:
+    """Überträgt alle Symbole per POST /api/symbols/bulk; liefert die abgelehnten Symbole.
+
+    None, wenn die Firmware den Sammel-Upload nicht kennt."""
+    rejected = []
+    for offset in range(0, len(symbols), SYMBOL_BULK_MAX_RECORDS):
+        chunk = symbols[offset:offset + SYMBOL_BULK_MAX_RECORDS]
+        body = b"".join(_symbol_bulk_record(*entry) for entry in chunk)
+        response = requests.post(
+            f"http://{ip}/api/symbols/bulk",
+            headers=box_manager_headers({"Content-Type": "application/octet-stream"}),
+            data=body,
+            timeout=10,
+            allow_redirects=False,
+        )
+        _ensure_no_redirect(response, action="Sammel-Upload der Symbole", host=ip)
+        if response.status_code == 404 and offset == 0:
+            return None
+        if not response.ok:
+            raise SymbolTransferError(response.text or f"Fehler HTTP {response.status_code}", response.status_code)
+        try:
+            result = bytes.fromhex(str(response.json().get("result", "")))
+        except (ValueError, AttributeError):
+            result = b""
+        for position, (symbol, _, _) in enumerate(chunk):
+            stored = position // 8 < len(result) and result[position // 8] & (1 << (position % 8))
+            if not stored:
+                rejected.append(symbol)
+    return rejected
+
+
+@app.route("/transfer_symbols", methods=["POST"])
+def transfer_symbols():
+    payload = request.get_json(silent=True) or {}
+    raw_hostname = payload.get("hostname")
+    entries = payload.get("symbols")
+
+    if not raw_hostname:
+        return "Hostname fehlt", 400
+    if not isinstance(entries, list) or not entries:
+        return "Keine Symbole angegeben", 400
+
+    symbols = {}
+    for entry in entries:
+        if not isinstance(entry, dict):
+            return "Ungültiges Zeichen/Symbol", 400
+        symbol = _normalize_transfer_symbol(entry.get("char") or entry.get("slot", ""))
+        bitmap = str(entry.get("bitmap", "")).strip()
+        if symbol is None:
+            return "Ungültiges Zeichen/Symbol", 400
+        if not _SYMBOL_BITMAP_HEX_PATTERN.fullmatch(bitmap):
+            return "Bitmap muss 256 Hex-Zeichen enthalten", 400
+        symbols[symbol] = (symbol, bitmap.lower(), bool(entry.get("enabled", True)))
+    symbols = list(symbols.values())
+
+    ip, error = _symbol_transfer_box_ip(raw_hostname)
+    if error:
+        return error
+
+    try:
+        rejected = _transfer_symbols_bulk(ip, symbols)
+        if rejected is None:
+            # Firmware ohne Sammel-Upload: Symbol für Symbol übertragen.
+            rejected = []
+            for symbol, bitmap, enabled in symbols:
+                response = _post_symbol_to_box(ip, symbol, bitmap, enabled)
+                _ensure_no_redirect(response, action="Symbol-Upload", host=ip)
+                if not response.ok:
+                    rejected.append(symbol)
+    except requests.RequestException:
+        return "Box nicht erreichbar", 503
+    except RedirectResponseError as error:
+        return _redirect_error_response(error)
+    except SymbolTransferError as error:
+        return str(error), error.status
+
+    return jsonify({"stored": len(symbols) - len(rejected), "rejected": rejected})
+
 @app.route("/shutdown", methods=["POST"])
 def shutdown():
     _execute_poweroff()
@@ -1,7 +1,10 @@
 #include "config.h"
+#include "clock_events.h"
 #include "rtc_manager.h"
 #include "wifi_manager.h"
 #include "trigger_handler.h"
+#include "display_plan.h"
+#include "log_manager.h"
 #include "web_manager.h"
 
 bool triggerActive = false;
@@ -15,6 +18,7 @@ bool wifiDisabled = false;
 bool alreadyCleared = false;
 
 constexpr unsigned long WIFI_IDLE_TIMEOUT_MS = 5UL * 60UL * 1000UL;
+constexpr unsigned long LOOP_IDLE_SLEEP_MAX_MS = 1UL;
 
 static unsigned long getChipRandomSeed() {
 #if defined(ESP32)
@@ -28,7 +32,7 @@ static unsigned long getChipRandomSeed() {
 void setup() {
   Serial.begin(19200);
   delay(500);
-  Serial.println(F("🚀 Systemstart..."));
+  LOG_INFO(CONFIG, "🚀 Systemstart...");
   randomSeed(getChipRandomSeed() ^ micros());
   initializeTimezone();
   // clearDisplay();
@@ -42,12 +46,11 @@ void setup() {
   enableRTC();
   if (!rtc.begin()) {
     rtc_ok = false;
-    Serial.println(F("⚠️ RTC nicht gefunden!"));
+    LOG_WARN(CONFIG, "⚠️ RTC nicht gefunden!");
   } else {
     rtc_ok = true;
     startTime = getRTCTime();
-    Serial.print(F("⏰ Startzeit: "));
-    Serial.println(startTime);
+    LOG_INFO(CONFIG, "⏰ Startzeit: %s", startTime.c_str());
   }
   enableRS485();
 
@@ -60,41 +63,53 @@ void setup() {
 }
 
 void loop() {
+#if RIDDLEMATRIX_LOG_LEVEL_DISPLAY >= LOG_LEVEL_DEBUG
     static unsigned long lastDebugTime = 0;
-    static unsigned long lastWeekdayUpdate = 0;
+#endif
 
     if (triggerActive) {
         unsigned long elapsedTime = millis() - letterStartTime;
 
+#if RIDDLEMATRIX_LOG_LEVEL_DISPLAY >= LOG_LEVEL_DEBUG
         // **Nur alle 1000 ms (1 Sekunde) eine Debug-Ausgabe**
         if (millis() - lastDebugTime > 1000) {
-            Serial.print(F("⏳ Anzeige läuft... Verstrichene Zeit: "));
-            Serial.println(elapsedTime / 1000);
+            LOG_DEBUG(DISPLAY, "⏳ Anzeige läuft... Verstrichene Zeit: %lu", elapsedTime / 1000);
             lastDebugTime = millis();  // **Speichert den Zeitpunkt der letzten Ausgabe**
         }
+#endif
 
         if (elapsedTime >= ((unsigned long)letter_display_time * 1000UL)) {
-            Serial.println(F("🧹 Anzeigezeit abgelaufen, Zeichen/Symbol wird gelöscht!"));
+            LOG_DEBUG(DISPLAY, "🧹 Anzeigezeit abgelaufen, Zeichen/Symbol wird gelöscht!");
             clearDisplay();
             if (!triggerActive && wifiConnected && !wifiDisabled && wifi_status_symbol_enabled) {
-                Serial.println(F("🔁 Sicherheits-Check: WiFi-Symbol nach dem Löschen erneut anzeigen."));
+                LOG_DEBUG(DISPLAY, "🔁 Sicherheits-Check: WiFi-Symbol nach dem Löschen erneut anzeigen.");
                 drawWiFiSymbol();
             }
             triggerActive = false;
         }
     }
 
-    const unsigned long nowForWeekday = millis();
-    if ((nowForWeekday - lastWeekdayUpdate) >= 500UL) {
-        updateCachedWeekday();
-        lastWeekdayUpdate = nowForWeekday;
+    // **Wochentag, Tagesplan und Aktivfenster nur an Zeitgrenzen neu bestimmen**
+    const uint8_t clockEvents = pollClockEvents();
+    if (clockEvents != CLOCK_EVENT_NONE) {
+        refreshDisplayPlan(getCachedWeekday());
+        handleClockEvents(clockEvents);
     }
 
     checkWiFi();
     checkTrigger();
     checkAutoDisplay();
     processPendingTriggers();
+    serviceConfigFlush();
 
     maintainWiFiAccessWindow(WIFI_IDLE_TIMEOUT_MS);
 
+    // **Leerlauf bis zum nächsten geplanten Trigger, gedeckelt damit RS485 und WLAN reaktiv bleiben**
+    if (!triggerActive) {
+        const unsigned long idleMs = millisUntilNextPendingTrigger();
+        if (idleMs > 0) {
+            delay(idleMs < LOOP_IDLE_SLEEP_MAX_MS ? idleMs : LOOP_IDLE_SLEEP_MAX_MS);
+        }
+    }
+
 }
@@ -0,0 +1,77 @@
+#include "clock_events.h"
+
+namespace {
+
+constexpr uint32_t SECONDS_PER_DAY = 86400UL;
+constexpr uint16_t MINUTES_PER_DAY = 1440U;
+
+bool armed = false;
+uint32_t lastEpoch = 0;
+uint16_t activeStart = 0;
+uint16_t activeEnd = 0;
+
+// Abstand von `epoch` bis zum nächsten Auftreten der Tagessekunde `boundary`; 86400, wenn genau jetzt.
+uint32_t secondsUntil(uint32_t epoch, uint32_t boundary) {
+    const uint32_t secondOfDay = epoch % SECONDS_PER_DAY;
+    const uint32_t offset = (boundary + SECONDS_PER_DAY - secondOfDay) % SECONDS_PER_DAY;
+    return offset == 0 ? SECONDS_PER_DAY : offset;
+}
+
+bool hasActiveWindow() {
+    return activeStart != activeEnd;
+}
+
+uint32_t activeStartSecond() {
+    return static_cast<uint32_t>(activeStart) * 60UL;
+}
+
+uint32_t activeEndSecond() {
+    return static_cast<uint32_t>((activeEnd + 1U) % MINUTES_PER_DAY) * 60UL;
+}
+
+} // namespace
+
+uint8_t advanceClockEvents(uint32_t epoch, uint16_t activeStartMinutes, uint16_t activeEndMinutes) {
+    if (!armed || activeStartMinutes != activeStart || activeEndMinutes != activeEnd || epoch < lastEpoch ||
+        (epoch - lastEpoch) >= SECONDS_PER_DAY) {
+        armed = true;
+        activeStart = activeStartMinutes;
+        activeEnd = activeEndMinutes;
+        lastEpoch = epoch;
+        return CLOCK_EVENT_RESYNC;
+    }
+
+    const uint32_t span = epoch - lastEpoch;
+    uint8_t events = CLOCK_EVENT_NONE;
+    if (span > 0) {
+        if (secondsUntil(lastEpoch, 0) <= span) {
+            events |= CLOCK_EVENT_MIDNIGHT;
+        }
+        if (hasActiveWindow() && secondsUntil(lastEpoch, activeStartSecond()) <= span) {
+            events |= CLOCK_EVENT_ACTIVE_START;
+        }
+        if (hasActiveWindow() && secondsUntil(lastEpoch, activeEndSecond()) <= span) {
+            events |= CLOCK_EVENT_ACTIVE_END;
+        }
+    }
+    lastEpoch = epoch;
+    return events;
+}
+
+uint32_t secondsUntilNextClockBoundary(uint32_t epoch) {
+    uint32_t next = secondsUntil(epoch, 0);
+    if (hasActiveWindow()) {
+        const uint32_t untilStart = secondsUntil(epoch, activeStartSecond());
+        const uint32_t untilEnd = secondsUntil(epoch, activeEndSecond());
+        next = untilStart < next ? untilStart : next;
+        next = untilEnd < next ? untilEnd : next;
+    }
+    return next;
+}
+
+void resetClockEvents() {
+    armed = false;
+    lastEpoch = 0;
+    activeStart = 0;
+    activeEnd = 0;
+}
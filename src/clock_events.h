@@ -0,0 +1,27 @@
+#ifndef CLOCK_EVENTS_H
+#define CLOCK_EVENTS_H
+
+#include <stdint.h>
+
+// **Zeitgrenzen als Ereignisse**
+// Statt Wochentag und Aktivfenster periodisch neu abzufragen, bestimmt das Modul die
+// nächste relevante Grenze (Mitternacht, Beginn und Ende des Standalone-Aktivfensters)
+// und meldet jede überschrittene Grenze genau einmal. Zeiten sind Ortszeit in Sekunden
+// seit 1970, Fenstergrenzen Minuten seit Mitternacht; das Ende ist wie bei
+// isWithinStandaloneWindow() inklusive, die Grenze liegt also am Beginn der Folgeminute.
+enum ClockEvent : uint8_t {
+    CLOCK_EVENT_NONE = 0,
+    CLOCK_EVENT_MIDNIGHT = 1U << 0,
+    CLOCK_EVENT_ACTIVE_START = 1U << 1,
+    CLOCK_EVENT_ACTIVE_END = 1U << 2,
+    // Erster Abgleich, Zeitsprung rückwärts/über einen Tag oder geändertes Fenster: Zustand neu bestimmen.
+    CLOCK_EVENT_RESYNC = 1U << 3
+};
+
+// Liefert die seit dem letzten Aufruf überschrittenen Grenzen als Bitmaske.
+uint8_t advanceClockEvents(uint32_t epoch, uint16_t activeStartMinutes, uint16_t activeEndMinutes);
+// Sekunden bis zur nächsten Grenze nach `epoch` (1 bis 86400) für das zuletzt übergebene Fenster.
+uint32_t secondsUntilNextClockBoundary(uint32_t epoch);
+void resetClockEvents();
+
+#endif
@@ -1,4 +1,12 @@
 #include "config.h"
+#include "crc32.h"
+#include "glyph_span_table.h"
+#include "log_manager.h"
+#include "rs485_protocol.h"
+#include "symbol_pack.h"
+#if RIDDLEMATRIX_CONFIG_STORE_LOG
+#include "config_record_log.h"
+#endif
 
 #include <algorithm>
 #include <cctype>
@@ -59,9 +67,9 @@ char dailyLetterColors[NUM_TRIGGERS][NUM_DAYS][COLOR_STRING_LENGTH] = {};
 uint8_t dailyLetterColorModes[NUM_TRIGGERS][NUM_DAYS] = {};
 uint16_t dailyLetterRandomPaletteMasks[NUM_TRIGGERS][NUM_DAYS] = {};
 unsigned long letter_trigger_delays[NUM_TRIGGERS][NUM_DAYS] = {};
-uint8_t customSymbolBitmaps[CUSTOM_SYMBOL_COUNT][SYMBOL_BITMAP_SIZE] = {};
-uint8_t customSymbolEnabled[CUSTOM_SYMBOL_COUNT] = {};
+uint16_t configRevision = 0;
 char random_symbol_pool[RANDOM_SYMBOL_POOL_LENGTH] = {};
+uint8_t rs485_box_address = 0;
 
 int display_brightness;
 unsigned long letter_display_time;
@@ -85,12 +93,14 @@ namespace {
 
 constexpr uint16_t EEPROM_OFFSET_CONFIG_VERSION_LEGACY = 400;
 constexpr uint16_t EEPROM_VERSION_INVALID = 0xFFFF;
+constexpr uint16_t EEPROM_CONFIG_VERSION_LEGACY = 0;
 constexpr uint16_t EEPROM_CONFIG_VERSION_WITH_AUTH = 4;
-constexpr uint16_t EEPROM_CONFIG_VERSION_WITHOUT_ACTIVITY_WINDOW = 5;
 constexpr uint16_t EEPROM_CONFIG_VERSION_WITH_ACTIVITY_WINDOW = 6;
 constexpr uint16_t EEPROM_CONFIG_VERSION_WITH_COLOR_MODES = 7;
 constexpr uint16_t EEPROM_CONFIG_VERSION_WITH_WIFI_MODES = 8;
 constexpr uint16_t EEPROM_CONFIG_VERSION_WITH_EDITABLE_SYMBOLS = 9;
+constexpr uint16_t EEPROM_CONFIG_VERSION_WITH_RANDOM_SYMBOL_POOL = 10;
+constexpr uint16_t EEPROM_CONFIG_VERSION_WITH_RS485_ADDRESS = 11;
 constexpr uint16_t DEFAULT_ACTIVE_START_MINUTES = 10 * 60;
 constexpr uint16_t DEFAULT_ACTIVE_END_MINUTES = (18 * 60) + 5;
 constexpr char DEFAULT_RANDOM_SYMBOL_POOL[] = "#&";
@@ -122,10 +132,17 @@ void resetNetworkExtensionDefaults() {
     copyDefaultString(wifi_local_ap_password, sizeof(wifi_local_ap_password), DEFAULT_WIFI_LOCAL_AP_PASSWORD);
 }
 
+bool isSelectableSymbol(char letter) {
+    return isCustomSymbol(letter) || memchr(availableLetters, letter, sizeof(availableLetters)) != nullptr;
+}
+
 bool isSupportedRandomPoolSymbol(char letter) {
     if (letter == '\0' || letter == '*') {
         return false;
     }
+    if (isCustomSymbol(letter)) {
+        return true;
+    }
     for (size_t index = 0; index < sizeof(availableLetters); ++index) {
         if (availableLetters[index] == letter) {
             return true;
@@ -253,11 +270,6 @@ void resetTriggerDelaysToDefaults() {
     memcpy(letter_trigger_delays, DEFAULT_TRIGGER_DELAYS, sizeof(letter_trigger_delays));
 }
 
-void resetCustomSymbolsToDefaults() {
-    memset(customSymbolBitmaps, 0, sizeof(customSymbolBitmaps));
-    memset(customSymbolEnabled, 0, sizeof(customSymbolEnabled));
-}
-
 bool isValidDelayValue(unsigned long value) {
     return value <= 999UL;
 }
@@ -306,13 +318,8 @@ uint16_t readStoredConfigVersion(uint16_t &versionOffset) {
 }
 
 void migrateLegacyLayout(uint16_t storedVersion, bool &migratedLegacyLayout) {
-    Serial.print(F("ℹ️ Legacy-Layout (Version "));
-    if (storedVersion == EEPROM_VERSION_INVALID) {
-        Serial.print(F("unbekannt"));
-    } else {
-        Serial.print(storedVersion);
-    }
-    Serial.println(F(") erkannt – migriere auf mehrspurige Trigger-Konfiguration."));
+    LOG_INFO(CONFIG, "ℹ️ Legacy-Layout (Version %d) erkannt – migriere auf mehrspurige Trigger-Konfiguration.",
+             storedVersion == EEPROM_VERSION_INVALID ? -1 : static_cast<int>(storedVersion));
 
     char legacyLetters[NUM_DAYS] = {};
     char legacyColors[NUM_DAYS][COLOR_STRING_LENGTH] = {};
@@ -358,9 +365,8 @@ void migrateLegacyLayout(uint16_t storedVersion, bool &migratedLegacyLayout) {
             letter_trigger_delays[trigger][day] = delayValid ? legacyValue : fallback;
         }
         if (!delayValid) {
-            Serial.print(F("⚠️ Ungültige Legacy-Verzögerung für Trigger "));
-            Serial.print(trigger + 1);
-            Serial.println(F(" – Standardwert 0 Sekunden wird verwendet."));
+            LOG_WARN(CONFIG, "⚠️ Ungültige Legacy-Verzögerung für Trigger %u – Standardwert 0 Sekunden wird verwendet.",
+                     static_cast<unsigned>(trigger + 1));
         }
     }
 
@@ -380,553 +386,962 @@ void migrateLegacyLayout(uint16_t storedVersion, bool &migratedLegacyLayout) {
             }
         }
     } else {
-        Serial.println(F("✅ Legacy-Verzögerungen repliziert – keine zusätzlichen Matrixdaten übernommen."));
+        LOG_INFO(CONFIG, "✅ Legacy-Verzögerungen repliziert – keine zusätzlichen Matrixdaten übernommen.");
     }
 
     migratedLegacyLayout = true;
 }
 
-void loadConfigFromVersion4Layout() {
-    constexpr uint16_t LEGACY_OFFSET_AUTH_TOKEN = EEPROM_OFFSET_HOSTNAME + 50;
-    constexpr uint16_t LEGACY_OFFSET_AUTH_FLAG = LEGACY_OFFSET_AUTH_TOKEN + LEGACY_AUTH_TOKEN_MAX_LENGTH;
-    constexpr uint16_t LEGACY_OFFSET_DAILY_LETTERS = LEGACY_OFFSET_AUTH_FLAG + sizeof(uint8_t);
-    constexpr uint16_t LEGACY_OFFSET_DAILY_LETTER_COLORS =
-        LEGACY_OFFSET_DAILY_LETTERS + (NUM_TRIGGERS * NUM_DAYS);
-    constexpr uint16_t LEGACY_OFFSET_DISPLAY_BRIGHTNESS = LEGACY_OFFSET_DAILY_LETTER_COLORS +
-                                                          (NUM_TRIGGERS * NUM_DAYS * COLOR_STRING_LENGTH);
-    constexpr uint16_t LEGACY_OFFSET_LETTER_DISPLAY_TIME = LEGACY_OFFSET_DISPLAY_BRIGHTNESS + sizeof(int);
-    constexpr uint16_t LEGACY_OFFSET_TRIGGER_DELAY_MATRIX =
-        LEGACY_OFFSET_LETTER_DISPLAY_TIME + EEPROM_SIZEOF_UNSIGNED_LONG;
-    constexpr uint16_t LEGACY_OFFSET_AUTO_INTERVAL =
-        LEGACY_OFFSET_TRIGGER_DELAY_MATRIX + EEPROM_TRIGGER_DELAY_MATRIX_SIZE;
-    constexpr uint16_t LEGACY_OFFSET_AUTO_MODE = LEGACY_OFFSET_AUTO_INTERVAL + EEPROM_SIZEOF_UNSIGNED_LONG;
-    constexpr uint16_t LEGACY_OFFSET_WIFI_CONNECT_TIMEOUT = LEGACY_OFFSET_AUTO_MODE + sizeof(uint8_t);
-
-    (void)LEGACY_OFFSET_AUTH_TOKEN;
-    (void)LEGACY_OFFSET_AUTH_FLAG;
-
-    EEPROM.get(LEGACY_OFFSET_DAILY_LETTERS, dailyLetters);
-    EEPROM.get(LEGACY_OFFSET_DAILY_LETTER_COLORS, dailyLetterColors);
-    sanitizeColorMatrix(dailyLetterColors);
-    EEPROM.get(LEGACY_OFFSET_TRIGGER_DELAY_MATRIX, letter_trigger_delays);
-    EEPROM.get(LEGACY_OFFSET_AUTO_INTERVAL, letter_auto_display_interval);
-    uint8_t autoModeByte = 0;
-    EEPROM.get(LEGACY_OFFSET_AUTO_MODE, autoModeByte);
-    autoDisplayMode = (autoModeByte == 1);
-    EEPROM.get(LEGACY_OFFSET_DISPLAY_BRIGHTNESS, display_brightness);
-    EEPROM.get(LEGACY_OFFSET_LETTER_DISPLAY_TIME, letter_display_time);
-    EEPROM.get(LEGACY_OFFSET_WIFI_CONNECT_TIMEOUT, wifi_connect_timeout);
-    standalone_active_start_minutes = DEFAULT_ACTIVE_START_MINUTES;
-    standalone_active_end_minutes = DEFAULT_ACTIVE_END_MINUTES;
-}
-
-void loadConfigFromVersion5Layout() {
-    EEPROM.get(EEPROM_OFFSET_DAILY_LETTERS, dailyLetters);
-    EEPROM.get(EEPROM_OFFSET_DAILY_LETTER_COLORS, dailyLetterColors);
-    sanitizeColorMatrix(dailyLetterColors);
-    EEPROM.get(EEPROM_OFFSET_TRIGGER_DELAY_MATRIX, letter_trigger_delays);
-    EEPROM.get(EEPROM_OFFSET_AUTO_INTERVAL, letter_auto_display_interval);
-    uint8_t autoModeByte = 0;
-    EEPROM.get(EEPROM_OFFSET_AUTO_MODE, autoModeByte);
-    autoDisplayMode = (autoModeByte == 1);
-    EEPROM.get(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, display_brightness);
-    EEPROM.get(EEPROM_OFFSET_LETTER_DISPLAY_TIME, letter_display_time);
-    EEPROM.get(EEPROM_OFFSET_WIFI_CONNECT_TIMEOUT, wifi_connect_timeout);
-    standalone_active_start_minutes = DEFAULT_ACTIVE_START_MINUTES;
-    standalone_active_end_minutes = DEFAULT_ACTIVE_END_MINUTES;
-}
-
-void loadConfigFromVersion6Layout() {
-    EEPROM.get(EEPROM_OFFSET_DAILY_LETTERS, dailyLetters);
-    EEPROM.get(EEPROM_OFFSET_DAILY_LETTER_COLORS, dailyLetterColors);
-    sanitizeColorMatrix(dailyLetterColors);
-    EEPROM.get(EEPROM_OFFSET_TRIGGER_DELAY_MATRIX, letter_trigger_delays);
-    EEPROM.get(EEPROM_OFFSET_AUTO_INTERVAL, letter_auto_display_interval);
-    uint8_t autoModeByte = 0;
-    EEPROM.get(EEPROM_OFFSET_AUTO_MODE, autoModeByte);
-    autoDisplayMode = (autoModeByte == 1);
-    EEPROM.get(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, display_brightness);
-    EEPROM.get(EEPROM_OFFSET_LETTER_DISPLAY_TIME, letter_display_time);
-    EEPROM.get(EEPROM_OFFSET_WIFI_CONNECT_TIMEOUT, wifi_connect_timeout);
-    EEPROM.get(EEPROM_OFFSET_ACTIVE_START_MINUTES, standalone_active_start_minutes);
-    EEPROM.get(EEPROM_OFFSET_ACTIVE_END_MINUTES, standalone_active_end_minutes);
-}
-
-void loadConfigFromVersion7Layout() {
-    EEPROM.get(EEPROM_OFFSET_DAILY_LETTERS, dailyLetters);
-    EEPROM.get(EEPROM_OFFSET_DAILY_LETTER_COLORS, dailyLetterColors);
-    sanitizeColorMatrix(dailyLetterColors);
-    EEPROM.get(EEPROM_OFFSET_TRIGGER_DELAY_MATRIX, letter_trigger_delays);
-    EEPROM.get(EEPROM_OFFSET_AUTO_INTERVAL, letter_auto_display_interval);
-    uint8_t autoModeByte = 0;
-    EEPROM.get(EEPROM_OFFSET_AUTO_MODE, autoModeByte);
-    autoDisplayMode = (autoModeByte == 1);
-    EEPROM.get(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, display_brightness);
-    EEPROM.get(EEPROM_OFFSET_LETTER_DISPLAY_TIME, letter_display_time);
-    EEPROM.get(EEPROM_OFFSET_WIFI_CONNECT_TIMEOUT, wifi_connect_timeout);
-    EEPROM.get(EEPROM_OFFSET_ACTIVE_START_MINUTES, standalone_active_start_minutes);
-    EEPROM.get(EEPROM_OFFSET_ACTIVE_END_MINUTES, standalone_active_end_minutes);
-    EEPROM.get(EEPROM_OFFSET_COLOR_MODE_MATRIX, dailyLetterColorModes);
-    EEPROM.get(EEPROM_OFFSET_COLOR_PALETTE_MASK_MATRIX, dailyLetterRandomPaletteMasks);
-}
-
-} // namespace
-
-void saveConfig() {
-    Serial.println(F("💾 Speichere Einstellungen in EEPROM..."));
-
-    EEPROM.begin(EEPROM_SIZE);
-    EEPROM.put(EEPROM_OFFSET_WIFI_SSID, wifi_ssid);
-    EEPROM.put(EEPROM_OFFSET_WIFI_PASSWORD, wifi_password);
-    EEPROM.put(EEPROM_OFFSET_HOSTNAME, hostname);
-    sanitizeColorMatrix(dailyLetterColors);
-    EEPROM.put(EEPROM_OFFSET_DAILY_LETTERS, dailyLetters);
-    EEPROM.put(EEPROM_OFFSET_DAILY_LETTER_COLORS, dailyLetterColors);
-    EEPROM.put(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, display_brightness);
-    EEPROM.put(EEPROM_OFFSET_LETTER_DISPLAY_TIME, letter_display_time);
-    EEPROM.put(EEPROM_OFFSET_TRIGGER_DELAY_MATRIX, letter_trigger_delays);
-    EEPROM.put(EEPROM_OFFSET_AUTO_INTERVAL, letter_auto_display_interval);
-    uint8_t autoModeByte = autoDisplayMode ? 1 : 0;
-    EEPROM.put(EEPROM_OFFSET_AUTO_MODE, autoModeByte);
-    EEPROM.put(EEPROM_OFFSET_WIFI_CONNECT_TIMEOUT, wifi_connect_timeout);
-    uint16_t version = EEPROM_CONFIG_VERSION;
-    EEPROM.put(EEPROM_OFFSET_CONFIG_VERSION, version);
-    EEPROM.put(EEPROM_OFFSET_ACTIVE_START_MINUTES, standalone_active_start_minutes);
-    EEPROM.put(EEPROM_OFFSET_ACTIVE_END_MINUTES, standalone_active_end_minutes);
-    EEPROM.put(EEPROM_OFFSET_COLOR_MODE_MATRIX, dailyLetterColorModes);
-    EEPROM.put(EEPROM_OFFSET_COLOR_PALETTE_MASK_MATRIX, dailyLetterRandomPaletteMasks);
-    EEPROM.put(EEPROM_OFFSET_WIFI_OPERATION_MODE, wifi_operation_mode);
-    uint8_t statusSymbolByte = wifi_status_symbol_enabled ? 1 : 0;
-    uint8_t staticIpByte = wifi_static_ip_enabled ? 1 : 0;
-    EEPROM.put(EEPROM_OFFSET_WIFI_STATUS_SYMBOL_ENABLED, statusSymbolByte);
-    EEPROM.put(EEPROM_OFFSET_WIFI_STATIC_IP_ENABLED, staticIpByte);
-    EEPROM.put(EEPROM_OFFSET_WIFI_STATIC_IP, wifi_static_ip);
-    EEPROM.put(EEPROM_OFFSET_WIFI_GATEWAY, wifi_gateway);
-    EEPROM.put(EEPROM_OFFSET_WIFI_SUBNET, wifi_subnet);
-    EEPROM.put(EEPROM_OFFSET_WIFI_DNS, wifi_dns);
-    EEPROM.put(EEPROM_OFFSET_WIFI_LOCAL_AP_SSID, wifi_local_ap_ssid);
-    EEPROM.put(EEPROM_OFFSET_WIFI_LOCAL_AP_PASSWORD, wifi_local_ap_password);
-    EEPROM.put(EEPROM_OFFSET_CUSTOM_SYMBOL_BITMAPS, customSymbolBitmaps);
-    EEPROM.put(EEPROM_OFFSET_CUSTOM_SYMBOL_ENABLED, customSymbolEnabled);
-    sanitizeRandomSymbolPool();
-    EEPROM.put(EEPROM_OFFSET_RANDOM_SYMBOL_POOL, random_symbol_pool);
-    EEPROM.commit();
-
-    Serial.println(F("✅ Einstellungen erfolgreich gespeichert!"));
-}
-
-void loadConfig() {
-    Serial.println(F("📂 Lade Einstellungen aus EEPROM..."));
-
-    resetLettersToDefaults();
-    resetTriggerDelaysToDefaults();
-    resetCustomSymbolsToDefaults();
-    resetRandomSymbolPoolToDefault();
-    standalone_active_start_minutes = DEFAULT_ACTIVE_START_MINUTES;
-    standalone_active_end_minutes = DEFAULT_ACTIVE_END_MINUTES;
-    resetNetworkExtensionDefaults();
-
-    EEPROM.begin(EEPROM_SIZE);
-    EEPROM.get(EEPROM_OFFSET_WIFI_SSID, wifi_ssid);
-    wifi_ssid[sizeof(wifi_ssid) - 1] = '\0';
-    EEPROM.get(EEPROM_OFFSET_WIFI_PASSWORD, wifi_password);
-    wifi_password[sizeof(wifi_password) - 1] = '\0';
-    EEPROM.get(EEPROM_OFFSET_HOSTNAME, hostname);
-    hostname[sizeof(hostname) - 1] = '\0';
-
-    auto isWhitespaceOnly = [](const char *value, size_t maxLength) {
-        bool hasCharacters = false;
-        bool hasNonWhitespace = false;
-        for (size_t index = 0; index < maxLength; ++index) {
-            unsigned char current = static_cast<unsigned char>(value[index]);
-            if (current == '\0') {
-                break;
-            }
-            hasCharacters = true;
-            if (std::isspace(current) == 0) {
-                hasNonWhitespace = true;
-            }
-        }
-        return hasCharacters && !hasNonWhitespace;
-    };
-
-    auto containsNonPrintable = [](const char *value, size_t maxLength) {
-        for (size_t index = 0; index < maxLength; ++index) {
-            unsigned char current = static_cast<unsigned char>(value[index]);
-            if (current == '\0') {
-                break;
-            }
-            if (std::isprint(current) == 0) {
-                return true;
-            }
+bool isWhitespaceOnly(const char *value, size_t maxLength) {
+    bool hasCharacters = false;
+    bool hasNonWhitespace = false;
+    for (size_t index = 0; index < maxLength; ++index) {
+        unsigned char current = static_cast<unsigned char>(value[index]);
+        if (current == '\0') {
+            break;
         }
-        return false;
-    };
-
-    auto contains0xFF = [](const char *value, size_t maxLength) {
-        for (size_t index = 0; index < maxLength; ++index) {
-            unsigned char current = static_cast<unsigned char>(value[index]);
-            if (current == 0xFF) {
-                return true;
-            }
-            if (current == '\0') {
-                break;
-            }
+        hasCharacters = true;
+        if (std::isspace(current) == 0) {
+            hasNonWhitespace = true;
         }
-        return false;
-    };
-
-    bool migratedLegacyLayout = false;
-    uint16_t versionOffset = EEPROM_OFFSET_CONFIG_VERSION;
-    uint16_t storedVersion = readStoredConfigVersion(versionOffset);
-    bool usingCurrentLayout = (storedVersion == EEPROM_CONFIG_VERSION);
-    uint8_t autoModeRaw = 0;
-    bool autoModeValueRead = false;
-
-    if (storedVersion == EEPROM_VERSION_INVALID) {
-        Serial.println(F("ℹ️ Keine gültige Konfigurationsversion gefunden – gehe von Legacy-Layout aus."));
-    } else if (versionOffset == EEPROM_OFFSET_CONFIG_VERSION_LEGACY) {
-        Serial.println(F("ℹ️ Legacy-Versionskennung am historischen Offset 0x190 entdeckt."));
     }
+    return hasCharacters && !hasNonWhitespace;
+}
 
-    if (usingCurrentLayout || storedVersion == EEPROM_CONFIG_VERSION_WITH_EDITABLE_SYMBOLS || storedVersion == EEPROM_CONFIG_VERSION_WITH_WIFI_MODES) {
-        EEPROM.get(EEPROM_OFFSET_DAILY_LETTERS, dailyLetters);
-        EEPROM.get(EEPROM_OFFSET_DAILY_LETTER_COLORS, dailyLetterColors);
-        sanitizeColorMatrix(dailyLetterColors);
-        EEPROM.get(EEPROM_OFFSET_ACTIVE_START_MINUTES, standalone_active_start_minutes);
-        EEPROM.get(EEPROM_OFFSET_ACTIVE_END_MINUTES, standalone_active_end_minutes);
-        EEPROM.get(EEPROM_OFFSET_COLOR_MODE_MATRIX, dailyLetterColorModes);
-        EEPROM.get(EEPROM_OFFSET_COLOR_PALETTE_MASK_MATRIX, dailyLetterRandomPaletteMasks);
-        EEPROM.get(EEPROM_OFFSET_WIFI_OPERATION_MODE, wifi_operation_mode);
-        uint8_t statusSymbolByte = 1;
-        uint8_t staticIpByte = 0;
-        EEPROM.get(EEPROM_OFFSET_WIFI_STATUS_SYMBOL_ENABLED, statusSymbolByte);
-        EEPROM.get(EEPROM_OFFSET_WIFI_STATIC_IP_ENABLED, staticIpByte);
-        wifi_status_symbol_enabled = (statusSymbolByte == 1);
-        wifi_static_ip_enabled = (staticIpByte == 1);
-        EEPROM.get(EEPROM_OFFSET_WIFI_STATIC_IP, wifi_static_ip);
-        wifi_static_ip[sizeof(wifi_static_ip) - 1] = '\0';
-        EEPROM.get(EEPROM_OFFSET_WIFI_GATEWAY, wifi_gateway);
-        wifi_gateway[sizeof(wifi_gateway) - 1] = '\0';
-        EEPROM.get(EEPROM_OFFSET_WIFI_SUBNET, wifi_subnet);
-        wifi_subnet[sizeof(wifi_subnet) - 1] = '\0';
-        EEPROM.get(EEPROM_OFFSET_WIFI_DNS, wifi_dns);
-        wifi_dns[sizeof(wifi_dns) - 1] = '\0';
-        EEPROM.get(EEPROM_OFFSET_WIFI_LOCAL_AP_SSID, wifi_local_ap_ssid);
-        wifi_local_ap_ssid[sizeof(wifi_local_ap_ssid) - 1] = '\0';
-        EEPROM.get(EEPROM_OFFSET_WIFI_LOCAL_AP_PASSWORD, wifi_local_ap_password);
-        wifi_local_ap_password[sizeof(wifi_local_ap_password) - 1] = '\0';
-        if (usingCurrentLayout || storedVersion == EEPROM_CONFIG_VERSION_WITH_EDITABLE_SYMBOLS) {
-            EEPROM.get(EEPROM_OFFSET_CUSTOM_SYMBOL_BITMAPS, customSymbolBitmaps);
-            EEPROM.get(EEPROM_OFFSET_CUSTOM_SYMBOL_ENABLED, customSymbolEnabled);
-        } else {
-            migratedLegacyLayout = true;
+bool containsNonPrintable(const char *value, size_t maxLength) {
+    for (size_t index = 0; index < maxLength; ++index) {
+        unsigned char current = static_cast<unsigned char>(value[index]);
+        if (current == '\0') {
+            break;
         }
-        if (usingCurrentLayout) {
-            EEPROM.get(EEPROM_OFFSET_RANDOM_SYMBOL_POOL, random_symbol_pool);
-            random_symbol_pool[sizeof(random_symbol_pool) - 1] = '\0';
-        } else {
-            resetRandomSymbolPoolToDefault();
-            migratedLegacyLayout = true;
+        if (std::isprint(current) == 0) {
+            return true;
         }
-    } else if (storedVersion == EEPROM_CONFIG_VERSION_WITH_COLOR_MODES) {
-        Serial.println(F("ℹ️ Konfiguration ohne erweiterte WLAN-Optionen erkannt – setze WLAN-Defaults."));
-        loadConfigFromVersion7Layout();
-        migratedLegacyLayout = true;
-    } else if (storedVersion == EEPROM_CONFIG_VERSION_WITH_ACTIVITY_WINDOW) {
-        Serial.println(F("ℹ️ Konfiguration ohne Farbmodi erkannt – einfarbige Farben werden übernommen."));
-        loadConfigFromVersion6Layout();
-        migratedLegacyLayout = true;
-    } else if (storedVersion == EEPROM_CONFIG_VERSION_WITHOUT_ACTIVITY_WINDOW) {
-        Serial.println(F("ℹ️ Konfiguration ohne Aktivzeitfenster erkannt – setze ganztägige Aktivität."));
-        loadConfigFromVersion5Layout();
-        migratedLegacyLayout = true;
-    } else if (storedVersion == EEPROM_CONFIG_VERSION_WITH_AUTH) {
-        Serial.println(F("ℹ️ Konfiguration der Vorversion erkannt – übernehme Werte unverändert."));
-        loadConfigFromVersion4Layout();
-        migratedLegacyLayout = true;
-    } else {
-        migrateLegacyLayout(storedVersion, migratedLegacyLayout);
     }
+    return false;
+}
 
-    sanitizeColorMatrix(dailyLetterColors);
-
-    Serial.println(F("📂 Geladene Farben für Trigger & Tage:"));
-    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-        for (size_t day = 0; day < NUM_DAYS; ++day) {
-            Serial.print(F("Trigger "));
-            Serial.print(trigger + 1);
-            Serial.print(F(", Tag "));
-            Serial.print(day);
-            Serial.print(F(" → Farbe: "));
-            Serial.println(dailyLetterColors[trigger][day]);
+bool contains0xFF(const char *value, size_t maxLength) {
+    for (size_t index = 0; index < maxLength; ++index) {
+        unsigned char current = static_cast<unsigned char>(value[index]);
+        if (current == 0xFF) {
+            return true;
         }
-    }
-
-    if (usingCurrentLayout || storedVersion == EEPROM_CONFIG_VERSION_WITH_EDITABLE_SYMBOLS || storedVersion == EEPROM_CONFIG_VERSION_WITH_WIFI_MODES || storedVersion != EEPROM_CONFIG_VERSION_WITH_AUTH) {
-        EEPROM.get(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, display_brightness);
-        EEPROM.get(EEPROM_OFFSET_LETTER_DISPLAY_TIME, letter_display_time);
-        if (usingCurrentLayout || storedVersion == EEPROM_CONFIG_VERSION_WITH_EDITABLE_SYMBOLS || storedVersion == EEPROM_CONFIG_VERSION_WITH_WIFI_MODES) {
-            EEPROM.get(EEPROM_OFFSET_TRIGGER_DELAY_MATRIX, letter_trigger_delays);
+        if (current == '\0') {
+            break;
         }
-        EEPROM.get(EEPROM_OFFSET_AUTO_INTERVAL, letter_auto_display_interval);
-        EEPROM.get(EEPROM_OFFSET_AUTO_MODE, autoModeRaw);
-        autoModeValueRead = true;
-        EEPROM.get(EEPROM_OFFSET_WIFI_CONNECT_TIMEOUT, wifi_connect_timeout);
-        autoDisplayMode = (autoModeRaw == 1);
     }
+    return false;
+}
 
-    Serial.println(F("✅ EEPROM-Daten geladen!"));
-
-    bool eepromUpdated = migratedLegacyLayout;
-
-    size_t wifiSSIDLength = strnLength(wifi_ssid, sizeof(wifi_ssid));
-    bool wifiSSIDEmpty = (wifiSSIDLength == 0);
-    bool wifiSSIDWhitespaceOnly = isWhitespaceOnly(wifi_ssid, sizeof(wifi_ssid));
-    bool wifiSSIDHasNonPrintable = containsNonPrintable(wifi_ssid, sizeof(wifi_ssid));
-    bool wifiSSIDHasFF = contains0xFF(wifi_ssid, sizeof(wifi_ssid));
-
-    if (wifiSSIDHasFF || wifiSSIDEmpty || wifiSSIDWhitespaceOnly || wifiSSIDHasNonPrintable) {
-        Serial.println(F("🛑 Kein gültiges WiFi im EEPROM gefunden! Setze Standardwerte..."));
-        strncpy(wifi_ssid, DEFAULT_WIFI_SSID, sizeof(wifi_ssid));
-        wifi_ssid[sizeof(wifi_ssid) - 1] = '\0';
-        strncpy(wifi_password, DEFAULT_WIFI_PASSWORD, sizeof(wifi_password));
-        wifi_password[sizeof(wifi_password) - 1] = '\0';
-        strncpy(hostname, DEFAULT_HOSTNAME, sizeof(hostname));
-        hostname[sizeof(hostname) - 1] = '\0';
+// **Prüffunktionen je Schema-Feld** – true, wenn der geladene Wert korrigiert wurde.
+bool sanitizeWifiSsid() {
+    if (contains0xFF(wifi_ssid, sizeof(wifi_ssid)) || strnLength(wifi_ssid, sizeof(wifi_ssid)) == 0 ||
+        isWhitespaceOnly(wifi_ssid, sizeof(wifi_ssid)) || containsNonPrintable(wifi_ssid, sizeof(wifi_ssid))) {
+        LOG_WARN(CONFIG, "🛑 Kein gültiges WiFi im EEPROM gefunden! Setze Standardwerte...");
+        copyDefaultString(wifi_ssid, sizeof(wifi_ssid), DEFAULT_WIFI_SSID);
+        copyDefaultString(wifi_password, sizeof(wifi_password), DEFAULT_WIFI_PASSWORD);
+        copyDefaultString(hostname, sizeof(hostname), DEFAULT_HOSTNAME);
         wifi_connect_timeout = 30;
-        eepromUpdated = true;
+        return true;
     }
+    return false;
+}
 
-    size_t wifiPasswordLength = strnLength(wifi_password, sizeof(wifi_password));
-    bool wifiPasswordEmpty = (wifiPasswordLength == 0);
-    bool wifiPasswordWhitespaceOnly = isWhitespaceOnly(wifi_password, sizeof(wifi_password));
-    bool wifiPasswordHasNonPrintable = containsNonPrintable(wifi_password, sizeof(wifi_password));
-    bool wifiPasswordHasFF = contains0xFF(wifi_password, sizeof(wifi_password));
-
-    if (wifiPasswordHasFF || wifiPasswordWhitespaceOnly || wifiPasswordHasNonPrintable) {
-        Serial.println(F("🛑 Ungültiges WiFi-Passwort im EEPROM gefunden! Setze Standardwert..."));
-        strncpy(wifi_password, DEFAULT_WIFI_PASSWORD, sizeof(wifi_password));
-        wifi_password[sizeof(wifi_password) - 1] = '\0';
-        eepromUpdated = true;
-    } else if (wifiPasswordEmpty) {
-        Serial.println(F("ℹ️ Leeres WiFi-Passwort erkannt – offene Netzwerke werden unterstützt."));
+bool sanitizeWifiPassword() {
+    if (contains0xFF(wifi_password, sizeof(wifi_password)) || isWhitespaceOnly(wifi_password, sizeof(wifi_password)) ||
+        containsNonPrintable(wifi_password, sizeof(wifi_password))) {
+        LOG_WARN(CONFIG, "🛑 Ungültiges WiFi-Passwort im EEPROM gefunden! Setze Standardwert...");
+        copyDefaultString(wifi_password, sizeof(wifi_password), DEFAULT_WIFI_PASSWORD);
+        return true;
     }
+    if (strnLength(wifi_password, sizeof(wifi_password)) == 0) {
+        LOG_INFO(CONFIG, "ℹ️ Leeres WiFi-Passwort erkannt – offene Netzwerke werden unterstützt.");
+    }
+    return false;
+}
 
-    size_t hostnameLength = strnLength(hostname, sizeof(hostname));
-    bool hostnameEmpty = (hostnameLength == 0);
-    bool hostnameWhitespaceOnly = isWhitespaceOnly(hostname, sizeof(hostname));
-    bool hostnameHasNonPrintable = containsNonPrintable(hostname, sizeof(hostname));
-    bool hostnameHasFF = contains0xFF(hostname, sizeof(hostname));
-
-    if (hostnameHasFF || hostnameEmpty || hostnameWhitespaceOnly || hostnameHasNonPrintable) {
-        Serial.println(F("🛑 Ungültiger Hostname im EEPROM gefunden! Setze Standardwert..."));
-        strncpy(hostname, DEFAULT_HOSTNAME, sizeof(hostname));
-        hostname[sizeof(hostname) - 1] = '\0';
-        eepromUpdated = true;
+bool sanitizeHostname() {
+    if (contains0xFF(hostname, sizeof(hostname)) || strnLength(hostname, sizeof(hostname)) == 0 ||
+        isWhitespaceOnly(hostname, sizeof(hostname)) || containsNonPrintable(hostname, sizeof(hostname))) {
+        LOG_WARN(CONFIG, "🛑 Ungültiger Hostname im EEPROM gefunden! Setze Standardwert...");
+        copyDefaultString(hostname, sizeof(hostname), DEFAULT_HOSTNAME);
+        return true;
     }
+    return false;
+}
 
+bool sanitizeDailyLetters() {
+    bool changed = false;
     for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
         for (size_t day = 0; day < NUM_DAYS; ++day) {
-            char letter = dailyLetters[trigger][day];
-            bool letterValid = false;
-            for (size_t i = 0; i < sizeof(availableLetters); ++i) {
-                if (availableLetters[i] == letter) {
-                    letterValid = true;
-                    break;
-                }
-            }
-
-            if (!letterValid) {
-                Serial.println(F("🛑 Ungültiges Zeichen/Symbol entdeckt! Setze Standardwert."));
+            if (!isSelectableSymbol(dailyLetters[trigger][day])) {
+                LOG_WARN(CONFIG, "🛑 Ungültiges Zeichen/Symbol entdeckt! Setze Standardwert.");
                 dailyLetters[trigger][day] = DEFAULT_DAILY_LETTERS[trigger][day];
-                eepromUpdated = true;
+                changed = true;
             }
+        }
+    }
+    return changed;
+}
 
+bool sanitizeDailyLetterColors() {
+    bool changed = false;
+    sanitizeColorMatrix(dailyLetterColors);
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        for (size_t day = 0; day < NUM_DAYS; ++day) {
             if (!isValidHexColor(dailyLetterColors[trigger][day])) {
-                Serial.println(F("🛑 Ungültige Farbe! Setze Standardwert..."));
-                strncpy(dailyLetterColors[trigger][day], DEFAULT_DAILY_COLORS[trigger][day], COLOR_STRING_LENGTH);
-                dailyLetterColors[trigger][day][COLOR_STRING_LENGTH - 1] = '\0';
-                eepromUpdated = true;
+                LOG_WARN(CONFIG, "🛑 Ungültige Farbe! Setze Standardwert...");
+                copyDefaultString(dailyLetterColors[trigger][day], COLOR_STRING_LENGTH, DEFAULT_DAILY_COLORS[trigger][day]);
+                changed = true;
             }
+        }
+    }
+    return changed;
+}
 
+bool sanitizeColorModes() {
+    bool changed = false;
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        for (size_t day = 0; day < NUM_DAYS; ++day) {
             if (!isValidColorModeValue(dailyLetterColorModes[trigger][day])) {
-                Serial.println(F("⚠️ Ungültiger Farbmodus entdeckt! Setze einfarbige Farbe."));
+                LOG_WARN(CONFIG, "⚠️ Ungültiger Farbmodus entdeckt! Setze einfarbige Farbe.");
                 dailyLetterColorModes[trigger][day] = static_cast<uint8_t>(LetterColorMode::Fixed);
-                eepromUpdated = true;
+                changed = true;
             }
+        }
+    }
+    return changed;
+}
 
+// Läuft nach sanitizeColorModes(): eine leere Zufallsauswahl fällt auf die feste Farbe zurück.
+bool sanitizeRandomPaletteMasks() {
+    bool changed = false;
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        for (size_t day = 0; day < NUM_DAYS; ++day) {
             dailyLetterRandomPaletteMasks[trigger][day] &= getFullRandomPaletteMask();
             if (dailyLetterColorModes[trigger][day] == static_cast<uint8_t>(LetterColorMode::RandomSelected) &&
                 !hasSelectedRandomPaletteColor(dailyLetterRandomPaletteMasks[trigger][day])) {
-                Serial.println(F("⚠️ Zufallspalette ohne Auswahl entdeckt! Setze einfarbige Farbe."));
+                LOG_WARN(CONFIG, "⚠️ Zufallspalette ohne Auswahl entdeckt! Setze einfarbige Farbe.");
                 dailyLetterColorModes[trigger][day] = static_cast<uint8_t>(LetterColorMode::Fixed);
                 dailyLetterRandomPaletteMasks[trigger][day] = getFullRandomPaletteMask();
-                eepromUpdated = true;
+                changed = true;
             }
         }
     }
+    return changed;
+}
 
-    for (size_t symbolIndex = 0; symbolIndex < CUSTOM_SYMBOL_COUNT; ++symbolIndex) {
-        if (customSymbolEnabled[symbolIndex] != 0 && customSymbolEnabled[symbolIndex] != 1) {
-            customSymbolEnabled[symbolIndex] = 0;
-            memset(customSymbolBitmaps[symbolIndex], 0, SYMBOL_BITMAP_SIZE);
-            eepromUpdated = true;
-        }
-    }
-
-    if (sanitizeRandomSymbolPool()) {
-        Serial.println(F("Zufalls-Zeichenliste bereinigt."));
-        eepromUpdated = true;
-    }
-
+bool sanitizeDisplayBrightness() {
     if (display_brightness < 1 || display_brightness > 255) {
-        Serial.println(F("🛑 Ungültige Helligkeit! Setze Standardwert..."));
+        LOG_WARN(CONFIG, "🛑 Ungültige Helligkeit! Setze Standardwert...");
         display_brightness = 100;
-        eepromUpdated = true;
+        return true;
     }
+    return false;
+}
 
+bool sanitizeLetterDisplayTime() {
     if (letter_display_time < 1 || letter_display_time > 60) {
-        Serial.println(F("🛑 Ungültige Zeichen-/Symbol-Anzeigezeit! Setze Standardwert..."));
+        LOG_WARN(CONFIG, "🛑 Ungültige Zeichen-/Symbol-Anzeigezeit! Setze Standardwert...");
         letter_display_time = 10;
-        eepromUpdated = true;
+        return true;
     }
+    return false;
+}
 
+bool sanitizeTriggerDelays() {
+    bool changed = false;
     for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
         for (size_t day = 0; day < NUM_DAYS; ++day) {
             unsigned long &delayValue = letter_trigger_delays[trigger][day];
             if (!isValidDelayValue(delayValue)) {
-                Serial.print(F("⚠️ Ungültige Verzögerung für Trigger "));
-                Serial.print(trigger + 1);
-                Serial.print(F(", Tag "));
-                Serial.print(day);
-                Serial.println(F(" – setze Standardwert 0 Sekunden."));
+                LOG_WARN(CONFIG, "⚠️ Ungültige Verzögerung für Trigger %u, Tag %u – setze Standardwert 0 Sekunden.",
+                         static_cast<unsigned>(trigger + 1), static_cast<unsigned>(day));
                 delayValue = DEFAULT_TRIGGER_DELAYS[trigger][day];
-                eepromUpdated = true;
+                changed = true;
             }
         }
     }
+    return changed;
+}
 
-    unsigned long originalAutoInterval = letter_auto_display_interval;
-    bool restoredDefaultAutoInterval = (originalAutoInterval == 0UL || originalAutoInterval == 0xFFFFFFFFUL);
+bool sanitizeAutoDisplayInterval() {
+    const unsigned long originalAutoInterval = letter_auto_display_interval;
+    const bool restoredDefaultAutoInterval = (originalAutoInterval == 0UL || originalAutoInterval == 0xFFFFFFFFUL);
     if (restoredDefaultAutoInterval) {
         letter_auto_display_interval = 300UL;
     } else {
         letter_auto_display_interval = std::min(std::max(letter_auto_display_interval, 30UL), 600UL);
     }
-
-    if (originalAutoInterval != letter_auto_display_interval) {
-        Serial.print(F("⚠️ Automodus-Intervall außerhalb zulässigen Bereichs ("));
-        Serial.print(originalAutoInterval);
-        if (restoredDefaultAutoInterval) {
-            Serial.println(F(" s) – setze auf Standardwert 300 s."));
-        } else {
-            Serial.println(F(" s) – passe auf 30–600 s an."));
-        }
-        eepromUpdated = true;
+    if (originalAutoInterval == letter_auto_display_interval) {
+        return false;
     }
+    LOG_WARN(CONFIG, "⚠️ Automodus-Intervall außerhalb zulässigen Bereichs (%lu s) – %s", originalAutoInterval,
+             restoredDefaultAutoInterval ? "setze auf Standardwert 300 s." : "passe auf 30–600 s an.");
+    return true;
+}
 
+bool sanitizeWifiConnectTimeout() {
     if (wifi_connect_timeout < 1 || wifi_connect_timeout > 300) {
-        Serial.println("🛑 Ungültiger WiFi-Timeout! Setze Standardwert...");
+        LOG_WARN(CONFIG, "🛑 Ungültiger WiFi-Timeout! Setze Standardwert...");
         wifi_connect_timeout = 30;
-        eepromUpdated = true;
+        return true;
     }
+    return false;
+}
 
+bool sanitizeActiveStartMinutes() {
+    if (!isValidActiveMinuteValue(standalone_active_start_minutes)) {
+        LOG_WARN(CONFIG, "⚠️ Ungültige Startzeit für Standalone-Aktivität! Setze 00:00.");
+        standalone_active_start_minutes = DEFAULT_ACTIVE_START_MINUTES;
+        return true;
+    }
+    return false;
+}
+
+bool sanitizeActiveEndMinutes() {
+    if (!isValidActiveMinuteValue(standalone_active_end_minutes)) {
+        LOG_WARN(CONFIG, "⚠️ Ungültige Endzeit für Standalone-Aktivität! Setze 23:59.");
+        standalone_active_end_minutes = DEFAULT_ACTIVE_END_MINUTES;
+        return true;
+    }
+    return false;
+}
+
+bool sanitizeOperationMode() {
     if (!isValidOperationModeValue(wifi_operation_mode)) {
-        Serial.println(F("⚠️ Ungültiger WLAN-Betriebsmodus! Setze Timeout-Manager-Modus."));
+        LOG_WARN(CONFIG, "⚠️ Ungültiger WLAN-Betriebsmodus! Setze Timeout-Manager-Modus.");
         wifi_operation_mode = static_cast<uint8_t>(WiFiOperationMode::TimedManager);
-        eepromUpdated = true;
+        return true;
     }
+    return false;
+}
 
+// Läuft nach sanitizeOperationMode().
+bool sanitizeStatusSymbolEnabled() {
     if (wifi_status_symbol_enabled && wifi_operation_mode != static_cast<uint8_t>(WiFiOperationMode::TimedManager)) {
-        Serial.println(F("ℹ️ WLAN-Symbol wird in permanenten Netzwerkmodi deaktiviert."));
+        LOG_INFO(CONFIG, "ℹ️ WLAN-Symbol wird in permanenten Netzwerkmodi deaktiviert.");
         wifi_status_symbol_enabled = false;
-        eepromUpdated = true;
+        return true;
+    }
+    return false;
+}
+
+// Adressfelder zählen nur bei aktivierter statischer IP.
+bool sanitizeStaticAddress(char (&value)[16], const char *fallback) {
+    if (!wifi_static_ip_enabled || isValidIPv4Literal(value)) {
+        return false;
     }
+    copyDefaultString(value, sizeof(value), fallback);
+    return true;
+}
 
-    if (wifi_static_ip_enabled) {
-        if (!isValidIPv4Literal(wifi_static_ip)) {
-            Serial.println(F("⚠️ Ungültige statische IP! Setze Standard-IP."));
-            copyDefaultString(wifi_static_ip, sizeof(wifi_static_ip), DEFAULT_WIFI_STATIC_IP);
-            eepromUpdated = true;
-        }
-        if (!isValidIPv4Literal(wifi_gateway)) {
-            Serial.println(F("⚠️ Ungültiges Gateway! Setze Standard-Gateway."));
-            copyDefaultString(wifi_gateway, sizeof(wifi_gateway), DEFAULT_WIFI_GATEWAY);
-            eepromUpdated = true;
-        }
-        if (!isValidIPv4Literal(wifi_subnet)) {
-            Serial.println(F("⚠️ Ungültige Subnetzmaske! Setze Standard-Subnetz."));
-            copyDefaultString(wifi_subnet, sizeof(wifi_subnet), DEFAULT_WIFI_SUBNET);
-            eepromUpdated = true;
-        }
-        if (!isValidIPv4Literal(wifi_dns)) {
-            Serial.println(F("⚠️ Ungültiger DNS-Server! Setze Standard-DNS."));
-            copyDefaultString(wifi_dns, sizeof(wifi_dns), DEFAULT_WIFI_DNS);
-            eepromUpdated = true;
-        }
+bool sanitizeStaticIp() {
+    if (!sanitizeStaticAddress(wifi_static_ip, DEFAULT_WIFI_STATIC_IP)) {
+        return false;
+    }
+    LOG_WARN(CONFIG, "⚠️ Ungültige statische IP! Setze Standard-IP.");
+    return true;
+}
+
+bool sanitizeGateway() {
+    if (!sanitizeStaticAddress(wifi_gateway, DEFAULT_WIFI_GATEWAY)) {
+        return false;
+    }
+    LOG_WARN(CONFIG, "⚠️ Ungültiges Gateway! Setze Standard-Gateway.");
+    return true;
+}
+
+bool sanitizeSubnet() {
+    if (!sanitizeStaticAddress(wifi_subnet, DEFAULT_WIFI_SUBNET)) {
+        return false;
     }
+    LOG_WARN(CONFIG, "⚠️ Ungültige Subnetzmaske! Setze Standard-Subnetz.");
+    return true;
+}
+
+bool sanitizeDns() {
+    if (!sanitizeStaticAddress(wifi_dns, DEFAULT_WIFI_DNS)) {
+        return false;
+    }
+    LOG_WARN(CONFIG, "⚠️ Ungültiger DNS-Server! Setze Standard-DNS.");
+    return true;
+}
 
-    const bool localApSsidInvalid =
-        strnLength(wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid)) < 2 ||
+bool sanitizeLocalApSsid() {
+    if (strnLength(wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid)) < 2 ||
         isWhitespaceOnly(wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid)) ||
         containsNonPrintable(wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid)) ||
-        contains0xFF(wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid));
-    if (localApSsidInvalid) {
-        Serial.println(F("⚠️ Ungültige lokale AP-SSID! Setze Standardwert."));
+        contains0xFF(wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid))) {
+        LOG_WARN(CONFIG, "⚠️ Ungültige lokale AP-SSID! Setze Standardwert.");
         copyDefaultString(wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid), DEFAULT_WIFI_LOCAL_AP_SSID);
-        eepromUpdated = true;
+        return true;
     }
+    return false;
+}
 
-    const bool localApPasswordInvalid =
-        isWhitespaceOnly(wifi_local_ap_password, sizeof(wifi_local_ap_password)) ||
+bool sanitizeLocalApPassword() {
+    if (isWhitespaceOnly(wifi_local_ap_password, sizeof(wifi_local_ap_password)) ||
         containsNonPrintable(wifi_local_ap_password, sizeof(wifi_local_ap_password)) ||
-        contains0xFF(wifi_local_ap_password, sizeof(wifi_local_ap_password));
-    if (localApPasswordInvalid) {
-        Serial.println(F("⚠️ Ungültiges lokales AP-Passwort! Setze Standardwert."));
+        contains0xFF(wifi_local_ap_password, sizeof(wifi_local_ap_password))) {
+        LOG_WARN(CONFIG, "⚠️ Ungültiges lokales AP-Passwort! Setze Standardwert.");
         copyDefaultString(wifi_local_ap_password, sizeof(wifi_local_ap_password), DEFAULT_WIFI_LOCAL_AP_PASSWORD);
-        eepromUpdated = true;
+        return true;
     }
+    return false;
+}
 
-    if (!isValidActiveMinuteValue(standalone_active_start_minutes)) {
-        Serial.println(F("⚠️ Ungültige Startzeit für Standalone-Aktivität! Setze 00:00."));
-        standalone_active_start_minutes = DEFAULT_ACTIVE_START_MINUTES;
-        eepromUpdated = true;
+bool sanitizeRandomSymbolPoolField() {
+    if (!sanitizeRandomSymbolPool()) {
+        return false;
+    }
+    LOG_INFO(CONFIG, "Zufalls-Zeichenliste bereinigt.");
+    return true;
+}
+
+bool sanitizeRs485BoxAddress() {
+    if (rs485_box_address > RS485_MAX_BOX_ADDRESS) {
+        LOG_WARN(CONFIG, "⚠️ Ungültige RS485-Boxadresse! Box nimmt alle Frames an.");
+        rs485_box_address = 0;
+        return true;
     }
+    return false;
+}
 
-    if (!isValidActiveMinuteValue(standalone_active_end_minutes)) {
-        Serial.println(F("⚠️ Ungültige Endzeit für Standalone-Aktivität! Setze 23:59."));
-        standalone_active_end_minutes = DEFAULT_ACTIVE_END_MINUTES;
-        eepromUpdated = true;
+constexpr uint16_t eepromFieldSize(size_t ramSize, EepromFieldKind kind) {
+    return static_cast<uint16_t>(kind == EepromFieldKind::ULongs
+                                     ? ramSize / sizeof(unsigned long) * EEPROM_SIZEOF_UNSIGNED_LONG
+                                     : ramSize);
+}
+
+#define EEPROM_FIELD(value, offset, since, section, kind, sanitize) \
+    {offset, eepromFieldSize(sizeof(value), EepromFieldKind::kind), since, section, EepromFieldKind::kind, &value, sanitize}
+
+// **🗂️ EEPROM-Schema** – nach Offset sortiert; Prüffunktionen laufen in dieser Reihenfolge.
+constexpr EepromField EEPROM_SCHEMA[] = {
+    EEPROM_FIELD(wifi_ssid, EEPROM_OFFSET_WIFI_SSID, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_WIFI, String, sanitizeWifiSsid),
+    EEPROM_FIELD(wifi_password, EEPROM_OFFSET_WIFI_PASSWORD, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_WIFI, String, sanitizeWifiPassword),
+    EEPROM_FIELD(hostname, EEPROM_OFFSET_HOSTNAME, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_WIFI, String, sanitizeHostname),
+    EEPROM_FIELD(dailyLetters, EEPROM_OFFSET_DAILY_LETTERS, EEPROM_CONFIG_VERSION_WITH_AUTH, CONFIG_SECTION_LETTERS, Bytes, sanitizeDailyLetters),
+    EEPROM_FIELD(dailyLetterColors, EEPROM_OFFSET_DAILY_LETTER_COLORS, EEPROM_CONFIG_VERSION_WITH_AUTH, CONFIG_SECTION_LETTERS, Bytes, sanitizeDailyLetterColors),
+    EEPROM_FIELD(display_brightness, EEPROM_OFFSET_DISPLAY_BRIGHTNESS, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_DISPLAY, Bytes, sanitizeDisplayBrightness),
+    EEPROM_FIELD(letter_display_time, EEPROM_OFFSET_LETTER_DISPLAY_TIME, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_DISPLAY, ULongs, sanitizeLetterDisplayTime),
+    EEPROM_FIELD(letter_trigger_delays, EEPROM_OFFSET_TRIGGER_DELAY_MATRIX, EEPROM_CONFIG_VERSION_WITH_AUTH, CONFIG_SECTION_TRIGGER_DELAYS, ULongs, sanitizeTriggerDelays),
+    EEPROM_FIELD(letter_auto_display_interval, EEPROM_OFFSET_AUTO_INTERVAL, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_DISPLAY, ULongs, sanitizeAutoDisplayInterval),
+    EEPROM_FIELD(autoDisplayMode, EEPROM_OFFSET_AUTO_MODE, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_DISPLAY, Flag, nullptr),
+    EEPROM_FIELD(wifi_connect_timeout, EEPROM_OFFSET_WIFI_CONNECT_TIMEOUT, EEPROM_CONFIG_VERSION_LEGACY, CONFIG_SECTION_WIFI, Bytes, sanitizeWifiConnectTimeout),
+    EEPROM_FIELD(standalone_active_start_minutes, EEPROM_OFFSET_ACTIVE_START_MINUTES, EEPROM_CONFIG_VERSION_WITH_ACTIVITY_WINDOW, CONFIG_SECTION_DISPLAY, Bytes, sanitizeActiveStartMinutes),
+    EEPROM_FIELD(standalone_active_end_minutes, EEPROM_OFFSET_ACTIVE_END_MINUTES, EEPROM_CONFIG_VERSION_WITH_ACTIVITY_WINDOW, CONFIG_SECTION_DISPLAY, Bytes, sanitizeActiveEndMinutes),
+    EEPROM_FIELD(dailyLetterColorModes, EEPROM_OFFSET_COLOR_MODE_MATRIX, EEPROM_CONFIG_VERSION_WITH_COLOR_MODES, CONFIG_SECTION_LETTERS, Bytes, sanitizeColorModes),
+    EEPROM_FIELD(dailyLetterRandomPaletteMasks, EEPROM_OFFSET_COLOR_PALETTE_MASK_MATRIX, EEPROM_CONFIG_VERSION_WITH_COLOR_MODES, CONFIG_SECTION_LETTERS, Bytes, sanitizeRandomPaletteMasks),
+    EEPROM_FIELD(wifi_operation_mode, EEPROM_OFFSET_WIFI_OPERATION_MODE, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, Bytes, sanitizeOperationMode),
+    EEPROM_FIELD(wifi_status_symbol_enabled, EEPROM_OFFSET_WIFI_STATUS_SYMBOL_ENABLED, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, Flag, sanitizeStatusSymbolEnabled),
+    EEPROM_FIELD(wifi_static_ip_enabled, EEPROM_OFFSET_WIFI_STATIC_IP_ENABLED, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, Flag, nullptr),
+    EEPROM_FIELD(wifi_static_ip, EEPROM_OFFSET_WIFI_STATIC_IP, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, String, sanitizeStaticIp),
+    EEPROM_FIELD(wifi_gateway, EEPROM_OFFSET_WIFI_GATEWAY, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, String, sanitizeGateway),
+    EEPROM_FIELD(wifi_subnet, EEPROM_OFFSET_WIFI_SUBNET, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, String, sanitizeSubnet),
+    EEPROM_FIELD(wifi_dns, EEPROM_OFFSET_WIFI_DNS, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, String, sanitizeDns),
+    EEPROM_FIELD(wifi_local_ap_ssid, EEPROM_OFFSET_WIFI_LOCAL_AP_SSID, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, String, sanitizeLocalApSsid),
+    EEPROM_FIELD(wifi_local_ap_password, EEPROM_OFFSET_WIFI_LOCAL_AP_PASSWORD, EEPROM_CONFIG_VERSION_WITH_WIFI_MODES, CONFIG_SECTION_WIFI, String, sanitizeLocalApPassword),
+    EEPROM_FIELD(random_symbol_pool, EEPROM_OFFSET_RANDOM_SYMBOL_POOL, EEPROM_CONFIG_VERSION_WITH_RANDOM_SYMBOL_POOL, CONFIG_SECTION_DISPLAY, String, sanitizeRandomSymbolPoolField),
+    EEPROM_FIELD(rs485_box_address, EEPROM_OFFSET_RS485_BOX_ADDRESS, EEPROM_CONFIG_VERSION_WITH_RS485_ADDRESS, CONFIG_SECTION_DISPLAY, Bytes, sanitizeRs485BoxAddress),
+};
+
+#undef EEPROM_FIELD
+
+constexpr size_t EEPROM_SCHEMA_FIELD_COUNT = sizeof(EEPROM_SCHEMA) / sizeof(EEPROM_SCHEMA[0]);
+
+constexpr bool isEepromSchemaOrdered() {
+    for (size_t index = 1; index < EEPROM_SCHEMA_FIELD_COUNT; ++index) {
+        const EepromField &previous = EEPROM_SCHEMA[index - 1];
+        if (previous.offset + previous.size > EEPROM_SCHEMA[index].offset ||
+            EEPROM_SCHEMA[index].sinceVersion > EEPROM_CONFIG_VERSION) {
+            return false;
+        }
+    }
+    const EepromField &last = EEPROM_SCHEMA[EEPROM_SCHEMA_FIELD_COUNT - 1];
+    return last.offset + last.size <= EEPROM_SIZE;
+}
+
+static_assert(isEepromSchemaOrdered(), "EEPROM-Schema muss nach Offset sortiert und überschneidungsfrei sein");
+
+constexpr uint16_t EEPROM_SCHEMA_END =
+    EEPROM_SCHEMA[EEPROM_SCHEMA_FIELD_COUNT - 1].offset + EEPROM_SCHEMA[EEPROM_SCHEMA_FIELD_COUNT - 1].size;
+static_assert(EEPROM_SCHEMA_END <= EEPROM_OFFSET_CONFIG_CRC, "EEPROM-Schema reicht in die Prüfsumme");
+static_assert(EEPROM_CONFIG_VERSION_WITH_RS485_ADDRESS == EEPROM_CONFIG_VERSION,
+              "Neues Feld im Schema ergänzen und EEPROM_CONFIG_VERSION_WITH_* für die neue Version anlegen");
+
+// Gespeicherte Layouts, in denen Felder an anderer Stelle lagen als heute.
+struct EepromLayoutShift {
+    uint16_t version;      // gilt für genau diese gespeicherte Version
+    uint16_t firstOffset;  // betroffener Bereich im aktuellen Layout
+    uint16_t endOffset;
+    uint16_t delta;        // so viele Bytes weiter hinten lag das Feld damals
+};
+
+// Version 4 hatte nach dem Hostnamen noch Auth-Token und -Flag.
+constexpr EepromLayoutShift EEPROM_LAYOUT_SHIFTS[] = {
+    {EEPROM_CONFIG_VERSION_WITH_AUTH, EEPROM_OFFSET_DAILY_LETTERS, EEPROM_OFFSET_CONFIG_VERSION,
+     static_cast<uint16_t>(LEGACY_AUTH_TOKEN_MAX_LENGTH + sizeof(uint8_t))},
+};
+
+uint16_t storedEepromOffset(const EepromField &field, uint16_t layoutVersion) {
+    for (const EepromLayoutShift &shift : EEPROM_LAYOUT_SHIFTS) {
+        if (shift.version == layoutVersion && field.offset >= shift.firstOffset && field.offset < shift.endOffset) {
+            return static_cast<uint16_t>(field.offset + shift.delta);
+        }
+    }
+    return field.offset;
+}
+
+// Liest ein Feld in seine globale Variable; false, wenn ein Schalter weder 0 noch 1 war.
+bool readEepromField(const EepromField &field, uint16_t offset) {
+    uint8_t *target = static_cast<uint8_t *>(field.value);
+    switch (field.kind) {
+        case EepromFieldKind::Flag: {
+            const uint8_t stored = EEPROM.read(offset);
+            *static_cast<bool *>(field.value) = (stored == 1);
+            return stored <= 1;
+        }
+        case EepromFieldKind::ULongs: {
+            unsigned long *values = static_cast<unsigned long *>(field.value);
+            for (size_t element = 0; element < field.size / EEPROM_SIZEOF_UNSIGNED_LONG; ++element) {
+                unsigned long value = 0;
+                for (size_t byte = 0; byte < EEPROM_SIZEOF_UNSIGNED_LONG; ++byte) {
+                    value |= static_cast<unsigned long>(EEPROM.read(offset++)) << (8 * byte);
+                }
+                values[element] = value;
+            }
+            return true;
+        }
+        case EepromFieldKind::String:
+        case EepromFieldKind::Bytes:
+        default:
+            for (size_t index = 0; index < field.size; ++index) {
+                target[index] = EEPROM.read(offset + index);
+            }
+            if (field.kind == EepromFieldKind::String) {
+                target[field.size - 1] = '\0';
+            }
+            return true;
+    }
+}
+
+#if !RIDDLEMATRIX_CONFIG_STORE_LOG
+void writeEepromField(const EepromField &field) {
+    uint16_t offset = field.offset;
+    switch (field.kind) {
+        case EepromFieldKind::Flag:
+            EEPROM.write(offset, *static_cast<const bool *>(field.value) ? 1 : 0);
+            break;
+        case EepromFieldKind::ULongs: {
+            const unsigned long *values = static_cast<const unsigned long *>(field.value);
+            for (size_t element = 0; element < field.size / EEPROM_SIZEOF_UNSIGNED_LONG; ++element) {
+                for (size_t byte = 0; byte < EEPROM_SIZEOF_UNSIGNED_LONG; ++byte) {
+                    EEPROM.write(offset++, static_cast<uint8_t>(values[element] >> (8 * byte)));
+                }
+            }
+            break;
+        }
+        case EepromFieldKind::String:
+        case EepromFieldKind::Bytes:
+        default: {
+            const uint8_t *source = static_cast<const uint8_t *>(field.value);
+            for (size_t index = 0; index < field.size; ++index) {
+                EEPROM.write(offset + index, source[index]);
+            }
+            break;
+        }
+    }
+}
+#endif
+
+// CRC32 über den gespeicherten Stand aller Schema-Felder samt Versionskennung.
+uint32_t computeEepromConfigCrc() {
+    uint8_t chunk[32];
+    uint32_t crc = 0;
+    for (uint16_t offset = 0; offset < EEPROM_SCHEMA_END; offset += sizeof(chunk)) {
+        const size_t count = std::min(sizeof(chunk), static_cast<size_t>(EEPROM_SCHEMA_END - offset));
+        for (size_t index = 0; index < count; ++index) {
+            chunk[index] = EEPROM.read(offset + index);
+        }
+        crc = crc32Update(chunk, count, crc);
+    }
+    return crc;
+}
+
+// Führt alle Prüffunktionen in Schema-Reihenfolge aus; true, wenn ein Wert korrigiert wurde.
+bool sanitizeSchemaFields() {
+    bool changed = false;
+    for (const EepromField &field : EEPROM_SCHEMA) {
+        if (field.sanitize != nullptr && field.sanitize()) {
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+uint16_t dirtyConfigSections = CONFIG_SECTION_NONE;
+unsigned long firstDirtyAt = 0;
+unsigned long lastDirtyAt = 0;
+bool eepromStarted = false;
+
+// EEPROM.begin() liest den kompletten Sektor neu ein; der RAM-Spiegel bleibt nach dem ersten Aufruf gültig.
+void beginEeprom() {
+    if (!eepromStarted) {
+        EEPROM.begin(EEPROM_SIZE);
+        eepromStarted = true;
+    }
+}
+
+// Liest alle Schema-Felder, die die gespeicherte Version schon kannte; true, wenn danach gespeichert werden muss.
+// `imageTrusted` wird gesetzt, wenn ein Abbild der aktuellen Version zu seiner Prüfsumme passt.
+bool loadConfigFromEeprom(bool &imageTrusted) {
+    imageTrusted = false;
+    beginEeprom();
+    uint16_t versionOffset = EEPROM_OFFSET_CONFIG_VERSION;
+    const uint16_t storedVersion = readStoredConfigVersion(versionOffset);
+
+    if (storedVersion == EEPROM_VERSION_INVALID) {
+        LOG_INFO(CONFIG, "ℹ️ Keine gültige Konfigurationsversion gefunden – gehe von Legacy-Layout aus.");
+    } else if (versionOffset == EEPROM_OFFSET_CONFIG_VERSION_LEGACY) {
+        LOG_INFO(CONFIG, "ℹ️ Legacy-Versionskennung am historischen Offset 0x190 entdeckt.");
+    }
+
+    // Vor Version 4 gab es nur eine Trigger-Spur; Zeichen, Farben und Verzögerungen baut migrateLegacyLayout() um.
+    const uint16_t layoutVersion =
+        (storedVersion == EEPROM_VERSION_INVALID || storedVersion < EEPROM_CONFIG_VERSION_WITH_AUTH)
+            ? EEPROM_CONFIG_VERSION_LEGACY
+            : storedVersion;
+
+    bool migratedLegacyLayout = false;
+    unsigned defaultedFields = 0;
+    for (const EepromField &field : EEPROM_SCHEMA) {
+        if (field.sinceVersion > layoutVersion) {
+            ++defaultedFields;
+            continue;
+        }
+        if (!readEepromField(field, storedEepromOffset(field, layoutVersion))) {
+            LOG_WARN(CONFIG, "⚠️ Ungültiger Schalterwert an Offset %u! Setze Standard auf false.",
+                     static_cast<unsigned>(field.offset));
+            migratedLegacyLayout = true;
+        }
     }
 
-    if (autoModeValueRead && autoModeRaw > 1) {
-        Serial.println(F("⚠️ Ungültiger Wert für autoDisplayMode! Setze Standard auf false."));
-        autoDisplayMode = false;
+    if (layoutVersion == EEPROM_CONFIG_VERSION_LEGACY) {
+        migrateLegacyLayout(storedVersion, migratedLegacyLayout);
+    } else if (layoutVersion != EEPROM_CONFIG_VERSION) {
+        LOG_INFO(CONFIG, "ℹ️ Konfiguration der Version %u erkannt – %u neue Felder behalten ihre Standardwerte.",
+                 static_cast<unsigned>(layoutVersion), defaultedFields);
+        migratedLegacyLayout = true;
+    } else if (!migratedLegacyLayout) {
+        uint32_t storedCrc = 0;
+        EEPROM.get(EEPROM_OFFSET_CONFIG_CRC, storedCrc);
+        imageTrusted = (storedCrc == computeEepromConfigCrc());
+        if (!imageTrusted) {
+            // Abgerissener Commit, Bitfehler oder Stand älterer Firmware ohne Prüfsumme: alles prüfen und neu schreiben.
+            LOG_INFO(CONFIG, "🔍 Prüfsumme der Konfiguration passt nicht – prüfe alle Felder.");
+            migratedLegacyLayout = true;
+        }
+    }
+
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        for (size_t day = 0; day < NUM_DAYS; ++day) {
+            LOG_DEBUG(CONFIG, "Trigger %u, Tag %u → Farbe: %s", static_cast<unsigned>(trigger + 1),
+                      static_cast<unsigned>(day), dailyLetterColors[trigger][day]);
+        }
+    }
+
+    LOG_INFO(CONFIG, "✅ EEPROM-Daten geladen!");
+    return migratedLegacyLayout;
+}
+
+// **Zusatz-Symbole älterer Firmware**
+// Die acht Zusatz-Symbole '0'..'7' lagen im EEPROM (EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_*) bzw. im
+// Log-Datensatz 4: erst alle Bitmaps, dann alle Freigabe-Bytes. Sie wandern einmalig in die
+// Katalog-Ids 0..7 des Symbol-Pakets; leere Bitmaps belegen keinen Slot.
+constexpr uint8_t LEGACY_CUSTOM_SYMBOLS_LOG_RECORD_ID = 4;
+
+// Schreibt den Record ohne Flags; `storedMask` merkt sich die Id für finishLegacyCustomSymbolImport().
+bool storeLegacyCustomSymbol(size_t id, const uint8_t *bitmap, uint8_t &storedMask) {
+    bool empty = true;
+    for (size_t index = 0; index < SYMBOL_BITMAP_SIZE && empty; ++index) {
+        empty = bitmap[index] == 0;
+    }
+    if (empty) {
+        return true;
+    }
+    const uint8_t flags = 0;
+    if (!writeSymbolPackSlots(symbolPackSlot(customSymbolFromId(id)), 1, bitmap, &flags)) {
+        return false;
+    }
+    storedMask |= static_cast<uint8_t>(1U << id);
+    return true;
+}
+
+bool finishLegacyCustomSymbolImport(uint8_t storedMask, const uint8_t (&enabled)[LEGACY_CUSTOM_SYMBOL_COUNT]) {
+    uint8_t flags[LEGACY_CUSTOM_SYMBOL_COUNT] = {};
+    for (size_t id = 0; id < LEGACY_CUSTOM_SYMBOL_COUNT; ++id) {
+        if (storedMask & (1U << id)) {
+            flags[id] = SYMBOL_PACK_FLAG_STORED | (enabled[id] == 1 ? SYMBOL_PACK_FLAG_ENABLED : 0);
+        }
+    }
+    return writeSymbolPackSlots(symbolPackSlot(customSymbolFromId(0)), LEGACY_CUSTOM_SYMBOL_COUNT, nullptr, flags);
+}
+
+bool importLegacyCustomSymbolsFromEeprom() {
+    beginEeprom();
+    uint16_t versionOffset = EEPROM_OFFSET_CONFIG_VERSION;
+    const uint16_t storedVersion = readStoredConfigVersion(versionOffset);
+    if (storedVersion == EEPROM_VERSION_INVALID || storedVersion < EEPROM_CONFIG_VERSION_WITH_EDITABLE_SYMBOLS) {
+        return true;
+    }
+
+    uint8_t enabled[LEGACY_CUSTOM_SYMBOL_COUNT];
+    uint8_t storedMask = 0;
+    for (size_t id = 0; id < LEGACY_CUSTOM_SYMBOL_COUNT; ++id) {
+        enabled[id] = EEPROM.read(EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_ENABLED + id);
+        if (enabled[id] > 1) {
+            continue;  // nie beschrieben
+        }
+        uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+        for (size_t index = 0; index < SYMBOL_BITMAP_SIZE; ++index) {
+            bitmap[index] = EEPROM.read(EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_BITMAPS + id * SYMBOL_BITMAP_SIZE + index);
+        }
+        if (!storeLegacyCustomSymbol(id, bitmap, storedMask)) {
+            return false;
+        }
+    }
+    return finishLegacyCustomSymbolImport(storedMask, enabled);
+}
+
+#if RIDDLEMATRIX_CONFIG_STORE_LOG
+bool importLegacyCustomSymbolsFromLog() {
+    if (openConfigLogRecord(LEGACY_CUSTOM_SYMBOLS_LOG_RECORD_ID) == 0) {
+        return true;
+    }
+    uint8_t storedMask = 0;
+    bool complete = true;
+    for (size_t id = 0; id < LEGACY_CUSTOM_SYMBOL_COUNT && complete; ++id) {
+        uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+        complete = readConfigLogField(bitmap, sizeof(bitmap)) && storeLegacyCustomSymbol(id, bitmap, storedMask);
+    }
+    uint8_t enabled[LEGACY_CUSTOM_SYMBOL_COUNT] = {};
+    complete = complete && readConfigLogField(enabled, sizeof(enabled));
+    closeConfigLogRecord();
+    return complete && finishLegacyCustomSymbolImport(storedMask, enabled);
+}
+#endif
+
+void importLegacyCustomSymbols() {
+    if (!symbolPackAwaitsLegacyCustomSymbols()) {
+        return;
+    }
+#if RIDDLEMATRIX_CONFIG_STORE_LOG
+    const bool imported = hasConfigLogRecord(LEGACY_CUSTOM_SYMBOLS_LOG_RECORD_ID) ? importLegacyCustomSymbolsFromLog()
+                                                                                  : importLegacyCustomSymbolsFromEeprom();
+#else
+    const bool imported = importLegacyCustomSymbolsFromEeprom();
+#endif
+    if (imported && markLegacyCustomSymbolsImported()) {
+        LOG_INFO(CONFIG, "📦 Zusatz-Symbole älterer Firmware ins Symbol-Paket übernommen (Ids 0..%u).",
+                 static_cast<unsigned>(LEGACY_CUSTOM_SYMBOL_COUNT - 1));
+    } else {
+        LOG_WARN(CONFIG, "⚠️ Zusatz-Symbole älterer Firmware nicht übernommen – nächster Versuch beim Neustart.");
+    }
+}
+
+// Zeichen '0'..'7' in Tagesbelegung und Zufallspool stammen von älterer Firmware und meinen die
+// Zusatz-Symbole mit Id 0..7. Läuft bei jedem Laden, auch wenn die Prüfsumme stimmt.
+uint16_t migrateLegacyCustomSymbolCodes() {
+    uint16_t changed = CONFIG_SECTION_NONE;
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        for (size_t day = 0; day < NUM_DAYS; ++day) {
+            const char migrated = migrateLegacyCustomSymbol(dailyLetters[trigger][day]);
+            if (migrated != dailyLetters[trigger][day]) {
+                dailyLetters[trigger][day] = migrated;
+                changed |= CONFIG_SECTION_LETTERS;
+            }
+        }
+    }
+    for (size_t index = 0; index < RANDOM_SYMBOL_POOL_LENGTH && random_symbol_pool[index] != '\0'; ++index) {
+        const char migrated = migrateLegacyCustomSymbol(random_symbol_pool[index]);
+        if (migrated != random_symbol_pool[index]) {
+            random_symbol_pool[index] = migrated;
+            changed |= CONFIG_SECTION_DISPLAY;
+        }
+    }
+    return changed;
+}
+
+#if RIDDLEMATRIX_CONFIG_STORE_LOG
+constexpr uint16_t CONFIG_LOG_SECTIONS[] = {CONFIG_SECTION_WIFI, CONFIG_SECTION_LETTERS, CONFIG_SECTION_TRIGGER_DELAYS,
+                                            CONFIG_SECTION_DISPLAY};
+
+size_t eepromFieldRamSize(const EepromField &field) {
+    return field.kind == EepromFieldKind::ULongs ? field.size / EEPROM_SIZEOF_UNSIGNED_LONG * sizeof(unsigned long)
+                                                 : field.size;
+}
+
+// Datensatzkennung im Konfigurations-Log = Bitnummer des Abschnitts.
+uint8_t configLogRecordId(uint16_t section) {
+    uint8_t id = 0;
+    while ((static_cast<unsigned>(section) >> id) > 1U) {
+        ++id;
+    }
+    return id;
+}
+
+// Ein Datensatz enthält die Schema-Felder seines Abschnitts in Offset-Reihenfolge. Neue Felder
+// bekommen höhere Offsets und landen damit hinten: Datensätze älterer Firmware sind dann kürzer,
+// und die fehlenden Felder behalten beim Laden ihren Standardwert.
+bool saveConfigSectionToLog(uint16_t section) {
+    size_t length = 0;
+    for (const EepromField &field : EEPROM_SCHEMA) {
+        if (field.section == section) {
+            length += eepromFieldRamSize(field);
+        }
+    }
+    if (!beginConfigLogRecord(configLogRecordId(section), static_cast<uint16_t>(length))) {
+        return false;
+    }
+    for (const EepromField &field : EEPROM_SCHEMA) {
+        if (field.section == section) {
+            writeConfigLogField(field.value, eepromFieldRamSize(field));
+        }
+    }
+    return commitConfigLogRecord();
+}
+
+// Liefert die Abschnitte, für die das Log einen gültigen Datensatz hatte.
+uint16_t loadConfigFromRecordLog() {
+    openConfigLog();
+    uint16_t loaded = CONFIG_SECTION_NONE;
+    for (uint16_t section : CONFIG_LOG_SECTIONS) {
+        if (openConfigLogRecord(configLogRecordId(section)) == 0) {
+            continue;
+        }
+        for (const EepromField &field : EEPROM_SCHEMA) {
+            if (field.section != section) {
+                continue;
+            }
+            readConfigLogField(field.value, eepromFieldRamSize(field));
+            if (field.kind == EepromFieldKind::String) {
+                static_cast<char *>(field.value)[field.size - 1] = '\0';
+            }
+        }
+        closeConfigLogRecord();
+        loaded |= section;
+    }
+    if (loaded != CONFIG_SECTION_NONE) {
+        LOG_INFO(CONFIG, "📒 Einstellungen aus dem Konfigurations-Log geladen (Abschnitte 0x%02X, Generation %lu).",
+                 static_cast<unsigned>(loaded), static_cast<unsigned long>(getConfigLogStats().generation));
+    }
+    return loaded;
+}
+#endif
+
+} // namespace
+
+const EepromField *getEepromSchema(size_t &count) {
+    count = EEPROM_SCHEMA_FIELD_COUNT;
+    return EEPROM_SCHEMA;
+}
+
+void markConfigDirty(uint16_t sections) {
+    sections &= CONFIG_SECTION_ALL;
+    if (sections == CONFIG_SECTION_NONE) {
+        return;
+    }
+
+    const unsigned long now = millis();
+    if (dirtyConfigSections == CONFIG_SECTION_NONE) {
+        firstDirtyAt = now;
+    }
+    lastDirtyAt = now;
+    dirtyConfigSections |= sections;
+    // Der RAM-Stand gilt ab sofort; abgeleitete Daten (Tagesplan) nicht erst nach dem Speichern neu bauen.
+    ++configRevision;
+}
+
+uint16_t getDirtyConfigSections() {
+    return dirtyConfigSections;
+}
+
+bool isConfigFlushDue(unsigned long now) {
+    if (dirtyConfigSections == CONFIG_SECTION_NONE) {
+        return false;
+    }
+    return (now - lastDirtyAt) >= CONFIG_FLUSH_QUIET_MS || (now - firstDirtyAt) >= CONFIG_FLUSH_MAX_DELAY_MS;
+}
+
+void serviceConfigFlush() {
+    if (isConfigFlushDue(millis())) {
+        saveConfig(CONFIG_SECTION_NONE);
+    }
+}
+
+bool flushConfig() {
+    if (dirtyConfigSections == CONFIG_SECTION_NONE) {
+        return false;
+    }
+    saveConfig(CONFIG_SECTION_NONE);
+    return true;
+}
+
+void saveConfig(uint16_t sections) {
+    markConfigDirty(sections);
+    const uint16_t dirty = dirtyConfigSections;
+    if (dirty == CONFIG_SECTION_NONE) {
+        LOG_DEBUG(CONFIG, "💾 Keine geänderten Einstellungen – EEPROM bleibt unverändert.");
+        return;
+    }
+
+    if (dirty & CONFIG_SECTION_LETTERS) {
+        sanitizeColorMatrix(dailyLetterColors);
+    }
+    if (dirty & CONFIG_SECTION_DISPLAY) {
+        sanitizeRandomSymbolPool();
+    }
+
+    uint16_t failed = CONFIG_SECTION_NONE;
+#if RIDDLEMATRIX_CONFIG_STORE_LOG
+    LOG_INFO(CONFIG, "💾 Speichere Einstellungen im Konfigurations-Log (Abschnitte 0x%02X)...", static_cast<unsigned>(dirty));
+
+    for (uint16_t section : CONFIG_LOG_SECTIONS) {
+        if ((dirty & section) && !saveConfigSectionToLog(section)) {
+            failed |= section;
+        }
+    }
+#else
+    LOG_INFO(CONFIG, "💾 Speichere Einstellungen in EEPROM (Abschnitte 0x%02X)...", static_cast<unsigned>(dirty));
+
+    beginEeprom();
+    for (const EepromField &field : EEPROM_SCHEMA) {
+        if (dirty & field.section) {
+            writeEepromField(field);
+        }
+    }
+    uint16_t version = EEPROM_CONFIG_VERSION;
+    EEPROM.put(EEPROM_OFFSET_CONFIG_VERSION, version);
+    const uint32_t crc = computeEepromConfigCrc();
+    EEPROM.put(EEPROM_OFFSET_CONFIG_CRC, crc);
+    EEPROM.commit();
+#endif
+
+    dirtyConfigSections = failed;
+    if (failed != CONFIG_SECTION_NONE) {
+        // Nicht geschriebene Abschnitte bleiben markiert; serviceConfigFlush() versucht es nach der Ruhezeit erneut.
+        firstDirtyAt = lastDirtyAt = millis();
+        LOG_ERROR(CONFIG, "❌ Abschnitte 0x%02X konnten nicht gespeichert werden.", static_cast<unsigned>(failed));
+        return;
+    }
+
+    LOG_INFO(CONFIG, "✅ Einstellungen erfolgreich gespeichert!");
+}
+
+void loadConfig() {
+    LOG_INFO(CONFIG, "📂 Lade Einstellungen aus EEPROM...");
+
+    resetLettersToDefaults();
+    resetTriggerDelaysToDefaults();
+    resetRandomSymbolPoolToDefault();
+    rs485_box_address = 0;
+    standalone_active_start_minutes = DEFAULT_ACTIVE_START_MINUTES;
+    standalone_active_end_minutes = DEFAULT_ACTIVE_END_MINUTES;
+    resetNetworkExtensionDefaults();
+
+    bool migratedLegacyLayout = false;
+    bool imageTrusted = false;
+#if RIDDLEMATRIX_CONFIG_STORE_LOG
+    const uint16_t loggedSections = loadConfigFromRecordLog();
+    if (loggedSections == CONFIG_SECTION_NONE) {
+        LOG_INFO(CONFIG, "📒 Konfigurations-Log leer – übernehme Einstellungen aus dem EEPROM.");
+        loadConfigFromEeprom(imageTrusted);
+        migratedLegacyLayout = true;
+    } else if (loggedSections != CONFIG_SECTION_ALL) {
+        // Abschnitte, die das Log noch nicht kennt, behalten ihre Defaults und werden nachgetragen.
+        markConfigDirty(CONFIG_SECTION_ALL & ~loggedSections);
+    } else {
+        // Jeder Datensatz hat seine CRC beim Lesen bereits bestanden.
+        imageTrusted = true;
+    }
+#else
+    migratedLegacyLayout = loadConfigFromEeprom(imageTrusted);
+#endif
+
+    importLegacyCustomSymbols();
+    const uint16_t migratedSymbolSections = migrateLegacyCustomSymbolCodes();
+    if (migratedSymbolSections != CONFIG_SECTION_NONE) {
+        LOG_INFO(CONFIG, "🔢 Zusatz-Symbole '0'..'7' auf Katalog-Ids umgestellt.");
+        markConfigDirty(migratedSymbolSections);
+    }
+
+    bool eepromUpdated = migratedLegacyLayout;
+    if (imageTrusted && !migratedLegacyLayout) {
+        LOG_INFO(CONFIG, "⚡ Prüfsumme stimmt – Einstellungen ohne Einzelprüfung übernommen.");
+    } else if (sanitizeSchemaFields()) {
         eepromUpdated = true;
     }
 
+    ++configRevision;
+
     if (eepromUpdated) {
-        Serial.println(F("💾 Standardwerte wurden gesetzt und gespeichert!"));
+        LOG_INFO(CONFIG, "💾 Standardwerte wurden gesetzt und gespeichert!");
         saveConfig();
     }
 }
 
+namespace {
+
+#if RIDDLEMATRIX_DOUBLE_BUFFER
+volatile bool displayFramePending = false;
+#endif
+
+} // namespace
+
 void IRAM_ATTR display_updater() {
+#if RIDDLEMATRIX_DOUBLE_BUFFER
+    if (displayFramePending) {
+        display.showBuffer();
+        displayFramePending = false;
+    }
+#endif
     display.display();
 }
 
+void beginDisplayFrame() {
+#if RIDDLEMATRIX_DOUBLE_BUFFER
+    // Ein noch nicht getauschter Frame wird verworfen: der Hintergrundpuffer
+    // gehört ab hier wieder loop() und wird ohnehin komplett neu gezeichnet.
+    noInterrupts();
+    displayFramePending = false;
+    interrupts();
+#endif
+}
+
+void presentDisplayFrame() {
+#if RIDDLEMATRIX_DOUBLE_BUFFER
+    displayFramePending = true;
+#endif
+}
+
 void setupMatrix() {
     display.begin(32);
     display.setBrightness(display_brightness);
     display.setFastUpdate(false);
     display.setDriverChip(FM6126A);
+    beginDisplayFrame();
+    display.fillScreen(display.color565(0, 0, 0));
+    presentDisplayFrame();
     display_ticker.attach(0.005, display_updater);
-    display.clearDisplay();
-    display.display();
 }
 
 void checkMemoryUsage() {
-    Serial.print(F("📝 Freier Speicher: "));
-    Serial.println(ESP.getFreeHeap());
+    LOG_INFO(CONFIG, "📝 Freier Speicher: %lu", static_cast<unsigned long>(ESP.getFreeHeap()));
+#if RIDDLEMATRIX_GLYPH_SPAN_TABLES
+    LOG_INFO(CONFIG, "🔤 Lauf-Tabelle der Factory-Symbole im Flash: %u Bytes",
+             static_cast<unsigned>(FACTORY_GLYPH_SPAN_TABLE_BYTES));
+#endif
 }
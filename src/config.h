@@ -1,6 +1,18 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+// **Doppelpuffer der LED-Matrix**
+// Gezeichnet wird in den unsichtbaren Puffer; display_updater() tauscht ihn
+// erst beim nächsten Refresh ein. Mit -DRIDDLEMATRIX_DOUBLE_BUFFER=0 wird
+// direkt in den sichtbaren Puffer gezeichnet (spart ca. 12 KB RAM).
+#ifndef RIDDLEMATRIX_DOUBLE_BUFFER
+#define RIDDLEMATRIX_DOUBLE_BUFFER 1
+#endif
+
+#if RIDDLEMATRIX_DOUBLE_BUFFER && !defined(PxMATRIX_double_buffer)
+#define PxMATRIX_double_buffer true
+#endif
+
 #include <Wire.h>
 #include <RTClib.h>
 #include <PxMatrix.h>
@@ -97,7 +109,8 @@ static constexpr size_t NUM_DAYS = 7;
 static constexpr size_t COLOR_STRING_LENGTH = 8; // "#RRGGBB" + Terminator
 static constexpr size_t RANDOM_COLOR_PALETTE_SIZE = 8;
 static constexpr size_t RANDOM_SYMBOL_POOL_LENGTH = 40;
-static constexpr size_t CUSTOM_SYMBOL_COUNT = 8;
+static constexpr size_t CUSTOM_SYMBOL_COUNT = 64;       // Katalog der Zusatz-Symbole, Ids 0..63
+static constexpr size_t LEGACY_CUSTOM_SYMBOL_COUNT = 8; // Zusatz-Symbole '0'..'7' im EEPROM älterer Firmware
 static constexpr size_t EDITABLE_BUILTIN_SYMBOL_COUNT = 30;
 static constexpr size_t SYMBOL_BITMAP_SIZE = 128;
 
@@ -135,11 +148,16 @@ static constexpr uint16_t EEPROM_OFFSET_WIFI_SUBNET = EEPROM_OFFSET_WIFI_GATEWAY
 static constexpr uint16_t EEPROM_OFFSET_WIFI_DNS = EEPROM_OFFSET_WIFI_SUBNET + 16;
 static constexpr uint16_t EEPROM_OFFSET_WIFI_LOCAL_AP_SSID = EEPROM_OFFSET_WIFI_DNS + 16;
 static constexpr uint16_t EEPROM_OFFSET_WIFI_LOCAL_AP_PASSWORD = EEPROM_OFFSET_WIFI_LOCAL_AP_SSID + 50;
-static constexpr uint16_t EEPROM_OFFSET_CUSTOM_SYMBOL_BITMAPS = EEPROM_OFFSET_WIFI_LOCAL_AP_PASSWORD + 50;
-static constexpr size_t EEPROM_CUSTOM_SYMBOL_BITMAPS_SIZE = CUSTOM_SYMBOL_COUNT * SYMBOL_BITMAP_SIZE;
-static constexpr uint16_t EEPROM_OFFSET_CUSTOM_SYMBOL_ENABLED = EEPROM_OFFSET_CUSTOM_SYMBOL_BITMAPS + EEPROM_CUSTOM_SYMBOL_BITMAPS_SIZE;
-static constexpr uint16_t EEPROM_OFFSET_RANDOM_SYMBOL_POOL = EEPROM_OFFSET_CUSTOM_SYMBOL_ENABLED + CUSTOM_SYMBOL_COUNT;
-static constexpr uint16_t EEPROM_CONFIG_VERSION = 10;
+// Reserviert: Zusatz-Symbole älterer Firmware, nur noch für die einmalige Übernahme ins Symbol-Paket.
+static constexpr uint16_t EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_BITMAPS = EEPROM_OFFSET_WIFI_LOCAL_AP_PASSWORD + 50;
+static constexpr size_t EEPROM_CUSTOM_SYMBOL_BITMAPS_SIZE = LEGACY_CUSTOM_SYMBOL_COUNT * SYMBOL_BITMAP_SIZE;
+static constexpr uint16_t EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_ENABLED = EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_BITMAPS + EEPROM_CUSTOM_SYMBOL_BITMAPS_SIZE;
+static constexpr uint16_t EEPROM_OFFSET_RANDOM_SYMBOL_POOL = EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_ENABLED + LEGACY_CUSTOM_SYMBOL_COUNT;
+static constexpr uint16_t EEPROM_OFFSET_RS485_BOX_ADDRESS = EEPROM_OFFSET_RANDOM_SYMBOL_POOL + RANDOM_SYMBOL_POOL_LENGTH;
+static constexpr uint16_t EEPROM_CONFIG_VERSION = 11;
+// CRC32 über alle Schema-Felder (Offset 0 bis Ende des letzten Felds) in den letzten 4 Bytes;
+// passt sie beim Start, entfällt die Prüfung jedes einzelnen Felds.
+static constexpr uint16_t EEPROM_OFFSET_CONFIG_CRC = 4092;
 
 static_assert(EEPROM_OFFSET_DAILY_LETTERS + (NUM_TRIGGERS * NUM_DAYS) <= EEPROM_OFFSET_DAILY_LETTER_COLORS,
               "Letter-Block überschneidet sich mit Farb-Block");
@@ -151,10 +169,14 @@ static_assert(EEPROM_OFFSET_COLOR_PALETTE_MASK_MATRIX + EEPROM_COLOR_PALETTE_MAS
               "Activity window exceeds allocated EEPROM size");
 static_assert(EEPROM_OFFSET_WIFI_LOCAL_AP_PASSWORD + 50 <= EEPROM_SIZE,
               "WiFi network extension exceeds allocated EEPROM size");
-static_assert(EEPROM_OFFSET_CUSTOM_SYMBOL_ENABLED + CUSTOM_SYMBOL_COUNT <= EEPROM_SIZE,
+static_assert(EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_ENABLED + LEGACY_CUSTOM_SYMBOL_COUNT <= EEPROM_SIZE,
               "Custom symbol block exceeds allocated EEPROM size");
 static_assert(EEPROM_OFFSET_RANDOM_SYMBOL_POOL + RANDOM_SYMBOL_POOL_LENGTH <= EEPROM_SIZE,
               "Random symbol pool exceeds allocated EEPROM size");
+static_assert(EEPROM_OFFSET_RS485_BOX_ADDRESS + sizeof(uint8_t) <= EEPROM_SIZE,
+              "RS485 box address exceeds allocated EEPROM size");
+static_assert(EEPROM_OFFSET_CONFIG_CRC + sizeof(uint32_t) == EEPROM_SIZE,
+              "Config CRC must occupy the last four EEPROM bytes");
 
 enum class WiFiOperationMode : uint8_t {
     TimedManager = 0,
@@ -193,11 +215,13 @@ extern char dailyLetters[NUM_TRIGGERS][NUM_DAYS];
 extern char dailyLetterColors[NUM_TRIGGERS][NUM_DAYS][COLOR_STRING_LENGTH];
 extern uint8_t dailyLetterColorModes[NUM_TRIGGERS][NUM_DAYS];
 extern uint16_t dailyLetterRandomPaletteMasks[NUM_TRIGGERS][NUM_DAYS];
-extern uint8_t customSymbolBitmaps[CUSTOM_SYMBOL_COUNT][SYMBOL_BITMAP_SIZE];
-extern uint8_t customSymbolEnabled[CUSTOM_SYMBOL_COUNT];
-extern uint8_t editableBuiltinSymbolBitmaps[EDITABLE_BUILTIN_SYMBOL_COUNT][SYMBOL_BITMAP_SIZE];
-extern uint8_t editableBuiltinSymbolEnabled[EDITABLE_BUILTIN_SYMBOL_COUNT];
 extern char random_symbol_pool[RANDOM_SYMBOL_POOL_LENGTH];
+extern uint8_t rs485_box_address; // 0 = nimmt alle RS485-Frames an
+
+// **Revisionszähler der Konfiguration**
+// Steigt bei jedem Laden/Speichern von Einstellungen oder Symbolen; abgeleitete
+// Daten wie der Tagesplan (display_plan.cpp) bauen sich bei Abweichung neu auf.
+extern uint16_t configRevision;
 
 enum class LetterColorMode : uint8_t {
     Fixed = 0,
@@ -208,16 +232,45 @@ enum class LetterColorMode : uint8_t {
 extern const char *const randomColorPalette[RANDOM_COLOR_PALETTE_SIZE];
 extern const char *const randomColorPaletteLabels[RANDOM_COLOR_PALETTE_SIZE];
 
-// **Alle auswählbaren Zeichen/Symbole**
+// **Alle auswählbaren Zeichen/Symbole** (ohne die Zusatz-Symbole des Katalogs, siehe unten)
 const char availableLetters[] = {
     'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
     'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-    '*', '#', '~', '&', '?', '0', '1', '2', '3', '4', '5', '6', '7'};
+    '*', '#', '~', '&', '?'};
 
 const char editableBuiltinSymbols[] = {
     'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
     'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
     '#', '~', '&', '?'};
+
+// **🔢 Zusatz-Symbole des Katalogs**
+// Zusatz-Symbole werden über ihre Id 0..CUSTOM_SYMBOL_COUNT-1 angesprochen. In dailyLetters und
+// random_symbol_pool steht Id n als Zeichencode CUSTOM_SYMBOL_CODE_BASE + n, in Formularen und
+// HTTP-Parametern als Text "@n". Bitmap und Freigabe liegen nur im Symbol-Paket (symbol_pack.h);
+// der RAM-Bedarf hängt deshalb nicht von der Kataloggröße ab.
+static constexpr uint8_t CUSTOM_SYMBOL_CODE_BASE = 0x80;
+static_assert(CUSTOM_SYMBOL_CODE_BASE + CUSTOM_SYMBOL_COUNT <= 0xFF, "Zeichencodes der Zusatz-Symbole kollidieren mit 0xFF");
+
+inline bool isCustomSymbol(char symbol) {
+    const uint8_t code = static_cast<uint8_t>(symbol);
+    return code >= CUSTOM_SYMBOL_CODE_BASE && code < CUSTOM_SYMBOL_CODE_BASE + CUSTOM_SYMBOL_COUNT;
+}
+
+// Id eines Zusatz-Symbols oder -1 für eingebaute Zeichen.
+inline int customSymbolId(char symbol) {
+    return isCustomSymbol(symbol) ? static_cast<uint8_t>(symbol) - CUSTOM_SYMBOL_CODE_BASE : -1;
+}
+
+inline char customSymbolFromId(size_t id) {
+    return static_cast<char>(CUSTOM_SYMBOL_CODE_BASE + id);
+}
+
+// Zusatz-Symbole älterer Firmware hießen '0'..'7'; sie sind heute die Ids 0..7.
+inline char migrateLegacyCustomSymbol(char symbol) {
+    return (symbol >= '0' && symbol < static_cast<char>('0' + LEGACY_CUSTOM_SYMBOL_COUNT))
+               ? customSymbolFromId(static_cast<size_t>(symbol - '0'))
+               : symbol;
+}
 
 // **Konfiguration für Zeichen-/Symbolanzeige**
 extern int display_brightness;           // Standard: 100
@@ -257,8 +310,73 @@ extern const char* daysOfTheWeek[7];
 #  endif
 #endif
 
-// **💾 Einstellungen speichern in EEPROM**
-void saveConfig();
+// **💾 EEPROM-Abschnitte für saveConfig()**
+// Jeder Abschnitt fasst die EEPROM_OFFSET_*-Blöcke zusammen, die eine Route gemeinsam ändert.
+// Geschrieben werden nur als geändert markierte Abschnitte; ist keiner markiert, entfällt
+// EEPROM.commit() und damit das Löschen/Schreiben des Flash-Sektors.
+enum ConfigSection : uint16_t {
+    CONFIG_SECTION_NONE = 0,
+    CONFIG_SECTION_WIFI = 1U << 0,           // SSID, Passwort, Hostname, Timeout, Betriebsart, statische IP, lokaler AP
+    CONFIG_SECTION_LETTERS = 1U << 1,        // Zeichen, Farben, Farbmodi und Paletten je Trigger/Tag
+    CONFIG_SECTION_TRIGGER_DELAYS = 1U << 2, // Verzögerungsmatrix
+    CONFIG_SECTION_DISPLAY = 1U << 3,        // Helligkeit, Anzeigezeit, Automodus, Aktivfenster, Zufallspool, RS485-Adresse
+    CONFIG_SECTION_ALL = 0x0F
+};
+
+// **📒 Speicherort der Einstellungen**
+// 0 = EEPROM-Layout (EEPROM_OFFSET_*), 1 = Konfigurations-Log auf dem Flash-Dateisystem
+// (config_record_log.h): ein Datensatz je Abschnitt, beim ersten Start aus dem EEPROM übernommen.
+#ifndef RIDDLEMATRIX_CONFIG_STORE_LOG
+#define RIDDLEMATRIX_CONFIG_STORE_LOG 0
+#endif
+
+// **🗂️ EEPROM-Schema**
+// Eine Zeile je gespeichertem Feld: Offset und Größe im aktuellen Layout, die Version, mit der
+// das Feld eingeführt wurde, sein Abschnitt und seine Prüffunktion. Laden, Speichern, Migration
+// älterer Layouts und das Konfigurations-Log arbeiten alle nur diese Tabelle ab; ein neues Feld
+// braucht einen Offset, eine Tabellenzeile und eine höhere EEPROM_CONFIG_VERSION.
+enum class EepromFieldKind : uint8_t {
+    Bytes,   // Rohbytes wie im RAM
+    String,  // Rohbytes, letztes Byte wird beim Laden terminiert
+    Flag,    // bool als 0/1-Byte
+    ULongs   // unsigned long-Werte mit je EEPROM_SIZEOF_UNSIGNED_LONG Bytes
+};
+
+struct EepromField {
+    uint16_t offset;
+    uint16_t size;          // Bytes im EEPROM
+    uint16_t sinceVersion;  // ältere Layouts enthalten das Feld nicht; es behält seinen Standardwert
+    uint16_t section;       // ConfigSection
+    EepromFieldKind kind;
+    void *value;
+    bool (*sanitize)();     // true, wenn der geladene Wert korrigiert wurde
+};
+
+const EepromField *getEepromSchema(size_t &count);
+
+// **⏳ Verzögertes Speichern**
+// Web-Routen markieren geänderte Abschnitte nur (markConfigDirty) und antworten sofort;
+// loop() schreibt alles gesammelt, sobald CONFIG_FLUSH_QUIET_MS lang nichts mehr geändert
+// wurde, spätestens aber CONFIG_FLUSH_MAX_DELAY_MS nach der ersten Änderung.
+#ifndef RIDDLEMATRIX_CONFIG_FLUSH_QUIET_MS
+#define RIDDLEMATRIX_CONFIG_FLUSH_QUIET_MS 2000UL
+#endif
+#ifndef RIDDLEMATRIX_CONFIG_FLUSH_MAX_DELAY_MS
+#define RIDDLEMATRIX_CONFIG_FLUSH_MAX_DELAY_MS 10000UL
+#endif
+constexpr unsigned long CONFIG_FLUSH_QUIET_MS = RIDDLEMATRIX_CONFIG_FLUSH_QUIET_MS;
+constexpr unsigned long CONFIG_FLUSH_MAX_DELAY_MS = RIDDLEMATRIX_CONFIG_FLUSH_MAX_DELAY_MS;
+
+void markConfigDirty(uint16_t sections);
+uint16_t getDirtyConfigSections();
+bool isConfigFlushDue(unsigned long now);
+// Aus loop(): speichert, wenn isConfigFlushDue().
+void serviceConfigFlush();
+// Speichert alle markierten Abschnitte sofort; false, wenn nichts anstand.
+bool flushConfig();
+
+// **💾 Einstellungen speichern in EEPROM** (markiert `sections` und schreibt alle markierten Abschnitte)
+void saveConfig(uint16_t sections = CONFIG_SECTION_ALL);
 
 // **📂 Einstellungen aus EEPROM laden**
 void loadConfig();
@@ -266,14 +384,59 @@ void loadConfig();
 bool initEditableSymbolStore();
 int editableBuiltinSymbolIndexFromChar(char symbol);
 bool isEditableBuiltinSymbol(char symbol);
-bool getDefaultBuiltinSymbolBitmap(char symbol, uint8_t *target);
 bool getEditableBuiltinSymbolBitmap(char symbol, uint8_t *target);
+bool hasEditableBuiltinSymbolOverride(char symbol);
+// Zeiger in den Bitmap-Cache; gültig bis zum nächsten Aufruf, der ein anderes Symbol nachlädt.
+const uint8_t *findEditableBuiltinSymbolBitmap(char symbol);
 bool saveEditableBuiltinSymbol(char symbol, const uint8_t *bitmap, bool enabled);
 bool clearEditableBuiltinSymbol(char symbol);
 
+// **🔢 Zusatz-Symbole** (Zeichencode aus customSymbolFromId())
+// Gespeichert wird sofort im Symbol-Paket; ein Zusatz-Symbol belegt erst beim Anzeigen bzw. Abruf
+// einen Eintrag im Bitmap-Cache.
+bool hasCustomSymbol(char symbol);                 // gespeichert und freigegeben
+const uint8_t *findCustomSymbolBitmap(char symbol);  // nur freigegebene; Zeiger in den Bitmap-Cache
+// Liest ein gespeichertes Zusatz-Symbol auch ohne Freigabe (Editor); false, wenn der Slot leer ist.
+bool readCustomSymbol(char symbol, uint8_t *target, bool &enabled);
+// Speicher-Flags (SYMBOL_PACK_FLAG_*) aller Zusatz-Symbole mit einem Lesezugriff, z. B. für Auswahllisten.
+bool readCustomSymbolFlags(uint8_t (&flags)[CUSTOM_SYMBOL_COUNT]);
+bool saveCustomSymbol(char symbol, const uint8_t *bitmap, bool enabled);
+bool clearCustomSymbol(char symbol);
+
+// **📦 Sammel-Upload** (editierbare eingebaute und Zusatz-Symbole gemischt)
+// Alle Symbole eines Uploads werden erst mit commitSymbolBatch() auf einen Schlag sichtbar;
+// abortSymbolBatch() lässt den bisherigen Stand unverändert. bitmap == nullptr leert den Slot.
+bool beginSymbolBatch();
+bool stageSymbolBatchRecord(char symbol, const uint8_t *bitmap, bool enabled);
+bool commitSymbolBatch();
+void abortSymbolBatch();
+
+// **🗃️ Bitmap-Cache für bearbeitete Symbole**
+// Overrides und Zusatz-Symbole liegen nur im Symbol-Paket (symbol_pack.h). Im RAM stehen je editierbarem
+// eingebautem Symbol das Freigabe-Byte und die zuletzt benutzten SYMBOL_CACHE_ENTRIES Bitmaps (LRU),
+// gefüllt beim ersten Anzeigen bzw. Abruf.
+#ifndef RIDDLEMATRIX_SYMBOL_CACHE_ENTRIES
+#define RIDDLEMATRIX_SYMBOL_CACHE_ENTRIES 4
+#endif
+constexpr size_t SYMBOL_CACHE_ENTRIES = RIDDLEMATRIX_SYMBOL_CACHE_ENTRIES;
+static_assert(SYMBOL_CACHE_ENTRIES > 0, "RIDDLEMATRIX_SYMBOL_CACHE_ENTRIES muss mindestens 1 sein");
+
+struct SymbolCacheStats {
+    uint32_t hits;
+    uint32_t misses;  // jeder Fehlgriff liest einen Record aus dem Symbol-Paket
+};
+
+const SymbolCacheStats &getSymbolCacheStats();
+
 
 void IRAM_ATTR display_updater();
 
+// **Frame-Übergabe an display_updater()**
+// beginDisplayFrame() vor dem ersten Zeichenaufruf, presentDisplayFrame()
+// nach dem letzten; der Tausch erfolgt ohne delay() im nächsten Refresh.
+void beginDisplayFrame();
+void presentDisplayFrame();
+
 // **LED-Matrix Setup-Funktion**
 void setupMatrix();
 
@@ -0,0 +1,381 @@
+#include "config_record_log.h"
+
+#include "crc32.h"
+#include "log_manager.h"
+#include "storage_fs.h"
+
+#include <string.h>
+
+namespace {
+
+const char *const CONFIG_LOG_PATHS[2] = {"/cfg_a.log", "/cfg_b.log"};
+constexpr uint8_t CONFIG_LOG_MAGIC[4] = {'R', 'M', 'C', 'L'};
+constexpr size_t CONFIG_LOG_FILE_HEADER_SIZE = 12;
+constexpr size_t CONFIG_LOG_RECORD_HEADER_SIZE = 4;
+constexpr uint8_t CONFIG_LOG_COMMIT_ID = 0xFF;
+constexpr size_t CONFIG_LOG_COPY_CHUNK = 32;
+
+struct RecordLocation {
+    uint32_t offset;  // Beginn des Datensatzkopfs; 0 = kein Datensatz (dort liegt der Dateikopf)
+    uint16_t length;
+};
+
+struct LogScan {
+    RecordLocation records[CONFIG_LOG_RECORD_IDS];
+    uint32_t generation;
+    size_t validEnd;
+    size_t fileSize;
+    bool committed;
+};
+
+RecordLocation records[CONFIG_LOG_RECORD_IDS] = {};
+ConfigLogStats stats = {};
+uint8_t activeFile = 0;
+bool logOpen = false;
+bool compactionPending = false;
+
+File pendingRecord;
+uint32_t pendingCrc = 0;
+uint32_t pendingOffset = 0;
+uint16_t pendingRemaining = 0;
+uint16_t pendingLength = 0;
+uint8_t pendingId = 0;
+bool pendingOk = false;
+
+File readerFile;
+uint16_t readerRemaining = 0;
+
+void storeLe16(uint8_t *target, uint16_t value) {
+    target[0] = static_cast<uint8_t>(value);
+    target[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void storeLe32(uint8_t *target, uint32_t value) {
+    for (uint8_t index = 0; index < 4; ++index) {
+        target[index] = static_cast<uint8_t>(value >> (8 * index));
+    }
+}
+
+uint32_t loadLe32(const uint8_t *source) {
+    return static_cast<uint32_t>(source[0]) | (static_cast<uint32_t>(source[1]) << 8) |
+        (static_cast<uint32_t>(source[2]) << 16) | (static_cast<uint32_t>(source[3]) << 24);
+}
+
+bool writeAll(File &file, const uint8_t *data, size_t length) {
+    return file.write(data, length) == length;
+}
+
+bool writeFileHeader(File &file, uint32_t generation) {
+    uint8_t header[CONFIG_LOG_FILE_HEADER_SIZE];
+    memcpy(header, CONFIG_LOG_MAGIC, sizeof(CONFIG_LOG_MAGIC));
+    storeLe32(header + 4, generation);
+    storeLe32(header + 8, crc32Update(header, 8));
+    return writeAll(file, header, sizeof(header));
+}
+
+bool writeRecordHeader(File &file, uint8_t id, uint16_t length, uint32_t &crc) {
+    uint8_t header[CONFIG_LOG_RECORD_HEADER_SIZE] = {id, 0};
+    storeLe16(header + 2, length);
+    crc = crc32Update(header, sizeof(header));
+    return writeAll(file, header, sizeof(header));
+}
+
+bool writeRecordTrailer(File &file, uint32_t crc) {
+    uint8_t trailer[4];
+    storeLe32(trailer, crc);
+    return writeAll(file, trailer, sizeof(trailer));
+}
+
+bool writeCommitRecord(File &file, uint32_t generation) {
+    uint8_t payload[4];
+    storeLe32(payload, generation);
+    uint32_t crc = 0;
+    const bool headerWritten = writeRecordHeader(file, CONFIG_LOG_COMMIT_ID, sizeof(payload), crc);
+    crc = crc32Update(payload, sizeof(payload), crc);
+    return headerWritten && writeAll(file, payload, sizeof(payload)) && writeRecordTrailer(file, crc);
+}
+
+// Läuft einmal über die Datei und merkt sich je Kennung den letzten Datensatz mit gültiger CRC.
+// Am ersten beschädigten oder unvollständigen Datensatz endet der gültige Teil.
+bool scanLogFile(uint8_t fileIndex, LogScan &scan) {
+    memset(&scan, 0, sizeof(scan));
+    File file = RIDDLEMATRIX_STORAGE_FS.open(CONFIG_LOG_PATHS[fileIndex], "r");
+    if (!file) {
+        return false;
+    }
+    scan.fileSize = file.size();
+
+    uint8_t header[CONFIG_LOG_FILE_HEADER_SIZE];
+    if (file.read(header, sizeof(header)) != sizeof(header) ||
+        memcmp(header, CONFIG_LOG_MAGIC, sizeof(CONFIG_LOG_MAGIC)) != 0 ||
+        loadLe32(header + 8) != crc32Update(header, 8)) {
+        file.close();
+        return false;
+    }
+    scan.generation = loadLe32(header + 4);
+    scan.validEnd = CONFIG_LOG_FILE_HEADER_SIZE;
+
+    uint8_t chunk[CONFIG_LOG_COPY_CHUNK];
+    while (scan.validEnd + CONFIG_LOG_RECORD_OVERHEAD <= scan.fileSize) {
+        uint8_t recordHeader[CONFIG_LOG_RECORD_HEADER_SIZE];
+        if (file.read(recordHeader, sizeof(recordHeader)) != sizeof(recordHeader)) {
+            break;
+        }
+        const uint8_t id = recordHeader[0];
+        const uint16_t length = static_cast<uint16_t>(recordHeader[2] | (recordHeader[3] << 8));
+        if (recordHeader[1] != 0 || scan.validEnd + CONFIG_LOG_RECORD_OVERHEAD + length > scan.fileSize) {
+            break;
+        }
+
+        uint32_t crc = crc32Update(recordHeader, sizeof(recordHeader));
+        uint8_t commitPayload[4] = {};
+        size_t remaining = length;
+        while (remaining > 0) {
+            const size_t count = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+            if (file.read(chunk, count) != count) {
+                break;
+            }
+            if (id == CONFIG_LOG_COMMIT_ID && length == sizeof(commitPayload)) {
+                memcpy(commitPayload, chunk, sizeof(commitPayload));
+            }
+            crc = crc32Update(chunk, count, crc);
+            remaining -= count;
+        }
+        uint8_t trailer[4];
+        if (remaining != 0 || file.read(trailer, sizeof(trailer)) != sizeof(trailer) || loadLe32(trailer) != crc) {
+            break;
+        }
+
+        if (id == CONFIG_LOG_COMMIT_ID) {
+            scan.committed = scan.committed || loadLe32(commitPayload) == scan.generation;
+        } else if (id < CONFIG_LOG_RECORD_IDS) {
+            scan.records[id] = {static_cast<uint32_t>(scan.validEnd), length};
+        }
+        // Unbekannte Kennungen stammen von neuerer Firmware und werden übersprungen.
+        scan.validEnd += CONFIG_LOG_RECORD_OVERHEAD + length;
+    }
+    file.close();
+    return true;
+}
+
+bool copyRecord(File &source, File &target, const RecordLocation &location) {
+    if (!source.seek(location.offset)) {
+        return false;
+    }
+    uint8_t chunk[CONFIG_LOG_COPY_CHUNK];
+    size_t remaining = CONFIG_LOG_RECORD_OVERHEAD + location.length;
+    while (remaining > 0) {
+        const size_t count = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+        if (source.read(chunk, count) != count || !writeAll(target, chunk, count)) {
+            return false;
+        }
+        remaining -= count;
+    }
+    return true;
+}
+
+// Größe einer frisch verdichteten Datei: Kopf, aktuelle Datensätze, Commit-Datensatz.
+size_t liveConfigLogBytes() {
+    size_t bytes = CONFIG_LOG_FILE_HEADER_SIZE + CONFIG_LOG_RECORD_OVERHEAD + 4;
+    for (const RecordLocation &location : records) {
+        if (location.offset != 0) {
+            bytes += CONFIG_LOG_RECORD_OVERHEAD + location.length;
+        }
+    }
+    return bytes;
+}
+
+// Schreibt die aktuellen Datensätze in die andere Datei und schaltet erst nach dem Commit um.
+bool compactConfigLog() {
+    const uint8_t targetFile = logOpen ? static_cast<uint8_t>(activeFile ^ 1U) : 0;
+    const uint32_t generation = stats.generation + 1;
+    File source;
+    if (logOpen) {
+        source = RIDDLEMATRIX_STORAGE_FS.open(CONFIG_LOG_PATHS[activeFile], "r");
+    }
+    File target = RIDDLEMATRIX_STORAGE_FS.open(CONFIG_LOG_PATHS[targetFile], "w");
+    if (!target || (logOpen && !source)) {
+        source.close();
+        target.close();
+        LOG_ERROR(CONFIG, "❌ Konfigurations-Log konnte nicht verdichtet werden (Datei nicht geöffnet).");
+        return false;
+    }
+
+    RecordLocation moved[CONFIG_LOG_RECORD_IDS] = {};
+    size_t position = CONFIG_LOG_FILE_HEADER_SIZE;
+    bool ok = writeFileHeader(target, generation);
+    for (uint8_t id = 0; ok && id < CONFIG_LOG_RECORD_IDS; ++id) {
+        if (records[id].offset == 0) {
+            continue;
+        }
+        ok = copyRecord(source, target, records[id]);
+        moved[id] = {static_cast<uint32_t>(position), records[id].length};
+        position += CONFIG_LOG_RECORD_OVERHEAD + records[id].length;
+    }
+    ok = ok && writeCommitRecord(target, generation);
+    source.close();
+    target.close();
+    if (!ok) {
+        LOG_ERROR(CONFIG, "❌ Verdichtung des Konfigurations-Logs abgebrochen – alte Datei bleibt gültig.");
+        return false;
+    }
+
+    memcpy(records, moved, sizeof(records));
+    activeFile = targetFile;
+    stats.generation = generation;
+    stats.bytes = liveConfigLogBytes();
+    ++stats.compactions;
+    compactionPending = false;
+    logOpen = true;
+    LOG_INFO(CONFIG, "📒 Konfigurations-Log verdichtet: %s, Generation %lu, %u Bytes.", CONFIG_LOG_PATHS[activeFile],
+             static_cast<unsigned long>(generation), static_cast<unsigned>(stats.bytes));
+    return true;
+}
+
+} // namespace
+
+bool openConfigLog() {
+    closeConfigLogRecord();
+    pendingRecord.close();
+    memset(records, 0, sizeof(records));
+    stats = {};
+    logOpen = false;
+    compactionPending = false;
+
+    if (!mountStorageFs()) {
+        LOG_WARN(CONFIG, "⚠️ Dateisystem für das Konfigurations-Log nicht verfügbar.");
+        return false;
+    }
+
+    LogScan scans[2];
+    int8_t newest = -1;
+    for (uint8_t fileIndex = 0; fileIndex < 2; ++fileIndex) {
+        if (scanLogFile(fileIndex, scans[fileIndex]) && scans[fileIndex].committed &&
+            (newest < 0 || scans[fileIndex].generation > scans[newest].generation)) {
+            newest = static_cast<int8_t>(fileIndex);
+        }
+    }
+
+    if (newest < 0) {
+        LOG_INFO(CONFIG, "📒 Kein Konfigurations-Log gefunden – lege es neu an.");
+        compactConfigLog();
+        return false;
+    }
+
+    const LogScan &scan = scans[newest];
+    memcpy(records, scan.records, sizeof(records));
+    activeFile = static_cast<uint8_t>(newest);
+    stats.generation = scan.generation;
+    stats.bytes = scan.validEnd;
+    stats.droppedBytes = static_cast<unsigned long>(scan.fileSize - scan.validEnd);
+    logOpen = true;
+    if (stats.droppedBytes > 0) {
+        // Hinter einem abgerissenen Datensatz angehängte Daten wären beim Start unerreichbar.
+        LOG_WARN(CONFIG, "⚠️ Konfigurations-Log endet mit %lu unvollständigen Bytes – verdichte.", stats.droppedBytes);
+        compactionPending = true;
+        compactConfigLog();
+    }
+    return true;
+}
+
+bool hasConfigLogRecord(uint8_t id) {
+    return id < CONFIG_LOG_RECORD_IDS && records[id].offset != 0;
+}
+
+bool beginConfigLogRecord(uint8_t id, uint16_t length) {
+    pendingRecord.close();
+    pendingOk = false;
+    if (id >= CONFIG_LOG_RECORD_IDS) {
+        return false;
+    }
+    if (!logOpen) {
+        openConfigLog();
+    }
+    if (!logOpen) {
+        return false;
+    }
+    // Verdichtet wird nur, wenn es überholte Datensätze gibt; sonst wächst das Log einfach weiter.
+    const bool full = stats.bytes + CONFIG_LOG_RECORD_OVERHEAD + length > CONFIG_LOG_MAX_BYTES &&
+        stats.bytes > liveConfigLogBytes();
+    if ((compactionPending || full) && !compactConfigLog() && compactionPending) {
+        return false;
+    }
+
+    pendingRecord = RIDDLEMATRIX_STORAGE_FS.open(CONFIG_LOG_PATHS[activeFile], "a");
+    if (!pendingRecord) {
+        return false;
+    }
+    pendingId = id;
+    pendingLength = length;
+    pendingRemaining = length;
+    pendingOffset = static_cast<uint32_t>(stats.bytes);
+    pendingOk = writeRecordHeader(pendingRecord, id, length, pendingCrc);
+    return pendingOk;
+}
+
+bool writeConfigLogField(const void *data, size_t size) {
+    if (!pendingRecord || !pendingOk || size > pendingRemaining) {
+        pendingOk = false;
+        return false;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    pendingOk = writeAll(pendingRecord, bytes, size);
+    pendingCrc = crc32Update(bytes, size, pendingCrc);
+    pendingRemaining = static_cast<uint16_t>(pendingRemaining - size);
+    return pendingOk;
+}
+
+bool commitConfigLogRecord() {
+    if (!pendingRecord) {
+        return false;
+    }
+    const bool ok = pendingOk && pendingRemaining == 0 && writeRecordTrailer(pendingRecord, pendingCrc);
+    pendingRecord.close();
+    pendingOk = false;
+    if (!ok) {
+        // Der angefangene Datensatz steht ohne gültige CRC in der Datei; vor dem nächsten Anhängen verdichten.
+        compactionPending = true;
+        LOG_ERROR(CONFIG, "❌ Datensatz %u konnte nicht vollständig ins Konfigurations-Log geschrieben werden.",
+                  static_cast<unsigned>(pendingId));
+        return false;
+    }
+    records[pendingId] = {pendingOffset, pendingLength};
+    stats.bytes += CONFIG_LOG_RECORD_OVERHEAD + pendingLength;
+    return true;
+}
+
+uint16_t openConfigLogRecord(uint8_t id) {
+    closeConfigLogRecord();
+    if (!logOpen || !hasConfigLogRecord(id)) {
+        return 0;
+    }
+    readerFile = RIDDLEMATRIX_STORAGE_FS.open(CONFIG_LOG_PATHS[activeFile], "r");
+    if (!readerFile || !readerFile.seek(records[id].offset + CONFIG_LOG_RECORD_HEADER_SIZE)) {
+        readerFile.close();
+        return 0;
+    }
+    readerRemaining = records[id].length;
+    return readerRemaining;
+}
+
+bool readConfigLogField(void *target, size_t size) {
+    if (!readerFile || size > readerRemaining) {
+        readerRemaining = 0;
+        return false;
+    }
+    if (readerFile.read(static_cast<uint8_t *>(target), size) != size) {
+        readerRemaining = 0;
+        return false;
+    }
+    readerRemaining = static_cast<uint16_t>(readerRemaining - size);
+    return true;
+}
+
+void closeConfigLogRecord() {
+    readerFile.close();
+    readerRemaining = 0;
+}
+
+const ConfigLogStats &getConfigLogStats() {
+    return stats;
+}
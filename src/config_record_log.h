@@ -0,0 +1,53 @@
+#ifndef CONFIG_RECORD_LOG_H
+#define CONFIG_RECORD_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **📒 Konfigurations-Log mit A/B-Verdichtung**
+// Alternative zum EEPROM-Layout (RIDDLEMATRIX_CONFIG_STORE_LOG=1): Jeder Konfigurationsabschnitt
+// ist ein Datensatz, der nur an /cfg_a.log bzw. /cfg_b.log angehängt wird:
+//   Dateikopf:  "RMCL" | Generation (u32) | CRC32 über Magic+Generation
+//   Datensatz:  Kennung (u8) | 0 | Länge n (u16) | n Nutzbytes | CRC32 über alles davor
+// Beim Start zählt je Kennung der letzte Datensatz mit gültiger CRC; ein abgerissener Schreibvorgang
+// kostet nur diesen einen Datensatz. Wird das Log größer als CONFIG_LOG_MAX_BYTES, kopiert die
+// Verdichtung die aktuellen Datensätze in die andere Datei und schließt sie mit einem
+// Commit-Datensatz ab. Erst der gilt: Bricht die Verdichtung ab, bleibt die alte Datei maßgeblich.
+// Die Log-Größe ist damit begrenzt und das Einlesen beim Start dauert nie länger als ein Durchlauf
+// über CONFIG_LOG_MAX_BYTES.
+#ifndef RIDDLEMATRIX_CONFIG_LOG_MAX_BYTES
+#define RIDDLEMATRIX_CONFIG_LOG_MAX_BYTES 8192
+#endif
+
+constexpr size_t CONFIG_LOG_MAX_BYTES = RIDDLEMATRIX_CONFIG_LOG_MAX_BYTES;
+static constexpr uint8_t CONFIG_LOG_RECORD_IDS = 16;  // gültige Kennungen: 0..15
+static constexpr size_t CONFIG_LOG_RECORD_OVERHEAD = 8;
+
+struct ConfigLogStats {
+    uint32_t generation;     // Generation der aktiven Datei (0 = kein Log)
+    size_t bytes;            // gültige Länge der aktiven Datei
+    unsigned long compactions;
+    unsigned long droppedBytes;  // beim Start verworfene Bytes hinter dem letzten gültigen Datensatz
+};
+
+// Mountet das Dateisystem, wählt die jüngste abgeschlossene Datei und merkt sich je Kennung den
+// letzten gültigen Datensatz. Liefert false, wenn kein Log existiert (es wird dann neu angelegt).
+bool openConfigLog();
+bool hasConfigLogRecord(uint8_t id);
+
+// Datensatz schreiben: Länge vorab angeben, Felder einzeln anhängen, dann abschließen.
+// Erst commitConfigLogRecord() schreibt die CRC; vorher gilt weiter der alte Datensatz.
+bool beginConfigLogRecord(uint8_t id, uint16_t length);
+bool writeConfigLogField(const void *data, size_t size);
+bool commitConfigLogRecord();
+
+// Datensatz lesen: liefert die gespeicherte Länge (0 = nicht vorhanden). readConfigLogField()
+// füllt ein Feld nur, wenn der Datensatz es noch vollständig enthält – Felder, die eine ältere
+// Firmware nicht kannte, behalten so ihren Standardwert.
+uint16_t openConfigLogRecord(uint8_t id);
+bool readConfigLogField(void *target, size_t size);
+void closeConfigLogRecord();
+
+const ConfigLogStats &getConfigLogStats();
+
+#endif
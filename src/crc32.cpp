@@ -0,0 +1,12 @@
+#include "crc32.h"
+
+uint32_t crc32Update(const uint8_t *data, size_t length, uint32_t crc) {
+    crc = ~crc;
+    for (size_t index = 0; index < length; ++index) {
+        crc ^= data[index];
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1U) ? (crc >> 1) ^ 0xEDB88320UL : crc >> 1;
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,12 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **CRC-32 (IEEE, reflektiert, Polynom 0xEDB88320)**
+// Prüfwert von "123456789" ist 0xCBF43926. Für fortlaufende Berechnung das bisherige Ergebnis als
+// `crc` übergeben. Bitweise statt per Tabelle: spart 1 KB RAM, und die Datenmengen sind klein.
+uint32_t crc32Update(const uint8_t *data, size_t length, uint32_t crc = 0);
+
+#endif
@@ -0,0 +1,186 @@
+#include "display_plan.h"
+#include "log_manager.h"
+#include "symbol_renderer.h"
+
+#include <stdlib.h>
+
+namespace {
+
+struct DisplayPlan {
+    DisplayPlanEntry entries[NUM_TRIGGERS];
+    uint16_t paletteColors[RANDOM_COLOR_PALETTE_SIZE];
+    uint16_t revision;
+    int8_t weekday;
+    bool valid;
+};
+
+DisplayPlan plan = {};
+
+uint16_t color565FromHex(const char *hexColor) {
+    if (hexColor == nullptr || hexColor[0] != '#' || strnlen(hexColor, COLOR_STRING_LENGTH) != 7) {
+        hexColor = "#FFFFFF";
+    }
+    const uint32_t colorHex = strtoul(hexColor + 1, nullptr, 16);
+    return display.color565(static_cast<uint8_t>((colorHex >> 16) & 0xFF),
+                            static_cast<uint8_t>((colorHex >> 8) & 0xFF),
+                            static_cast<uint8_t>(colorHex & 0xFF));
+}
+
+uint16_t rainbowColor565() {
+    const uint16_t hue = static_cast<uint16_t>(random(1536));
+    const uint8_t segment = static_cast<uint8_t>(hue / 256U);
+    const uint8_t offset = static_cast<uint8_t>(hue % 256U);
+
+    uint8_t r = 0;
+    uint8_t g = 0;
+    uint8_t b = 0;
+
+    switch (segment) {
+        case 0:
+            r = 255;
+            g = offset;
+            break;
+        case 1:
+            r = static_cast<uint8_t>(255 - offset);
+            g = 255;
+            break;
+        case 2:
+            g = 255;
+            b = offset;
+            break;
+        case 3:
+            g = static_cast<uint8_t>(255 - offset);
+            b = 255;
+            break;
+        case 4:
+            r = offset;
+            b = 255;
+            break;
+        default:
+            r = 255;
+            b = static_cast<uint8_t>(255 - offset);
+            break;
+    }
+
+    return display.color565(r, g, b);
+}
+
+void buildDisplayPlan(int weekday) {
+    const size_t day = static_cast<size_t>(weekday);
+    const uint16_t paletteBits = static_cast<uint16_t>((1U << RANDOM_COLOR_PALETTE_SIZE) - 1U);
+
+    for (size_t index = 0; index < RANDOM_COLOR_PALETTE_SIZE; ++index) {
+        plan.paletteColors[index] = color565FromHex(randomColorPalette[index]);
+    }
+
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        DisplayPlanEntry &entry = plan.entries[trigger];
+        resolveDisplaySymbol(dailyLetters[trigger][day], entry.symbol);
+        entry.delayMs = letter_trigger_delays[trigger][day] * 1000UL;
+        entry.color565 = color565FromHex(dailyLetterColors[trigger][day]);
+        entry.paletteMask = static_cast<uint16_t>(dailyLetterRandomPaletteMasks[trigger][day] & paletteBits);
+        entry.colorMode = dailyLetterColorModes[trigger][day];
+    }
+
+    plan.weekday = static_cast<int8_t>(weekday);
+    plan.revision = configRevision;
+    plan.valid = true;
+
+    LOG_DEBUG(DISPLAY, "🗓️ Tagesplan aufgebaut für %s", daysOfTheWeek[weekday]);
+}
+
+} // namespace
+
+bool resolveDisplaySymbol(char letter, DisplaySymbol &symbol) {
+    symbol.letter = letter;
+
+    if (letter == '*') {
+        symbol.source = DisplaySymbolSource::RandomSelection;
+        return true;
+    }
+
+    if (hasEditableBuiltinSymbolOverride(letter)) {
+        // Die Bitmap holt erst renderDisplaySymbol() aus dem Cache; ein Zeiger im Plan könnte verdrängt werden.
+        symbol.source = DisplaySymbolSource::BuiltinOverride;
+        return true;
+    }
+
+    if (isCustomSymbol(letter)) {
+        // Nur die Freigabe aus dem Index; die Bitmap lädt renderDisplaySymbol() in den Cache.
+        symbol.source = hasCustomSymbol(letter) ? DisplaySymbolSource::Custom : DisplaySymbolSource::Missing;
+        return symbol.source == DisplaySymbolSource::Custom;
+    }
+
+    if (factorySymbolExists(letter)) {
+        symbol.source = DisplaySymbolSource::Factory;
+        return true;
+    }
+
+    symbol.source = DisplaySymbolSource::Missing;
+    return false;
+}
+
+void refreshDisplayPlan(int weekday) {
+    if (weekday < 0 || weekday >= static_cast<int>(NUM_DAYS)) {
+        return;
+    }
+    if (plan.valid && plan.weekday == weekday && plan.revision == configRevision) {
+        return;
+    }
+    buildDisplayPlan(weekday);
+}
+
+const DisplayPlanEntry *getDisplayPlanEntry(uint8_t triggerIndex, int weekday) {
+    if (triggerIndex >= NUM_TRIGGERS || weekday < 0 || weekday >= static_cast<int>(NUM_DAYS)) {
+        return nullptr;
+    }
+    refreshDisplayPlan(weekday);
+    return &plan.entries[triggerIndex];
+}
+
+uint16_t pickDisplayPlanColor(const DisplayPlanEntry &entry) {
+    const LetterColorMode colorMode = static_cast<LetterColorMode>(entry.colorMode);
+    if (colorMode == LetterColorMode::Fixed) {
+        return entry.color565;
+    }
+    if (colorMode == LetterColorMode::RandomAll) {
+        return rainbowColor565();
+    }
+
+    size_t selectedCount = 0;
+    for (size_t index = 0; index < RANDOM_COLOR_PALETTE_SIZE; ++index) {
+        if ((entry.paletteMask & static_cast<uint16_t>(1U << index)) != 0U) {
+            ++selectedCount;
+        }
+    }
+    if (selectedCount == 0) {
+        return entry.color565;
+    }
+
+    size_t selectedOffset = static_cast<size_t>(random(static_cast<long>(selectedCount)));
+    for (size_t index = 0; index < RANDOM_COLOR_PALETTE_SIZE; ++index) {
+        if ((entry.paletteMask & static_cast<uint16_t>(1U << index)) == 0U) {
+            continue;
+        }
+        if (selectedOffset == 0) {
+            return plan.paletteColors[index];
+        }
+        --selectedOffset;
+    }
+    return entry.color565;
+}
+
+uint16_t renderDisplaySymbol(const DisplaySymbol &symbol, uint16_t color) {
+    switch (symbol.source) {
+        case DisplaySymbolSource::Factory:
+            return renderFactorySymbol(symbol.letter, color);
+        case DisplaySymbolSource::BuiltinOverride: {
+            const SymbolView view = ramSymbolView(findEditableBuiltinSymbolBitmap(symbol.letter));
+            return view ? renderSymbolView(view, color) : renderFactorySymbol(symbol.letter, color);
+        }
+        case DisplaySymbolSource::Custom:
+            return renderSymbolView(ramSymbolView(findCustomSymbolBitmap(symbol.letter)), color);
+        default:
+            return 0;
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef DISPLAY_PLAN_H
+#define DISPLAY_PLAN_H
+
+#include "config.h"
+
+// **Tagesplan für die Anzeige**
+// Wird einmal pro Tageswechsel bzw. nach jeder Konfigurationsänderung
+// (configRevision) aufgebaut. Der Trigger-Pfad liest danach nur noch fertige
+// Einträge: Bitmap-Quelle, RGB565-Farbe, Verzögerung und Farbmodus, ohne String
+// oder strtol.
+
+enum class DisplaySymbolSource : uint8_t {
+    Missing = 0,
+    Factory,          // Lauf-Tabelle/PROGMEM-Bitmap aus symbol_defaults.h
+    BuiltinOverride,  // bearbeitete Bitmap aus dem Symbol-Cache (symbol_store.cpp)
+    Custom,           // Zusatz-Symbol des Katalogs aus dem Symbol-Cache (symbol_store.cpp)
+    RandomSelection,  // '*' – Auswahl erfolgt erst bei der Anzeige
+};
+
+struct DisplaySymbol {
+    char letter;
+    DisplaySymbolSource source;
+};
+
+struct DisplayPlanEntry {
+    DisplaySymbol symbol;
+    unsigned long delayMs;
+    uint16_t color565;      // feste Farbe, auch Rückfall bei leerer Palette
+    uint16_t paletteMask;   // Auswahl für LetterColorMode::RandomSelected
+    uint8_t colorMode;      // LetterColorMode als Rohwert
+};
+
+// Liefert den Eintrag für Trigger und Wochentag; baut den Plan bei Bedarf neu.
+// nullptr bei ungültigem Trigger oder Wochentag.
+const DisplayPlanEntry *getDisplayPlanEntry(uint8_t triggerIndex, int weekday);
+
+// Baut den Plan vorab auf, damit der erste Trigger des Tages nichts rechnen muss.
+void refreshDisplayPlan(int weekday);
+
+// Ordnet ein Zeichen seiner Bitmap-Quelle zu (Override > eigenes Symbol > Factory).
+bool resolveDisplaySymbol(char letter, DisplaySymbol &symbol);
+
+// Wählt die Anzeigefarbe gemäß Farbmodus; nutzt nur vorberechnete RGB565-Werte.
+uint16_t pickDisplayPlanColor(const DisplayPlanEntry &entry);
+
+// Zeichnet ein aufgelöstes Symbol; liefert die Anzahl der Läufe.
+uint16_t renderDisplaySymbol(const DisplaySymbol &symbol, uint16_t color);
+
+#endif
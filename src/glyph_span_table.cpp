@@ -0,0 +1,20 @@
+#include "glyph_span_table.h"
+
+#if RIDDLEMATRIX_GLYPH_SPAN_TABLES
+
+// Wird vollständig vom Compiler berechnet und landet als Konstante im Flash.
+constexpr FactoryGlyphSpanTable factoryGlyphSpanTable PROGMEM = buildFactoryGlyphSpanTable();
+
+bool findFactoryGlyphSpans(char symbol, uint16_t &first, uint16_t &count) {
+    for (size_t index = 0; index < FACTORY_GLYPH_COUNT; ++index) {
+        const FactoryGlyphSpanRange *range = &factoryGlyphSpanTable.ranges[index];
+        if (static_cast<char>(pgm_read_byte(&range->symbol)) == symbol) {
+            first = pgm_read_word(&range->first);
+            count = pgm_read_word(&range->count);
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif
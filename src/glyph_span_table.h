@@ -0,0 +1,131 @@
+#ifndef GLYPH_SPAN_TABLE_H
+#define GLYPH_SPAN_TABLE_H
+
+#include "symbol_defaults.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **Vorberechnete Pixel-Läufe der Factory-Symbole**
+// Die Tabelle wird beim Kompilieren aus den Bitmaps in symbol_defaults.h
+// erzeugt; displayLetter() streamt dann nur noch fertige Läufe statt jede
+// Zeile per pgm_read_byte zu zerlegen. Mit -DRIDDLEMATRIX_GLYPH_SPAN_TABLES=0
+// entfällt die Tabelle (spart Flash, siehe FACTORY_GLYPH_SPAN_TABLE_BYTES).
+#ifndef RIDDLEMATRIX_GLYPH_SPAN_TABLES
+#define RIDDLEMATRIX_GLYPH_SPAN_TABLES 1
+#endif
+
+struct FactoryGlyphSource {
+    char symbol;
+    const uint8_t *bitmap;
+};
+
+// Reihenfolge und Umfang entsprechen getFactorySymbolBitmap().
+constexpr FactoryGlyphSource FACTORY_GLYPH_SOURCES[] = {
+    {'A', letter_A}, {'B', letter_B}, {'C', letter_C}, {'D', letter_D}, {'E', letter_E},
+    {'F', letter_F}, {'G', letter_G}, {'H', letter_H}, {'I', letter_I}, {'J', letter_J},
+    {'K', letter_K}, {'L', letter_L}, {'M', letter_M}, {'N', letter_N}, {'O', letter_O},
+    {'P', letter_P}, {'Q', letter_Q}, {'R', letter_R}, {'S', letter_S}, {'T', letter_T},
+    {'U', letter_U}, {'V', letter_V}, {'W', letter_W}, {'X', letter_X}, {'Y', letter_Y},
+    {'Z', letter_Z}, {'#', letter_SUN}, {'~', letter_WIFI}, {'&', letter_RIESENRAD},
+    {'?', letter_RIDDLER},
+};
+
+constexpr size_t FACTORY_GLYPH_COUNT = sizeof(FACTORY_GLYPH_SOURCES) / sizeof(FACTORY_GLYPH_SOURCES[0]);
+constexpr uint8_t GLYPH_SIZE = 32;
+
+// Ein Lauf als 16 Bit: Zeile (5 Bit) | Startspalte (5 Bit) | Länge - 1 (5 Bit).
+constexpr uint16_t encodeGlyphSpan(uint8_t row, uint8_t column, uint8_t length) {
+    return static_cast<uint16_t>((row << 10) | (column << 5) | (length - 1));
+}
+constexpr uint8_t glyphSpanRow(uint16_t span) { return static_cast<uint8_t>((span >> 10) & 0x1F); }
+constexpr uint8_t glyphSpanColumn(uint16_t span) { return static_cast<uint8_t>((span >> 5) & 0x1F); }
+constexpr uint8_t glyphSpanLength(uint16_t span) { return static_cast<uint8_t>((span & 0x1F) + 1); }
+
+constexpr uint32_t glyphRowBits(const uint8_t *bitmap, uint8_t row) {
+    return (static_cast<uint32_t>(bitmap[row * 4]) << 24) |
+           (static_cast<uint32_t>(bitmap[(row * 4) + 1]) << 16) |
+           (static_cast<uint32_t>(bitmap[(row * 4) + 2]) << 8) |
+           static_cast<uint32_t>(bitmap[(row * 4) + 3]);
+}
+
+constexpr bool glyphPixelSet(uint32_t rowBits, uint8_t column) {
+    return (rowBits & (0x80000000UL >> column)) != 0U;
+}
+
+constexpr uint16_t countGlyphSpans(const uint8_t *bitmap) {
+    uint16_t count = 0;
+    for (uint8_t row = 0; row < GLYPH_SIZE; ++row) {
+        const uint32_t rowBits = glyphRowBits(bitmap, row);
+        for (uint8_t column = 0; column < GLYPH_SIZE; ++column) {
+            if (glyphPixelSet(rowBits, column) && (column == 0 || !glyphPixelSet(rowBits, column - 1))) {
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+constexpr size_t countFactoryGlyphSpans() {
+    size_t total = 0;
+    for (size_t index = 0; index < FACTORY_GLYPH_COUNT; ++index) {
+        total += countGlyphSpans(FACTORY_GLYPH_SOURCES[index].bitmap);
+    }
+    return total;
+}
+
+constexpr size_t FACTORY_GLYPH_SPAN_COUNT = countFactoryGlyphSpans();
+
+struct FactoryGlyphSpanRange {
+    uint16_t first;
+    uint16_t count;
+    char symbol;
+};
+
+struct FactoryGlyphSpanTable {
+    FactoryGlyphSpanRange ranges[FACTORY_GLYPH_COUNT];
+    uint16_t spans[FACTORY_GLYPH_SPAN_COUNT];
+};
+
+constexpr FactoryGlyphSpanTable buildFactoryGlyphSpanTable() {
+    FactoryGlyphSpanTable table{};
+    uint16_t next = 0;
+    for (size_t glyph = 0; glyph < FACTORY_GLYPH_COUNT; ++glyph) {
+        const uint8_t *bitmap = FACTORY_GLYPH_SOURCES[glyph].bitmap;
+        table.ranges[glyph].first = next;
+        table.ranges[glyph].symbol = FACTORY_GLYPH_SOURCES[glyph].symbol;
+        for (uint8_t row = 0; row < GLYPH_SIZE; ++row) {
+            const uint32_t rowBits = glyphRowBits(bitmap, row);
+            uint8_t column = 0;
+            while (column < GLYPH_SIZE) {
+                if (!glyphPixelSet(rowBits, column)) {
+                    ++column;
+                    continue;
+                }
+                uint8_t length = 0;
+                while (column + length < GLYPH_SIZE && glyphPixelSet(rowBits, column + length)) {
+                    ++length;
+                }
+                table.spans[next++] = encodeGlyphSpan(row, column, length);
+                column = static_cast<uint8_t>(column + length);
+            }
+        }
+        table.ranges[glyph].count = static_cast<uint16_t>(next - table.ranges[glyph].first);
+    }
+    return table;
+}
+
+// Flash-Bedarf der Lauf-Tabelle im Vergleich zu den Quell-Bitmaps.
+constexpr size_t FACTORY_GLYPH_SPAN_TABLE_BYTES = sizeof(FactoryGlyphSpanTable);
+constexpr size_t FACTORY_GLYPH_BITMAP_BYTES = FACTORY_GLYPH_COUNT * sizeof(letter_A);
+
+static_assert(FACTORY_GLYPH_SPAN_COUNT <= 0xFFFF, "Lauf-Tabelle passt nicht in 16-Bit-Indizes");
+
+#if RIDDLEMATRIX_GLYPH_SPAN_TABLES
+extern const FactoryGlyphSpanTable factoryGlyphSpanTable;
+
+// Sucht die vorberechneten Läufe eines Factory-Symbols (liegt im PROGMEM).
+bool findFactoryGlyphSpans(char symbol, uint16_t &first, uint16_t &count);
+#endif
+
+#endif
@@ -0,0 +1,464 @@
+#include "json_stream.h"
+
+#include <string.h>
+
+namespace {
+
+enum ParserState : uint8_t {
+    StateValue,            // Wert erwartet (Wurzel, nach ':' bzw. nach ',' im Array)
+    StateValueOrArrayEnd,  // nach '['
+    StateKeyOrObjectEnd,   // nach '{'
+    StateKey,              // nach ',' im Objekt
+    StateColon,
+    StateCommaOrEnd,
+    StateString,
+    StateStringEscape,
+    StateStringUnicode,
+    StateNumber,
+    StateLiteral,
+    StateDone,
+};
+
+// Grammatik einer Zahl: -? (0 | [1-9][0-9]*) (. [0-9]+)? ([eE] [+-]? [0-9]+)?
+enum NumberState : uint8_t {
+    NumberSign,
+    NumberZero,
+    NumberInteger,
+    NumberDot,
+    NumberFraction,
+    NumberExponentStart,
+    NumberExponentSign,
+    NumberExponent,
+};
+
+const char *const LITERALS[] = {"true", "false", "null"};
+constexpr uint8_t LITERAL_NULL = 2;
+
+bool isWhitespace(char value) {
+    return value == ' ' || value == '\t' || value == '\n' || value == '\r';
+}
+
+bool isDigit(char value) {
+    return value >= '0' && value <= '9';
+}
+
+bool fail(JsonStreamParser &parser, JsonStreamError error) {
+    if (parser.error == JsonStreamError::None) {
+        parser.error = error;
+    }
+    return false;
+}
+
+bool emit(JsonStreamParser &parser, JsonStreamEvent event, JsonStreamType type) {
+    if (parser.callback != nullptr && !parser.callback(parser, event, type, parser.user)) {
+        return fail(parser, JsonStreamError::Aborted);
+    }
+    return true;
+}
+
+bool isObjectLevel(const JsonStreamParser &parser, size_t level) {
+    return ((parser.objectLevels >> level) & 1U) != 0U;
+}
+
+void resetText(JsonStreamParser &parser) {
+    parser.textLength = 0;
+    parser.truncated = false;
+    parser.text[0] = '\0';
+}
+
+void appendText(JsonStreamParser &parser, char value) {
+    if (parser.textLength + 1U < JSON_STREAM_TEXT_SIZE) {
+        parser.text[parser.textLength++] = value;
+        parser.text[parser.textLength] = '\0';
+    } else {
+        parser.truncated = true;
+    }
+}
+
+void appendCodePoint(JsonStreamParser &parser, uint16_t codePoint) {
+    if (codePoint < 0x80U) {
+        appendText(parser, static_cast<char>(codePoint));
+    } else if (codePoint < 0x800U) {
+        appendText(parser, static_cast<char>(0xC0U | (codePoint >> 6)));
+        appendText(parser, static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    } else {
+        appendText(parser, static_cast<char>(0xE0U | (codePoint >> 12)));
+        appendText(parser, static_cast<char>(0x80U | ((codePoint >> 6) & 0x3FU)));
+        appendText(parser, static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    }
+}
+
+// Nach einem vollständigen Wert folgt ',' bzw. das Container-Ende, an der Wurzel nur noch Leerraum.
+void completeValue(JsonStreamParser &parser) {
+    parser.state = parser.depth == 0 ? StateDone : StateCommaOrEnd;
+}
+
+void countValue(JsonStreamParser &parser) {
+    if (parser.depth > 0) {
+        ++parser.counts[parser.depth - 1];
+    }
+}
+
+bool beginContainer(JsonStreamParser &parser, bool object) {
+    if (parser.depth >= JSON_STREAM_MAX_DEPTH) {
+        return fail(parser, JsonStreamError::TooDeep);
+    }
+    countValue(parser);
+    if (!emit(parser, JsonStreamEvent::Value, object ? JsonStreamType::Object : JsonStreamType::Array)) {
+        return false;
+    }
+    const uint8_t level = parser.depth++;
+    parser.counts[level] = 0;
+    if (object) {
+        parser.objectLevels |= static_cast<uint16_t>(1U << level);
+    } else {
+        parser.objectLevels &= static_cast<uint16_t>(~(1U << level));
+    }
+    if (level < JSON_STREAM_PATH_DEPTH) {
+        parser.keys[level][0] = '\0';
+    }
+    parser.state = object ? StateKeyOrObjectEnd : StateValueOrArrayEnd;
+    return true;
+}
+
+bool endContainer(JsonStreamParser &parser, bool object) {
+    if (parser.depth == 0 || isObjectLevel(parser, parser.depth - 1U) != object) {
+        return fail(parser, JsonStreamError::InvalidInput);
+    }
+    parser.endCount = parser.counts[--parser.depth];
+    if (!emit(parser, JsonStreamEvent::End, object ? JsonStreamType::Object : JsonStreamType::Array)) {
+        return false;
+    }
+    completeValue(parser);
+    return true;
+}
+
+bool beginValue(JsonStreamParser &parser, char value) {
+    parser.started = true;
+    if (value == '{' || value == '[') {
+        return beginContainer(parser, value == '{');
+    }
+    resetText(parser);
+    if (value == '"') {
+        countValue(parser);
+        parser.key = false;
+        parser.state = StateString;
+        return true;
+    }
+    if (value == '-' || isDigit(value)) {
+        countValue(parser);
+        appendText(parser, value);
+        parser.detail = value == '-' ? NumberSign : (value == '0' ? NumberZero : NumberInteger);
+        parser.state = StateNumber;
+        return true;
+    }
+    for (uint8_t literal = 0; literal < sizeof(LITERALS) / sizeof(LITERALS[0]); ++literal) {
+        if (value == LITERALS[literal][0]) {
+            countValue(parser);
+            appendText(parser, value);
+            parser.literal = literal;
+            parser.detail = 1;
+            parser.state = StateLiteral;
+            return true;
+        }
+    }
+    return fail(parser, JsonStreamError::InvalidInput);
+}
+
+bool completeString(JsonStreamParser &parser) {
+    if (parser.key) {
+        const size_t level = parser.depth - 1U;
+        if (level < JSON_STREAM_PATH_DEPTH) {
+            // Abgeschnittene Schlüssel dürfen keinen bekannten Schlüssel vortäuschen.
+            strcpy(parser.keys[level], parser.truncated ? "" : parser.text);
+        }
+        parser.state = StateColon;
+        return true;
+    }
+    if (!emit(parser, JsonStreamEvent::Value, JsonStreamType::String)) {
+        return false;
+    }
+    completeValue(parser);
+    return true;
+}
+
+bool advanceNumber(uint8_t &state, char value) {
+    const bool digit = isDigit(value);
+    const bool exponent = value == 'e' || value == 'E';
+    switch (state) {
+        case NumberSign:
+            if (digit) {
+                state = value == '0' ? NumberZero : NumberInteger;
+            }
+            return digit;
+        case NumberZero:
+        case NumberInteger:
+            if (digit && state == NumberInteger) {
+                return true;
+            }
+            if (value == '.' || exponent) {
+                state = value == '.' ? NumberDot : NumberExponentStart;
+                return true;
+            }
+            return false;
+        case NumberDot:
+        case NumberFraction:
+            if (digit) {
+                state = NumberFraction;
+                return true;
+            }
+            if (exponent && state == NumberFraction) {
+                state = NumberExponentStart;
+                return true;
+            }
+            return false;
+        case NumberExponentStart:
+            if (value == '+' || value == '-') {
+                state = NumberExponentSign;
+                return true;
+            }
+            // fall through
+        default:
+            if (digit) {
+                state = NumberExponent;
+            }
+            return digit;
+    }
+}
+
+bool completeNumber(JsonStreamParser &parser) {
+    if (parser.detail != NumberZero && parser.detail != NumberInteger && parser.detail != NumberFraction &&
+        parser.detail != NumberExponent) {
+        return fail(parser, JsonStreamError::InvalidInput);
+    }
+    if (!emit(parser, JsonStreamEvent::Value, JsonStreamType::Number)) {
+        return false;
+    }
+    completeValue(parser);
+    return true;
+}
+
+int hexValue(char value) {
+    if (isDigit(value)) {
+        return value - '0';
+    }
+    if (value >= 'a' && value <= 'f') {
+        return value - 'a' + 10;
+    }
+    if (value >= 'A' && value <= 'F') {
+        return value - 'A' + 10;
+    }
+    return -1;
+}
+
+char unescape(char value) {
+    switch (value) {
+        case '"':
+        case '\\':
+        case '/':
+            return value;
+        case 'b':
+            return '\b';
+        case 'f':
+            return '\f';
+        case 'n':
+            return '\n';
+        case 'r':
+            return '\r';
+        case 't':
+            return '\t';
+        default:
+            return '\0';
+    }
+}
+
+bool step(JsonStreamParser &parser, char value) {
+    switch (parser.state) {
+        case StateString:
+            if (value == '"') {
+                return completeString(parser);
+            }
+            if (value == '\\') {
+                parser.state = StateStringEscape;
+            } else if (static_cast<uint8_t>(value) < 0x20U) {
+                return fail(parser, JsonStreamError::InvalidInput);
+            } else {
+                appendText(parser, value);
+            }
+            return true;
+        case StateStringEscape:
+            if (value == 'u') {
+                parser.unicode = 0;
+                parser.detail = 0;
+                parser.state = StateStringUnicode;
+                return true;
+            }
+            if (unescape(value) == '\0') {
+                return fail(parser, JsonStreamError::InvalidInput);
+            }
+            appendText(parser, unescape(value));
+            parser.state = StateString;
+            return true;
+        case StateStringUnicode: {
+            const int digit = hexValue(value);
+            if (digit < 0) {
+                return fail(parser, JsonStreamError::InvalidInput);
+            }
+            parser.unicode = static_cast<uint16_t>((parser.unicode << 4) | static_cast<uint16_t>(digit));
+            if (++parser.detail == 4) {
+                appendCodePoint(parser, parser.unicode);
+                parser.state = StateString;
+            }
+            return true;
+        }
+        case StateNumber:
+            if (advanceNumber(parser.detail, value)) {
+                appendText(parser, value);
+                return true;
+            }
+            // Das erste Zeichen nach der Zahl gehört schon zum nächsten Token.
+            return completeNumber(parser) && step(parser, value);
+        case StateLiteral: {
+            const char *literal = LITERALS[parser.literal];
+            if (value != literal[parser.detail]) {
+                return fail(parser, JsonStreamError::InvalidInput);
+            }
+            appendText(parser, value);
+            if (literal[++parser.detail] != '\0') {
+                return true;
+            }
+            if (!emit(parser, JsonStreamEvent::Value,
+                      parser.literal == LITERAL_NULL ? JsonStreamType::Null : JsonStreamType::Boolean)) {
+                return false;
+            }
+            completeValue(parser);
+            return true;
+        }
+        default:
+            break;
+    }
+
+    if (isWhitespace(value)) {
+        return true;
+    }
+    switch (parser.state) {
+        case StateValue:
+            return beginValue(parser, value);
+        case StateValueOrArrayEnd:
+            return value == ']' ? endContainer(parser, false) : beginValue(parser, value);
+        case StateKeyOrObjectEnd:
+            if (value == '}') {
+                return endContainer(parser, true);
+            }
+            // fall through
+        case StateKey:
+            if (value != '"') {
+                return fail(parser, JsonStreamError::InvalidInput);
+            }
+            resetText(parser);
+            parser.key = true;
+            parser.state = StateString;
+            return true;
+        case StateColon:
+            if (value != ':') {
+                return fail(parser, JsonStreamError::InvalidInput);
+            }
+            parser.state = StateValue;
+            return true;
+        case StateCommaOrEnd: {
+            const bool object = isObjectLevel(parser, parser.depth - 1U);
+            if (value == ',') {
+                parser.state = object ? StateKey : StateValue;
+                return true;
+            }
+            if (value == (object ? '}' : ']')) {
+                return endContainer(parser, object);
+            }
+            return fail(parser, JsonStreamError::InvalidInput);
+        }
+        default:
+            return fail(parser, JsonStreamError::InvalidInput);
+    }
+}
+
+} // namespace
+
+void beginJsonStream(JsonStreamParser &parser, JsonStreamCallback callback, void *user) {
+    memset(&parser, 0, sizeof(parser));
+    parser.callback = callback;
+    parser.user = user;
+    parser.error = JsonStreamError::None;
+    parser.state = StateValue;
+}
+
+bool feedJsonStream(JsonStreamParser &parser, const uint8_t *data, size_t length) {
+    if (parser.error != JsonStreamError::None) {
+        return false;
+    }
+    for (size_t index = 0; index < length; ++index) {
+        if (!step(parser, static_cast<char>(data[index]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool finishJsonStream(JsonStreamParser &parser) {
+    if (parser.error != JsonStreamError::None) {
+        return false;
+    }
+    if (parser.state == StateNumber && parser.depth == 0 && !completeNumber(parser)) {
+        return false;
+    }
+    if (parser.state == StateDone) {
+        return true;
+    }
+    return fail(parser, parser.started ? JsonStreamError::IncompleteInput : JsonStreamError::EmptyInput);
+}
+
+size_t jsonStreamDepth(const JsonStreamParser &parser) {
+    return parser.depth;
+}
+
+const char *jsonStreamKey(const JsonStreamParser &parser, size_t level) {
+    if (level >= parser.depth || level >= JSON_STREAM_PATH_DEPTH || !isObjectLevel(parser, level)) {
+        return "";
+    }
+    return parser.keys[level];
+}
+
+size_t jsonStreamIndex(const JsonStreamParser &parser, size_t level) {
+    if (level >= parser.depth || isObjectLevel(parser, level) || parser.counts[level] == 0) {
+        return 0;
+    }
+    return parser.counts[level] - 1U;
+}
+
+const char *jsonStreamText(const JsonStreamParser &parser) {
+    return parser.text;
+}
+
+bool jsonStreamTextTruncated(const JsonStreamParser &parser) {
+    return parser.truncated;
+}
+
+size_t jsonStreamCount(const JsonStreamParser &parser) {
+    return parser.endCount;
+}
+
+const char *jsonStreamErrorText(JsonStreamError error) {
+    switch (error) {
+        case JsonStreamError::None:
+            return "Ok";
+        case JsonStreamError::EmptyInput:
+            return "EmptyInput";
+        case JsonStreamError::IncompleteInput:
+            return "IncompleteInput";
+        case JsonStreamError::TooDeep:
+            return "TooDeep";
+        case JsonStreamError::Aborted:
+            return "Aborted";
+        default:
+            return "InvalidInput";
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **Streamender JSON-Parser**
+// Liest ein JSON-Dokument in beliebig zerteilten Stücken, ohne den Rumpf zu puffern. Statt eines
+// Dokumentbaums meldet er jeden Wert an einen Callback: Skalare einmal mit ihrem Text, Objekte und
+// Arrays einmal zu Beginn (JsonStreamEvent::Value) und einmal am Ende (JsonStreamEvent::End, mit
+// Elementanzahl). Der Pfad des gemeldeten Werts steht über jsonStreamKey()/jsonStreamIndex() bereit,
+// Schlüssel allerdings nur für die äußeren JSON_STREAM_PATH_DEPTH Ebenen; tiefer verschachtelte
+// Werte werden nur noch auf Syntax geprüft. Der Speicherbedarf ist fest (sizeof(JsonStreamParser)).
+static constexpr size_t JSON_STREAM_MAX_DEPTH = 10;   // Verschachtelungsgrenze wie bei ArduinoJson
+static constexpr size_t JSON_STREAM_PATH_DEPTH = 3;
+static constexpr size_t JSON_STREAM_KEY_SIZE = 24;    // längere Schlüssel werden als "" gemeldet
+static constexpr size_t JSON_STREAM_TEXT_SIZE = 24;   // längere Werte werden abgeschnitten
+
+enum class JsonStreamType : uint8_t {
+    Object,
+    Array,
+    String,
+    Number,
+    Boolean,
+    Null,
+};
+
+enum class JsonStreamEvent : uint8_t {
+    Value,  // Skalar oder Beginn eines Objekts/Arrays
+    End,    // Ende eines Objekts/Arrays
+};
+
+enum class JsonStreamError : uint8_t {
+    None,
+    EmptyInput,
+    IncompleteInput,
+    InvalidInput,
+    TooDeep,
+    Aborted,  // der Callback hat false geliefert
+};
+
+struct JsonStreamParser;
+
+// Liefert der Callback false, bricht das Parsen mit JsonStreamError::Aborted ab.
+typedef bool (*JsonStreamCallback)(const JsonStreamParser &parser, JsonStreamEvent event, JsonStreamType type,
+                                   void *user);
+
+struct JsonStreamParser {
+    JsonStreamCallback callback;
+    void *user;
+    JsonStreamError error;
+    uint8_t state;
+    uint8_t detail;      // Zahl: Grammatik-Zustand, Literal: Position, \u: gelesene Ziffern
+    uint8_t literal;
+    uint8_t depth;       // Anzahl offener Objekte/Arrays
+    bool started;
+    bool key;            // gelesene Zeichenkette ist ein Schlüssel
+    bool truncated;
+    uint8_t textLength;
+    uint16_t unicode;
+    uint16_t objectLevels;  // Bit i gesetzt: Ebene i ist ein Objekt
+    uint16_t counts[JSON_STREAM_MAX_DEPTH];
+    uint16_t endCount;
+    char keys[JSON_STREAM_PATH_DEPTH][JSON_STREAM_KEY_SIZE];
+    char text[JSON_STREAM_TEXT_SIZE];
+};
+
+void beginJsonStream(JsonStreamParser &parser, JsonStreamCallback callback, void *user);
+
+// Verarbeitet das nächste Stück des Dokuments; false nach einem Fehler (siehe parser.error).
+bool feedJsonStream(JsonStreamParser &parser, const uint8_t *data, size_t length);
+
+// Schließt das Dokument ab; true nur für ein vollständiges, gültiges Dokument.
+bool finishJsonStream(JsonStreamParser &parser);
+
+// Anzahl der Objekte/Arrays, die den gemeldeten Wert umschließen (0 = Wurzel).
+size_t jsonStreamDepth(const JsonStreamParser &parser);
+
+// Schlüssel bzw. Index, unter dem der gemeldete Wert (oder sein Vorfahr) in Ebene `level` steht.
+const char *jsonStreamKey(const JsonStreamParser &parser, size_t level);
+size_t jsonStreamIndex(const JsonStreamParser &parser, size_t level);
+
+// Text eines Skalars ("true"/"false"/"null" bei Literalen) und ob er abgeschnitten wurde.
+const char *jsonStreamText(const JsonStreamParser &parser);
+bool jsonStreamTextTruncated(const JsonStreamParser &parser);
+
+// Elementanzahl des gerade beendeten Objekts/Arrays (JsonStreamEvent::End).
+size_t jsonStreamCount(const JsonStreamParser &parser);
+
+const char *jsonStreamErrorText(JsonStreamError error);
+
+#endif
@@ -0,0 +1,295 @@
+#include "log_manager.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+#endif
+
+namespace {
+
+LogEntry logEntries[LOG_ENTRY_COUNT];
+uint32_t nextSequence = 0;
+
+const char *const LOG_MODULE_TAGS[] = {"TRG", "DSP", "WIFI", "CFG", "WEB"};
+const char LOG_LEVEL_TAGS[] = {'-', 'E', 'W', 'I', 'D'};
+
+// Eine printf-Umwandlung ohne Längenangabe; beim Ausgeben wird sie passend zum gespeicherten Typ ergänzt.
+struct FormatSpec {
+    char flags[12];      // Flags, Breite, Genauigkeit
+    uint8_t flagsLength;
+    char lengthModifier; // 0, 'h', 'l', 'q' (ll) oder 'z'
+    char conversion;
+};
+
+char readFormatChar(const char *address) {
+    return static_cast<char>(pgm_read_byte(address));
+}
+
+// format zeigt hinter das '%'; Rückgabe zeigt hinter die Umwandlung.
+const char *parseFormatSpec(const char *format, FormatSpec &spec) {
+    spec = {};
+    char current = readFormatChar(format);
+    while (current != '\0' && strchr("-+ #0123456789.", current) != nullptr) {
+        if (spec.flagsLength < sizeof(spec.flags) - 1) {
+            spec.flags[spec.flagsLength++] = current;
+        }
+        current = readFormatChar(++format);
+    }
+    while (current == 'h' || current == 'l' || current == 'z') {
+        spec.lengthModifier = (spec.lengthModifier == 'l' && current == 'l') ? 'q' : current;
+        current = readFormatChar(++format);
+    }
+    spec.conversion = current;
+    return current == '\0' ? format : format + 1;
+}
+
+bool isFloatConversion(char conversion) {
+    return conversion == 'f' || conversion == 'F' || conversion == 'e' || conversion == 'E' ||
+        conversion == 'g' || conversion == 'G';
+}
+
+void storeArgument(LogEntry &entry, size_t &argCount, uint32_t value) {
+    if (argCount < LOG_ENTRY_MAX_ARGS) {
+        entry.args[argCount] = value;
+    }
+    ++argCount;
+}
+
+void storeText(LogEntry &entry, size_t &textLength, const char *value) {
+    if (textLength >= LOG_ENTRY_TEXT_LENGTH) {
+        return;
+    }
+    if (value == nullptr) {
+        value = "(null)";
+    }
+    while (textLength < LOG_ENTRY_TEXT_LENGTH - 1 && *value != '\0') {
+        entry.text[textLength++] = *value++;
+    }
+    entry.text[textLength++] = '\0';
+}
+
+// Legt die Argumente binär im Eintrag ab; Strings werden kopiert, weil sie nur bis zum Aufruf gültig sind.
+void captureArguments(LogEntry &entry, const char *format, va_list arguments) {
+    size_t argCount = 0;
+    size_t textLength = 0;
+    for (char current = readFormatChar(format); current != '\0'; current = readFormatChar(format)) {
+        ++format;
+        if (current != '%') {
+            continue;
+        }
+
+        FormatSpec spec;
+        format = parseFormatSpec(format, spec);
+        switch (spec.conversion) {
+            case '%':
+                break;
+            case 'd':
+            case 'i':
+            case 'c':
+                if (spec.lengthModifier == 'q') {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, long long)));
+                } else if (spec.lengthModifier == 'l') {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, long)));
+                } else if (spec.lengthModifier == 'z') {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, size_t)));
+                } else {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, int)));
+                }
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                if (spec.lengthModifier == 'q') {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, unsigned long long)));
+                } else if (spec.lengthModifier == 'l') {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, unsigned long)));
+                } else if (spec.lengthModifier == 'z') {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, size_t)));
+                } else {
+                    storeArgument(entry, argCount, static_cast<uint32_t>(va_arg(arguments, unsigned int)));
+                }
+                break;
+            case 'p':
+                storeArgument(entry, argCount, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(va_arg(arguments, void *))));
+                break;
+            case 's':
+                storeText(entry, textLength, va_arg(arguments, const char *));
+                break;
+            default:
+                if (isFloatConversion(spec.conversion)) {
+                    const float value = static_cast<float>(va_arg(arguments, double));
+                    uint32_t bits = 0;
+                    memcpy(&bits, &value, sizeof(bits));
+                    storeArgument(entry, argCount, bits);
+                    break;
+                }
+                return;  // unbekannte Umwandlung – weitere Argumente lassen sich nicht zuordnen
+        }
+    }
+}
+
+void appendFormatted(char *destination, size_t capacity, size_t &length, const char *format, ...) {
+    if (length + 1 >= capacity) {
+        return;
+    }
+    va_list arguments;
+    va_start(arguments, format);
+    const int written = vsnprintf(destination + length, capacity - length, format, arguments);
+    va_end(arguments);
+    if (written > 0) {
+        length += static_cast<size_t>(written);
+        if (length > capacity - 1) {
+            length = capacity - 1;
+        }
+    }
+}
+
+// Baut "%<flags><länge><umwandlung>" für snprintf aus dem RAM.
+void buildSpecText(const FormatSpec &spec, const char *lengthModifier, char conversion, char *specText, size_t capacity) {
+    snprintf(specText, capacity, "%%%s%s%c", spec.flags, lengthModifier, conversion);
+}
+
+} // namespace
+
+void logWrite(LogModule module, LogLevel level, const char *format, ...) {
+    LogEntry &entry = logEntries[nextSequence % LOG_ENTRY_COUNT];
+    memset(&entry, 0, sizeof(entry));
+    entry.sequence = nextSequence;
+    entry.timestamp = static_cast<uint32_t>(millis());
+    entry.format = format;
+    entry.module = module;
+    entry.level = level;
+
+    va_list arguments;
+    va_start(arguments, format);
+    captureArguments(entry, format, arguments);
+    va_end(arguments);
+    ++nextSequence;
+
+#if RIDDLEMATRIX_LOG_SERIAL
+    char line[LOG_LINE_MAX_LENGTH];
+    size_t length = 0;
+    appendFormatted(line, sizeof(line), length, "%lu %s %c ", static_cast<unsigned long>(entry.timestamp),
+                    getLogModuleTag(module), getLogLevelTag(level));
+    formatLogMessage(entry, line + length, sizeof(line) - length);
+    Serial.println(line);
+#endif
+}
+
+uint32_t getLogNextSequence() {
+    return nextSequence;
+}
+
+uint32_t getLogOldestSequence() {
+    return nextSequence > LOG_ENTRY_COUNT ? nextSequence - static_cast<uint32_t>(LOG_ENTRY_COUNT) : 0;
+}
+
+bool readLogEntry(uint32_t sequence, LogEntry &entry) {
+    if (sequence < getLogOldestSequence() || sequence >= nextSequence) {
+        return false;
+    }
+    entry = logEntries[sequence % LOG_ENTRY_COUNT];
+    return entry.sequence == sequence;
+}
+
+size_t formatLogMessage(const LogEntry &entry, char *destination, size_t capacity) {
+    if (capacity == 0) {
+        return 0;
+    }
+    destination[0] = '\0';
+    if (entry.format == nullptr) {
+        return 0;
+    }
+
+    size_t length = 0;
+    size_t argIndex = 0;
+    const char *text = entry.text;
+    const char *const textEnd = entry.text + LOG_ENTRY_TEXT_LENGTH;
+    const char *format = entry.format;
+    char specText[24];
+
+    for (char current = readFormatChar(format); current != '\0' && length + 1 < capacity;
+         current = readFormatChar(format)) {
+        ++format;
+        if (current != '%') {
+            destination[length++] = current;
+            destination[length] = '\0';
+            continue;
+        }
+
+        FormatSpec spec;
+        format = parseFormatSpec(format, spec);
+        const bool numeric = spec.conversion != '%' && spec.conversion != 's';
+        if (numeric && argIndex >= LOG_ENTRY_MAX_ARGS) {
+            appendFormatted(destination, capacity, length, "?");
+            ++argIndex;
+            continue;
+        }
+        const uint32_t value = numeric ? entry.args[argIndex] : 0;
+        switch (spec.conversion) {
+            case '%':
+                appendFormatted(destination, capacity, length, "%%");
+                break;
+            case 'd':
+            case 'i':
+                buildSpecText(spec, "l", spec.conversion, specText, sizeof(specText));
+                appendFormatted(destination, capacity, length, specText, static_cast<long>(static_cast<int32_t>(value)));
+                ++argIndex;
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                buildSpecText(spec, "l", spec.conversion, specText, sizeof(specText));
+                appendFormatted(destination, capacity, length, specText, static_cast<unsigned long>(value));
+                ++argIndex;
+                break;
+            case 'c':
+                buildSpecText(spec, "", 'c', specText, sizeof(specText));
+                appendFormatted(destination, capacity, length, specText, static_cast<int>(value));
+                ++argIndex;
+                break;
+            case 'p':
+                appendFormatted(destination, capacity, length, "0x%lx", static_cast<unsigned long>(value));
+                ++argIndex;
+                break;
+            case 's':
+                if (text < textEnd) {
+                    buildSpecText(spec, "", 's', specText, sizeof(specText));
+                    appendFormatted(destination, capacity, length, specText, text);
+                    text += strlen(text) + 1;
+                } else {
+                    appendFormatted(destination, capacity, length, "?");
+                }
+                break;
+            default:
+                if (isFloatConversion(spec.conversion)) {
+                    float floatValue = 0.0f;
+                    memcpy(&floatValue, &value, sizeof(floatValue));
+                    buildSpecText(spec, "", spec.conversion, specText, sizeof(specText));
+                    appendFormatted(destination, capacity, length, specText, static_cast<double>(floatValue));
+                    ++argIndex;
+                    break;
+                }
+                return length;
+        }
+    }
+    return length;
+}
+
+const char *getLogModuleTag(LogModule module) {
+    return LOG_MODULE_TAGS[static_cast<uint8_t>(module)];
+}
+
+char getLogLevelTag(LogLevel level) {
+    return LOG_LEVEL_TAGS[static_cast<uint8_t>(level)];
+}
+
+void clearLogBuffer() {
+    nextSequence = 0;
+    memset(logEntries, 0, sizeof(logEntries));
+}
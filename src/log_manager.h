@@ -0,0 +1,120 @@
+#ifndef LOG_MANAGER_H
+#define LOG_MANAGER_H
+
+#include <Arduino.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **Protokollierung mit Compile-Time-Stufen je Modul**
+// Serial teilt sich die Pins mit dem RS485-Bus; jede Zeile dort blockiert bei 19200 Baud
+// mehrere Millisekunden. Meldungen landen deshalb in einem binären Ringpuffer im RAM:
+// pro Eintrag nur Zeitstempel, Modul, Stufe, der Formatstring im Flash als Nachrichten-ID
+// und die Argumente. Formatiert wird erst beim Auslesen (/api/logs). Stufen oberhalb von
+// RIDDLEMATRIX_LOG_LEVEL_<MODUL> werden samt Argumenten wegoptimiert.
+// RIDDLEMATRIX_LOG_SERIAL=1 spiegelt Meldungen zusätzlich auf Serial (nur am Prüfstand).
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef RIDDLEMATRIX_LOG_LEVEL
+#define RIDDLEMATRIX_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+#ifndef RIDDLEMATRIX_LOG_LEVEL_TRIGGER
+#define RIDDLEMATRIX_LOG_LEVEL_TRIGGER RIDDLEMATRIX_LOG_LEVEL
+#endif
+#ifndef RIDDLEMATRIX_LOG_LEVEL_DISPLAY
+#define RIDDLEMATRIX_LOG_LEVEL_DISPLAY RIDDLEMATRIX_LOG_LEVEL
+#endif
+#ifndef RIDDLEMATRIX_LOG_LEVEL_WIFI
+#define RIDDLEMATRIX_LOG_LEVEL_WIFI RIDDLEMATRIX_LOG_LEVEL
+#endif
+#ifndef RIDDLEMATRIX_LOG_LEVEL_CONFIG
+#define RIDDLEMATRIX_LOG_LEVEL_CONFIG RIDDLEMATRIX_LOG_LEVEL
+#endif
+#ifndef RIDDLEMATRIX_LOG_LEVEL_WEB
+#define RIDDLEMATRIX_LOG_LEVEL_WEB RIDDLEMATRIX_LOG_LEVEL
+#endif
+
+#ifndef RIDDLEMATRIX_LOG_SERIAL
+#define RIDDLEMATRIX_LOG_SERIAL 0
+#endif
+
+#ifndef RIDDLEMATRIX_LOG_ENTRIES
+#define RIDDLEMATRIX_LOG_ENTRIES 32
+#endif
+
+#ifndef PSTR
+#define PSTR(s) (s)
+#endif
+
+enum class LogModule : uint8_t {
+    Trigger = 0,
+    Display,
+    WiFi,
+    Config,
+    Web
+};
+
+#define LOG_MODULE_TRIGGER LogModule::Trigger
+#define LOG_MODULE_DISPLAY LogModule::Display
+#define LOG_MODULE_WIFI LogModule::WiFi
+#define LOG_MODULE_CONFIG LogModule::Config
+#define LOG_MODULE_WEB LogModule::Web
+
+enum class LogLevel : uint8_t {
+    Error = LOG_LEVEL_ERROR,
+    Warn = LOG_LEVEL_WARN,
+    Info = LOG_LEVEL_INFO,
+    Debug = LOG_LEVEL_DEBUG
+};
+
+static constexpr size_t LOG_ENTRY_COUNT = RIDDLEMATRIX_LOG_ENTRIES;
+static constexpr size_t LOG_ENTRY_MAX_ARGS = 5;
+static constexpr size_t LOG_ENTRY_TEXT_LENGTH = 40;
+static constexpr size_t LOG_LINE_MAX_LENGTH = 128;
+
+static_assert(LOG_ENTRY_COUNT > 0, "RIDDLEMATRIX_LOG_ENTRIES muss mindestens 1 sein");
+
+struct LogEntry {
+    uint32_t sequence;
+    uint32_t timestamp;
+    const char *format;                   // Nachrichten-ID: Formatstring im Flash
+    uint32_t args[LOG_ENTRY_MAX_ARGS];    // Zahlen/Zeichen in Formatreihenfolge
+    char text[LOG_ENTRY_TEXT_LENGTH];     // %s-Argumente als Kopie, '\0'-getrennt
+    LogModule module;
+    LogLevel level;
+};
+
+// Format liegt im Flash (PSTR); printf-Syntax ohne '*'-Breiten. %s-Argumente müssen im RAM liegen,
+// F()-Texte also vorher kopieren. Bei mehr als
+// LOG_ENTRY_MAX_ARGS Zahlen oder zu langen Strings wird der Rest als '?' bzw. gekürzt ausgegeben.
+void logWrite(LogModule module, LogLevel level, const char *format, ...) __attribute__((format(printf, 3, 4)));
+
+// Laufende Nummern: gültig sind Einträge im Bereich [getLogOldestSequence(), getLogNextSequence()).
+uint32_t getLogNextSequence();
+uint32_t getLogOldestSequence();
+bool readLogEntry(uint32_t sequence, LogEntry &entry);
+
+// Setzt den Meldungstext aus Formatstring und gespeicherten Argumenten zusammen.
+size_t formatLogMessage(const LogEntry &entry, char *destination, size_t capacity);
+const char *getLogModuleTag(LogModule module);
+char getLogLevelTag(LogLevel level);
+void clearLogBuffer();
+
+#define LOG_AT(module, level, format, ...)                                            \
+    do {                                                                              \
+        if (RIDDLEMATRIX_LOG_LEVEL_##module >= LOG_LEVEL_##level) {                   \
+            logWrite(LOG_MODULE_##module, static_cast<LogLevel>(LOG_LEVEL_##level),   \
+                     PSTR(format), ##__VA_ARGS__);                                    \
+        }                                                                             \
+    } while (0)
+
+#define LOG_ERROR(module, format, ...) LOG_AT(module, ERROR, format, ##__VA_ARGS__)
+#define LOG_WARN(module, format, ...) LOG_AT(module, WARN, format, ##__VA_ARGS__)
+#define LOG_INFO(module, format, ...) LOG_AT(module, INFO, format, ##__VA_ARGS__)
+#define LOG_DEBUG(module, format, ...) LOG_AT(module, DEBUG, format, ##__VA_ARGS__)
+
+#endif
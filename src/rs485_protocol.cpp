@@ -0,0 +1,150 @@
+#include "rs485_protocol.h"
+
+namespace {
+
+enum class ParserState : uint8_t {
+    Idle,
+    Address,
+    Count,
+    Payload,
+    Checksum
+};
+
+ParserState parserState = ParserState::Idle;
+unsigned long lastByteAt = 0;
+uint8_t frameAddress = 0;
+uint8_t frameCount = 0;
+uint8_t frameReceived = 0;
+uint8_t frameCrc = 0;
+uint8_t frameTriggers[RS485_FRAME_MAX_TRIGGERS] = {};
+Rs485ReceiveStats receiveStats = {};
+
+uint8_t updateCrc8(uint8_t crc, uint8_t value) {
+    crc ^= value;
+    for (uint8_t bit = 0; bit < 8; ++bit) {
+        crc = (crc & 0x80U) ? static_cast<uint8_t>((crc << 1) ^ 0x07U) : static_cast<uint8_t>(crc << 1);
+    }
+    return crc;
+}
+
+bool isWhitespaceByte(uint8_t value) {
+    return value == '\r' || value == '\n' || value == ' ';
+}
+
+bool isFrameForBox(uint8_t address, uint8_t boxAddress) {
+    return boxAddress == RS485_BROADCAST_ADDRESS ||
+        address == RS485_BROADCAST_ADDRESS ||
+        address == boxAddress;
+}
+
+void restartFrame() {
+    parserState = ParserState::Address;
+    frameAddress = 0;
+    frameCount = 0;
+    frameReceived = 0;
+    frameCrc = 0;
+}
+
+bool handleIdleByte(uint8_t value, Rs485ParseResult &result) {
+    if (value == RS485_FRAME_START) {
+        restartFrame();
+        return false;
+    }
+    if (value >= '1' && value < static_cast<uint8_t>('1' + NUM_TRIGGERS)) {
+        ++receiveStats.legacyTriggers;
+        result.triggerCount = 1;
+        result.triggerIndices[0] = static_cast<uint8_t>(value - '1');
+        result.framed = false;
+        return true;
+    }
+    if (!isWhitespaceByte(value)) {
+        ++receiveStats.noiseBytes;
+    }
+    return false;
+}
+
+} // namespace
+
+uint8_t rs485Crc8(const uint8_t *data, size_t length) {
+    uint8_t crc = 0;
+    for (size_t index = 0; index < length; ++index) {
+        crc = updateCrc8(crc, data[index]);
+    }
+    return crc;
+}
+
+bool feedRs485Byte(uint8_t value, unsigned long now, uint8_t boxAddress, Rs485ParseResult &result) {
+    result.triggerCount = 0;
+    result.framed = false;
+
+    if (parserState != ParserState::Idle && (now - lastByteAt) > RS485_FRAME_TIMEOUT_MS) {
+        ++receiveStats.timeouts;
+        parserState = ParserState::Idle;
+    }
+    lastByteAt = now;
+
+    switch (parserState) {
+        case ParserState::Idle:
+            return handleIdleByte(value, result);
+
+        case ParserState::Address:
+            frameAddress = value;
+            frameCrc = updateCrc8(frameCrc, value);
+            parserState = ParserState::Count;
+            return false;
+
+        case ParserState::Count:
+            if (value == 0 || value > RS485_FRAME_MAX_TRIGGERS) {
+                ++receiveStats.malformedFrames;
+                parserState = ParserState::Idle;
+                return false;
+            }
+            frameCount = value;
+            frameCrc = updateCrc8(frameCrc, value);
+            parserState = ParserState::Payload;
+            return false;
+
+        case ParserState::Payload:
+            frameTriggers[frameReceived++] = value;
+            frameCrc = updateCrc8(frameCrc, value);
+            if (frameReceived >= frameCount) {
+                parserState = ParserState::Checksum;
+            }
+            return false;
+
+        case ParserState::Checksum:
+        default:
+            parserState = ParserState::Idle;
+            if (value != frameCrc) {
+                ++receiveStats.crcErrors;
+                return false;
+            }
+            for (uint8_t index = 0; index < frameCount; ++index) {
+                if (frameTriggers[index] < 1 || frameTriggers[index] > NUM_TRIGGERS) {
+                    ++receiveStats.malformedFrames;
+                    return false;
+                }
+            }
+            if (!isFrameForBox(frameAddress, boxAddress)) {
+                ++receiveStats.foreignFrames;
+                return false;
+            }
+            ++receiveStats.frames;
+            for (uint8_t index = 0; index < frameCount; ++index) {
+                result.triggerIndices[index] = static_cast<uint8_t>(frameTriggers[index] - 1);
+            }
+            result.triggerCount = frameCount;
+            result.framed = true;
+            return true;
+    }
+}
+
+const Rs485ReceiveStats &getRs485ReceiveStats() {
+    return receiveStats;
+}
+
+void resetRs485Parser() {
+    parserState = ParserState::Idle;
+    lastByteAt = 0;
+    receiveStats = {};
+}
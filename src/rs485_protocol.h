@@ -0,0 +1,53 @@
+#ifndef RS485_PROTOCOL_H
+#define RS485_PROTOCOL_H
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **Gerahmtes RS485-Triggerprotokoll**
+// Frame: 0x7E | Adresse | Anzahl n | n Trigger-IDs (1-3) | CRC-8 über Adresse bis letzte ID
+// (Polynom 0x07, Startwert 0x00). Adresse 0x00 gilt für alle Boxen; eine Box mit Adresse 0
+// nimmt jeden Frame an. Einzelne ASCII-Zeichen '1'..'3' außerhalb eines Frames bleiben als
+// Legacy-Trigger gültig. Der Parser arbeitet byteweise, damit checkTrigger() den
+// UART-Empfangspuffer in einem Rutsch leeren kann, auch wenn ein Frame über mehrere
+// loop()-Durchläufe verteilt ankommt.
+#ifndef RIDDLEMATRIX_RS485_RX_BUFFER_SIZE
+#define RIDDLEMATRIX_RS485_RX_BUFFER_SIZE 512
+#endif
+
+static constexpr size_t RS485_RX_BUFFER_SIZE = RIDDLEMATRIX_RS485_RX_BUFFER_SIZE;
+static constexpr uint8_t RS485_FRAME_START = 0x7E;
+static constexpr uint8_t RS485_BROADCAST_ADDRESS = 0x00;
+static constexpr uint8_t RS485_MAX_BOX_ADDRESS = 0xFE;
+static constexpr uint8_t RS485_FRAME_MAX_TRIGGERS = 8;
+// Bei 19200 Baud dauert ein Byte ~0,5 ms; längere Lücken beenden einen angefangenen Frame.
+static constexpr unsigned long RS485_FRAME_TIMEOUT_MS = 50UL;
+
+struct Rs485ParseResult {
+    uint8_t triggerCount;
+    uint8_t triggerIndices[RS485_FRAME_MAX_TRIGGERS]; // 0-basiert wie dailyLetters[trigger]
+    bool framed;
+};
+
+struct Rs485ReceiveStats {
+    unsigned long frames;
+    unsigned long legacyTriggers;
+    unsigned long foreignFrames;
+    unsigned long crcErrors;
+    unsigned long malformedFrames;
+    unsigned long timeouts;
+    unsigned long noiseBytes;
+};
+
+uint8_t rs485Crc8(const uint8_t *data, size_t length);
+
+// Verarbeitet ein empfangenes Byte. Liefert true, sobald ein Legacy-Zeichen oder ein
+// vollständiger, gültiger Frame für diese Box vorliegt; `result` enthält dann die Trigger.
+bool feedRs485Byte(uint8_t value, unsigned long now, uint8_t boxAddress, Rs485ParseResult &result);
+
+const Rs485ReceiveStats &getRs485ReceiveStats();
+void resetRs485Parser();
+
+#endif
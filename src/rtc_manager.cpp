@@ -1,6 +1,10 @@
 #include "rtc_manager.h"
 
+#include "clock_events.h"
 #include "config.h"
+#include "log_manager.h"
+#include "rs485_protocol.h"
+#include "software_clock.h"
 
 #include <sys/time.h>
 #include <time.h>
@@ -8,19 +12,19 @@
 namespace {
 
 volatile int cachedWeekday = -1;
-volatile unsigned long cachedWeekdayTimestamp = 0;
 volatile bool cachedWeekdayValid = false;
 
-constexpr unsigned long WEEKDAY_CACHE_MAX_AGE_MS = 5000UL;
 constexpr unsigned long SERIAL_IDLE_CHECK_DELAY_MS = 2UL;
 constexpr unsigned long SERIAL_IDLE_MAX_WAIT_MS = 20UL;
 constexpr const char *NTP_TIMEZONE_EUROPE_BERLIN = "CET-1CEST,M3.5.0,M10.5.0/3";
+constexpr unsigned long CLOCK_EVENT_RETRY_MS = 1000UL;
 bool timezoneInitialized = false;
+unsigned long clockEventCheckedAt = 0;
+unsigned long clockEventWaitMs = 0;
 
 void storeWeekdayInCache(int weekday) {
   if (weekday >= 0 && weekday < static_cast<int>(NUM_DAYS)) {
     cachedWeekday = weekday;
-    cachedWeekdayTimestamp = millis();
     cachedWeekdayValid = true;
   } else {
     cachedWeekdayValid = false;
@@ -63,6 +67,57 @@ bool setSystemLocalTime(int year, int month, int day, int hour, int minute, int
   return true;
 }
 
+// Gleicht die Software-Uhr mit der DS1307 ab, wenn das Intervall abgelaufen ist. Ein fälliger
+// Abgleich wird verschoben, solange RS485-Daten anstehen; nur eine ungestellte Uhr liest sofort.
+bool refreshSoftwareClock(bool waitForIdle) {
+  if (!isSoftwareClockResyncDue(millis())) {
+    return true;
+  }
+
+  if (isSoftwareClockValid() && Serial.available() > 0) {
+    delay(SERIAL_IDLE_CHECK_DELAY_MS);
+
+    if (waitForIdle) {
+      const unsigned long waitStart = millis();
+      while (Serial.available() > 0 && (millis() - waitStart) < SERIAL_IDLE_MAX_WAIT_MS) {
+        delay(SERIAL_IDLE_CHECK_DELAY_MS);
+      }
+    }
+
+    if (Serial.available() > 0) {
+      return true;
+    }
+  }
+
+  enableRTC();
+  DateTime nowRtc = rtc.now();
+  enableRS485();
+
+  disciplineSoftwareClock(nowRtc.unixtime(), millis());
+  LOG_DEBUG(CONFIG, "RTC-Abgleich der Software-Uhr, Gangabweichung %ld ppm",
+            static_cast<long>(getSoftwareClockDriftPpm()));
+  return isSoftwareClockValid();
+}
+
+bool readLocalEpochMs(uint64_t &epochMs) {
+  if (!rtc_ok) {
+    struct tm timeinfo = {};
+    if (!getSystemLocalTime(timeinfo)) {
+      return false;
+    }
+    const DateTime localTime(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
+                             timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+    epochMs = static_cast<uint64_t>(localTime.unixtime()) * 1000ULL;
+    return true;
+  }
+
+  if (!refreshSoftwareClock(false)) {
+    return false;
+  }
+  epochMs = getSoftwareClockEpochMs(millis());
+  return true;
+}
+
 } // namespace
 
 void initializeTimezone() {
@@ -86,6 +141,9 @@ void enableRTC() {
 
 void enableRS485() {
   delay(40);
+  // Größerer, per UART-Interrupt befüllter Empfangspuffer fängt Trigger-Bursts ab, bis
+  // checkTrigger() ihn im nächsten loop()-Durchlauf blockweise leert (ESP32: nur vor begin()).
+  Serial.setRxBufferSize(RS485_RX_BUFFER_SIZE);
   Serial.begin(19200);
   digitalWrite(GPIO_RS485_ENABLE, LOW);
 }
@@ -113,31 +171,11 @@ bool updateCachedWeekday(bool waitForIdle) {
     return false;
   }
 
-  const unsigned long now = millis();
-  if (cachedWeekdayValid && (now - cachedWeekdayTimestamp) < WEEKDAY_CACHE_MAX_AGE_MS) {
-    return true;
+  if (!refreshSoftwareClock(waitForIdle)) {
+    return cachedWeekdayValid;
   }
 
-  if (Serial.available() > 0) {
-    delay(SERIAL_IDLE_CHECK_DELAY_MS);
-
-    if (waitForIdle) {
-      const unsigned long waitStart = millis();
-      while (Serial.available() > 0 && (millis() - waitStart) < SERIAL_IDLE_MAX_WAIT_MS) {
-        delay(SERIAL_IDLE_CHECK_DELAY_MS);
-      }
-    }
-
-    if (Serial.available() > 0) {
-      return cachedWeekdayValid;
-    }
-  }
-
-  enableRTC();
-  DateTime nowRtc = rtc.now();
-  enableRS485();
-
-  storeWeekdayInCache(nowRtc.dayOfTheWeek());
+  storeWeekdayInCache(weekdayFromEpoch(getSoftwareClockEpoch(millis())));
   return cachedWeekdayValid;
 }
 
@@ -152,12 +190,13 @@ bool getRTCMinutesOfDay(uint16_t &minutesOfDay) {
     return true;
   }
 
-  enableRTC();
-  DateTime now = rtc.now();
-  enableRS485();
+  if (!refreshSoftwareClock(false)) {
+    return false;
+  }
 
-  storeWeekdayInCache(now.dayOfTheWeek());
-  minutesOfDay = static_cast<uint16_t>((now.hour() * 60) + now.minute());
+  const uint32_t epoch = getSoftwareClockEpoch(millis());
+  storeWeekdayInCache(weekdayFromEpoch(epoch));
+  minutesOfDay = minutesOfDayFromEpoch(epoch);
   return true;
 }
 
@@ -176,10 +215,11 @@ String getRTCTime() {
         return String(buffer);
     }
 
-    enableRTC();
-    DateTime now = rtc.now();
-    enableRS485();
+    if (!refreshSoftwareClock(false)) {
+        return String(F("Keine gueltige Zeit verfuegbar"));
+    }
 
+    const DateTime now(getSoftwareClockEpoch(millis()));
     storeWeekdayInCache(now.dayOfTheWeek());
 
     char buffer[40];
@@ -209,7 +249,7 @@ bool setRTCFromWeb(const String &date, const String &time) {
     const int parsedTime = sscanf(time.c_str(), "%d:%d:%d", &hour, &minute, &second);
 
     if (parsedDate != 3 || (parsedTime != 2 && parsedTime != 3)) {
-        Serial.println(F("Fehler: Ungueltiges Datums- oder Zeitformat uebermittelt."));
+        LOG_WARN(CONFIG, "Fehler: Ungueltiges Datums- oder Zeitformat uebermittelt.");
         return false;
     }
 
@@ -231,53 +271,57 @@ bool setRTCFromWeb(const String &date, const String &time) {
     };
 
     if (year < 2000 || year > 2099) {
-        Serial.println(F("Fehler: Jahr ausserhalb des gueltigen Bereichs (2000-2099)."));
+        LOG_WARN(CONFIG, "Fehler: Jahr ausserhalb des gueltigen Bereichs (2000-2099).");
         return false;
     }
 
     const int maxDay = daysInMonth(year, month);
     if (maxDay == 0 || day < 1 || day > maxDay) {
-        Serial.println(F("Fehler: Ungueltiges Datum uebermittelt."));
+        LOG_WARN(CONFIG, "Fehler: Ungueltiges Datum uebermittelt.");
         return false;
     }
 
     if (hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59) {
-        Serial.println(F("Fehler: Ungueltige Uhrzeit uebermittelt."));
+        LOG_WARN(CONFIG, "Fehler: Ungueltige Uhrzeit uebermittelt.");
         return false;
     }
 
     const DateTime newDateTime(year, month, day, hour, minute, second);
     if (!setSystemLocalTime(year, month, day, hour, minute, second)) {
-        Serial.println(F("Fehler: Systemzeit konnte nicht gesetzt werden."));
+        LOG_WARN(CONFIG, "Fehler: Systemzeit konnte nicht gesetzt werden.");
         return false;
     }
 
     if (rtc_ok) {
         enableRTC();
         rtc.adjust(newDateTime);
-        storeWeekdayInCache(newDateTime.dayOfTheWeek());
         enableRS485();
-        Serial.println(F("RTC und Systemzeit wurden aktualisiert."));
+        disciplineSoftwareClock(newDateTime.unixtime(), millis());
+        storeWeekdayInCache(newDateTime.dayOfTheWeek());
+        requestClockEventCheck();
+        LOG_INFO(CONFIG, "RTC und Systemzeit wurden aktualisiert.");
     } else {
-        Serial.println(F("Systemzeit wurde aktualisiert; keine RTC zum Speichern verfuegbar."));
+        LOG_INFO(CONFIG, "Systemzeit wurde aktualisiert; keine RTC zum Speichern verfuegbar.");
+        requestClockEventCheck();
     }
     return true;
 }
 bool syncTimeWithNTP() {
-    Serial.println(F("Synchronisiere Zeit mit NTP..."));
+    LOG_DEBUG(CONFIG, "Synchronisiere Zeit mit NTP...");
     initializeTimezone();
     configTzTime(NTP_TIMEZONE_EUROPE_BERLIN, "pool.ntp.org", "time.nist.gov");
 
     struct tm timeinfo;
     if (!getSystemLocalTime(timeinfo, 10000)) {
-        Serial.println(F("NTP Zeit konnte nicht abgerufen werden!"));
+        LOG_WARN(CONFIG, "NTP Zeit konnte nicht abgerufen werden!");
         return false;
     }
 
     storeWeekdayInCache(timeinfo.tm_wday);
+    requestClockEventCheck();
 
     if (!rtc_ok) {
-        Serial.println(F("NTP Zeit als Systemzeit aktiv; keine RTC zum Speichern verfuegbar."));
+        LOG_INFO(CONFIG, "NTP Zeit als Systemzeit aktiv; keine RTC zum Speichern verfuegbar.");
         return true;
     }
 
@@ -286,9 +330,42 @@ bool syncTimeWithNTP() {
                                timeinfo.tm_mday, timeinfo.tm_hour,
                                timeinfo.tm_min, timeinfo.tm_sec);
     rtc.adjust(ntpDateTime);
-    storeWeekdayInCache(ntpDateTime.dayOfTheWeek());
     enableRS485();
-    Serial.println(F("NTP Synchronisierung erfolgreich!"));
+    disciplineSoftwareClock(ntpDateTime.unixtime(), millis());
+    storeWeekdayInCache(ntpDateTime.dayOfTheWeek());
+    LOG_INFO(CONFIG, "NTP Synchronisierung erfolgreich!");
     return true;
 }
 
+
+uint8_t pollClockEvents() {
+    const unsigned long now = millis();
+    if ((now - clockEventCheckedAt) < clockEventWaitMs) {
+        return CLOCK_EVENT_NONE;
+    }
+    clockEventCheckedAt = now;
+
+    uint64_t epochMs = 0;
+    if (!readLocalEpochMs(epochMs)) {
+        clockEventWaitMs = CLOCK_EVENT_RETRY_MS;
+        return CLOCK_EVENT_NONE;
+    }
+
+    const uint32_t epoch = static_cast<uint32_t>(epochMs / 1000ULL);
+    const uint8_t events = advanceClockEvents(epoch, standalone_active_start_minutes, standalone_active_end_minutes);
+    if ((events & (CLOCK_EVENT_MIDNIGHT | CLOCK_EVENT_RESYNC)) != 0) {
+        storeWeekdayInCache(weekdayFromEpoch(epoch));
+    }
+
+    // Bis zur nächsten Grenze schlafen, spätestens aber zum nächsten RTC-Abgleich erneut rechnen.
+    const uint64_t untilBoundaryMs =
+        static_cast<uint64_t>(secondsUntilNextClockBoundary(epoch)) * 1000ULL - (epochMs % 1000ULL);
+    clockEventWaitMs = untilBoundaryMs < RTC_RESYNC_INTERVAL_MS
+        ? static_cast<unsigned long>(untilBoundaryMs)
+        : RTC_RESYNC_INTERVAL_MS;
+    return events;
+}
+
+void requestClockEventCheck() {
+    clockEventWaitMs = 0;
+}
@@ -15,5 +15,9 @@ String getRTCTime();
 int getRTCWeekday();
 bool setRTCFromWeb(const String &date, const String &time);
 bool syncTimeWithNTP();
+// Meldet überschrittene Zeitgrenzen (CLOCK_EVENT_*); zwischen zwei Grenzen nur ein millis()-Vergleich.
+uint8_t pollClockEvents();
+// Erzwingt die Prüfung beim nächsten pollClockEvents(), z. B. nach geändertem Aktivfenster.
+void requestClockEventCheck();
 
 #endif
@@ -0,0 +1,125 @@
+#include "software_clock.h"
+
+namespace {
+
+constexpr uint32_t SECONDS_PER_DAY = 86400UL;
+constexpr uint8_t WEEKDAY_OF_EPOCH = 4;  // 01.01.1970 war ein Donnerstag
+
+bool clockValid = false;
+uint64_t baseEpochMs = 0;        // Ortszeit in ms zum Zeitpunkt baseMillis
+unsigned long baseMillis = 0;
+uint32_t anchorEpoch = 0;        // Beginn der Messstrecke für die Driftschätzung
+unsigned long anchorMillis = 0;
+unsigned long lastSyncMillis = 0;
+int32_t driftPpm = 0;            // positiv: millis() läuft langsamer als die RTC
+
+// millis() ist auf dem Gerät 32 Bit breit; der Host rechnet hier genauso.
+uint32_t millisSince(unsigned long now, unsigned long since) {
+    return static_cast<uint32_t>(now - since);
+}
+
+int64_t correctedElapsedMs(unsigned long now) {
+    const int64_t elapsed = static_cast<int64_t>(millisSince(now, baseMillis));
+    return elapsed + (elapsed * driftPpm) / 1000000LL;
+}
+
+uint64_t extrapolatedEpochMs(unsigned long now) {
+    return baseEpochMs + static_cast<uint64_t>(correctedElapsedMs(now));
+}
+
+void rebase(uint64_t epochMs, unsigned long now) {
+    baseEpochMs = epochMs;
+    baseMillis = now;
+}
+
+void updateDriftEstimate(uint32_t rtcEpoch, unsigned long now) {
+    const uint32_t span = millisSince(now, anchorMillis);
+    if (span < SOFTWARE_CLOCK_DRIFT_MIN_SPAN_MS) {
+        return;
+    }
+    const int64_t rtcSpanMs = static_cast<int64_t>(rtcEpoch - anchorEpoch) * 1000LL;
+    int64_t estimate = ((rtcSpanMs - static_cast<int64_t>(span)) * 1000000LL) / static_cast<int64_t>(span);
+    if (estimate > SOFTWARE_CLOCK_MAX_DRIFT_PPM) {
+        estimate = SOFTWARE_CLOCK_MAX_DRIFT_PPM;
+    } else if (estimate < -SOFTWARE_CLOCK_MAX_DRIFT_PPM) {
+        estimate = -SOFTWARE_CLOCK_MAX_DRIFT_PPM;
+    }
+    driftPpm = static_cast<int32_t>(estimate);
+    if (span >= SOFTWARE_CLOCK_DRIFT_MAX_SPAN_MS) {
+        anchorEpoch = rtcEpoch;
+        anchorMillis = now;
+    }
+}
+
+} // namespace
+
+void disciplineSoftwareClock(uint32_t rtcEpoch, unsigned long now) {
+    // Die RTC meldet volle Sekunden: die wahre Zeit liegt in [rtcMs, rtcMs + 999].
+    const uint64_t rtcMs = static_cast<uint64_t>(rtcEpoch) * 1000ULL;
+    lastSyncMillis = now;
+
+    if (!clockValid) {
+        clockValid = true;
+        rebase(rtcMs, now);
+        anchorEpoch = rtcEpoch;
+        anchorMillis = now;
+        return;
+    }
+
+    const uint64_t estimate = extrapolatedEpochMs(now);
+    const uint64_t distance = estimate > rtcMs ? estimate - rtcMs : rtcMs - estimate;
+    if (distance >= SOFTWARE_CLOCK_STEP_THRESHOLD_MS) {
+        // Uhr wurde gestellt: sofort übernehmen, Messstrecke neu beginnen, Driftschätzung behalten.
+        rebase(rtcMs, now);
+        anchorEpoch = rtcEpoch;
+        anchorMillis = now;
+        return;
+    }
+
+    updateDriftEstimate(rtcEpoch, now);
+    if (estimate < rtcMs) {
+        rebase(rtcMs, now);
+    } else if (estimate > rtcMs + 999ULL) {
+        rebase(rtcMs + 999ULL, now);
+    } else {
+        rebase(estimate, now);
+    }
+}
+
+bool isSoftwareClockValid() {
+    return clockValid;
+}
+
+uint32_t getSoftwareClockEpoch(unsigned long now) {
+    return static_cast<uint32_t>(extrapolatedEpochMs(now) / 1000ULL);
+}
+
+uint64_t getSoftwareClockEpochMs(unsigned long now) {
+    return extrapolatedEpochMs(now);
+}
+
+bool isSoftwareClockResyncDue(unsigned long now) {
+    return !clockValid || millisSince(now, lastSyncMillis) >= RTC_RESYNC_INTERVAL_MS;
+}
+
+int32_t getSoftwareClockDriftPpm() {
+    return driftPpm;
+}
+
+void resetSoftwareClock() {
+    clockValid = false;
+    baseEpochMs = 0;
+    baseMillis = 0;
+    anchorEpoch = 0;
+    anchorMillis = 0;
+    lastSyncMillis = 0;
+    driftPpm = 0;
+}
+
+uint16_t minutesOfDayFromEpoch(uint32_t epoch) {
+    return static_cast<uint16_t>((epoch % SECONDS_PER_DAY) / 60UL);
+}
+
+uint8_t weekdayFromEpoch(uint32_t epoch) {
+    return static_cast<uint8_t>((epoch / SECONDS_PER_DAY + WEEKDAY_OF_EPOCH) % 7UL);
+}
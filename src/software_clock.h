@@ -0,0 +1,40 @@
+#ifndef SOFTWARE_CLOCK_H
+#define SOFTWARE_CLOCK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **Software-Uhr auf Basis von millis(), gestützt durch die DS1307**
+// Die RTC liegt auf Pins, die sich I2C und der RS485-UART teilen; jedes rtc.now()
+// schaltet den Empfänger für ~80 ms ab. Die Uhr wird deshalb nur selten mit einem
+// RTC-Wert (Ortszeit, Sekunden seit 1970) abgeglichen und dazwischen aus millis()
+// fortgeschrieben. Abweichungen innerhalb der 1-s-Auflösung der RTC werden weich
+// eingefangen; die Gangabweichung von millis() wird über lange Zeiträume geschätzt
+// und herausgerechnet. Größere Sprünge (Zeit gestellt, NTP) übernimmt die Uhr sofort.
+#ifndef RIDDLEMATRIX_RTC_RESYNC_INTERVAL_MS
+#define RIDDLEMATRIX_RTC_RESYNC_INTERVAL_MS 900000UL
+#endif
+
+static constexpr unsigned long RTC_RESYNC_INTERVAL_MS = RIDDLEMATRIX_RTC_RESYNC_INTERVAL_MS;
+// Ab dieser Abweichung wird gesprungen statt nachgeführt.
+static constexpr unsigned long SOFTWARE_CLOCK_STEP_THRESHOLD_MS = 2000UL;
+// Erst über so lange Messstrecken ist die 1-s-Quantisierung der RTC klein genug für eine Driftschätzung.
+static constexpr unsigned long SOFTWARE_CLOCK_DRIFT_MIN_SPAN_MS = 6UL * 60UL * 60UL * 1000UL;
+// Danach beginnt die Messstrecke neu, damit sie nie an den 32-Bit-Überlauf von millis() (~49,7 Tage) heranreicht.
+static constexpr unsigned long SOFTWARE_CLOCK_DRIFT_MAX_SPAN_MS = 24UL * 60UL * 60UL * 1000UL;
+static constexpr int32_t SOFTWARE_CLOCK_MAX_DRIFT_PPM = 500;
+
+void disciplineSoftwareClock(uint32_t rtcEpoch, unsigned long now);
+bool isSoftwareClockValid();
+// Fortgeschriebene Ortszeit in Sekunden seit 1970; nur gültig, wenn isSoftwareClockValid().
+uint32_t getSoftwareClockEpoch(unsigned long now);
+uint64_t getSoftwareClockEpochMs(unsigned long now);
+bool isSoftwareClockResyncDue(unsigned long now);
+int32_t getSoftwareClockDriftPpm();
+void resetSoftwareClock();
+
+uint16_t minutesOfDayFromEpoch(uint32_t epoch);
+// 0 = Sonntag, wie DateTime::dayOfTheWeek().
+uint8_t weekdayFromEpoch(uint32_t epoch);
+
+#endif
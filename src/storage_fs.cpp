@@ -0,0 +1,28 @@
+#include "storage_fs.h"
+
+namespace {
+
+bool storageFsMounted = false;
+
+bool beginStorageFs() {
+#if defined(ESP32)
+    return RIDDLEMATRIX_STORAGE_FS.begin(true);
+#elif defined(ESP8266) || defined(RIDDLEMATRIX_HOST_TEST)
+    if (RIDDLEMATRIX_STORAGE_FS.begin()) {
+        return true;
+    }
+    RIDDLEMATRIX_STORAGE_FS.format();
+    return RIDDLEMATRIX_STORAGE_FS.begin();
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+bool mountStorageFs() {
+    if (!storageFsMounted) {
+        storageFsMounted = beginStorageFs();
+    }
+    return storageFsMounted;
+}
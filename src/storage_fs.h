@@ -0,0 +1,18 @@
+#ifndef STORAGE_FS_H
+#define STORAGE_FS_H
+
+// **Gemeinsames Flash-Dateisystem**
+// Symbol-Paket und Konfigurations-Log liegen auf demselben Dateisystem:
+// SPIFFS auf dem ESP32, LittleFS auf dem ESP8266 (Host-Tests: LittleFS-Stub im RAM).
+#if defined(ESP32)
+#include <SPIFFS.h>
+#define RIDDLEMATRIX_STORAGE_FS SPIFFS
+#elif defined(ESP8266) || defined(RIDDLEMATRIX_HOST_TEST)
+#include <LittleFS.h>
+#define RIDDLEMATRIX_STORAGE_FS LittleFS
+#endif
+
+// Mountet das Dateisystem beim ersten Aufruf (formatiert notfalls); danach nur noch Statusabfrage.
+bool mountStorageFs();
+
+#endif
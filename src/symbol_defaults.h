@@ -6,7 +6,7 @@
 // **Zeichen-/Symbol-Datenbank (Deklaration für externe Nutzung)**
 
 // **Zeichen A-Z + Symbole**
-const uint8_t letter_SUN[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_SUN[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000001, 0b10000000, 0b00000000,   //                ██               ,
@@ -41,7 +41,7 @@ const uint8_t letter_SUN[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_A[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_A[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000111, 0b11100000, 0b00000000,   //              ██████             ,
@@ -76,7 +76,7 @@ const uint8_t letter_A[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_B[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_B[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000011, 0b11111111, 0b11111110, 0b00000000,   //       █████████████████         ,
@@ -111,7 +111,7 @@ const uint8_t letter_B[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_C[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_C[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000011, 0b11111110, 0b00000000,   //               █████████         ,
     0b00000000, 0b00011111, 0b11111111, 0b11000000,   //            ███████████████      ,
@@ -146,7 +146,7 @@ const uint8_t letter_C[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_D[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_D[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00001111, 0b11111111, 0b11110000, 0b00000000,   //     ████████████████            ,
@@ -181,7 +181,7 @@ const uint8_t letter_D[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_E[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_E[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000001, 0b11111111, 0b11111111, 0b11000000,   //        ███████████████████      ,
@@ -216,7 +216,7 @@ const uint8_t letter_E[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_F[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_F[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b11111111, 0b11111111, 0b11100000,   //         ███████████████████     ,
@@ -251,7 +251,7 @@ const uint8_t letter_F[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_G[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_G[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000111, 0b11111110, 0b00000000,   //              ██████████         ,
     0b00000000, 0b00011111, 0b11111111, 0b11000000,   //            ███████████████      ,
@@ -286,7 +286,7 @@ const uint8_t letter_G[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_H[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_H[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000111, 0b10000000, 0b00000001, 0b11100000,   //      ████              ████     ,
@@ -321,7 +321,7 @@ const uint8_t letter_H[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_I[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_I[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00111111, 0b11111100, 0b00000000,   //           ████████████          ,
@@ -356,7 +356,7 @@ const uint8_t letter_I[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_J[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_J[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00001111, 0b11111100, 0b00000000,   //             ██████████          ,
     0b00000000, 0b00001111, 0b11111100, 0b00000000,   //             ██████████          ,
@@ -391,7 +391,7 @@ const uint8_t letter_J[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_K[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_K[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000011, 0b11000000, 0b00000001, 0b11110000,   //       ████             █████    ,
@@ -426,7 +426,7 @@ const uint8_t letter_K[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_L[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_L[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b11110000, 0b00000000, 0b00000000,   //         ████                    ,
@@ -461,7 +461,7 @@ const uint8_t letter_L[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_M[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_M[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00011111, 0b10000000, 0b00000001, 0b11111000,   //    ██████              ██████   ,
@@ -496,7 +496,7 @@ const uint8_t letter_M[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_N[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_N[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000111, 0b11100000, 0b00000001, 0b11100000,   //      ██████            ████     ,
@@ -531,7 +531,7 @@ const uint8_t letter_N[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_O[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_O[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00001111, 0b11110000, 0b00000000,   //             ████████            ,
     0b00000000, 0b01111111, 0b11111100, 0b00000000,   //          █████████████          ,
@@ -566,7 +566,7 @@ const uint8_t letter_O[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_P[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_P[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b11111111, 0b11110000, 0b00000000,   //         ████████████            ,
@@ -601,7 +601,7 @@ const uint8_t letter_P[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_Q[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_Q[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00001111, 0b11110000, 0b00000000,   //             ████████            ,
     0b00000000, 0b00111111, 0b11111100, 0b00000000,   //           ████████████          ,
@@ -636,7 +636,7 @@ const uint8_t letter_Q[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_R[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_R[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000011, 0b11111111, 0b11110000, 0b00000000,   //       ██████████████            ,
@@ -671,7 +671,7 @@ const uint8_t letter_R[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_S[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_S[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00001111, 0b11111000, 0b00000000,   //             █████████           ,
     0b00000000, 0b01111111, 0b11111111, 0b10000000,   //          ████████████████       ,
@@ -706,7 +706,7 @@ const uint8_t letter_S[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_T[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_T[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00001111, 0b11111111, 0b11111111, 0b11110000,   //     ████████████████████████    ,
@@ -741,7 +741,7 @@ const uint8_t letter_T[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_U[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_U[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00001111, 0b00000000, 0b00000001, 0b11100000,   //     ████               ████     ,
@@ -776,7 +776,7 @@ const uint8_t letter_U[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_V[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_V[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00011110, 0b00000000, 0b00000000, 0b01110000,   //    ████                  ███    ,
@@ -811,7 +811,7 @@ const uint8_t letter_V[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_W[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_W[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
@@ -846,7 +846,7 @@ const uint8_t letter_W[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_X[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_X[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00001111, 0b10000000, 0b00000001, 0b11110000,   //     █████              █████    ,
@@ -881,7 +881,7 @@ const uint8_t letter_X[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_Y[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_Y[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00001111, 0b00000000, 0b00000001, 0b11110000,   //     ████               █████    ,
@@ -916,7 +916,7 @@ const uint8_t letter_Y[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_Z[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_Z[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000111, 0b11111111, 0b11111111, 0b11100000,   //      ██████████████████████     ,
@@ -951,7 +951,7 @@ const uint8_t letter_Z[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 
 };
 
-const uint8_t letter_WIFI[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_WIFI[128] PROGMEM = {
     0b11111111, 0b11110000, 0b00001111, 0b11111111,   // ████████████        ████████████,
     0b11111111, 0b11000000, 0b00000011, 0b11111111,   // ██████████            ██████████,
     0b11111111, 0b00000000, 0b00000000, 0b11111111,   // ████████                ████████,
@@ -986,7 +986,7 @@ const uint8_t letter_WIFI[128] PROGMEM = {
     0b11111111, 0b11111110, 0b01111111, 0b11111111,   // ███████████████  ███████████████
 };
 
-const uint8_t letter_RIESENRAD[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_RIESENRAD[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b11000000, 0b00000000,   //                ██               ,
@@ -1021,7 +1021,7 @@ const uint8_t letter_RIESENRAD[128] PROGMEM = {
     0b00000000, 0b00100000, 0b00000010, 0b00000000,   //           █           █         
 };
 
-const uint8_t letter_LEGACY_COMBINED_RANDOM[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_LEGACY_COMBINED_RANDOM[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //
     0b00000000, 0b00000001, 0b11000000, 0b00000000,   //                ███
@@ -1056,7 +1056,7 @@ const uint8_t letter_LEGACY_COMBINED_RANDOM[128] PROGMEM = {
     0b00000000, 0b00100000, 0b00000010, 0b00000000,   //           █           █
 };
 
-const uint8_t letter_RIDDLER[128] PROGMEM = {
+alignas(4) constexpr uint8_t letter_RIDDLER[128] PROGMEM = {
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
     0b00000000, 0b00000000, 0b00000000, 0b00000000,   //                                 ,
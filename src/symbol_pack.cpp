@@ -0,0 +1,479 @@
+#include "symbol_pack.h"
+#include "log_manager.h"
+#include "storage_fs.h"
+
+#include <Arduino.h>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr char SYMBOL_PACK_PATH[] = "/symbols.pak";
+constexpr char SYMBOL_PACK_TEMP_PATH[] = "/symbols.tmp";  // Neuaufbau; ersetzt das Paket erst, wenn er vollständig ist
+constexpr char SYMBOL_PACK_BATCH_PATH[] = "/symbols.new"; // Kopie während eines Sammel-Uploads
+constexpr uint8_t SYMBOL_PACK_MAGIC[4] = {'R', 'M', 'S', 'P'};
+constexpr uint8_t SYMBOL_PACK_FORMAT_VERSION = 2;  // 1: acht Zusatz-Symbole '0'..'7'
+constexpr size_t SYMBOL_PACK_HEADER_FLAGS = 6;
+constexpr size_t SYMBOL_PACK_HEADER_COPY_STATE = 7;  // SYMBOL_PACK_COPY_COMPLETE, sobald eine Kopie fertig ist
+constexpr uint8_t SYMBOL_PACK_COPY_COMPLETE = 0xC5;
+constexpr size_t SYMBOL_PACK_INDEX_END =
+    SYMBOL_PACK_HEADER_SIZE + SYMBOL_PACK_SLOT_COUNT * SYMBOL_PACK_INDEX_ENTRY_SIZE;
+constexpr size_t LEGACY_SYMBOL_FILE_SIZE = SYMBOL_BITMAP_SIZE + 1;  // Freigabe-Byte + Bitmap
+
+char slotSymbol(size_t slot) {
+    if (slot < SYMBOL_PACK_FIRST_CUSTOM_SLOT) {
+        return editableBuiltinSymbols[slot];
+    }
+    return customSymbolFromId(slot - SYMBOL_PACK_FIRST_CUSTOM_SLOT);
+}
+
+uint16_t recordOffset(size_t slot) {
+    return static_cast<uint16_t>(SYMBOL_PACK_FIRST_RECORD_OFFSET + slot * SYMBOL_BITMAP_SIZE);
+}
+
+bool isValidSlotRange(size_t firstSlot, size_t count) {
+    return count > 0 && firstSlot < SYMBOL_PACK_SLOT_COUNT && count <= SYMBOL_PACK_SLOT_COUNT - firstSlot;
+}
+
+#ifdef RIDDLEMATRIX_STORAGE_FS
+void encodeIndexEntry(size_t slot, uint8_t flags, uint8_t *entry) {
+    const uint16_t offset = recordOffset(slot);
+    entry[0] = static_cast<uint8_t>(slotSymbol(slot));
+    entry[1] = flags;
+    entry[2] = static_cast<uint8_t>(offset & 0xFF);
+    entry[3] = static_cast<uint8_t>(offset >> 8);
+}
+
+// Kopf und Index müssen genau zu den Slots dieser Firmware passen, sonst wird neu angelegt.
+// `flags` (SYMBOL_PACK_SLOT_COUNT Bytes) darf nullptr sein, wenn nur geprüft werden soll.
+bool parseIndex(const uint8_t *index, uint8_t *flags) {
+    if (memcmp(index, SYMBOL_PACK_MAGIC, sizeof(SYMBOL_PACK_MAGIC)) != 0 || index[4] != SYMBOL_PACK_FORMAT_VERSION ||
+        index[5] != SYMBOL_PACK_SLOT_COUNT) {
+        return false;
+    }
+    for (size_t slot = 0; slot < SYMBOL_PACK_SLOT_COUNT; ++slot) {
+        const uint8_t *entry = index + SYMBOL_PACK_HEADER_SIZE + slot * SYMBOL_PACK_INDEX_ENTRY_SIZE;
+        const uint16_t offset = static_cast<uint16_t>(entry[2] | (entry[3] << 8));
+        if (entry[0] != static_cast<uint8_t>(slotSymbol(slot)) || offset != recordOffset(slot)) {
+            return false;
+        }
+        if (flags != nullptr) {
+            flags[slot] = entry[1] & (SYMBOL_PACK_FLAG_STORED | SYMBOL_PACK_FLAG_ENABLED);
+        }
+    }
+    return true;
+}
+
+// Liest Kopf und Index mit einem open() und einem read().
+bool readIndexBlock(const char *path, uint8_t (&index)[SYMBOL_PACK_INDEX_END]) {
+    File pack = RIDDLEMATRIX_STORAGE_FS.open(path, "r");
+    if (!pack) {
+        return false;
+    }
+    const bool complete = pack.size() == SYMBOL_PACK_FILE_SIZE && pack.read(index, sizeof(index)) == sizeof(index);
+    pack.close();
+    return complete && parseIndex(index, nullptr);
+}
+
+bool writeSlots(File &pack, size_t firstSlot, size_t count, const uint8_t *bitmaps, const uint8_t *flags) {
+    if (bitmaps != nullptr) {
+        const size_t length = count * SYMBOL_BITMAP_SIZE;
+        if (!pack.seek(recordOffset(firstSlot)) || pack.write(bitmaps, length) != length) {
+            return false;
+        }
+    }
+    uint8_t entries[SYMBOL_PACK_SLOT_COUNT * SYMBOL_PACK_INDEX_ENTRY_SIZE];
+    for (size_t index = 0; index < count; ++index) {
+        encodeIndexEntry(firstSlot + index, flags[index], entries + index * SYMBOL_PACK_INDEX_ENTRY_SIZE);
+    }
+    const size_t length = count * SYMBOL_PACK_INDEX_ENTRY_SIZE;
+    return pack.seek(SYMBOL_PACK_HEADER_SIZE + firstSlot * SYMBOL_PACK_INDEX_ENTRY_SIZE) &&
+           pack.write(entries, length) == length;
+}
+
+// Schreibt Kopf, Index (alle Flags 0) und leere Records in voller Größe; danach wird nur noch überschrieben.
+bool createSymbolPack(File &pack) {
+    uint8_t block[SYMBOL_PACK_RECORD_ALIGN] = {};
+    memcpy(block, SYMBOL_PACK_MAGIC, sizeof(SYMBOL_PACK_MAGIC));
+    block[4] = SYMBOL_PACK_FORMAT_VERSION;
+    block[5] = static_cast<uint8_t>(SYMBOL_PACK_SLOT_COUNT);
+    size_t written = pack.write(block, SYMBOL_PACK_HEADER_SIZE);
+    for (size_t slot = 0; slot < SYMBOL_PACK_SLOT_COUNT; ++slot) {
+        encodeIndexEntry(slot, 0, block);
+        written += pack.write(block, SYMBOL_PACK_INDEX_ENTRY_SIZE);
+    }
+    memset(block, 0, sizeof(block));
+    while (written < SYMBOL_PACK_FILE_SIZE) {
+        const size_t chunk = std::min(sizeof(block), SYMBOL_PACK_FILE_SIZE - written);
+        const size_t count = pack.write(block, chunk);
+        written += count;
+        if (count != chunk) {
+            break;
+        }
+    }
+    return written == SYMBOL_PACK_FILE_SIZE;
+}
+
+// Paket einer älteren Formatversion: jeder gespeicherte Record wandert über seinen Indexeintrag in
+// den Slot seines Symbols (Format 1 kannte die Zusatz-Symbole als '0'..'7'). Schon Format 1 hielt
+// die Zusatz-Symbole im Paket; EEPROM bzw. Log sind dann bereits übernommen.
+void importOlderSymbolPack(File &target) {
+    File source = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_PATH, "r");
+    if (!source) {
+        return;
+    }
+    uint8_t header[SYMBOL_PACK_HEADER_SIZE];
+    if (source.read(header, sizeof(header)) != sizeof(header) ||
+        memcmp(header, SYMBOL_PACK_MAGIC, sizeof(SYMBOL_PACK_MAGIC)) != 0 || header[4] >= SYMBOL_PACK_FORMAT_VERSION) {
+        source.close();
+        return;
+    }
+
+    size_t imported = 0;
+    for (size_t index = 0; index < header[5]; ++index) {
+        uint8_t entry[SYMBOL_PACK_INDEX_ENTRY_SIZE];
+        if (!source.seek(SYMBOL_PACK_HEADER_SIZE + index * SYMBOL_PACK_INDEX_ENTRY_SIZE) ||
+            source.read(entry, sizeof(entry)) != sizeof(entry)) {
+            break;
+        }
+        const char symbol = migrateLegacyCustomSymbol(static_cast<char>(entry[0]));
+        const int slot = symbolPackSlot(symbol);
+        const uint8_t flags = entry[1] & (SYMBOL_PACK_FLAG_STORED | SYMBOL_PACK_FLAG_ENABLED);
+        if (slot < 0 || (flags & SYMBOL_PACK_FLAG_STORED) == 0) {
+            continue;
+        }
+        uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+        if (!source.seek(static_cast<uint16_t>(entry[2] | (entry[3] << 8))) ||
+            source.read(bitmap, sizeof(bitmap)) != sizeof(bitmap) ||
+            !writeSlots(target, static_cast<size_t>(slot), 1, bitmap, &flags)) {
+            continue;
+        }
+        ++imported;
+    }
+    source.close();
+
+    const uint8_t headerFlags = SYMBOL_PACK_HEADER_LEGACY_CUSTOM_IMPORTED;
+    if (target.seek(SYMBOL_PACK_HEADER_FLAGS)) {
+        target.write(&headerFlags, 1);
+    }
+    LOG_INFO(CONFIG, "📦 %u Symbole aus Symbol-Paket-Format %u übernommen.", static_cast<unsigned>(imported),
+             static_cast<unsigned>(header[4]));
+}
+
+// Markiert eine Kopie als fertig geschrieben; nur solche Kopien übernimmt loadIndexBlock().
+bool markCopyState(File &pack, bool complete) {
+    const uint8_t state = complete ? SYMBOL_PACK_COPY_COMPLETE : 0;
+    return pack.seek(SYMBOL_PACK_HEADER_COPY_STATE) && pack.write(&state, 1) == 1;
+}
+
+// Ersetzt das Paket durch eine fertige Kopie. LittleFS tauscht beim rename() atomar aus; SPIFFS
+// (ESP32) lehnt ein vorhandenes Ziel ab, dort wird das Paket vorher gelöscht. Ein Abbruch in
+// dieser Lücke fängt loadIndexBlock() beim nächsten Start über die markierte Kopie auf.
+bool replaceSymbolPack(const char *path) {
+    if (RIDDLEMATRIX_STORAGE_FS.rename(path, SYMBOL_PACK_PATH)) {
+        return true;
+    }
+    return RIDDLEMATRIX_STORAGE_FS.remove(SYMBOL_PACK_PATH) && RIDDLEMATRIX_STORAGE_FS.rename(path, SYMBOL_PACK_PATH);
+}
+
+// Baut das Paket in einer Temporärdatei neu auf und ersetzt das alte erst danach.
+bool rebuildSymbolPack() {
+    File pack = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_TEMP_PATH, "w");
+    if (!pack) {
+        return false;
+    }
+    bool complete = createSymbolPack(pack);
+    if (complete) {
+        importOlderSymbolPack(pack);
+        complete = markCopyState(pack, true);
+    }
+    pack.close();
+    if (!complete) {
+        RIDDLEMATRIX_STORAGE_FS.remove(SYMBOL_PACK_TEMP_PATH);
+        return false;
+    }
+    return replaceSymbolPack(SYMBOL_PACK_TEMP_PATH);
+}
+
+// Einzeldateien /sym_XX.bin älterer Firmware wandern in ihren Slot und werden danach gelöscht.
+void importLegacySymbolFiles() {
+    for (size_t slot = 0; slot < SYMBOL_PACK_FIRST_CUSTOM_SLOT; ++slot) {
+        char path[12];
+        snprintf(path, sizeof(path), "/sym_%02X.bin", static_cast<unsigned char>(slotSymbol(slot)));
+        if (!RIDDLEMATRIX_STORAGE_FS.exists(path)) {
+            continue;
+        }
+        File file = RIDDLEMATRIX_STORAGE_FS.open(path, "r");
+        if (!file) {
+            continue;
+        }
+        uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+        const bool complete = file.size() == LEGACY_SYMBOL_FILE_SIZE;
+        const int enabled = complete ? file.read() : -1;
+        const bool readOk = complete && file.read(bitmap, SYMBOL_BITMAP_SIZE) == SYMBOL_BITMAP_SIZE;
+        file.close();
+        if (readOk) {
+            const uint8_t flags = SYMBOL_PACK_FLAG_STORED | (enabled == 1 ? SYMBOL_PACK_FLAG_ENABLED : 0);
+            if (!writeSymbolPackSlots(slot, 1, bitmap, &flags)) {
+                continue;  // Datei bleibt für den nächsten Versuch liegen
+            }
+            LOG_INFO(CONFIG, "📦 Symbol '%c' aus %s ins Symbol-Paket übernommen.", slotSymbol(slot), path);
+        }
+        RIDDLEMATRIX_STORAGE_FS.remove(path);
+    }
+}
+#endif
+
+} // namespace
+
+int symbolPackSlot(char symbol) {
+    for (size_t slot = 0; slot < SYMBOL_PACK_SLOT_COUNT; ++slot) {
+        if (slotSymbol(slot) == symbol) {
+            return static_cast<int>(slot);
+        }
+    }
+    return -1;
+}
+
+#ifdef RIDDLEMATRIX_STORAGE_FS
+namespace {
+
+File batchPack;
+bool batchOpen = false;
+
+bool copySymbolPack(File &target) {
+    File source = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_PATH, "r");
+    if (!source) {
+        return false;
+    }
+    uint8_t block[SYMBOL_PACK_RECORD_ALIGN];
+    size_t copied = 0;
+    while (copied < SYMBOL_PACK_FILE_SIZE) {
+        const size_t chunk = std::min(sizeof(block), SYMBOL_PACK_FILE_SIZE - copied);
+        if (source.read(block, chunk) != chunk || target.write(block, chunk) != chunk) {
+            break;
+        }
+        copied += chunk;
+    }
+    source.close();
+    return copied == SYMBOL_PACK_FILE_SIZE;
+}
+
+// Übernimmt eine als fertig markierte Kopie (Kopf, Index und Größe geprüft) als Paket.
+bool adoptSymbolPack(const char *path, uint8_t (&index)[SYMBOL_PACK_INDEX_END]) {
+    if (!readIndexBlock(path, index) || index[SYMBOL_PACK_HEADER_COPY_STATE] != SYMBOL_PACK_COPY_COMPLETE ||
+        !replaceSymbolPack(path)) {
+        return false;
+    }
+    LOG_WARN(CONFIG, "⚠️ Symbol-Paket %s aus %s wiederhergestellt.", SYMBOL_PACK_PATH, path);
+    return true;
+}
+
+// Kopf und Index des Pakets; fehlt es oder ist es unbrauchbar, wird es zuerst neu aufgebaut.
+bool loadIndexBlock(uint8_t (&index)[SYMBOL_PACK_INDEX_END]) {
+    if (readIndexBlock(SYMBOL_PACK_PATH, index)) {
+        return true;
+    }
+    const bool packExists = RIDDLEMATRIX_STORAGE_FS.exists(SYMBOL_PACK_PATH);
+    // Die fertige Kopie eines Sammel-Uploads enthält alle gespeicherten Symbole und hat deshalb Vorrang.
+    bool recovered = !batchOpen && adoptSymbolPack(SYMBOL_PACK_BATCH_PATH, index);
+    // Auf SPIFFS liegt zwischen Löschen und Umbenennen nur die Temporärdatei. Sie gilt nur ohne Paket:
+    // liegt das alte noch, wurde sie nie eingesetzt und entsteht beim Neuaufbau ohnehin neu.
+    if (!recovered && !packExists) {
+        recovered = adoptSymbolPack(SYMBOL_PACK_TEMP_PATH, index);
+    }
+    if (!recovered) {
+        if (packExists) {
+            LOG_WARN(CONFIG, "⚠️ Symbol-Paket %s veraltet oder unbrauchbar – wird neu angelegt.", SYMBOL_PACK_PATH);
+        }
+        if (!rebuildSymbolPack()) {
+            LOG_ERROR(CONFIG, "❌ Symbol-Paket %s konnte nicht angelegt werden.", SYMBOL_PACK_PATH);
+            return false;
+        }
+    }
+    importLegacySymbolFiles();
+    return readIndexBlock(SYMBOL_PACK_PATH, index);
+}
+
+} // namespace
+#endif
+
+bool loadSymbolPackIndex(uint8_t (&flags)[SYMBOL_PACK_SLOT_COUNT]) {
+    memset(flags, 0, sizeof(flags));
+    if (!mountStorageFs()) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    uint8_t index[SYMBOL_PACK_INDEX_END];
+    return loadIndexBlock(index) && parseIndex(index, flags);
+#else
+    return false;
+#endif
+}
+
+bool readSymbolPackFlags(size_t firstSlot, size_t count, uint8_t *flags) {
+    if (flags == nullptr || !isValidSlotRange(firstSlot, count) || !mountStorageFs()) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    File pack = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_PATH, "r");
+    if (!pack) {
+        return false;
+    }
+    bool complete = pack.seek(SYMBOL_PACK_HEADER_SIZE + firstSlot * SYMBOL_PACK_INDEX_ENTRY_SIZE);
+    for (size_t index = 0; complete && index < count; ++index) {
+        uint8_t entry[SYMBOL_PACK_INDEX_ENTRY_SIZE];
+        complete = pack.read(entry, sizeof(entry)) == sizeof(entry) &&
+                   entry[0] == static_cast<uint8_t>(slotSymbol(firstSlot + index));
+        flags[index] = complete ? entry[1] & (SYMBOL_PACK_FLAG_STORED | SYMBOL_PACK_FLAG_ENABLED) : 0;
+    }
+    pack.close();
+    return complete;
+#else
+    return false;
+#endif
+}
+
+bool readSymbolPackRecords(size_t firstSlot, size_t count, uint8_t *bitmaps) {
+    if (bitmaps == nullptr || !isValidSlotRange(firstSlot, count) || !mountStorageFs()) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    File pack = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_PATH, "r");
+    if (!pack) {
+        return false;
+    }
+    const size_t length = count * SYMBOL_BITMAP_SIZE;
+    const bool complete = pack.seek(recordOffset(firstSlot)) && pack.read(bitmaps, length) == length;
+    pack.close();
+    return complete;
+#else
+    return false;
+#endif
+}
+
+bool writeSymbolPackSlots(size_t firstSlot, size_t count, const uint8_t *bitmaps, const uint8_t *flags) {
+    if (flags == nullptr || !isValidSlotRange(firstSlot, count) || !mountStorageFs()) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    if (batchOpen) {
+        LOG_WARN(CONFIG, "Symbol-Paket gesperrt: Sammel-Upload läuft.");
+        return false;
+    }
+    File pack = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_PATH, "r+");
+    if (!pack) {
+        return false;
+    }
+    const bool complete = writeSlots(pack, firstSlot, count, bitmaps, flags);
+    pack.close();
+    return complete;
+#else
+    (void)bitmaps;
+    return false;
+#endif
+}
+
+bool symbolPackAwaitsLegacyCustomSymbols() {
+    if (!mountStorageFs()) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    uint8_t index[SYMBOL_PACK_INDEX_END];
+    return loadIndexBlock(index) && (index[SYMBOL_PACK_HEADER_FLAGS] & SYMBOL_PACK_HEADER_LEGACY_CUSTOM_IMPORTED) == 0;
+#else
+    return false;
+#endif
+}
+
+bool markLegacyCustomSymbolsImported() {
+    if (!mountStorageFs()) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    File pack = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_PATH, "r+");
+    if (!pack) {
+        return false;
+    }
+    const uint8_t headerFlags = SYMBOL_PACK_HEADER_LEGACY_CUSTOM_IMPORTED;
+    const bool complete = pack.seek(SYMBOL_PACK_HEADER_FLAGS) && pack.write(&headerFlags, 1) == 1;
+    pack.close();
+    return complete;
+#else
+    return false;
+#endif
+}
+
+bool beginSymbolPackBatch() {
+    if (!mountStorageFs()) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    uint8_t index[SYMBOL_PACK_INDEX_END];
+    if (batchOpen || !loadIndexBlock(index)) {
+        return false;
+    }
+    batchPack = RIDDLEMATRIX_STORAGE_FS.open(SYMBOL_PACK_BATCH_PATH, "w");
+    if (!batchPack) {
+        return false;
+    }
+    if (!copySymbolPack(batchPack) || !markCopyState(batchPack, false)) {
+        batchPack.close();
+        RIDDLEMATRIX_STORAGE_FS.remove(SYMBOL_PACK_BATCH_PATH);
+        LOG_WARN(CONFIG, "❌ Kopie des Symbol-Pakets für den Sammel-Upload fehlgeschlagen (Flash voll?).");
+        return false;
+    }
+    batchOpen = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool writeSymbolPackBatchSlots(size_t firstSlot, size_t count, const uint8_t *bitmaps, const uint8_t *flags) {
+    if (flags == nullptr || !isValidSlotRange(firstSlot, count)) {
+        return false;
+    }
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    return batchOpen && writeSlots(batchPack, firstSlot, count, bitmaps, flags);
+#else
+    (void)bitmaps;
+    return false;
+#endif
+}
+
+bool commitSymbolPackBatch() {
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    if (!batchOpen) {
+        return false;
+    }
+    const bool marked = markCopyState(batchPack, true);
+    batchPack.close();
+    batchOpen = false;
+    if (!marked) {
+        RIDDLEMATRIX_STORAGE_FS.remove(SYMBOL_PACK_BATCH_PATH);
+        LOG_ERROR(CONFIG, "❌ Sammel-Upload konnte nicht abgeschlossen werden.");
+        return false;
+    }
+    // Scheitert das Ersetzen, bleibt die fertige Kopie liegen und wird beim Start übernommen, falls
+    // das Paket dann fehlt oder unbrauchbar ist.
+    if (!replaceSymbolPack(SYMBOL_PACK_BATCH_PATH)) {
+        LOG_ERROR(CONFIG, "❌ Sammel-Upload konnte das Symbol-Paket nicht ersetzen.");
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void abortSymbolPackBatch() {
+#ifdef RIDDLEMATRIX_STORAGE_FS
+    if (!batchOpen) {
+        return;
+    }
+    batchPack.close();
+    batchOpen = false;
+    RIDDLEMATRIX_STORAGE_FS.remove(SYMBOL_PACK_BATCH_PATH);
+#endif
+}
@@ -0,0 +1,69 @@
+#ifndef SYMBOL_PACK_H
+#define SYMBOL_PACK_H
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// **📦 Symbol-Paket /symbols.pak**
+// Alle gespeicherten Symbol-Bitmaps liegen in einer einzigen Datei mit festen Slots:
+// zuerst die EDITABLE_BUILTIN_SYMBOL_COUNT editierbaren eingebauten Symbole, danach die
+// CUSTOM_SYMBOL_COUNT Zusatz-Symbole des Katalogs in Id-Reihenfolge.
+//   Dateikopf:  "RMSP" | Formatversion (u8) | Slotanzahl (u8) | Kopf-Flags (u8) | Kopie fertig (u8)
+//   Index:      je Slot Symbol (u8) | Flags (u8) | Record-Offset (u16)
+//   Records:    je Slot SYMBOL_BITMAP_SIZE Bytes, ab SYMBOL_PACK_RECORD_ALIGN ausgerichtet
+// Der Start liest Kopf und Index mit einem open() und einem read(). Änderungen überschreiben
+// Record und Indexeintrag an Ort und Stelle; die Dateigröße ändert sich nach dem Anlegen nie.
+static constexpr size_t SYMBOL_PACK_SLOT_COUNT = EDITABLE_BUILTIN_SYMBOL_COUNT + CUSTOM_SYMBOL_COUNT;
+static constexpr size_t SYMBOL_PACK_FIRST_CUSTOM_SLOT = EDITABLE_BUILTIN_SYMBOL_COUNT;
+static constexpr size_t SYMBOL_PACK_HEADER_SIZE = 8;
+static constexpr size_t SYMBOL_PACK_INDEX_ENTRY_SIZE = 4;
+static constexpr size_t SYMBOL_PACK_RECORD_ALIGN = SYMBOL_BITMAP_SIZE;
+static constexpr size_t SYMBOL_PACK_FIRST_RECORD_OFFSET =
+    ((SYMBOL_PACK_HEADER_SIZE + SYMBOL_PACK_SLOT_COUNT * SYMBOL_PACK_INDEX_ENTRY_SIZE + SYMBOL_PACK_RECORD_ALIGN - 1) /
+     SYMBOL_PACK_RECORD_ALIGN) * SYMBOL_PACK_RECORD_ALIGN;
+static constexpr size_t SYMBOL_PACK_FILE_SIZE =
+    SYMBOL_PACK_FIRST_RECORD_OFFSET + SYMBOL_PACK_SLOT_COUNT * SYMBOL_BITMAP_SIZE;
+static_assert(SYMBOL_PACK_SLOT_COUNT <= 0xFF, "Slotanzahl passt nicht in den Dateikopf");
+static_assert(SYMBOL_PACK_FILE_SIZE <= 0xFFFF, "Record-Offsets passen nicht in 16 Bit");
+
+static constexpr uint8_t SYMBOL_PACK_FLAG_STORED = 0x01;   // Record enthält eine gespeicherte Bitmap
+static constexpr uint8_t SYMBOL_PACK_FLAG_ENABLED = 0x02;  // Bitmap ersetzt den Default bzw. ist freigegeben
+
+// Kopf-Flag: Zusatz-Symbole älterer Firmware (EEPROM bzw. Konfigurations-Log) sind übernommen.
+static constexpr uint8_t SYMBOL_PACK_HEADER_LEGACY_CUSTOM_IMPORTED = 0x01;
+
+// Slot eines Symbols oder -1, wenn es im Paket keinen Platz hat.
+int symbolPackSlot(char symbol);
+
+// Liest die Flags aller Slots. Fehlt das Paket oder ist es unbrauchbar, wird es neu angelegt und
+// übernimmt dabei gespeicherte Records eines Pakets älterer Formatversion sowie die Einzeldateien
+// /sym_XX.bin älterer Firmware. false nur ohne Dateisystem.
+bool loadSymbolPackIndex(uint8_t (&flags)[SYMBOL_PACK_SLOT_COUNT]);
+
+// Liest die Flags von `count` aufeinanderfolgenden Slots ab `firstSlot` direkt aus dem Index.
+bool readSymbolPackFlags(size_t firstSlot, size_t count, uint8_t *flags);
+
+// Liest `count` aufeinanderfolgende Records ab `firstSlot` nach `bitmaps` (count * SYMBOL_BITMAP_SIZE Bytes).
+bool readSymbolPackRecords(size_t firstSlot, size_t count, uint8_t *bitmaps);
+
+// Überschreibt `count` aufeinanderfolgende Slots: erst die Records (bei bitmaps == nullptr bleiben
+// sie unverändert), dann die Indexeinträge mit `flags[i]`.
+bool writeSymbolPackSlots(size_t firstSlot, size_t count, const uint8_t *bitmaps, const uint8_t *flags);
+
+// **Sammel-Upload**
+// beginSymbolPackBatch() kopiert das Paket nach /symbols.new; writeSymbolPackBatchSlots() schreibt wie
+// writeSymbolPackSlots() in diese Kopie. commitSymbolPackBatch() markiert sie als fertig und ersetzt
+// das Paket danach per rename(), abortSymbolPackBatch() verwirft die Kopie. Bis dahin gilt das alte Paket unverändert.
+// Es ist höchstens ein Sammel-Upload offen; solange sperrt writeSymbolPackSlots() Einzel-Schreibzugriffe.
+bool beginSymbolPackBatch();
+bool writeSymbolPackBatchSlots(size_t firstSlot, size_t count, const uint8_t *bitmaps, const uint8_t *flags);
+bool commitSymbolPackBatch();
+void abortSymbolPackBatch();
+
+// true, solange die Zusatz-Symbole älterer Firmware noch nicht ins Paket übernommen wurden.
+bool symbolPackAwaitsLegacyCustomSymbols();
+bool markLegacyCustomSymbolsImported();
+
+#endif
@@ -0,0 +1,50 @@
+#include "symbol_renderer.h"
+#include "glyph_span_table.h"
+
+namespace {
+
+void drawScaledSymbolSpan(uint8_t row, uint8_t column, uint8_t length, uint16_t color) {
+    const int16_t x = static_cast<int16_t>(SYMBOL_RENDER_OFFSET_X + (column * SYMBOL_RENDER_SCALE));
+    const int16_t y = static_cast<int16_t>(SYMBOL_RENDER_OFFSET_Y + (row * SYMBOL_RENDER_SCALE));
+    const int16_t width = static_cast<int16_t>(length * SYMBOL_RENDER_SCALE);
+    for (uint8_t line = 0; line < SYMBOL_RENDER_SCALE; ++line) {
+        display.drawFastHLine(x, static_cast<int16_t>(y + line), width, color);
+    }
+}
+
+} // namespace
+
+uint16_t renderSymbolView(const SymbolView &view, uint16_t color) {
+    if (!view) {
+        return 0;
+    }
+
+    uint16_t spanCount = 0;
+    for (uint8_t row = 0; row < SYMBOL_PIXEL_SIZE; ++row) {
+        const uint32_t rowBits = view.row(row);
+        if (rowBits == 0U) {
+            continue;
+        }
+
+        forEachSymbolRowSpan(rowBits, [&](uint8_t column, uint8_t length) {
+            drawScaledSymbolSpan(row, column, length, color);
+            ++spanCount;
+        });
+    }
+    return spanCount;
+}
+
+uint16_t renderFactorySymbol(char symbol, uint16_t color) {
+#if RIDDLEMATRIX_GLYPH_SPAN_TABLES
+    uint16_t first = 0;
+    uint16_t count = 0;
+    if (findFactoryGlyphSpans(symbol, first, count)) {
+        for (uint16_t index = first; index < first + count; ++index) {
+            const uint16_t span = pgm_read_word(&factoryGlyphSpanTable.spans[index]);
+            drawScaledSymbolSpan(glyphSpanRow(span), glyphSpanColumn(span), glyphSpanLength(span), color);
+        }
+        return count;
+    }
+#endif
+    return renderSymbolView(progmemSymbolView(getFactorySymbolBitmap(symbol)), color);
+}
@@ -0,0 +1,47 @@
+#ifndef SYMBOL_RENDERER_H
+#define SYMBOL_RENDERER_H
+
+#include "config.h"
+#include "symbol_view.h"
+
+// **Geometrie der Zeichen/Symbole auf der 64x64-Matrix**
+static constexpr uint8_t SYMBOL_PIXEL_SIZE = 32;
+static constexpr uint8_t SYMBOL_BYTES_PER_ROW = SYMBOL_PIXEL_SIZE / 8;
+static constexpr uint8_t SYMBOL_RENDER_SCALE = 2;
+static constexpr uint8_t SYMBOL_RENDER_OFFSET_X = (64 - (SYMBOL_PIXEL_SIZE * SYMBOL_RENDER_SCALE)) / 2;
+static constexpr uint8_t SYMBOL_RENDER_OFFSET_Y = (64 - (SYMBOL_PIXEL_SIZE * SYMBOL_RENDER_SCALE)) / 2;
+
+static_assert(SYMBOL_BYTES_PER_ROW * SYMBOL_PIXEL_SIZE == SYMBOL_BITMAP_SIZE,
+              "Symbolgeometrie passt nicht zur Bitmap-Größe");
+static_assert(SYMBOL_PIXEL_SIZE == SYMBOL_VIEW_ROWS, "SymbolView liefert eine Zeile je Pixelreihe");
+
+// Zerlegt eine Zeile in zusammenhängende Läufe gesetzter Pixel und ruft
+// callback(startColumn, length) einmal pro Lauf auf.
+template <typename Callback>
+void forEachSymbolRowSpan(uint32_t rowBits, Callback callback) {
+    uint8_t column = 0;
+    while (rowBits != 0U) {
+        const uint8_t gap = static_cast<uint8_t>(__builtin_clz(rowBits));
+        rowBits <<= gap;
+        column = static_cast<uint8_t>(column + gap);
+
+        const uint32_t inverted = ~rowBits;
+        const uint8_t length = inverted == 0U
+            ? static_cast<uint8_t>(SYMBOL_PIXEL_SIZE - column)
+            : static_cast<uint8_t>(__builtin_clz(inverted));
+        callback(column, length);
+
+        column = static_cast<uint8_t>(column + length);
+        rowBits = length >= SYMBOL_PIXEL_SIZE ? 0U : (rowBits << length);
+    }
+}
+
+// **Zeichnet ein 32x32-Symbol als 2x skalierte Läufe (zwei H-Linien pro Lauf)**
+// Liest die Bitmap zeilenweise direkt aus RAM oder Flash; liefert die Anzahl der gezeichneten Läufe.
+uint16_t renderSymbolView(const SymbolView &view, uint16_t color);
+
+// Zeichnet ein Factory-Symbol aus der vorberechneten Lauf-Tabelle (glyph_span_table.h);
+// ohne Tabelle wird die PROGMEM-Bitmap zur Laufzeit zerlegt.
+uint16_t renderFactorySymbol(char symbol, uint16_t color);
+
+#endif
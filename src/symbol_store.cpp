@@ -1,52 +1,161 @@
 #include "config.h"
-#include "symbol_defaults.h"
+#include "log_manager.h"
+#include "symbol_pack.h"
 
 #include <Arduino.h>
 #include <cstring>
 
-#if defined(ESP32)
-#include <SPIFFS.h>
-#define RIDDLEMATRIX_SYMBOL_FS SPIFFS
-#elif defined(ESP8266)
-#include <LittleFS.h>
-#define RIDDLEMATRIX_SYMBOL_FS LittleFS
-#endif
+namespace {
 
-uint8_t editableBuiltinSymbolBitmaps[EDITABLE_BUILTIN_SYMBOL_COUNT][SYMBOL_BITMAP_SIZE] = {};
 uint8_t editableBuiltinSymbolEnabled[EDITABLE_BUILTIN_SYMBOL_COUNT] = {};
+uint64_t customSymbolEnabledMask = 0;  // Bit = Id des Zusatz-Symbols
+static_assert(CUSTOM_SYMBOL_COUNT <= 64, "Freigaben der Zusatz-Symbole passen nicht in 64 Bit");
 
-namespace {
+struct SymbolCacheEntry {
+    uint32_t lastUse;  // 0 = frei
+    char symbol;
+    alignas(4) uint8_t bitmap[SYMBOL_BITMAP_SIZE];  // Wortzugriffe in SymbolView::row()
+};
 
-bool symbolFsReady = false;
+bool symbolPackReady = false;
+SymbolCacheEntry symbolCache[SYMBOL_CACHE_ENTRIES] = {};
+uint32_t symbolCacheClock = 0;
+SymbolCacheStats symbolCacheStats = {};
 
-String symbolFilePath(char symbol) {
-    char buffer[16] = {};
-    snprintf(buffer, sizeof(buffer), "/sym_%02X.bin", static_cast<unsigned char>(symbol));
-    return String(buffer);
+void resetEditableBuiltinSymbols() {
+    memset(editableBuiltinSymbolEnabled, 0, sizeof(editableBuiltinSymbolEnabled));
+    customSymbolEnabledMask = 0;
+    memset(symbolCache, 0, sizeof(symbolCache));
 }
 
-bool beginSymbolFs() {
-#if defined(ESP32)
-    if (RIDDLEMATRIX_SYMBOL_FS.begin(true)) {
-        return true;
+SymbolCacheEntry *findCachedSymbol(char symbol) {
+    for (SymbolCacheEntry &entry : symbolCache) {
+        if (entry.lastUse != 0 && entry.symbol == symbol) {
+            return &entry;
+        }
     }
-#elif defined(ESP8266)
-    if (RIDDLEMATRIX_SYMBOL_FS.begin()) {
-        return true;
+    return nullptr;
+}
+
+void forgetCachedSymbol(char symbol) {
+    SymbolCacheEntry *entry = findCachedSymbol(symbol);
+    if (entry != nullptr) {
+        entry->lastUse = 0;
     }
-    RIDDLEMATRIX_SYMBOL_FS.format();
-    if (RIDDLEMATRIX_SYMBOL_FS.begin()) {
-        return true;
+}
+
+// Freier Platz oder der am längsten nicht benutzte Eintrag.
+SymbolCacheEntry &leastRecentlyUsedEntry() {
+    SymbolCacheEntry *victim = &symbolCache[0];
+    for (SymbolCacheEntry &entry : symbolCache) {
+        if (entry.lastUse < victim->lastUse) {
+            victim = &entry;
+        }
     }
-#else
-    return false;
-#endif
-    return false;
+    return *victim;
 }
 
-void resetEditableBuiltinSymbols() {
-    memset(editableBuiltinSymbolBitmaps, 0, sizeof(editableBuiltinSymbolBitmaps));
-    memset(editableBuiltinSymbolEnabled, 0, sizeof(editableBuiltinSymbolEnabled));
+void touchCachedSymbol(SymbolCacheEntry &entry) {
+    entry.lastUse = ++symbolCacheClock;
+}
+
+// Die editierbaren eingebauten Symbole belegen die ersten Slots des Symbol-Pakets (Slot = Index),
+// danach folgen die Zusatz-Symbole in Id-Reihenfolge.
+uint8_t symbolPackFlags(bool enabled) {
+    return SYMBOL_PACK_FLAG_STORED | (enabled ? SYMBOL_PACK_FLAG_ENABLED : 0);
+}
+
+// Alle Freigaben stehen im RAM, damit Anzeige und Zufallsauswahl ohne Dateizugriff prüfen können.
+bool isSlotEnabled(int slot) {
+    if (slot < static_cast<int>(SYMBOL_PACK_FIRST_CUSTOM_SLOT)) {
+        return editableBuiltinSymbolEnabled[slot] == 1;
+    }
+    return (customSymbolEnabledMask >> (slot - SYMBOL_PACK_FIRST_CUSTOM_SLOT)) & 1U;
+}
+
+void setSlotEnabled(int slot, bool enabled) {
+    if (slot < static_cast<int>(SYMBOL_PACK_FIRST_CUSTOM_SLOT)) {
+        editableBuiltinSymbolEnabled[slot] = enabled ? 1 : 0;
+        return;
+    }
+    const uint64_t bit = 1ULL << (slot - SYMBOL_PACK_FIRST_CUSTOM_SLOT);
+    customSymbolEnabledMask = enabled ? (customSymbolEnabledMask | bit) : (customSymbolEnabledMask & ~bit);
+}
+
+// Liefert die Bitmap eines freigegebenen Overrides bzw. Zusatz-Symbols aus dem Cache; lädt sie bei Bedarf
+// aus dem Flash.
+const uint8_t *loadCachedSymbol(char symbol) {
+    const int slot = symbolPackSlot(symbol);
+    if (slot < 0) {
+        return nullptr;
+    }
+
+    SymbolCacheEntry *cached = findCachedSymbol(symbol);
+    if (cached != nullptr) {
+        ++symbolCacheStats.hits;
+        touchCachedSymbol(*cached);
+        return cached->bitmap;
+    }
+    if (!isSlotEnabled(slot)) {
+        return nullptr;
+    }
+
+    ++symbolCacheStats.misses;
+    SymbolCacheEntry &entry = leastRecentlyUsedEntry();
+    entry.lastUse = 0;
+    if (!readSymbolPackRecords(static_cast<size_t>(slot), 1, entry.bitmap)) {
+        LOG_WARN(CONFIG, "Symbol-Record in Slot %u nicht lesbar – Symbol wird nicht angezeigt.", static_cast<unsigned>(slot));
+        setSlotEnabled(slot, false);
+        ++configRevision;
+        return nullptr;
+    }
+    entry.symbol = symbol;
+    touchCachedSymbol(entry);
+    return entry.bitmap;
+}
+
+bool saveSymbolSlot(char symbol, const uint8_t *bitmap, bool enabled) {
+    const int slot = symbolPackSlot(symbol);
+    if (bitmap == nullptr || slot < 0) {
+        return false;
+    }
+    if (!symbolPackReady && !initEditableSymbolStore()) {
+        return false;
+    }
+
+    forgetCachedSymbol(symbol);
+    setSlotEnabled(slot, false);
+    ++configRevision;
+
+    const uint8_t flags = symbolPackFlags(enabled);
+    if (!writeSymbolPackSlots(static_cast<size_t>(slot), 1, bitmap, &flags)) {
+        return false;
+    }
+    setSlotEnabled(slot, enabled);
+    if (enabled) {
+        // Wer gerade speichert, will das Ergebnis meist gleich sehen.
+        SymbolCacheEntry &entry = leastRecentlyUsedEntry();
+        entry.symbol = symbol;
+        memcpy(entry.bitmap, bitmap, SYMBOL_BITMAP_SIZE);
+        touchCachedSymbol(entry);
+    }
+    return true;
+}
+
+// Setzt die Flags zurück; der Record bleibt liegen und wird beim nächsten Speichern überschrieben.
+bool clearSymbolSlot(char symbol) {
+    const int slot = symbolPackSlot(symbol);
+    if (slot < 0) {
+        return false;
+    }
+    setSlotEnabled(slot, false);
+    forgetCachedSymbol(symbol);
+    ++configRevision;
+    if (!symbolPackReady && !initEditableSymbolStore()) {
+        return true;
+    }
+    const uint8_t flags = 0;
+    return writeSymbolPackSlots(static_cast<size_t>(slot), 1, nullptr, &flags);
 }
 
 } // namespace
@@ -64,110 +173,117 @@ bool isEditableBuiltinSymbol(char symbol) {
     return editableBuiltinSymbolIndexFromChar(symbol) >= 0;
 }
 
+bool hasEditableBuiltinSymbolOverride(char symbol) {
+    const int index = editableBuiltinSymbolIndexFromChar(symbol);
+    return index >= 0 && editableBuiltinSymbolEnabled[index] == 1;
+}
+
+// Beim Start wird nur der Index des Symbol-Pakets gelesen und als Freigaben im RAM gehalten; Bitmaps
+// kommen erst bei Bedarf in den Cache.
 bool initEditableSymbolStore() {
     resetEditableBuiltinSymbols();
-    symbolFsReady = beginSymbolFs();
-    if (!symbolFsReady) {
-        Serial.println(F("Symbol-Dateisystem konnte nicht gestartet werden. Eingebaute Defaults bleiben aktiv."));
+    uint8_t flags[SYMBOL_PACK_SLOT_COUNT];
+    symbolPackReady = loadSymbolPackIndex(flags);
+    if (!symbolPackReady) {
+        LOG_WARN(CONFIG, "Symbol-Paket konnte nicht geöffnet werden. Eingebaute Defaults bleiben aktiv.");
         return false;
     }
 
-#if defined(ESP32) || defined(ESP8266)
-    for (size_t index = 0; index < EDITABLE_BUILTIN_SYMBOL_COUNT; ++index) {
-        const String path = symbolFilePath(editableBuiltinSymbols[index]);
-        if (!RIDDLEMATRIX_SYMBOL_FS.exists(path)) {
-            continue;
-        }
-        File file = RIDDLEMATRIX_SYMBOL_FS.open(path, "r");
-        if (!file) {
-            continue;
-        }
-        if (file.size() != static_cast<size_t>(SYMBOL_BITMAP_SIZE + 1)) {
-            file.close();
-            RIDDLEMATRIX_SYMBOL_FS.remove(path);
-            continue;
-        }
-        editableBuiltinSymbolEnabled[index] = file.read() == 1 ? 1 : 0;
-        const size_t bytesRead = file.read(editableBuiltinSymbolBitmaps[index], SYMBOL_BITMAP_SIZE);
-        file.close();
-        if (bytesRead != SYMBOL_BITMAP_SIZE) {
-            editableBuiltinSymbolEnabled[index] = 0;
-            memset(editableBuiltinSymbolBitmaps[index], 0, SYMBOL_BITMAP_SIZE);
-            RIDDLEMATRIX_SYMBOL_FS.remove(path);
-        }
+    for (size_t slot = 0; slot < SYMBOL_PACK_SLOT_COUNT; ++slot) {
+        setSlotEnabled(static_cast<int>(slot), flags[slot] == symbolPackFlags(true));
     }
-#endif
 
-    return true;
-}
-
-bool getDefaultBuiltinSymbolBitmap(char symbol, uint8_t *target) {
-    const uint8_t *source = getFactorySymbolBitmap(symbol);
-    if (target == nullptr || source == nullptr) {
-        return false;
-    }
-    for (size_t index = 0; index < SYMBOL_BITMAP_SIZE; ++index) {
-        target[index] = pgm_read_byte(&source[index]);
-    }
+    ++configRevision;
     return true;
 }
 
 bool getEditableBuiltinSymbolBitmap(char symbol, uint8_t *target) {
-    if (target == nullptr) {
+    if (target == nullptr || !isEditableBuiltinSymbol(symbol)) {
         return false;
     }
-    const int index = editableBuiltinSymbolIndexFromChar(symbol);
-    if (index < 0 || editableBuiltinSymbolEnabled[index] != 1) {
+    const uint8_t *bitmap = loadCachedSymbol(symbol);
+    if (bitmap == nullptr) {
         return false;
     }
-    memcpy(target, editableBuiltinSymbolBitmaps[index], SYMBOL_BITMAP_SIZE);
+    memcpy(target, bitmap, SYMBOL_BITMAP_SIZE);
     return true;
 }
 
+const uint8_t *findEditableBuiltinSymbolBitmap(char symbol) {
+    return isEditableBuiltinSymbol(symbol) ? loadCachedSymbol(symbol) : nullptr;
+}
+
 bool saveEditableBuiltinSymbol(char symbol, const uint8_t *bitmap, bool enabled) {
-    if (bitmap == nullptr) {
-        return false;
-    }
-    const int index = editableBuiltinSymbolIndexFromChar(symbol);
-    if (index < 0) {
+    return isEditableBuiltinSymbol(symbol) && saveSymbolSlot(symbol, bitmap, enabled);
+}
+
+bool clearEditableBuiltinSymbol(char symbol) {
+    return isEditableBuiltinSymbol(symbol) && clearSymbolSlot(symbol);
+}
+
+bool hasCustomSymbol(char symbol) {
+    if (!isCustomSymbol(symbol)) {
         return false;
     }
-    if (!symbolFsReady && !initEditableSymbolStore()) {
+    return findCachedSymbol(symbol) != nullptr || isSlotEnabled(symbolPackSlot(symbol));
+}
+
+const uint8_t *findCustomSymbolBitmap(char symbol) {
+    return isCustomSymbol(symbol) ? loadCachedSymbol(symbol) : nullptr;
+}
+
+bool readCustomSymbol(char symbol, uint8_t *target, bool &enabled) {
+    enabled = false;
+    const int slot = isCustomSymbol(symbol) ? symbolPackSlot(symbol) : -1;
+    uint8_t flags = 0;
+    if (target == nullptr || slot < 0 || !readSymbolPackFlags(static_cast<size_t>(slot), 1, &flags) ||
+        (flags & SYMBOL_PACK_FLAG_STORED) == 0) {
         return false;
     }
+    enabled = flags == symbolPackFlags(true);
+    return readSymbolPackRecords(static_cast<size_t>(slot), 1, target);
+}
+
+bool readCustomSymbolFlags(uint8_t (&flags)[CUSTOM_SYMBOL_COUNT]) {
+    memset(flags, 0, sizeof(flags));
+    return readSymbolPackFlags(SYMBOL_PACK_FIRST_CUSTOM_SLOT, CUSTOM_SYMBOL_COUNT, flags);
+}
 
-    memcpy(editableBuiltinSymbolBitmaps[index], bitmap, SYMBOL_BITMAP_SIZE);
-    editableBuiltinSymbolEnabled[index] = enabled ? 1 : 0;
+bool saveCustomSymbol(char symbol, const uint8_t *bitmap, bool enabled) {
+    return isCustomSymbol(symbol) && saveSymbolSlot(symbol, bitmap, enabled);
+}
+
+bool clearCustomSymbol(char symbol) {
+    return isCustomSymbol(symbol) && clearSymbolSlot(symbol);
+}
 
-#if defined(ESP32) || defined(ESP8266)
-    File file = RIDDLEMATRIX_SYMBOL_FS.open(symbolFilePath(symbol), "w");
-    if (!file) {
+bool beginSymbolBatch() {
+    if (!symbolPackReady && !initEditableSymbolStore()) {
         return false;
     }
-    file.write(static_cast<uint8_t>(enabled ? 1 : 0));
-    const size_t bytesWritten = file.write(bitmap, SYMBOL_BITMAP_SIZE);
-    file.close();
-    return bytesWritten == SYMBOL_BITMAP_SIZE;
-#else
-    return false;
-#endif
+    return beginSymbolPackBatch();
 }
 
-bool clearEditableBuiltinSymbol(char symbol) {
-    const int index = editableBuiltinSymbolIndexFromChar(symbol);
-    if (index < 0) {
+bool stageSymbolBatchRecord(char symbol, const uint8_t *bitmap, bool enabled) {
+    const int slot = symbolPackSlot(symbol);
+    if (slot < 0) {
         return false;
     }
-    editableBuiltinSymbolEnabled[index] = 0;
-    memset(editableBuiltinSymbolBitmaps[index], 0, SYMBOL_BITMAP_SIZE);
-    if (!symbolFsReady && !initEditableSymbolStore()) {
-        return true;
-    }
-#if defined(ESP32) || defined(ESP8266)
-    const String path = symbolFilePath(symbol);
-    if (RIDDLEMATRIX_SYMBOL_FS.exists(path)) {
-        return RIDDLEMATRIX_SYMBOL_FS.remove(path);
-    }
-#endif
-    return true;
+    const uint8_t flags = bitmap != nullptr ? symbolPackFlags(enabled) : 0;
+    return writeSymbolPackBatchSlots(static_cast<size_t>(slot), 1, bitmap, &flags);
+}
+
+// Nach dem Ersetzen wird nur der neue Index samt Freigaben gelesen; der Bitmap-Cache beginnt leer.
+bool commitSymbolBatch() {
+    const bool committed = commitSymbolPackBatch();
+    initEditableSymbolStore();
+    return committed;
+}
+
+void abortSymbolBatch() {
+    abortSymbolPackBatch();
+}
+
+const SymbolCacheStats &getSymbolCacheStats() {
+    return symbolCacheStats;
 }
@@ -0,0 +1,67 @@
+#ifndef SYMBOL_VIEW_H
+#define SYMBOL_VIEW_H
+
+#include "config.h"
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+// **Nur-Lese-Sicht auf eine 32x32-Symbol-Bitmap**
+// Renderer und Web-Oberfläche bekommen statt einer Kopie Zeiger plus Speicherart:
+//   Ram     – Eintrag im Symbol-Cache oder Zusatz-Symbol
+//   Progmem – Factory-Bitmap im Flash; auf dem ESP32 ist das in den Adressraum eingeblendetes
+//             .rodata, pgm_read_dword() dort ein gewöhnlicher Lesezugriff
+// Eine Zeile ist ein 32-Bit-Wort (4 Bytes, höchstwertiges Bit = linke Spalte). Liegt die Bitmap
+// auf einer 4-Byte-Grenze, liest row() jede Zeile mit einem einzigen Wortzugriff.
+enum class SymbolMemory : uint8_t {
+    Ram,
+    Progmem,
+};
+
+static constexpr size_t SYMBOL_VIEW_ROWS = SYMBOL_BITMAP_SIZE / sizeof(uint32_t);
+static_assert(SYMBOL_VIEW_ROWS == 32, "Symbol-Bitmaps bestehen aus 32 Zeilen zu 32 Pixeln");
+
+struct SymbolView {
+    const uint8_t *bitmap;
+    SymbolMemory memory;
+
+    explicit operator bool() const { return bitmap != nullptr; }
+
+    uint32_t row(uint8_t index) const {
+        const uint8_t *start = bitmap + static_cast<size_t>(index) * sizeof(uint32_t);
+        if ((reinterpret_cast<uintptr_t>(start) & (sizeof(uint32_t) - 1U)) != 0U) {
+            return unalignedRow(start);
+        }
+        uint32_t word;
+        if (memory == SymbolMemory::Progmem) {
+            word = pgm_read_dword(start);
+        } else {
+            memcpy(&word, start, sizeof(word));
+        }
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        word = __builtin_bswap32(word);  // Bitmap-Bytes stehen zeilenweise big-endian
+#endif
+        return word;
+    }
+
+  private:
+    uint32_t unalignedRow(const uint8_t *start) const {
+        uint32_t word = 0;
+        for (size_t index = 0; index < sizeof(uint32_t); ++index) {
+            const uint8_t value = memory == SymbolMemory::Progmem ? pgm_read_byte(&start[index]) : start[index];
+            word = (word << 8) | value;
+        }
+        return word;
+    }
+};
+
+inline SymbolView ramSymbolView(const uint8_t *bitmap) {
+    return SymbolView{bitmap, SymbolMemory::Ram};
+}
+
+inline SymbolView progmemSymbolView(const uint8_t *bitmap) {
+    return SymbolView{bitmap, SymbolMemory::Progmem};
+}
+
+#endif
@@ -1,5 +1,10 @@
 #include "trigger_handler.h"
+#include "clock_events.h"
 #include "rtc_manager.h"
+#include "display_plan.h"
+#include "log_manager.h"
+#include "rs485_protocol.h"
+#include "trigger_scheduler.h"
 #include "wifi_manager.h"
 
 DisplayLetterError lastDisplayLetterError = DisplayLetterError::None;
@@ -8,24 +13,14 @@ bool activeDisplayManagedBySchedule = false;
 
 namespace {
 
-constexpr size_t MAX_PENDING_TRIGGERS = NUM_TRIGGERS * 3;
-constexpr unsigned long WEEKDAY_CACHE_RETRY_DELAY_MS = 5UL;
-
-PendingTrigger pendingQueue[MAX_PENDING_TRIGGERS];
-size_t pendingTriggerCount = 0;
+// Bis zur ersten gültigen Uhrzeit bleibt die Standalone-Anzeige aktiv.
+bool standaloneWindowOpen = true;
 
-bool customSymbolIsAvailable(char letter) {
-    if (letter < '0' || letter > '7') {
-        return false;
-    }
-    const int index = letter - '0';
-    return index >= 0 &&
-        index < static_cast<int>(CUSTOM_SYMBOL_COUNT) &&
-        customSymbolEnabled[index] == 1;
-}
+constexpr unsigned long WEEKDAY_CACHE_RETRY_DELAY_MS = 5UL;
+constexpr size_t RS485_DRAIN_CHUNK_SIZE = 64;
 
 bool displaySymbolIsAvailable(char letter) {
-    return customSymbolIsAvailable(letter) || factorySymbolExists(letter);
+    return hasCustomSymbol(letter) || factorySymbolExists(letter);
 }
 
 char resolveRandomSymbolSelection() {
@@ -57,36 +52,6 @@ char resolveRandomSymbolSelection() {
     return candidates[random(static_cast<long>(candidateCount))];
 }
 
-void prioritizePendingTriggersWithExecuteAt(unsigned long executeAt) {
-    if (pendingTriggerCount < 2) {
-        return;
-    }
-
-    size_t insertPosition = 0;
-    for (size_t i = 0; i < pendingTriggerCount; ++i) {
-        if (pendingQueue[i].executeAt == executeAt) {
-            PendingTrigger matching = pendingQueue[i];
-
-            for (size_t j = i; j > insertPosition; --j) {
-                pendingQueue[j] = pendingQueue[j - 1];
-            }
-
-            pendingQueue[insertPosition] = matching;
-            ++insertPosition;
-        }
-    }
-}
-
-void shiftPendingQueue(size_t fromIndex) {
-    if (fromIndex >= pendingTriggerCount) {
-        return;
-    }
-
-    for (size_t i = fromIndex + 1; i < pendingTriggerCount; ++i) {
-        pendingQueue[i - 1] = pendingQueue[i];
-    }
-}
-
 void ensureWiFiSymbolAfterError() {
     if (wifiConnected && !wifiDisabled) {
         drawWiFiSymbol();
@@ -98,7 +63,7 @@ bool ensureWeekdayCacheForTriggers() {
         return true;
     }
 
-    Serial.println(F("⌛ Warte auf gültigen Wochentag aus dem RTC-Cache..."));
+    LOG_DEBUG(TRIGGER, "⌛ Warte auf gültigen Wochentag aus dem RTC-Cache...");
     updateCachedWeekday(true);
 
     if (!isWeekdayCacheValid()) {
@@ -107,7 +72,7 @@ bool ensureWeekdayCacheForTriggers() {
     }
 
     if (!isWeekdayCacheValid()) {
-        Serial.println(F("⚠️ Wochentag-Cache konnte nicht aktualisiert werden."));
+        LOG_WARN(TRIGGER, "⚠️ Wochentag-Cache konnte nicht aktualisiert werden.");
         return false;
     }
 
@@ -136,111 +101,46 @@ bool isWithinStandaloneWindow(uint16_t minutesOfDay) {
            minutesOfDay <= standalone_active_end_minutes;
 }
 
-uint16_t color565FromHex(const String &hexColor) {
-    uint32_t colorHex = strtol(hexColor.c_str() + 1, NULL, 16);
-    uint8_t r = (colorHex >> 16) & 0xFF;
-    uint8_t g = (colorHex >> 8) & 0xFF;
-    uint8_t b = colorHex & 0xFF;
-    return display.color565(r, g, b);
-}
-
-String buildRainbowRandomColor() {
-    const uint16_t hue = static_cast<uint16_t>(random(1536));
-    const uint8_t segment = static_cast<uint8_t>(hue / 256U);
-    const uint8_t offset = static_cast<uint8_t>(hue % 256U);
-
-    uint8_t r = 0;
-    uint8_t g = 0;
-    uint8_t b = 0;
-
-    switch (segment) {
-        case 0:
-            r = 255;
-            g = offset;
-            break;
-        case 1:
-            r = static_cast<uint8_t>(255 - offset);
-            g = 255;
-            break;
-        case 2:
-            g = 255;
-            b = offset;
-            break;
-        case 3:
-            g = static_cast<uint8_t>(255 - offset);
-            b = 255;
-            break;
-        case 4:
-            r = offset;
-            b = 255;
-            break;
+const char *describeDisplayLetterError(DisplayLetterError error) {
+    switch (error) {
+        case DisplayLetterError::TriggerAlreadyActive:
+            return "Ein anderes Zeichen/Symbol wird bereits angezeigt.";
+        case DisplayLetterError::InvalidWeekday:
+            return "Ungültiger Wochentag vom RTC-Modul.";
+        case DisplayLetterError::LetterNotFound:
+            return "Kein Muster für das angeforderte Zeichen/Symbol.";
+        case DisplayLetterError::None:
         default:
-            r = 255;
-            b = static_cast<uint8_t>(255 - offset);
-            break;
+            return "Unbekannter Fehler.";
     }
-
-    char buffer[8];
-    snprintf(buffer, sizeof(buffer), "#%02X%02X%02X", r, g, b);
-    return String(buffer);
 }
 
-String resolveDisplayColor(uint8_t triggerIndex, size_t dayIndex) {
-    String fixedColor(dailyLetterColors[triggerIndex][dayIndex]);
-    if (fixedColor.length() != 7 || fixedColor[0] != '#') {
-        fixedColor = "#FFFFFF";
-    }
-
-    const uint8_t colorModeValue = dailyLetterColorModes[triggerIndex][dayIndex];
-    const LetterColorMode colorMode = static_cast<LetterColorMode>(colorModeValue);
+void dispatchSerialTriggers(const Rs485ParseResult &result) {
+    for (uint8_t index = 0; index < result.triggerCount; ++index) {
+        const uint8_t triggerIndex = result.triggerIndices[index];
 
-    if (colorMode == LetterColorMode::Fixed) {
-        return fixedColor;
-    }
+        LOG_INFO(TRIGGER, "🔔 %s für Eingang %u", result.framed ? "RS485-Frame-Trigger" : "Serieller Trigger",
+                 static_cast<unsigned>(triggerIndex + 1));
 
-    if (colorMode == LetterColorMode::RandomAll) {
-        return buildRainbowRandomColor();
-    }
-
-    uint16_t paletteMask = dailyLetterRandomPaletteMasks[triggerIndex][dayIndex];
-    size_t selectedCount = 0;
-    for (size_t index = 0; index < RANDOM_COLOR_PALETTE_SIZE; ++index) {
-        if ((paletteMask & static_cast<uint16_t>(1U << index)) != 0U) {
-            ++selectedCount;
+        if (enqueuePendingTrigger(triggerIndex, false)) {
+            LOG_DEBUG(TRIGGER, "🗓️ Trigger wurde zur Ausführung eingeplant.");
         }
     }
-
-    if (selectedCount == 0) {
-        return fixedColor;
-    }
-
-    size_t selectedOffset = static_cast<size_t>(random(static_cast<long>(selectedCount)));
-    for (size_t index = 0; index < RANDOM_COLOR_PALETTE_SIZE; ++index) {
-        if ((paletteMask & static_cast<uint16_t>(1U << index)) == 0U) {
-            continue;
-        }
-
-        if (selectedOffset == 0) {
-            return String(randomColorPalette[index]);
-        }
-        --selectedOffset;
-    }
-
-    return fixedColor;
 }
 
 } // namespace
 
 void clearDisplay() {
     if (alreadyCleared) {
-        Serial.println(F("⚠️ `clearDisplay()` wurde bereits ausgeführt, Abbruch."));
+        LOG_DEBUG(DISPLAY, "⚠️ `clearDisplay()` wurde bereits ausgeführt, Abbruch.");
         return;
     }
 
-    Serial.println(F("🧹 Zeichen/Symbol wird jetzt gelöscht!"));
+    LOG_INFO(DISPLAY, "🧹 Zeichen/Symbol wird jetzt gelöscht!");
 
+    beginDisplayFrame();
     display.fillScreen(display.color565(0, 0, 0));
-    display.display();
+    presentDisplayFrame();
 
     alreadyCleared = true;
     triggerActive = false;
@@ -253,69 +153,49 @@ void clearDisplay() {
 }
 
 bool isTriggerPending(uint8_t triggerIndex) {
-    if (triggerIndex >= NUM_TRIGGERS) {
-        return false;
-    }
-
-    for (size_t i = 0; i < pendingTriggerCount; ++i) {
-        if (pendingQueue[i].triggerIndex == triggerIndex) {
-            return true;
-        }
-    }
-
-    return false;
+    return isTriggerScheduled(triggerIndex);
 }
 
 bool enqueuePendingTrigger(uint8_t triggerIndex, bool fromWeb) {
     if (triggerIndex >= NUM_TRIGGERS) {
-        Serial.println(F("⚠️ Ungültiger Trigger-Index beim Planen – Vorgang abgebrochen."));
+        LOG_WARN(TRIGGER, "⚠️ Ungültiger Trigger-Index beim Planen – Vorgang abgebrochen.");
         return false;
     }
 
-    if (pendingTriggerCount >= MAX_PENDING_TRIGGERS) {
-        Serial.println(F("⚠️ Zu viele geplante Trigger – bitte warten, bis ein Trigger abgearbeitet wurde."));
-        return false;
-    }
-
-    if (isTriggerPending(triggerIndex)) {
-        Serial.println(F("⚠️ Trigger wurde bereits geplant – doppelter Eintrag wird ignoriert."));
+    // Derselbe Trigger darf mehrfach anstehen (Bus-Bursts); begrenzt ist nur die Warteschlange.
+    if (scheduledTriggerCount() >= TRIGGER_QUEUE_CAPACITY) {
+        LOG_WARN(TRIGGER, "⚠️ Zu viele geplante Trigger – bitte warten, bis ein Trigger abgearbeitet wurde.");
         return false;
     }
 
     int today = resolveWeekdayForTriggerHandling();
     if (today < 0 || today >= static_cast<int>(NUM_DAYS)) {
-        Serial.println(F("⚠️ Ungültiger Wochentag aus Cache – Trigger kann nicht geplant werden."));
+        LOG_WARN(TRIGGER, "⚠️ Ungültiger Wochentag aus Cache – Trigger kann nicht geplant werden.");
         return false;
     }
 
-    unsigned long delaySeconds = letter_trigger_delays[triggerIndex][static_cast<size_t>(today)];
-    unsigned long executeAt = millis() + (delaySeconds * 1000UL);
+    const DisplayPlanEntry *planEntry = getDisplayPlanEntry(triggerIndex, today);
+    const unsigned long delaySeconds = planEntry->delayMs / 1000UL;
+    unsigned long executeAt = millis() + planEntry->delayMs;
 
-    pendingQueue[pendingTriggerCount++] = {triggerIndex, executeAt, fromWeb};
+    if (!scheduleTrigger({triggerIndex, executeAt, fromWeb})) {
+        LOG_ERROR(TRIGGER, "⚠️ Trigger konnte nicht in die Warteschlange übernommen werden.");
+        return false;
+    }
     pendingTriggerActive = true;
 
     if (triggerActive) {
-        Serial.println(F("ℹ️ Anzeige läuft noch – Trigger wurde zur späteren Ausführung eingeplant."));
+        LOG_DEBUG(TRIGGER, "ℹ️ Anzeige läuft noch – Trigger wurde zur späteren Ausführung eingeplant.");
     }
 
-    Serial.print(F("📥 Geplanter Trigger "));
-    Serial.print(triggerIndex + 1);
-    Serial.print(F(" aus Quelle "));
-    Serial.println(fromWeb ? F("Web") : F("Seriell"));
-
-    if (delaySeconds == 0) {
-        Serial.println(F("⚡ Keine Verzögerung konfiguriert – Ausführung erfolgt beim nächsten Durchlauf."));
-    } else {
-        Serial.print(F("⏱️ Ausführung in "));
-        Serial.print(delaySeconds);
-        Serial.println(F(" Sekunden geplant."));
-    }
+    LOG_INFO(TRIGGER, "📥 Geplanter Trigger %u aus Quelle %s, Ausführung in %lu s",
+             static_cast<unsigned>(triggerIndex + 1), fromWeb ? "Web" : "Seriell", delaySeconds);
 
     return true;
 }
 
 void processPendingTriggers() {
-    if (pendingTriggerCount == 0) {
+    if (scheduledTriggerCount() == 0) {
         pendingTriggerActive = false;
         return;
     }
@@ -324,75 +204,39 @@ void processPendingTriggers() {
         return;
     }
 
-    unsigned long now = millis();
-    size_t index = 0;
-
-    while (index < pendingTriggerCount) {
-        const PendingTrigger current = pendingQueue[index];
+    PendingTrigger current = {};
+    while (popDueScheduledTrigger(millis(), current)) {
+        pendingTriggerActive = scheduledTriggerCount() > 0;
 
-        if (static_cast<long>(now - current.executeAt) >= 0) {
-            shiftPendingQueue(index);
-            --pendingTriggerCount;
-            pendingTriggerActive = pendingTriggerCount > 0;
+        LOG_DEBUG(TRIGGER, "🚀 Ausführung des geplanten Triggers %u (Quelle: %s)",
+                  static_cast<unsigned>(current.triggerIndex + 1), current.fromWeb ? "Web" : "Seriell");
 
-            Serial.print(F("🚀 Ausführung des geplanten Triggers "));
-            Serial.print(current.triggerIndex + 1);
-            Serial.print(F(" (Quelle: "));
-            Serial.print(current.fromWeb ? F("Web") : F("Seriell"));
-            Serial.println(F(")"));
-
-            handleTrigger(static_cast<char>('1' + current.triggerIndex), false, current.fromWeb);
-
-            unsigned long afterExecution = millis();
-
-            bool hasSameExecuteAtPending = false;
-            for (size_t i = 0; i < pendingTriggerCount; ++i) {
-                const PendingTrigger& candidate = pendingQueue[i];
-                if (candidate.executeAt == current.executeAt &&
-                    static_cast<long>(afterExecution - candidate.executeAt) >= 0) {
-                    hasSameExecuteAtPending = true;
-                    break;
-                }
-            }
+        handleTrigger(static_cast<char>('1' + current.triggerIndex), false, current.fromWeb);
 
-            if (hasSameExecuteAtPending) {
-                Serial.println(F("🔁 Weitere Trigger mit identischem Ausführungszeitpunkt warten auf Abarbeitung."));
-                prioritizePendingTriggersWithExecuteAt(current.executeAt);
-            }
-
-            if (triggerActive) {
-                break;
-            }
-
-            now = afterExecution;
-            continue;
+        if (triggerActive) {
+            break;
         }
-
-        ++index;
     }
 
-    if (pendingTriggerCount == 0) {
-        pendingTriggerActive = false;
-    }
+    pendingTriggerActive = scheduledTriggerCount() > 0;
+}
+
+unsigned long millisUntilNextPendingTrigger() {
+    return millisUntilNextScheduledTrigger(millis());
 }
 
 bool displayLetter(uint8_t triggerIndex, char letter) {
     lastDisplayLetterError = DisplayLetterError::None;
 
     if (triggerIndex >= NUM_TRIGGERS) {
-        Serial.print(F("⚠️ Ungültiger Trigger-Index "));
-        Serial.print(triggerIndex);
-        Serial.println(F(" – fallback auf Trigger 1."));
+        LOG_WARN(DISPLAY, "⚠️ Ungültiger Trigger-Index %u – fallback auf Trigger 1.", static_cast<unsigned>(triggerIndex));
         triggerIndex = 0;
     }
 
-    Serial.print(F("🎨 Zeichne Zeichen/Symbol für Trigger "));
-    Serial.print(triggerIndex + 1);
-    Serial.print(F(": "));
-    Serial.println(letter);
+    LOG_DEBUG(DISPLAY, "🎨 Zeichne Zeichen/Symbol für Trigger %u: %c", static_cast<unsigned>(triggerIndex + 1), letter);
 
     if (triggerActive) {
-        Serial.println(F("⚠️ Ein Zeichen/Symbol ist bereits aktiv. Abbruch."));
+        LOG_DEBUG(DISPLAY, "⚠️ Ein Zeichen/Symbol ist bereits aktiv. Abbruch.");
         lastDisplayLetterError = DisplayLetterError::TriggerAlreadyActive;
         return false;
     }
@@ -402,90 +246,53 @@ bool displayLetter(uint8_t triggerIndex, char letter) {
     if (letter == '*') {
         letter = resolveRandomSymbolSelection();
         if (letter == '\0') {
-            Serial.println(F("Keine gueltige Zufalls-Zeichenliste vorhanden."));
+            LOG_WARN(DISPLAY, "Keine gueltige Zufalls-Zeichenliste vorhanden.");
             triggerActive = false;
             lastDisplayLetterError = DisplayLetterError::LetterNotFound;
             ensureWiFiSymbolAfterError();
             return false;
         }
-        Serial.print(F("Zufallsauswahl `*` wurde ersetzt durch: "));
-        Serial.println(letter);
+        LOG_DEBUG(DISPLAY, "Zufallsauswahl `*` wurde ersetzt durch: %c", letter);
     }
 
-    int today = getRTCWeekday();
-    Serial.print(F("📅 Heutiger Wochentag: "));
-    Serial.println(today);
+    int today = resolveWeekdayForTriggerHandling();
 
-    if (today < 0 || today >= static_cast<int>(NUM_DAYS)) {
-        Serial.println(F("⚠️ Ungültiger Wochentag – breche Anzeige ab."));
+    const DisplayPlanEntry *planEntry = getDisplayPlanEntry(triggerIndex, today);
+    if (planEntry == nullptr) {
+        LOG_WARN(DISPLAY, "⚠️ Ungültiger Wochentag – breche Anzeige ab.");
         triggerActive = false;
         lastDisplayLetterError = DisplayLetterError::InvalidWeekday;
         ensureWiFiSymbolAfterError();
         return false;
     }
 
-    String selectedColor = resolveDisplayColor(triggerIndex, static_cast<size_t>(today));
-
-    Serial.print(F("🎨 Geladene Farbe für heute: "));
-    Serial.println(selectedColor);
-
-    if (selectedColor.length() != 7 || selectedColor[0] != '#') {
-        Serial.println(F("⚠️ Fehler: Ungültige Farbe! Setze Standardfarbe Weiß."));
-        selectedColor = "#FFFFFF";
-    }
-
-    uint16_t letterColor = color565FromHex(selectedColor);
+    const uint16_t letterColor = pickDisplayPlanColor(*planEntry);
 
-    uint8_t builtinOverrideBitmap[SYMBOL_BITMAP_SIZE] = {};
-    const bool useBuiltinOverride = getEditableBuiltinSymbolBitmap(letter, builtinOverrideBitmap);
-
-    int customSymbolIndex = -1;
-    if (letter >= '0' && letter <= '7') {
-        customSymbolIndex = letter - '0';
+    DisplaySymbol symbol = planEntry->symbol;
+    if (symbol.letter != letter) {
+        resolveDisplaySymbol(letter, symbol);
     }
-    const bool useCustomSymbol =
-        customSymbolIndex >= 0 &&
-        customSymbolIndex < static_cast<int>(CUSTOM_SYMBOL_COUNT) &&
-        customSymbolEnabled[customSymbolIndex] == 1;
-
-    const uint8_t *factoryBitmap = getFactorySymbolBitmap(letter);
-    if (!useBuiltinOverride && !useCustomSymbol && factoryBitmap == nullptr) {
-        Serial.println(F("⚠️ Fehler: Zeichen/Symbol nicht gefunden!"));
+    if (symbol.source == DisplaySymbolSource::Missing ||
+        symbol.source == DisplaySymbolSource::RandomSelection) {
+        LOG_WARN(DISPLAY, "⚠️ Fehler: Zeichen/Symbol nicht gefunden!");
         triggerActive = false;
         lastDisplayLetterError = DisplayLetterError::LetterNotFound;
         ensureWiFiSymbolAfterError();
         return false;
     }
 
-    const uint8_t* bitmap = useBuiltinOverride
-        ? builtinOverrideBitmap
-        : (useCustomSymbol ? customSymbolBitmaps[customSymbolIndex] : factoryBitmap);
-
     wifiSymbolVisible = false;
+
+    beginDisplayFrame();
     display.fillScreen(display.color565(0, 0, 0));
-    display.display();
-    delay(10);
-
-    Serial.println(F("🖊️ Beginne Zeichnung..."));
-    for (int y = 0; y < 32; y++) {
-        for (int x = 0; x < 32; x++) {
-            uint8_t rowValue = (useBuiltinOverride || useCustomSymbol)
-                ? bitmap[y * 4 + (x / 8)]
-                : pgm_read_byte(&bitmap[y * 4 + (x / 8)]);
-            if (rowValue & (1 << (7 - (x % 8)))) {
-                display.setBrightness(display_brightness);
-                display.fillRect(x * 2, y * 2, 2, 2, letterColor);
-            }
-        }
-    }
+    display.setBrightness(display_brightness);
+    const uint16_t spanCount = renderDisplaySymbol(symbol, letterColor);
+    presentDisplayFrame();
 
-    Serial.println(F("✅ Zeichen/Symbol auf Display gezeichnet!"));
-    display.display();
+    LOG_INFO(DISPLAY, "✅ %c gezeichnet (Farbe 0x%04X, Tag %d, %u Läufe) für %lu s", letter,
+             static_cast<unsigned>(letterColor), today, static_cast<unsigned>(spanCount), letter_display_time);
 
     letterStartTime = millis();
-    Serial.print(F("⏳ Anzeigezeit startet jetzt für "));
-    Serial.print(letter_display_time);
-    Serial.println(F(" Sekunden!"));
 
     lastDisplayLetterError = DisplayLetterError::None;
     return true;
@@ -496,66 +303,40 @@ void handleTrigger(char triggerType, bool isAutoMode, bool fromWeb) {
     if (triggerType >= '1' && triggerType <= ('0' + NUM_TRIGGERS)) {
         triggerIndex = static_cast<uint8_t>(triggerType - '1');
     } else {
-        Serial.print(F("⚠️ Unbekannter Trigger-Typ "));
-        Serial.print(triggerType);
-        Serial.println(F(" – verwende Trigger 1."));
+        LOG_WARN(TRIGGER, "⚠️ Unbekannter Trigger-Typ %c – verwende Trigger 1.", triggerType);
         triggerIndex = 0;
     }
 
     if (wifiConnected) {
         if (!isAutoMode && !fromWeb) {
             if (wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::TimedManager)) {
-                Serial.println(F("WiFi wird abgeschaltet wegen Trigger (Quelle: Seriell)."));
+                LOG_INFO(WIFI, "WiFi wird abgeschaltet wegen Trigger (Quelle: Seriell).");
                 WiFi.disconnect();
                 wifiConnected = false;
                 server.end();
                 webServerRunning = false;
             } else {
-                Serial.println(F("WiFi bleibt aktiv, weil ein dauerhafter WLAN-Modus aktiv ist."));
+                LOG_DEBUG(WIFI, "WiFi bleibt aktiv, weil ein dauerhafter WLAN-Modus aktiv ist.");
             }
         } else {
-            Serial.print(F("ℹ️ WiFi bleibt aktiv (Quelle: "));
-            if (isAutoMode) {
-                Serial.println(F("Automodus)."));
-            } else {
-                Serial.println(F("Web)."));
-            }
+            LOG_DEBUG(WIFI, "ℹ️ WiFi bleibt aktiv (Quelle: %s).", isAutoMode ? "Automodus" : "Web");
         }
     }
 
     int today = resolveWeekdayForTriggerHandling();
     bool validDay = today >= 0 && today < static_cast<int>(NUM_DAYS);
-    size_t delayDayIndex = validDay ? static_cast<size_t>(today) : 0;
-
-    if (!validDay) {
-        Serial.println(F("⚠️ Ungültiger Wochentag! Nutze Fallback-Index 0 für Verzögerungen."));
-    }
 
     if (validDay) {
         if (!fromWeb && !isWithinStandaloneActiveWindow()) {
-            Serial.println(F("🌙 Standby aktiv – Zeichen/Symbol wird außerhalb des Aktivfensters nicht angezeigt."));
+            LOG_INFO(TRIGGER, "🌙 Standby aktiv – Zeichen/Symbol wird außerhalb des Aktivfensters nicht angezeigt.");
             activeDisplayManagedBySchedule = false;
             return;
         }
 
-        char letter = dailyLetters[triggerIndex][today];
-        Serial.print(F("📅 Heute ist "));
-        Serial.print(daysOfTheWeek[today]);
-        Serial.print(F(" → Trigger "));
-        Serial.print(triggerIndex + 1);
-        Serial.print(F(" zeigt Zeichen/Symbol: "));
-        Serial.println(letter);
-
-        unsigned long delayTime = letter_trigger_delays[triggerIndex][delayDayIndex];
-        if (!isAutoMode && !fromWeb) {
-            if (delayTime == 0) {
-                Serial.println(F("⚡ Keine Verzögerung für diesen Trigger hinterlegt."));
-            } else {
-                Serial.print(F("⏳ Konfigurierte Verzögerung: "));
-                Serial.print(delayTime);
-                Serial.println(F(" Sekunden (bereits eingehalten)."));
-            }
-        }
+        const DisplayPlanEntry *planEntry = getDisplayPlanEntry(triggerIndex, today);
+        char letter = planEntry->symbol.letter;
+        LOG_DEBUG(TRIGGER, "📅 Heute ist %s → Trigger %u zeigt Zeichen/Symbol: %c", daysOfTheWeek[today],
+                  static_cast<unsigned>(triggerIndex + 1), letter);
 
         bool displayed = displayLetter(triggerIndex, letter);
 
@@ -564,45 +345,37 @@ void handleTrigger(char triggerType, bool isAutoMode, bool fromWeb) {
             activeDisplayManagedBySchedule = isAutoMode;
         } else {
             activeDisplayManagedBySchedule = false;
-            Serial.print(F("❌ Anzeige fehlgeschlagen: "));
-            switch (lastDisplayLetterError) {
-                case DisplayLetterError::TriggerAlreadyActive:
-                    Serial.println(F("Ein anderes Zeichen/Symbol wird bereits angezeigt."));
-                    break;
-                case DisplayLetterError::InvalidWeekday:
-                    Serial.println(F("Ungültiger Wochentag vom RTC-Modul."));
-                    break;
-                case DisplayLetterError::LetterNotFound:
-                    Serial.println(F("Kein Muster für das angeforderte Zeichen/Symbol."));
-                    break;
-                case DisplayLetterError::None:
-                default:
-                    Serial.println(F("Unbekannter Fehler."));
-                    break;
-            }
+            LOG_WARN(DISPLAY, "❌ Anzeige fehlgeschlagen: %s", describeDisplayLetterError(lastDisplayLetterError));
         }
 
     } else {
-        Serial.println(F("⚠️ Ungültiger Wochentag! Anzeige wird übersprungen."));
+        LOG_WARN(TRIGGER, "⚠️ Ungültiger Wochentag! Anzeige wird übersprungen.");
     }
 }
 
 void checkTrigger() {
-    if (Serial.available() > 0) {
-        char receivedChar = Serial.read();
-        if (receivedChar == '1' || receivedChar == '2' || receivedChar == '3') {
-            uint8_t triggerIndex = static_cast<uint8_t>(receivedChar - '1');
-
-            Serial.print(F("🔔 Serieller Trigger für Eingang "));
-            Serial.println(triggerIndex + 1);
+    // **Empfangspuffer blockweise leeren, höchstens eine Puffergröße pro loop()-Durchlauf**
+    uint8_t chunk[RS485_DRAIN_CHUNK_SIZE];
+    size_t drained = 0;
+    int available = Serial.available();
+
+    while (available > 0 && drained < RS485_RX_BUFFER_SIZE) {
+        const size_t wanted = static_cast<size_t>(available) < sizeof(chunk) ? static_cast<size_t>(available) : sizeof(chunk);
+        const size_t received = Serial.readBytes(chunk, wanted);
+        if (received == 0) {
+            break;
+        }
 
-            if (enqueuePendingTrigger(triggerIndex, false)) {
-                Serial.println(F("🗓️ Trigger wurde zur Ausführung eingeplant."));
+        const unsigned long now = millis();
+        for (size_t index = 0; index < received; ++index) {
+            Rs485ParseResult result;
+            if (feedRs485Byte(chunk[index], now, rs485_box_address, result)) {
+                dispatchSerialTriggers(result);
             }
-        } else {
-            Serial.print(F("❌ Unbekannter Trigger: "));
-            Serial.println(receivedChar);
         }
+
+        drained += received;
+        available = Serial.available();
     }
 }
 
@@ -613,28 +386,38 @@ void checkAutoDisplay() {
         return;
     }
 
-    if (!isWithinStandaloneActiveWindow()) {
-        if (triggerActive && activeDisplayManagedBySchedule) {
-            Serial.println(F("🌙 Standalone-Aktivzeit beendet – automatische Anzeige wird gelöscht."));
-            clearDisplay();
-        }
+    if (!standaloneWindowOpen) {
         return;
     }
 
     if (millis() - lastDisplayTime > ((unsigned long)letter_auto_display_interval * 1000UL)) {
         lastDisplayTime = millis();
-        Serial.println(F("🕒 Automodus aktiv: Zeige heutiges Zeichen/Symbol automatisch!"));
+        LOG_DEBUG(TRIGGER, "🕒 Automodus aktiv: Zeige heutiges Zeichen/Symbol automatisch!");
 
         handleTrigger('1', true, false);
     }
 }
 
-bool isWithinStandaloneActiveWindow() {
+void handleClockEvents(uint8_t events) {
+    if ((events & (CLOCK_EVENT_ACTIVE_START | CLOCK_EVENT_ACTIVE_END | CLOCK_EVENT_RESYNC)) == 0) {
+        return;
+    }
+
     uint16_t minutesOfDay = 0;
     if (!getRTCMinutesOfDay(minutesOfDay)) {
-        Serial.println(F("⚠️ RTC-Zeit für Aktivfenster nicht verfügbar – Standalone-Anzeige bleibt aktiv."));
-        return true;
+        LOG_WARN(TRIGGER, "⚠️ RTC-Zeit für Aktivfenster nicht verfügbar – Standalone-Anzeige bleibt aktiv.");
+        standaloneWindowOpen = true;
+        return;
     }
 
-    return isWithinStandaloneWindow(minutesOfDay);
+    const bool wasOpen = standaloneWindowOpen;
+    standaloneWindowOpen = isWithinStandaloneWindow(minutesOfDay);
+    if (wasOpen && !standaloneWindowOpen && autoDisplayMode && triggerActive && activeDisplayManagedBySchedule) {
+        LOG_INFO(TRIGGER, "🌙 Standalone-Aktivzeit beendet – automatische Anzeige wird gelöscht.");
+        clearDisplay();
+    }
+}
+
+bool isWithinStandaloneActiveWindow() {
+    return standaloneWindowOpen;
 }
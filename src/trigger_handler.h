@@ -37,9 +37,14 @@ bool isTriggerPending(uint8_t triggerIndex);
 
 void processPendingTriggers();
 
+// Zeit bis zum nächsten geplanten Trigger (0 = fällig, ULONG_MAX = keiner geplant).
+unsigned long millisUntilNextPendingTrigger();
+
 void checkTrigger();
 
 void checkAutoDisplay();
+// Reagiert auf Zeitgrenzen aus pollClockEvents(): Aktivfenster neu bewerten, Automodus-Anzeige beenden.
+void handleClockEvents(uint8_t events);
 bool isWithinStandaloneActiveWindow();
 
 #endif
@@ -0,0 +1,109 @@
+#include "trigger_scheduler.h"
+
+namespace {
+
+struct ScheduledTrigger {
+    PendingTrigger trigger;
+    uint32_t sequence;
+};
+
+ScheduledTrigger heap[TRIGGER_QUEUE_CAPACITY];
+size_t heapSize = 0;
+uint32_t nextSequence = 0;
+uint8_t scheduledPerTrigger[NUM_TRIGGERS] = {};
+
+bool runsBefore(const ScheduledTrigger &left, const ScheduledTrigger &right) {
+    const long deadlineDelta = static_cast<long>(left.trigger.executeAt - right.trigger.executeAt);
+    if (deadlineDelta != 0) {
+        return deadlineDelta < 0;
+    }
+    return static_cast<int32_t>(left.sequence - right.sequence) < 0;
+}
+
+void siftUp(size_t index) {
+    const ScheduledTrigger moving = heap[index];
+    while (index > 0) {
+        const size_t parent = (index - 1) / 2;
+        if (!runsBefore(moving, heap[parent])) {
+            break;
+        }
+        heap[index] = heap[parent];
+        index = parent;
+    }
+    heap[index] = moving;
+}
+
+void siftDown(size_t index) {
+    const ScheduledTrigger moving = heap[index];
+    while (true) {
+        size_t child = (index * 2) + 1;
+        if (child >= heapSize) {
+            break;
+        }
+        if (child + 1 < heapSize && runsBefore(heap[child + 1], heap[child])) {
+            ++child;
+        }
+        if (!runsBefore(heap[child], moving)) {
+            break;
+        }
+        heap[index] = heap[child];
+        index = child;
+    }
+    heap[index] = moving;
+}
+
+} // namespace
+
+bool scheduleTrigger(const PendingTrigger &trigger) {
+    if (heapSize >= TRIGGER_QUEUE_CAPACITY || trigger.triggerIndex >= NUM_TRIGGERS) {
+        return false;
+    }
+    heap[heapSize] = {trigger, nextSequence++};
+    ++scheduledPerTrigger[trigger.triggerIndex];
+    siftUp(heapSize++);
+    return true;
+}
+
+bool peekNextScheduledTrigger(PendingTrigger &trigger) {
+    if (heapSize == 0) {
+        return false;
+    }
+    trigger = heap[0].trigger;
+    return true;
+}
+
+bool popDueScheduledTrigger(unsigned long now, PendingTrigger &trigger) {
+    if (heapSize == 0 || static_cast<long>(now - heap[0].trigger.executeAt) < 0) {
+        return false;
+    }
+    trigger = heap[0].trigger;
+    --scheduledPerTrigger[trigger.triggerIndex];
+    heap[0] = heap[--heapSize];
+    if (heapSize > 0) {
+        siftDown(0);
+    }
+    return true;
+}
+
+bool isTriggerScheduled(uint8_t triggerIndex) {
+    return triggerIndex < NUM_TRIGGERS && scheduledPerTrigger[triggerIndex] > 0;
+}
+
+size_t scheduledTriggerCount() {
+    return heapSize;
+}
+
+unsigned long millisUntilNextScheduledTrigger(unsigned long now) {
+    if (heapSize == 0) {
+        return TRIGGER_SCHEDULE_IDLE;
+    }
+    const long remaining = static_cast<long>(heap[0].trigger.executeAt - now);
+    return remaining > 0 ? static_cast<unsigned long>(remaining) : 0UL;
+}
+
+void clearScheduledTriggers() {
+    heapSize = 0;
+    for (size_t index = 0; index < NUM_TRIGGERS; ++index) {
+        scheduledPerTrigger[index] = 0;
+    }
+}
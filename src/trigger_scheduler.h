@@ -0,0 +1,33 @@
+#ifndef TRIGGER_SCHEDULER_H
+#define TRIGGER_SCHEDULER_H
+
+#include "trigger_handler.h"
+
+#include <limits.h>
+
+// **Deadline-Scheduler für geplante Trigger**
+// Binärer Min-Heap nach executeAt: nächster Termin in O(1), Einfügen und
+// Entnehmen in O(log n). Vergleiche laufen über die Differenz, damit der
+// millis()-Überlauf nach ~49 Tagen die Reihenfolge nicht umdreht; gleiche
+// Termine werden in Einplanungsreihenfolge (FIFO) abgearbeitet.
+#ifndef RIDDLEMATRIX_TRIGGER_QUEUE_CAPACITY
+#define RIDDLEMATRIX_TRIGGER_QUEUE_CAPACITY 16
+#endif
+
+static constexpr size_t TRIGGER_QUEUE_CAPACITY = RIDDLEMATRIX_TRIGGER_QUEUE_CAPACITY;
+static constexpr unsigned long TRIGGER_SCHEDULE_IDLE = ULONG_MAX;
+
+static_assert(TRIGGER_QUEUE_CAPACITY >= NUM_TRIGGERS, "Trigger-Warteschlange kleiner als Anzahl der Trigger");
+static_assert(TRIGGER_QUEUE_CAPACITY <= 0xFF, "Einträge je Trigger werden in 8 Bit gezählt");
+
+bool scheduleTrigger(const PendingTrigger &trigger);
+bool peekNextScheduledTrigger(PendingTrigger &trigger);
+// Entnimmt den frühesten Trigger, sofern er zum Zeitpunkt `now` fällig ist.
+bool popDueScheduledTrigger(unsigned long now, PendingTrigger &trigger);
+bool isTriggerScheduled(uint8_t triggerIndex);
+size_t scheduledTriggerCount();
+// Millisekunden bis zum nächsten Termin; 0 wenn fällig, TRIGGER_SCHEDULE_IDLE wenn leer.
+unsigned long millisUntilNextScheduledTrigger(unsigned long now);
+void clearScheduledTriggers();
+
+#endif
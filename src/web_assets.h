@@ -0,0 +1,324 @@
+// **Automatisch erzeugt von tools/embed_web_assets.py – nicht von Hand bearbeiten**
+// Statische Dateien der Weboberfläche, gzip-komprimiert im Flash. WEB_ASSET_*_HASH dient
+// als ETag und als Versionsparameter in den Verweisen der Startseite.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// web/script.js: 19402 Bytes, gzip 4546 Bytes
+#define WEB_ASSET_SCRIPT_JS_HASH "4ea9bce236190c34"
+static constexpr size_t WEB_ASSET_SCRIPT_JS_GZ_LENGTH = 4546;
+static const uint8_t WEB_ASSET_SCRIPT_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3c, 0xdb, 0x6e, 0xe4, 0xc8,
+    0x75, 0xef, 0xfa, 0x8a, 0x92, 0x9c, 0x0c, 0xd9, 0x3b, 0xdd, 0x54, 0x4b, 0xb3, 0x63, 0x6f, 0xd4,
+    0xd2, 0x08, 0x5a, 0xcd, 0x28, 0x2b, 0x78, 0x34, 0x3b, 0x98, 0x96, 0x32, 0x81, 0x67, 0x15, 0xa1,
+    0x9a, 0xac, 0xee, 0xe6, 0x8a, 0x4d, 0xb6, 0x79, 0x91, 0xd4, 0x9a, 0x95, 0x61, 0x03, 0xc9, 0x9b,
+    0x01, 0x27, 0x8e, 0xf3, 0x62, 0xc4, 0x48, 0x1e, 0xf2, 0x0d, 0x46, 0x02, 0x2c, 0xf2, 0x32, 0x7f,
+    0xb2, 0x3f, 0x90, 0x7c, 0x42, 0xce, 0xa9, 0x2a, 0x92, 0x55, 0x64, 0xb1, 0x2f, 0x1a, 0x39, 0xce,
+    0x26, 0x69, 0xec, 0x6a, 0x9a, 0x75, 0x39, 0xe7, 0xd4, 0xb9, 0xd5, 0x39, 0xa7, 0x8a, 0xed, 0x46,
+    0x61, 0x92, 0x92, 0xd8, 0xf7, 0xbc, 0x80, 0x9d, 0xd0, 0x34, 0xf6, 0x6f, 0x4e, 0x68, 0x48, 0x47,
+    0x2c, 0xfe, 0x31, 0x9b, 0x91, 0x3d, 0x12, 0xb2, 0x6b, 0x72, 0xf6, 0xe6, 0x65, 0x9f, 0xd1, 0xd8,
+    0x1d, 0xbf, 0xa6, 0x31, 0x9d, 0x24, 0xf6, 0xb5, 0x1f, 0x7a, 0xd1, 0xb5, 0x13, 0x44, 0x2e, 0x4d,
+    0xfd, 0x28, 0x74, 0x12, 0xde, 0xd9, 0x72, 0x46, 0x2c, 0xb5, 0xad, 0x78, 0x72, 0x71, 0xc9, 0x66,
+    0x56, 0x8b, 0x7c, 0xf3, 0x0d, 0xb1, 0xac, 0xde, 0xda, 0xda, 0x30, 0x0b, 0x5d, 0x1c, 0x46, 0x26,
+    0x02, 0xee, 0x11, 0x4b, 0xdd, 0xb1, 0x9d, 0xc5, 0x41, 0x9b, 0x44, 0x53, 0xec, 0x48, 0x5a, 0xe4,
+    0xfd, 0x1a, 0x81, 0x8f, 0xcb, 0x49, 0x19, 0x62, 0xff, 0x97, 0xa2, 0x07, 0x08, 0xf8, 0x72, 0xf0,
+    0x35, 0x73, 0x53, 0x87, 0x26, 0x89, 0x3f, 0x0a, 0xed, 0xf7, 0x77, 0xc5, 0x2c, 0x44, 0xf0, 0xfe,
+    0xae, 0xd5, 0x53, 0xa6, 0x8e, 0x19, 0xf5, 0x58, 0x9c, 0x48, 0xb2, 0xbf, 0x10, 0x4f, 0xb6, 0x0a,
+    0xd0, 0xc9, 0x87, 0xa8, 0x93, 0xfd, 0x21, 0xb1, 0xcd, 0x0c, 0xc8, 0x29, 0xc3, 0x8f, 0x9c, 0x09,
+    0xab, 0x85, 0x55, 0xfe, 0x65, 0xe7, 0x8d, 0x32, 0xa1, 0x23, 0x67, 0x74, 0x60, 0x8a, 0xd5, 0x6e,
+    0x60, 0xa6, 0x44, 0x76, 0xc7, 0xff, 0x1a, 0x69, 0xda, 0xcb, 0x71, 0x88, 0x91, 0x31, 0x4b, 0xb3,
+    0x38, 0x14, 0x43, 0x05, 0xbf, 0xd4, 0x59, 0x00, 0xee, 0x4e, 0x61, 0x6e, 0x36, 0xf5, 0x68, 0xca,
+    0xde, 0xa4, 0xee, 0x71, 0x38, 0xcd, 0xd2, 0xc4, 0x4e, 0xfd, 0x09, 0x3b, 0x65, 0x37, 0xa9, 0xce,
+    0xdb, 0x14, 0x5a, 0x00, 0x4d, 0x1f, 0x28, 0x0b, 0x47, 0xc5, 0x18, 0x21, 0x2a, 0x8d, 0x93, 0x13,
+    0x0a, 0x98, 0x60, 0x24, 0x4e, 0x70, 0xf8, 0x83, 0xbd, 0x69, 0x7f, 0xe5, 0xbd, 0xff, 0xf4, 0xae,
+    0xd5, 0xc1, 0x7f, 0xb7, 0xcb, 0x7f, 0xbf, 0x4a, 0x1e, 0x8b, 0x6f, 0x3b, 0xfc, 0xaf, 0xbd, 0xbf,
+    0x23, 0xbe, 0xb4, 0xf6, 0x5b, 0x9b, 0x1a, 0x4c, 0x24, 0xf0, 0xc8, 0x67, 0x81, 0x07, 0x70, 0xbd,
+    0xc8, 0xcd, 0x26, 0x2c, 0x4c, 0x9d, 0x9f, 0x66, 0x2c, 0x9e, 0xf5, 0x59, 0x00, 0x32, 0x8e, 0x62,
+    0x7b, 0xc3, 0x47, 0xea, 0xdf, 0x85, 0x74, 0xc2, 0xf6, 0x2c, 0x1c, 0x6f, 0x9d, 0x6f, 0x68, 0x30,
+    0x90, 0xe4, 0x55, 0x60, 0xe0, 0xf8, 0x2a, 0x8c, 0x6b, 0xc6, 0x2e, 0x3d, 0x3a, 0xab, 0x81, 0x01,
+    0xf5, 0x7d, 0x11, 0x30, 0xfc, 0xfa, 0xf9, 0xec, 0xd8, 0x03, 0x4d, 0x4e, 0xdd, 0xb7, 0x62, 0xa8,
+    0xa5, 0x28, 0x8a, 0x3a, 0x5b, 0x55, 0x0f, 0x0d, 0x76, 0xce, 0xb9, 0x64, 0x1a, 0xf8, 0xa0, 0x2d,
+    0x6d, 0xab, 0xf5, 0xae, 0x7b, 0xee, 0x00, 0xd7, 0x27, 0xb6, 0x04, 0x85, 0x1f, 0x15, 0x94, 0xe3,
+    0x87, 0x21, 0x8b, 0x4f, 0x85, 0x7c, 0x72, 0x28, 0x8f, 0x1e, 0x91, 0xf5, 0xcd, 0xaf, 0xbc, 0x4d,
+    0x27, 0x65, 0x49, 0x9a, 0x63, 0x6e, 0x91, 0xfd, 0x62, 0xc0, 0x0e, 0xb1, 0x3a, 0x96, 0xaa, 0x57,
+    0x48, 0xe1, 0xba, 0x10, 0x1e, 0x08, 0x75, 0xbd, 0x64, 0x39, 0x3e, 0x15, 0xcc, 0x53, 0xe9, 0x16,
+    0x5a, 0x56, 0x85, 0x51, 0x30, 0x85, 0x82, 0x7a, 0x5d, 0x31, 0xc9, 0x17, 0xb2, 0xbe, 0xb7, 0x57,
+    0x8a, 0x51, 0x85, 0x52, 0x34, 0x3a, 0x57, 0x34, 0xc8, 0x18, 0xac, 0x81, 0x13, 0xf1, 0x6e, 0xeb,
+    0x9c, 0x3c, 0x46, 0x1a, 0xe1, 0xaf, 0x68, 0xd8, 0xae, 0x36, 0x3c, 0x39, 0x5f, 0x01, 0xb7, 0x71,
+    0x05, 0x45, 0x63, 0x05, 0xf7, 0xa7, 0xe7, 0x4e, 0xc0, 0xc2, 0x51, 0x0a, 0x7a, 0x0c, 0x53, 0x9f,
+    0x02, 0xdb, 0xf2, 0x76, 0x24, 0x61, 0xa7, 0xdb, 0xb5, 0x80, 0x7f, 0x79, 0x53, 0x4e, 0x04, 0xd8,
+    0xd4, 0xe6, 0x26, 0xf9, 0xcf, 0x7f, 0xfa, 0x87, 0x5f, 0x93, 0x83, 0xcb, 0x34, 0x63, 0x41, 0xc0,
+    0xc8, 0xd9, 0x38, 0xbe, 0x65, 0x7e, 0x4a, 0xe8, 0x20, 0xce, 0x86, 0x2c, 0x2c, 0x8d, 0x8e, 0xdb,
+    0xe3, 0x9b, 0xd3, 0x43, 0x3b, 0x27, 0x47, 0x73, 0x71, 0xd6, 0x26, 0x68, 0xd4, 0x29, 0x2a, 0x60,
+    0xab, 0xa0, 0xd5, 0x49, 0xc7, 0x2c, 0xb4, 0x63, 0x96, 0x4c, 0x41, 0x5d, 0x80, 0xd4, 0x67, 0x24,
+    0xff, 0xee, 0xa0, 0xc2, 0xd8, 0xad, 0xea, 0x50, 0x5c, 0x1c, 0x0e, 0x2b, 0x97, 0xcb, 0xd9, 0x3d,
+    0x47, 0x67, 0x05, 0x46, 0x4d, 0x9f, 0x10, 0x48, 0x4f, 0x03, 0x60, 0x72, 0x17, 0x8a, 0x66, 0xde,
+    0x29, 0x64, 0xb8, 0xdc, 0xfa, 0x59, 0x1c, 0x47, 0x31, 0x12, 0x82, 0x7a, 0x1e, 0x05, 0xcc, 0xe1,
+    0x0d, 0xb6, 0x75, 0xc4, 0xc6, 0x01, 0x8b, 0x77, 0xc0, 0xeb, 0xf1, 0x86, 0x96, 0x70, 0x4b, 0x9c,
+    0x85, 0x7f, 0xff, 0x3b, 0x72, 0x14, 0x33, 0x9f, 0x85, 0xe4, 0xcd, 0xc1, 0x49, 0x03, 0xf3, 0x4e,
+    0xd8, 0x24, 0x8a, 0x67, 0x4d, 0xfc, 0x9b, 0xf0, 0xde, 0x8f, 0x61, 0x9f, 0x80, 0xb0, 0x02, 0x03,
+    0xc5, 0x84, 0xb3, 0x04, 0xc8, 0xa8, 0x30, 0x51, 0xf4, 0x3c, 0x30, 0x8f, 0x40, 0xcd, 0x40, 0x7f,
+    0x3a, 0x3f, 0x41, 0xf5, 0x82, 0x8d, 0xe5, 0x56, 0x65, 0x10, 0x3c, 0xab, 0xba, 0x15, 0x30, 0xd8,
+    0x1b, 0xa3, 0x78, 0x22, 0x77, 0xb7, 0x23, 0xf8, 0xfa, 0x9c, 0xa6, 0xd4, 0x9e, 0xa7, 0x0b, 0x38,
+    0xc8, 0x6a, 0x49, 0xc1, 0x56, 0x98, 0x9b, 0x48, 0xe5, 0x6c, 0x93, 0xf7, 0xb0, 0xb6, 0x74, 0x1c,
+    0x79, 0xe0, 0x4d, 0x5e, 0x7f, 0xd9, 0x3f, 0x85, 0x96, 0x41, 0xe4, 0xcd, 0x76, 0x04, 0xb6, 0xbb,
+    0x8f, 0xe0, 0x3e, 0x85, 0x65, 0xa7, 0xcd, 0x6c, 0xe2, 0xdd, 0x05, 0x7b, 0x08, 0xfa, 0x84, 0x1a,
+    0x83, 0x7e, 0xf9, 0xb7, 0x84, 0x33, 0x67, 0xca, 0x62, 0xf2, 0xea, 0xf4, 0x35, 0x49, 0x66, 0xa1,
+    0x3b, 0x8e, 0xa3, 0xd0, 0x4f, 0x7c, 0x16, 0x6b, 0xdc, 0x82, 0x0e, 0x18, 0xd0, 0xa4, 0x4a, 0xb2,
+    0x7b, 0x15, 0x5d, 0xca, 0x35, 0x28, 0x41, 0x65, 0xc0, 0x7e, 0xfb, 0x3d, 0x89, 0x2e, 0x77, 0xca,
+    0x61, 0xd1, 0x65, 0x9b, 0xe4, 0xdd, 0x77, 0xad, 0x96, 0x01, 0x74, 0x16, 0xa4, 0x75, 0xdd, 0xd3,
+    0xb6, 0x62, 0x31, 0xc8, 0xc9, 0xc1, 0x80, 0xc7, 0xd7, 0x5b, 0xe4, 0xa6, 0xc1, 0xbd, 0x9f, 0x65,
+    0x69, 0x70, 0xf0, 0xb3, 0x5f, 0x19, 0x5e, 0x1b, 0xb0, 0x43, 0x24, 0x1d, 0x40, 0x2d, 0x8c, 0xb6,
+    0x90, 0x87, 0x7d, 0x95, 0x87, 0x59, 0x38, 0x02, 0xae, 0x0f, 0xa3, 0x60, 0x04, 0xb6, 0xea, 0x8e,
+    0xd7, 0xd1, 0x29, 0x4a, 0x91, 0x90, 0x01, 0xf3, 0x89, 0x27, 0x19, 0x5f, 0x9d, 0xe4, 0x58, 0x2d,
+    0xdd, 0xa5, 0xf0, 0xad, 0xa7, 0xc0, 0xd5, 0xaa, 0x2c, 0x3a, 0x5f, 0x38, 0x9a, 0xc5, 0x35, 0x8d,
+    0x43, 0xdb, 0xea, 0xb3, 0xf8, 0x0a, 0x10, 0x17, 0xb6, 0x81, 0x0c, 0xa9, 0x80, 0xbc, 0x23, 0x2c,
+    0x00, 0xd1, 0x34, 0x43, 0x0a, 0xa2, 0x91, 0x6d, 0x7d, 0xf7, 0xd7, 0xff, 0xf6, 0x1f, 0xff, 0xfa,
+    0x2b, 0x22, 0xe0, 0xd1, 0x30, 0xbd, 0x8e, 0xe2, 0xb4, 0x09, 0xa0, 0xf6, 0x24, 0xf4, 0xaf, 0x32,
+    0x6c, 0x8e, 0x59, 0xd7, 0xc5, 0x38, 0xc7, 0xc8, 0x7b, 0x06, 0x54, 0x06, 0x55, 0x57, 0x11, 0xeb,
+    0x11, 0x5d, 0x10, 0x51, 0xef, 0xad, 0x7f, 0xe4, 0xbf, 0x62, 0xb8, 0xa2, 0xcb, 0xc4, 0xd6, 0x43,
+    0xb9, 0x84, 0xc7, 0x3b, 0xf3, 0xe2, 0x97, 0x6b, 0x7f, 0x98, 0x4f, 0x16, 0xc1, 0x91, 0x1a, 0xc6,
+    0xac, 0x8b, 0xf9, 0xf3, 0x23, 0x01, 0x31, 0x46, 0x78, 0xc1, 0x2f, 0x4e, 0x4f, 0x5e, 0x02, 0x36,
+    0x6b, 0x57, 0x84, 0xdf, 0xcf, 0xfa, 0x99, 0x3b, 0x66, 0x04, 0xe0, 0xdf, 0x5e, 0xb3, 0xf8, 0x92,
+    0x39, 0x8e, 0xb3, 0xbb, 0x29, 0xbb, 0x2c, 0xb3, 0xbf, 0x71, 0x69, 0x88, 0xeb, 0x59, 0xce, 0x04,
+    0xbf, 0x4e, 0xa2, 0xb0, 0xee, 0x50, 0x42, 0xc9, 0x8b, 0xba, 0x34, 0xe6, 0x90, 0x4a, 0x78, 0x58,
+    0xb0, 0xb7, 0xb1, 0xf1, 0xac, 0xdf, 0x3f, 0x7e, 0x4e, 0x68, 0x96, 0x90, 0x97, 0x7e, 0x92, 0x32,
+    0x72, 0x4d, 0x51, 0x1c, 0xa1, 0x81, 0xf4, 0xfc, 0x93, 0xe3, 0x73, 0xc0, 0x15, 0xbe, 0xa0, 0xb0,
+    0x0c, 0xd9, 0x50, 0xc7, 0x5f, 0x0a, 0x46, 0x22, 0x55, 0x04, 0xe3, 0xc6, 0x0c, 0x36, 0x5b, 0x29,
+    0x1b, 0xdb, 0x12, 0x03, 0xaa, 0xe6, 0x83, 0x1f, 0xd1, 0x53, 0x84, 0x31, 0x12, 0x99, 0x03, 0xa9,
+    0x8f, 0xd7, 0x38, 0x18, 0xd5, 0xf7, 0x30, 0x0a, 0x53, 0x0c, 0x91, 0xf4, 0x29, 0x18, 0xe5, 0x10,
+    0x1b, 0x55, 0x2d, 0x6f, 0x8d, 0xa1, 0x99, 0xb7, 0x7a, 0x9f, 0x4f, 0xb0, 0x3d, 0x5f, 0x8e, 0xc3,
+    0x42, 0x37, 0x9e, 0x4d, 0x53, 0xe6, 0xa1, 0x8b, 0x68, 0x13, 0xb0, 0xa3, 0xc4, 0x1d, 0x03, 0x11,
+    0x09, 0xb0, 0x35, 0xe5, 0x1e, 0x01, 0xd2, 0xae, 0x21, 0x6c, 0xdf, 0x90, 0xd7, 0xc1, 0xfc, 0x96,
+    0x55, 0x27, 0x47, 0x0a, 0x80, 0x4e, 0xa7, 0x2c, 0xf4, 0x0e, 0xc7, 0x7e, 0xe0, 0xd9, 0x82, 0xc2,
+    0xaa, 0x09, 0xde, 0xc7, 0xd6, 0x96, 0x93, 0x2e, 0x28, 0x18, 0x41, 0x7f, 0x32, 0x62, 0x48, 0x3d,
+    0xe8, 0x5e, 0xd8, 0x24, 0x57, 0xa3, 0xed, 0xa2, 0xbb, 0x9b, 0x90, 0xb7, 0x2f, 0x0f, 0x5e, 0x75,
+    0x10, 0x94, 0xc9, 0x94, 0xab, 0x36, 0x0a, 0xab, 0x0d, 0x64, 0xe6, 0xc1, 0x54, 0x63, 0x7d, 0x38,
+    0x5b, 0x95, 0x00, 0x40, 0x9c, 0x3c, 0x52, 0x6b, 0x4e, 0x7b, 0xac, 0x1f, 0x20, 0x0c, 0xdc, 0xf0,
+    0x89, 0x92, 0x00, 0x6d, 0xe0, 0xcc, 0x8d, 0x73, 0xd5, 0xf2, 0x25, 0x31, 0xb0, 0xd3, 0x94, 0x50,
+    0xf1, 0x41, 0xb0, 0x98, 0x73, 0x53, 0xf5, 0x0a, 0xc5, 0xa0, 0x42, 0x2d, 0xd5, 0x91, 0x4a, 0xd8,
+    0x5c, 0x49, 0x45, 0x91, 0x1b, 0x27, 0x91, 0x27, 0x22, 0xf3, 0xaa, 0xf3, 0x9a, 0x40, 0xc7, 0xca,
+    0x4b, 0xc1, 0xc6, 0x0b, 0x9c, 0xb9, 0x71, 0xbe, 0x03, 0xbe, 0xc7, 0xbd, 0x64, 0x9e, 0xd5, 0xda,
+    0x97, 0x64, 0x61, 0x0a, 0x8b, 0x41, 0xac, 0x67, 0xa9, 0x7c, 0x83, 0xa8, 0x21, 0x41, 0x53, 0x0f,
+    0x53, 0x41, 0xc6, 0x3c, 0x11, 0x94, 0x63, 0xdf, 0x22, 0x76, 0x3e, 0x5e, 0x97, 0x02, 0x9d, 0x2e,
+    0x86, 0x82, 0x45, 0x91, 0xe0, 0x60, 0x6a, 0x9a, 0x9e, 0xcc, 0x26, 0x83, 0x28, 0x58, 0x98, 0x76,
+    0xe2, 0x32, 0xfb, 0xe5, 0x50, 0x13, 0x8c, 0x43, 0x5c, 0xfd, 0x20, 0xba, 0x59, 0x04, 0xe6, 0x22,
+    0x49, 0x69, 0x9a, 0x25, 0x17, 0x62, 0xd6, 0x05, 0x0b, 0xe9, 0x20, 0x60, 0x1c, 0x62, 0xa1, 0x0d,
+    0x55, 0x0e, 0xa9, 0xa2, 0xaf, 0xf6, 0x39, 0x49, 0x3a, 0x03, 0xa3, 0xf1, 0x7c, 0x48, 0x6b, 0x79,
+    0x8e, 0x2b, 0xc4, 0x88, 0x91, 0x89, 0x60, 0x3d, 0x7a, 0x8f, 0x30, 0x0a, 0x19, 0xf7, 0x18, 0x03,
+    0x60, 0xc5, 0x65, 0x2d, 0x39, 0xcd, 0x79, 0xa8, 0xe2, 0xc9, 0xdb, 0xe6, 0xc0, 0xa7, 0x53, 0x5c,
+    0x0b, 0x47, 0x20, 0xe0, 0x22, 0x06, 0x8e, 0xaa, 0x8a, 0x40, 0xe1, 0xb2, 0xa6, 0xc6, 0x65, 0xf3,
+    0x52, 0xcb, 0x58, 0x0a, 0x4b, 0x21, 0x07, 0xb0, 0x1f, 0x0e, 0x64, 0xbd, 0x04, 0x52, 0x47, 0x9e,
+    0x8f, 0x76, 0xa4, 0xf2, 0x02, 0xe6, 0x21, 0x85, 0xf8, 0xc6, 0x64, 0x43, 0x69, 0x34, 0x1a, 0x05,
+    0xac, 0x0f, 0xe2, 0xf3, 0xdd, 0xe3, 0xa9, 0xd1, 0x86, 0xa4, 0x34, 0x97, 0xd2, 0x01, 0xdf, 0xbd,
+    0xf0, 0xa7, 0xa5, 0xfc, 0xf7, 0x73, 0x12, 0x54, 0xd5, 0x1a, 0x2e, 0xd4, 0xed, 0x44, 0x23, 0x47,
+    0xf5, 0x29, 0xc3, 0x9a, 0x4c, 0x87, 0x66, 0x89, 0xe6, 0x44, 0x37, 0x73, 0x38, 0x0f, 0xfc, 0x7f,
+    0xf3, 0x1b, 0x0c, 0xfc, 0x81, 0xce, 0xb0, 0xb3, 0x29, 0xcc, 0xa1, 0x73, 0x1a, 0xfb, 0x23, 0x08,
+    0x28, 0xc8, 0x87, 0x6f, 0x07, 0xf0, 0xf7, 0x2d, 0x1b, 0xf8, 0xb0, 0xed, 0xc5, 0x43, 0xea, 0x32,
+    0x85, 0x71, 0x62, 0xcc, 0x4b, 0x96, 0x42, 0x97, 0x2d, 0x9f, 0x8e, 0x43, 0x8f, 0xdd, 0xa8, 0x79,
+    0x14, 0xf7, 0x37, 0xb8, 0x89, 0x58, 0xe5, 0x1a, 0xd2, 0xd9, 0x94, 0x45, 0x43, 0xa2, 0x4e, 0x11,
+    0x4a, 0x11, 0x66, 0x13, 0xc0, 0x67, 0xa1, 0x90, 0xb5, 0xce, 0x67, 0x7b, 0xa4, 0xab, 0x2e, 0xb9,
+    0x00, 0xba, 0x2f, 0x87, 0xed, 0xf1, 0x30, 0x2f, 0x74, 0x41, 0x33, 0xce, 0xde, 0x1c, 0x1f, 0x46,
+    0x13, 0x08, 0x6d, 0x30, 0x02, 0xd0, 0xa0, 0x3c, 0x26, 0x5b, 0x45, 0x65, 0xd0, 0x14, 0x36, 0x69,
+    0x0b, 0x42, 0x80, 0x1c, 0xcd, 0xf7, 0x3b, 0x8d, 0xa9, 0xa5, 0x2d, 0xb5, 0x34, 0xe5, 0xbb, 0x7f,
+    0xfc, 0x1b, 0x92, 0x8b, 0xbb, 0x96, 0x9d, 0x7c, 0xf7, 0xbb, 0x5f, 0x92, 0xb3, 0x70, 0xc0, 0x2e,
+    0x69, 0x88, 0x0a, 0x40, 0xd4, 0xed, 0x5b, 0x4e, 0x5a, 0xff, 0xd8, 0xec, 0x04, 0x71, 0xfc, 0x2f,
+    0xcb, 0x50, 0x70, 0x49, 0x4b, 0x65, 0x29, 0xca, 0xc0, 0x79, 0x99, 0x0a, 0x37, 0xd3, 0xbf, 0xfb,
+    0x05, 0xae, 0x4c, 0x5a, 0xaa, 0x34, 0x54, 0xe2, 0xf9, 0x31, 0xbb, 0x84, 0xfd, 0x32, 0xbc, 0x65,
+    0xfe, 0x48, 0x4d, 0xd2, 0xa5, 0x23, 0x30, 0x58, 0x67, 0x1b, 0xed, 0x12, 0x1a, 0x73, 0xc9, 0x28,
+    0x16, 0x29, 0x3a, 0x84, 0xea, 0x24, 0xbc, 0x72, 0x6d, 0xe1, 0x76, 0x2f, 0x9a, 0xf3, 0x12, 0x1f,
+    0xf6, 0x6e, 0x55, 0xeb, 0xb1, 0xba, 0x38, 0xcf, 0xc2, 0xd1, 0x87, 0x6f, 0x83, 0x14, 0x28, 0x4a,
+    0x2a, 0x04, 0x23, 0x3f, 0x24, 0xfa, 0x72, 0x95, 0x0a, 0x33, 0x3e, 0xf7, 0xa1, 0x8f, 0x30, 0x3f,
+    0xc4, 0xff, 0x6f, 0x59, 0x10, 0xd6, 0x20, 0x60, 0x56, 0x71, 0xfd, 0xe1, 0x5f, 0x78, 0x3a, 0xa1,
+    0xaa, 0x9e, 0x9e, 0x53, 0x15, 0xfe, 0x27, 0x8b, 0x03, 0x74, 0x14, 0x9b, 0x1a, 0x3f, 0xf6, 0xdd,
+    0x31, 0x6d, 0xf4, 0x19, 0x1a, 0x79, 0x0f, 0xe2, 0xae, 0x90, 0x86, 0xc7, 0x30, 0xfe, 0xd1, 0xc3,
+    0x79, 0x2b, 0x00, 0xf9, 0x7f, 0xc1, 0x31, 0x55, 0x45, 0x1f, 0x8e, 0x18, 0x2a, 0x7a, 0x5a, 0x7a,
+    0xa7, 0x03, 0xa1, 0xf9, 0x95, 0x6c, 0xe4, 0xff, 0x9d, 0xd2, 0x7f, 0x93, 0x53, 0xfa, 0xf5, 0xbf,
+    0x13, 0x4c, 0x3f, 0x3a, 0xcf, 0x21, 0x0f, 0x09, 0x49, 0x32, 0xe5, 0xf2, 0x8a, 0xc3, 0x35, 0x34,
+    0x3d, 0x11, 0x8b, 0xbd, 0xf0, 0x7c, 0xc8, 0x34, 0xc0, 0xae, 0x27, 0x74, 0x2a, 0x0b, 0xaa, 0x07,
+    0x71, 0x4c, 0x67, 0xf6, 0xd6, 0xf6, 0x67, 0x2d, 0x67, 0xe8, 0x07, 0x81, 0xdd, 0x6d, 0xa9, 0x87,
+    0x97, 0x62, 0x1a, 0x4c, 0x38, 0x4e, 0xfa, 0x2c, 0xb5, 0xc1, 0x5f, 0xcd, 0xf4, 0x70, 0x6c, 0x30,
+    0x4b, 0x99, 0xb4, 0x42, 0x32, 0x23, 0x9f, 0x90, 0x4f, 0x81, 0xc6, 0x13, 0x9a, 0x8e, 0x9d, 0x61,
+    0x10, 0xc1, 0x42, 0x6f, 0xc8, 0x26, 0xf9, 0xac, 0xa5, 0x1d, 0xec, 0xd9, 0x75, 0x52, 0xde, 0x15,
+    0x50, 0xce, 0xc9, 0x23, 0x62, 0x6f, 0x91, 0xdd, 0x5d, 0x62, 0xff, 0x88, 0x74, 0x08, 0xcc, 0xff,
+    0x53, 0x98, 0x0f, 0x1f, 0xae, 0xa9, 0x5d, 0x3d, 0x0d, 0x4d, 0x58, 0xda, 0xcf, 0xe9, 0xe3, 0xa4,
+    0xb5, 0xf3, 0x40, 0xeb, 0xde, 0x34, 0xe6, 0xc7, 0x80, 0xc9, 0x25, 0x8c, 0xad, 0xd3, 0x51, 0xfa,
+    0xa1, 0x0a, 0xa2, 0x32, 0xdc, 0x6d, 0x5a, 0xd7, 0x37, 0x7b, 0x1c, 0xac, 0xf4, 0x22, 0x55, 0x55,
+    0x5d, 0xc0, 0x93, 0x3d, 0xf2, 0x33, 0x65, 0xb2, 0xc6, 0x84, 0x98, 0xc1, 0x98, 0xb8, 0xaf, 0xcc,
+    0xaf, 0x04, 0xcc, 0xa3, 0xd8, 0x9f, 0x1b, 0x2d, 0x0b, 0xd4, 0x7f, 0x0e, 0xa3, 0xb4, 0x42, 0x19,
+    0x4e, 0x9b, 0x5f, 0x26, 0xc3, 0x11, 0x7a, 0x6d, 0x42, 0x86, 0x95, 0x43, 0x30, 0x00, 0xf4, 0xdc,
+    0x04, 0xc3, 0xc2, 0x6e, 0x0f, 0xfe, 0xd9, 0x25, 0x4f, 0xb6, 0xe1, 0xdf, 0xc7, 0x8f, 0xb5, 0x58,
+    0x39, 0x1f, 0x76, 0x23, 0x86, 0xdd, 0xc8, 0x61, 0x37, 0xfa, 0xb0, 0x72, 0x25, 0x2e, 0x0b, 0x82,
+    0x39, 0x05, 0xa6, 0x41, 0x96, 0xa6, 0xf5, 0x02, 0x13, 0x4e, 0x72, 0x70, 0xd7, 0x40, 0x02, 0xe5,
+    0x10, 0xc3, 0x08, 0x37, 0xa0, 0x49, 0xf2, 0x8a, 0x4e, 0xf8, 0x30, 0xc1, 0x92, 0x0e, 0x76, 0xf0,
+    0x7a, 0x91, 0xd1, 0x0a, 0xc0, 0x2b, 0x12, 0x80, 0x85, 0xbe, 0xcf, 0x88, 0x93, 0x7a, 0xde, 0x8b,
+    0x2b, 0x20, 0x8c, 0x17, 0xdd, 0x80, 0x49, 0xb6, 0xe5, 0x06, 0x3e, 0x84, 0xfe, 0x6d, 0x02, 0x02,
+    0x32, 0x16, 0xd2, 0x0c, 0xfa, 0xbc, 0x6e, 0x42, 0x6d, 0x28, 0xa1, 0x99, 0xb4, 0xa0, 0xb9, 0x00,
+    0x55, 0x48, 0x4f, 0x2d, 0x5b, 0x21, 0xd1, 0xaa, 0x63, 0x31, 0xe8, 0x5a, 0x41, 0x0c, 0xe8, 0xe7,
+    0x69, 0xf4, 0x05, 0xbb, 0x29, 0x54, 0x4d, 0xda, 0x76, 0x5d, 0x8d, 0x4b, 0xf7, 0x08, 0x0f, 0xb6,
+    0xac, 0xa5, 0xc0, 0x9e, 0x27, 0xbe, 0x3d, 0x22, 0xdb, 0x4f, 0x9f, 0xc2, 0x8e, 0x18, 0xc9, 0xa3,
+    0xf9, 0xad, 0x1f, 0xb6, 0x9c, 0x29, 0xf5, 0x20, 0x01, 0x04, 0xdf, 0xb7, 0xdd, 0x26, 0x56, 0xd7,
+    0x52, 0xf7, 0xbf, 0xaf, 0x23, 0x1f, 0xb6, 0x03, 0xad, 0x92, 0x1a, 0x9d, 0xc1, 0x12, 0xe2, 0x43,
+    0x9a, 0x30, 0xdb, 0x50, 0x48, 0x96, 0x05, 0x85, 0x38, 0x9a, 0x20, 0xb1, 0xe3, 0x32, 0x1b, 0x92,
+    0x0a, 0x15, 0x30, 0x1a, 0x96, 0x17, 0x03, 0xa0, 0x5f, 0xde, 0x09, 0xd0, 0xce, 0xac, 0xb9, 0x39,
+    0x6c, 0xfe, 0xd5, 0xbb, 0x6e, 0xe7, 0xcf, 0x68, 0x67, 0x78, 0xd0, 0x39, 0x3a, 0x7f, 0xbf, 0xfd,
+    0xf4, 0x87, 0x77, 0x7f, 0x22, 0xcf, 0xa7, 0x39, 0x90, 0xd6, 0x7c, 0x47, 0x30, 0xc7, 0xd7, 0x2e,
+    0xe9, 0x0e, 0x00, 0xc2, 0xbb, 0xf3, 0x5e, 0xdd, 0x76, 0x7c, 0xe9, 0xd7, 0xc0, 0x7e, 0xc4, 0xd7,
+    0x5d, 0xb1, 0x2a, 0x19, 0x20, 0xe6, 0xad, 0x10, 0xf1, 0x6c, 0x57, 0x8d, 0xaa, 0x8e, 0xc4, 0x99,
+    0x66, 0xc9, 0xd8, 0x9e, 0xd2, 0x38, 0x01, 0xcf, 0x23, 0x57, 0xe6, 0x24, 0xa0, 0xb5, 0xcc, 0xf6,
+    0x45, 0xb4, 0x2a, 0xa1, 0x01, 0xb0, 0x36, 0x01, 0x61, 0x19, 0xf4, 0xa5, 0x59, 0x1b, 0xab, 0xc2,
+    0x39, 0xcc, 0x92, 0x34, 0x9a, 0x88, 0x51, 0xd5, 0xca, 0xa1, 0x08, 0x31, 0x16, 0x7a, 0xad, 0x7e,
+    0x10, 0xa5, 0x7a, 0x31, 0xec, 0xc0, 0x5c, 0x85, 0xa7, 0x53, 0x7f, 0x53, 0x5a, 0xf5, 0x80, 0x2f,
+    0x75, 0x6e, 0xd4, 0x29, 0x46, 0xb6, 0x3e, 0xa2, 0x62, 0xef, 0xd1, 0x94, 0xd6, 0x8d, 0xbc, 0xae,
+    0x92, 0x38, 0xce, 0x11, 0x14, 0x69, 0xd7, 0x51, 0x74, 0xc7, 0xb7, 0x44, 0xcd, 0x43, 0x0a, 0xb3,
+    0x2c, 0x75, 0x55, 0x03, 0x2e, 0xc3, 0x86, 0x95, 0x7f, 0x64, 0x97, 0x52, 0xa0, 0x59, 0x5f, 0xe7,
+    0x84, 0xc9, 0x8e, 0x79, 0x51, 0x91, 0xb9, 0xb0, 0xd9, 0x40, 0x1d, 0x57, 0x05, 0xac, 0x8e, 0x9a,
+    0x08, 0x44, 0x18, 0x26, 0xea, 0xb0, 0xbd, 0x52, 0xee, 0x17, 0x5c, 0xcb, 0x7c, 0xc8, 0x6a, 0xc2,
+    0xda, 0x78, 0x71, 0x3e, 0x68, 0x81, 0x0f, 0x09, 0x3d, 0x1a, 0x7b, 0x1d, 0x19, 0xb6, 0xee, 0x88,
+    0x44, 0xb9, 0x9f, 0x47, 0x45, 0xe4, 0xda, 0x8f, 0x3d, 0x7e, 0xcc, 0x07, 0xc9, 0xcd, 0x88, 0x0d,
+    0x68, 0x06, 0xb9, 0xce, 0x73, 0x36, 0xa4, 0x18, 0x5c, 0x67, 0x6c, 0xc0, 0xcf, 0x02, 0x62, 0x1f,
+    0xbe, 0x40, 0x6a, 0x63, 0x44, 0x02, 0x8e, 0xff, 0x27, 0x59, 0x42, 0xd3, 0xdb, 0x12, 0x05, 0x87,
+    0xa9, 0x60, 0x21, 0x74, 0x30, 0x62, 0x01, 0x1b, 0x01, 0xc4, 0xd0, 0x23, 0x98, 0xb8, 0x17, 0x49,
+    0x62, 0x96, 0x8c, 0x18, 0x3f, 0x89, 0xc1, 0xdb, 0x33, 0xb1, 0x87, 0x58, 0x9a, 0xf8, 0x7c, 0xb7,
+    0xf0, 0x2c, 0x59, 0x86, 0xe4, 0x97, 0x11, 0x56, 0x06, 0x48, 0x08, 0xb8, 0x61, 0xdf, 0x67, 0x01,
+    0x05, 0xb0, 0x12, 0x7a, 0xfd, 0x9c, 0xb9, 0xf4, 0xea, 0xf4, 0x8a, 0xcd, 0xb1, 0x45, 0xd3, 0xe1,
+    0x7b, 0xab, 0xd8, 0xe8, 0x27, 0x72, 0x0f, 0x81, 0xdd, 0x0d, 0x0c, 0x0a, 0x36, 0xb7, 0x7b, 0x58,
+    0xac, 0x09, 0x5a, 0x5e, 0xb4, 0x6b, 0x2f, 0xad, 0xf2, 0x45, 0x75, 0x0f, 0xa5, 0xbf, 0xc5, 0xf7,
+    0xe5, 0xae, 0x11, 0xb4, 0x30, 0x37, 0x80, 0x6c, 0xd8, 0xce, 0x5a, 0xcb, 0x79, 0x8f, 0x87, 0xbc,
+    0x3d, 0xf0, 0x70, 0xf9, 0xa0, 0x50, 0x86, 0x4a, 0x26, 0x07, 0x2c, 0xd6, 0x53, 0x39, 0xa9, 0x2b,
+    0x90, 0x9f, 0x49, 0x25, 0x4d, 0x1d, 0xce, 0x2c, 0xb3, 0x0e, 0x15, 0x83, 0x0a, 0x2d, 0xd5, 0x28,
+    0x58, 0x45, 0x1d, 0xab, 0xa0, 0xe6, 0xa8, 0x24, 0x10, 0x9c, 0xc7, 0x42, 0xa7, 0x91, 0x34, 0xca,
+    0xff, 0x11, 0x6a, 0x89, 0x5b, 0x22, 0x82, 0x03, 0x05, 0xfb, 0x5e, 0xab, 0xca, 0x7b, 0x43, 0xae,
+    0xb9, 0x48, 0x71, 0x72, 0xe7, 0x78, 0xed, 0x33, 0x70, 0x9b, 0x20, 0x48, 0x10, 0x69, 0x0a, 0x41,
+    0xa3, 0xd4, 0x9f, 0xbc, 0x5b, 0x93, 0x7a, 0x6d, 0xac, 0xa2, 0x46, 0xbd, 0xda, 0xde, 0xa8, 0x7b,
+    0xa1, 0xde, 0x0a, 0x0e, 0x70, 0x25, 0xe4, 0x73, 0x14, 0x8f, 0xcb, 0xd7, 0xe8, 0x0c, 0x57, 0x0e,
+    0xea, 0x16, 0x07, 0x41, 0x3e, 0xc4, 0x1b, 0xb1, 0x54, 0xf3, 0xe3, 0x09, 0xf0, 0xdc, 0xe6, 0xe7,
+    0x7e, 0x15, 0x3d, 0xf7, 0x03, 0xdc, 0x5a, 0x79, 0x0f, 0x22, 0x60, 0x09, 0x56, 0x73, 0x94, 0xc7,
+    0x77, 0xdd, 0x73, 0x25, 0x4e, 0xc5, 0xa6, 0xf9, 0x69, 0x9b, 0x00, 0xeb, 0x4f, 0xb8, 0x0a, 0xf1,
+    0x15, 0x08, 0xdc, 0x79, 0xb4, 0x8b, 0x0f, 0x4e, 0x14, 0xa2, 0x3c, 0xa0, 0xbf, 0x9a, 0xab, 0xc8,
+    0xc0, 0x99, 0x86, 0x57, 0x34, 0x99, 0x93, 0x8b, 0x89, 0x01, 0xea, 0x36, 0x2f, 0x5a, 0x9c, 0x6b,
+    0xdf, 0xc3, 0x9b, 0x89, 0x98, 0xe8, 0x55, 0xbb, 0xc6, 0xcc, 0x1f, 0x8d, 0xd3, 0x6a, 0x9f, 0xc0,
+    0x97, 0x62, 0x8c, 0x2b, 0xc7, 0x81, 0x05, 0xf3, 0x50, 0x00, 0x2c, 0xc2, 0xda, 0xd6, 0x62, 0x1d,
+    0x18, 0xe6, 0x78, 0x31, 0xbd, 0x96, 0xcc, 0xc4, 0xbf, 0x6d, 0xd2, 0xe5, 0xff, 0x3d, 0xd9, 0xc6,
+    0xff, 0x5b, 0x55, 0xc0, 0x53, 0xff, 0x06, 0x42, 0x6f, 0x84, 0x0d, 0x53, 0x01, 0x30, 0x9f, 0xc9,
+    0x7d, 0x89, 0x36, 0xcd, 0xc1, 0x88, 0xa3, 0x77, 0xff, 0x00, 0x7f, 0x85, 0xac, 0x78, 0xc5, 0xcc,
+    0x58, 0xb9, 0x80, 0x31, 0x1c, 0x82, 0xd3, 0x44, 0x91, 0x61, 0x8d, 0xe3, 0xc9, 0x36, 0xa8, 0x38,
+    0xa4, 0x3b, 0x9f, 0x90, 0x4f, 0x7b, 0x0d, 0x13, 0x68, 0x30, 0x1d, 0x43, 0x90, 0x2a, 0x79, 0xf0,
+    0x4e, 0xce, 0x7f, 0x4c, 0x9e, 0x9c, 0x37, 0xcd, 0x18, 0xc4, 0x28, 0xa1, 0x10, 0x1c, 0x04, 0xa2,
+    0xd1, 0xe6, 0xe1, 0xe5, 0xd2, 0x2a, 0xa0, 0x2d, 0x53, 0xe3, 0xf6, 0x79, 0x8b, 0x6c, 0x92, 0x27,
+    0xbd, 0x65, 0xb2, 0x5f, 0x41, 0xe1, 0x33, 0x5c, 0x0c, 0xe8, 0xbc, 0x82, 0x7d, 0x97, 0x6c, 0x6f,
+    0x77, 0x1b, 0xab, 0x75, 0x77, 0x6b, 0xcb, 0xa5, 0xc5, 0x67, 0x6f, 0x5e, 0x3a, 0x31, 0xbb, 0x8a,
+    0x2e, 0x99, 0xb8, 0x6d, 0x0f, 0xcf, 0x42, 0x69, 0x9c, 0x24, 0x76, 0xf3, 0xd4, 0x4c, 0xb7, 0x0a,
+    0xe9, 0x77, 0xa4, 0x59, 0x48, 0xe7, 0xf3, 0x39, 0xa4, 0xcf, 0xb5, 0xd8, 0x0b, 0x76, 0xb0, 0xb0,
+    0x74, 0x76, 0x2a, 0x14, 0x00, 0x0e, 0x10, 0x10, 0xb9, 0x30, 0x9a, 0x12, 0x39, 0x37, 0x5e, 0xdd,
+    0x47, 0xc8, 0x52, 0xf9, 0x73, 0x3a, 0x93, 0x47, 0x3c, 0x49, 0x9f, 0xfd, 0x34, 0x03, 0x1b, 0xf3,
+    0x69, 0x00, 0xd9, 0xc3, 0x4c, 0x3b, 0xe3, 0x93, 0x17, 0xce, 0x21, 0xf0, 0x9b, 0x9d, 0xa0, 0x88,
+    0xb6, 0x9e, 0x76, 0xbb, 0x95, 0x92, 0x8c, 0x2c, 0x6b, 0x0b, 0xbd, 0xca, 0x1f, 0x40, 0xbb, 0x8a,
+    0x07, 0x5d, 0xc5, 0xe4, 0x3b, 0x0f, 0xf2, 0xd2, 0x64, 0x94, 0xa5, 0xb6, 0xa9, 0x78, 0xb1, 0xec,
+    0x75, 0x0f, 0x51, 0xcd, 0xbf, 0x40, 0xef, 0x9b, 0xa3, 0x7e, 0x4c, 0x2c, 0xfe, 0x5c, 0x2c, 0xa5,
+    0x9e, 0x18, 0xd4, 0xaf, 0x6c, 0x15, 0xd7, 0x59, 0x4d, 0xe7, 0x2a, 0x6d, 0xfd, 0x4e, 0x47, 0xa3,
+    0x92, 0xb4, 0x0b, 0x1a, 0x3e, 0xc9, 0x59, 0xd6, 0x32, 0x15, 0xd8, 0x30, 0x3c, 0xc6, 0xb2, 0xaa,
+    0x21, 0xfe, 0xc8, 0xef, 0x68, 0x2f, 0x38, 0x8b, 0x16, 0xd7, 0x51, 0x7b, 0x73, 0xaf, 0xb3, 0x2a,
+    0xe0, 0xf2, 0x7b, 0x0a, 0x9b, 0x9b, 0xa4, 0x38, 0x69, 0x67, 0x37, 0xd3, 0xc0, 0xbf, 0xf5, 0xc1,
+    0x04, 0x59, 0xfc, 0xe1, 0x5b, 0xf7, 0x32, 0x41, 0x35, 0xc3, 0x43, 0xa6, 0x1d, 0xf2, 0x2a, 0x8b,
+    0x41, 0xcf, 0x20, 0xb3, 0xd8, 0x78, 0x4d, 0x93, 0x04, 0xcb, 0xd9, 0x24, 0xf8, 0xf0, 0xfb, 0x04,
+    0x13, 0x92, 0x0d, 0x8c, 0xba, 0x58, 0x7a, 0x0b, 0xee, 0x3e, 0x49, 0xdb, 0x39, 0x50, 0x91, 0xf8,
+    0x80, 0xfb, 0x3e, 0x0a, 0xe8, 0x88, 0x8f, 0x00, 0xc6, 0xa7, 0x60, 0x6d, 0x61, 0x82, 0x2b, 0x03,
+    0xb5, 0x05, 0x22, 0x86, 0x90, 0x22, 0x31, 0x9e, 0x24, 0x11, 0x4c, 0x22, 0xf8, 0x2b, 0x30, 0x0c,
+    0x0f, 0x9e, 0x14, 0x16, 0xc4, 0x6c, 0x12, 0x41, 0xea, 0xb0, 0xc4, 0xad, 0x8c, 0xa9, 0xa0, 0xcc,
+    0xbb, 0x10, 0x53, 0xd4, 0x42, 0xa3, 0x0e, 0x44, 0x95, 0x72, 0xbd, 0x37, 0x8f, 0xf0, 0x0d, 0xfe,
+    0x72, 0x22, 0x5e, 0x50, 0xa9, 0x22, 0x82, 0x48, 0x4d, 0x2f, 0x09, 0x1a, 0x0f, 0x09, 0xf8, 0x7c,
+    0xd0, 0x01, 0x58, 0x60, 0x23, 0xad, 0x6a, 0x8d, 0xe3, 0x0f, 0x70, 0x33, 0x45, 0x5f, 0xc6, 0x9c,
+    0xb1, 0x6d, 0x52, 0xbf, 0x84, 0xd1, 0x70, 0xd1, 0x62, 0x9f, 0x2f, 0x1e, 0x63, 0x33, 0xf0, 0xbe,
+    0x95, 0x0b, 0x35, 0xf2, 0x4e, 0xc3, 0x4a, 0x84, 0x57, 0xae, 0x53, 0x34, 0x12, 0xad, 0x8f, 0x6b,
+    0xd7, 0x91, 0x21, 0xc9, 0x95, 0xb6, 0x66, 0xa2, 0x4d, 0x51, 0x76, 0x79, 0xd7, 0xea, 0x8f, 0x7f,
+    0x8f, 0xdb, 0x7c, 0x42, 0xa3, 0x1f, 0xcb, 0xc8, 0x83, 0xb1, 0xce, 0x0b, 0x3f, 0xe4, 0x91, 0x68,
+    0x16, 0x8e, 0xb4, 0x13, 0x1a, 0xcd, 0xd9, 0x3c, 0x17, 0x5e, 0xad, 0x0f, 0x5e, 0xcd, 0x0f, 0x47,
+    0xc9, 0xfd, 0x6f, 0xc2, 0x4b, 0xf7, 0xa8, 0xdd, 0x86, 0x47, 0x20, 0x34, 0x4b, 0x23, 0xac, 0xc2,
+    0x1c, 0x16, 0xf5, 0x9e, 0x46, 0x10, 0x38, 0x94, 0x5f, 0x3e, 0xb3, 0x5a, 0xfa, 0xe5, 0x99, 0x52,
+    0xec, 0xe5, 0x90, 0x76, 0x0d, 0xb2, 0x51, 0x03, 0x8d, 0xb2, 0xac, 0x2c, 0xfa, 0xfb, 0x21, 0x56,
+    0xb9, 0x25, 0x77, 0xfe, 0x82, 0xc5, 0xb7, 0x1f, 0x7e, 0x3f, 0xe2, 0x17, 0xc4, 0x9b, 0xe5, 0x2a,
+    0x47, 0x3f, 0xc7, 0xbd, 0x26, 0x51, 0xf2, 0x8a, 0xd0, 0xed, 0x43, 0x8e, 0xca, 0x3c, 0xd9, 0x8f,
+    0xe2, 0xca, 0x6f, 0x3e, 0xf5, 0xee, 0x29, 0x78, 0x8e, 0x62, 0xde, 0x5b, 0x10, 0x82, 0xe9, 0x1a,
+    0x45, 0xdf, 0x13, 0x4b, 0xc2, 0x37, 0x93, 0xf4, 0x93, 0x68, 0x3c, 0x46, 0x38, 0xa2, 0xf1, 0xa0,
+    0x99, 0xf3, 0x30, 0x49, 0xc4, 0x08, 0xf7, 0x62, 0xfb, 0x73, 0x5e, 0xcb, 0x5d, 0x92, 0xf5, 0x22,
+    0xc4, 0x59, 0x82, 0xf7, 0x25, 0x4d, 0x0b, 0x18, 0xcf, 0xd1, 0xff, 0x71, 0x99, 0x5f, 0x66, 0xac,
+    0x10, 0x7d, 0x4e, 0x21, 0x14, 0x28, 0x54, 0x07, 0x83, 0x6a, 0xb0, 0x57, 0x59, 0x84, 0xab, 0x84,
+    0x48, 0xee, 0x12, 0x9b, 0x4b, 0x22, 0xe1, 0x5d, 0xc8, 0x60, 0xec, 0x82, 0x09, 0x88, 0x96, 0x7e,
+    0x68, 0x5c, 0x80, 0xda, 0x2f, 0xbe, 0x16, 0x3b, 0xc6, 0x0e, 0x04, 0x72, 0x78, 0x25, 0xb7, 0x76,
+    0x43, 0x59, 0xa1, 0x11, 0x9d, 0x52, 0xed, 0x76, 0xb2, 0xc0, 0x8c, 0xc9, 0xf5, 0xa2, 0x65, 0xa9,
+    0x5b, 0xa7, 0x94, 0xf0, 0xe1, 0x47, 0x2c, 0xee, 0x42, 0xc2, 0x50, 0xe3, 0xa0, 0x0a, 0x58, 0x35,
+    0xc4, 0xa9, 0x74, 0x29, 0x75, 0xfa, 0x1c, 0x81, 0x9a, 0xdf, 0x9b, 0x6f, 0x17, 0x83, 0xba, 0xd9,
+    0x96, 0x43, 0xbd, 0x2b, 0x1a, 0xba, 0xcc, 0xeb, 0x48, 0x82, 0x3a, 0x6e, 0x14, 0x64, 0x13, 0x08,
+    0x90, 0x8a, 0x9b, 0xfe, 0x2c, 0x0f, 0x69, 0xd5, 0x18, 0x5f, 0x36, 0xd6, 0xae, 0x35, 0x16, 0x2c,
+    0xdc, 0xc7, 0x4b, 0x24, 0x95, 0x2b, 0x8d, 0x55, 0xd5, 0x09, 0x7d, 0xcc, 0x59, 0xfc, 0x5b, 0x36,
+    0x5f, 0x2c, 0xdc, 0x77, 0x1d, 0x3e, 0x80, 0xe6, 0xfc, 0x41, 0xa5, 0xa5, 0x51, 0xa9, 0xbd, 0x11,
+    0xaa, 0x76, 0x34, 0x5d, 0x79, 0xfd, 0x28, 0x99, 0xd7, 0x20, 0x99, 0x75, 0xbd, 0x52, 0xe3, 0x9f,
+    0xe7, 0xee, 0x94, 0xbb, 0x67, 0x0b, 0x2d, 0xa1, 0xb9, 0xb6, 0xa4, 0xe7, 0x99, 0xe2, 0x6d, 0x60,
+    0xc8, 0x31, 0xf1, 0xcb, 0x2e, 0xf9, 0x11, 0xff, 0xa2, 0xe7, 0x96, 0xd2, 0x0c, 0xa3, 0x2c, 0x76,
+    0x99, 0x70, 0x85, 0x4b, 0xe4, 0x8e, 0xdd, 0x3c, 0x5b, 0xac, 0x95, 0x72, 0x04, 0xa0, 0xc3, 0x28,
+    0x88, 0xe6, 0xc2, 0x71, 0x71, 0xc0, 0x72, 0x60, 0x4e, 0x16, 0x9c, 0x6a, 0x09, 0x50, 0x18, 0xfa,
+    0x2c, 0x84, 0xc7, 0xb7, 0xd8, 0x39, 0x57, 0xff, 0xd5, 0x0b, 0xff, 0x5c, 0x85, 0x4a, 0x88, 0x98,
+    0x22, 0x8b, 0x57, 0x19, 0xea, 0xa5, 0xa4, 0x32, 0x9b, 0xdf, 0x5a, 0x26, 0x9b, 0x57, 0xae, 0x89,
+    0xd1, 0x18, 0x56, 0xb3, 0x34, 0xd7, 0x1b, 0x32, 0x76, 0xe3, 0x61, 0xa5, 0x00, 0xbd, 0xa4, 0x1c,
+    0xee, 0x09, 0x78, 0x05, 0xc9, 0xac, 0x8e, 0x61, 0x75, 0x59, 0x35, 0xe0, 0x30, 0x48, 0xae, 0xa8,
+    0x69, 0xa8, 0x5a, 0x8f, 0x57, 0x16, 0x15, 0x79, 0x98, 0x2a, 0x1d, 0x6a, 0x7f, 0xf9, 0x46, 0x8a,
+    0x02, 0x44, 0x7d, 0x2f, 0xc5, 0x7c, 0x52, 0x5b, 0xa2, 0x15, 0xb2, 0x29, 0xb0, 0xf2, 0xc7, 0x66,
+    0xa4, 0xbc, 0xbb, 0x82, 0x53, 0x69, 0x5b, 0x01, 0x25, 0x97, 0x9a, 0x8e, 0xf6, 0xa4, 0xe1, 0xd0,
+    0xb7, 0x32, 0xc4, 0x84, 0xbe, 0x6c, 0x5f, 0x8e, 0x04, 0x21, 0xd6, 0x02, 0x3d, 0x7f, 0x6c, 0x46,
+    0xcd, 0xbb, 0x2b, 0x68, 0x95, 0xb6, 0x2a, 0x4a, 0x73, 0xf9, 0x76, 0x4a, 0xb9, 0xfd, 0x1c, 0x97,
+    0x77, 0x34, 0xb4, 0x96, 0x5d, 0xf2, 0x99, 0xde, 0x32, 0xaf, 0xbc, 0x2b, 0x48, 0x78, 0x2d, 0x46,
+    0x2f, 0xa9, 0x9d, 0x12, 0xb6, 0xee, 0x4b, 0xf8, 0x77, 0x8d, 0x8e, 0x42, 0x4d, 0xcd, 0x98, 0x05,
+    0x43, 0xee, 0x87, 0x79, 0x8e, 0x65, 0xac, 0x40, 0x47, 0x29, 0xc4, 0x9c, 0x8a, 0x42, 0x8c, 0xb2,
+    0xc1, 0xc4, 0xb7, 0x52, 0x98, 0x72, 0x90, 0x1a, 0x38, 0xa9, 0xd0, 0xf4, 0xcc, 0xb6, 0x59, 0x97,
+    0xee, 0x4c, 0x97, 0xa3, 0x78, 0x62, 0xf2, 0xdb, 0x9f, 0x93, 0x03, 0x48, 0x7d, 0x27, 0x34, 0xf5,
+    0xb1, 0xf0, 0xc6, 0x7f, 0x43, 0x01, 0x62, 0x9d, 0xfc, 0x45, 0x63, 0xbc, 0x65, 0x20, 0x7f, 0x4d,
+    0x81, 0x5f, 0xc6, 0x8c, 0xf1, 0x07, 0x08, 0xc0, 0x68, 0x41, 0x95, 0x7a, 0xbc, 0x41, 0xbc, 0x64,
+    0x5f, 0xb6, 0x29, 0x1b, 0x37, 0x5e, 0x85, 0x7a, 0x73, 0x7a, 0x78, 0xc6, 0x93, 0x86, 0x72, 0xb3,
+    0x56, 0x40, 0xf0, 0x40, 0x2c, 0xcd, 0x9f, 0xec, 0xfc, 0xd7, 0x19, 0xda, 0xe4, 0x69, 0xb7, 0xdb,
+    0x6d, 0xf5, 0xb0, 0xe4, 0xc7, 0xb3, 0xa6, 0xa7, 0xa4, 0xcf, 0x2e, 0xb3, 0x10, 0xcb, 0x79, 0xb4,
+    0xa4, 0x8f, 0x89, 0x1b, 0x14, 0x3a, 0x05, 0x26, 0x90, 0xe2, 0x37, 0x0b, 0x72, 0xa8, 0x7a, 0x74,
+    0x91, 0x46, 0x53, 0x03, 0x8d, 0xfc, 0x30, 0xad, 0x00, 0xa2, 0x50, 0x9c, 0x47, 0x68, 0x5a, 0xbf,
+    0x4e, 0x81, 0xc4, 0x50, 0xfc, 0xd2, 0x44, 0x6f, 0x4d, 0xfb, 0xe1, 0x84, 0xde, 0x5a, 0x8d, 0x31,
+    0xc0, 0xb5, 0xf2, 0x07, 0x57, 0x16, 0xbc, 0x35, 0xd8, 0xf0, 0x83, 0x2b, 0xe5, 0x8f, 0xad, 0xac,
+    0x32, 0xbf, 0xfc, 0xb1, 0x95, 0x35, 0x1e, 0x1a, 0xe6, 0xe8, 0x73, 0x36, 0x14, 0x0d, 0x86, 0x2b,
+    0x81, 0x43, 0x80, 0x9f, 0xf0, 0x12, 0x99, 0xca, 0x41, 0xc9, 0x9f, 0x79, 0x13, 0x07, 0x41, 0x16,
+    0x8b, 0xd2, 0x9a, 0xca, 0x05, 0xe4, 0x9a, 0x5a, 0xe0, 0xac, 0xdc, 0xa3, 0xfe, 0xed, 0x3f, 0xe3,
+    0xd5, 0x67, 0x48, 0x28, 0xb3, 0x49, 0x82, 0xb7, 0x5e, 0xe8, 0xa0, 0x3c, 0xb0, 0x18, 0x72, 0xcd,
+    0x10, 0x25, 0x9c, 0x26, 0x3d, 0x86, 0x10, 0xd0, 0x1f, 0xa4, 0xa8, 0x3d, 0xfe, 0x15, 0x3f, 0xd4,
+    0xb8, 0x13, 0x4b, 0x2e, 0x38, 0x96, 0x2f, 0xb9, 0x68, 0x58, 0x75, 0xc9, 0xf3, 0x26, 0x7e, 0xc4,
+    0x92, 0xa5, 0xf1, 0x3d, 0xd4, 0x9a, 0xe7, 0xa4, 0x58, 0x0b, 0xdf, 0xe1, 0x54, 0x72, 0x2d, 0x5f,
+    0x28, 0x59, 0x9e, 0x69, 0xf9, 0x0d, 0xeb, 0x76, 0xc7, 0x78, 0xd5, 0x1e, 0x56, 0x6e, 0x7a, 0xc3,
+    0x14, 0x09, 0x2a, 0x34, 0xf7, 0x61, 0xaa, 0xba, 0xdc, 0xdb, 0x56, 0x20, 0x15, 0x65, 0x93, 0x6a,
+    0xd9, 0x76, 0x0e, 0xb9, 0xa6, 0x97, 0xf9, 0x38, 0xff, 0xcc, 0x6f, 0xca, 0xf6, 0xd6, 0xcc, 0x6f,
+    0xff, 0xa1, 0x59, 0x35, 0xe7, 0x8e, 0xbd, 0xb5, 0xff, 0x02, 0x4d, 0x2a, 0xe7, 0x4c, 0xca, 0x4b,
+    0x00, 0x00,
+};
+
+// web/style.css: 343 Bytes, gzip 254 Bytes
+#define WEB_ASSET_STYLE_CSS_HASH "1a73b0ecc37b30b1"
+static constexpr size_t WEB_ASSET_STYLE_CSS_GZ_LENGTH = 254;
+static const uint8_t WEB_ASSET_STYLE_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4d, 0x90, 0xdd, 0x6e, 0x84, 0x20,
+    0x10, 0x46, 0xef, 0x7d, 0x0a, 0x13, 0xd3, 0x3b, 0x31, 0xfe, 0xd4, 0x66, 0x17, 0x9f, 0x06, 0x64,
+    0x10, 0x52, 0x04, 0x02, 0x63, 0xd6, 0x2d, 0xf1, 0xdd, 0x8b, 0xdd, 0x35, 0x69, 0xb8, 0x99, 0xc9,
+    0x9c, 0xef, 0xcb, 0x09, 0xdc, 0x89, 0x67, 0x92, 0xce, 0x22, 0x91, 0x6c, 0xd5, 0xe6, 0x49, 0x23,
+    0xb3, 0x91, 0x44, 0x08, 0x5a, 0x4e, 0x2b, 0xdb, 0xc9, 0x43, 0x0b, 0x54, 0xf4, 0x7e, 0x6b, 0xfd,
+    0x9e, 0xf7, 0xb0, 0x68, 0x4b, 0xdb, 0x92, 0x6d, 0xe8, 0x26, 0xcf, 0x84, 0xd0, 0x76, 0xa1, 0x5d,
+    0x9f, 0x4f, 0x46, 0x5b, 0x20, 0x0a, 0xf4, 0xa2, 0x90, 0x76, 0xcd, 0x30, 0x1e, 0x85, 0xd4, 0x60,
+    0x44, 0x04, 0x4c, 0xef, 0xd4, 0xcd, 0xef, 0x65, 0x7b, 0x14, 0xda, 0xfa, 0x0d, 0xeb, 0x08, 0x06,
+    0x66, 0xac, 0xf9, 0x86, 0xe8, 0xec, 0x45, 0x0c, 0x99, 0x38, 0xbb, 0xae, 0xe2, 0x4f, 0xbf, 0x1f,
+    0x05, 0x32, 0x6e, 0x20, 0x71, 0x17, 0x04, 0x04, 0x32, 0x3b, 0x63, 0x98, 0x8f, 0x40, 0xaf, 0x61,
+    0x7a, 0xe9, 0x75, 0x6d, 0xfb, 0x91, 0x51, 0x51, 0xa3, 0x4a, 0xff, 0xd2, 0xd3, 0x2b, 0x46, 0xbb,
+    0x5c, 0x1c, 0x9d, 0xd1, 0xa2, 0xac, 0x38, 0xe7, 0x19, 0x54, 0x09, 0x61, 0x47, 0xc2, 0x8c, 0x5e,
+    0x2c, 0x35, 0x20, 0x71, 0xe2, 0x6c, 0xfe, 0x5e, 0x82, 0xdb, 0xac, 0xa0, 0x95, 0x1c, 0xce, 0x77,
+    0x14, 0xaa, 0xab, 0x55, 0xff, 0x96, 0x23, 0xdc, 0x65, 0xd5, 0x95, 0x7e, 0x9d, 0x4e, 0xcd, 0xba,
+    0x21, 0x88, 0x94, 0x25, 0x5c, 0xa0, 0xd5, 0x38, 0x8e, 0xd3, 0xdf, 0x07, 0x46, 0xfd, 0x03, 0xb4,
+    0xb9, 0xf7, 0xb0, 0x1e, 0xc5, 0x2f, 0x74, 0x61, 0x50, 0xca, 0x57, 0x01, 0x00, 0x00,
+};
+
+#endif
@@ -1,25 +1,28 @@
 #include "web_manager.h"
 #include "wifi_manager.h"
+#include "log_manager.h"
+#include "rs485_protocol.h"
+#include "symbol_pack.h"
+#include "json_stream.h"
+#include "symbol_view.h"
+#include "web_assets.h"
 #include <AsyncJson.h>
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <math.h>
+#include <memory>
+#include <new>
 
 namespace {
 
-constexpr size_t MAX_JSON_BODY_SIZE = 4096;
-constexpr size_t UPDATE_JSON_CAPACITY = 4096;
+// /updateAllLetters liest JSON streamend; das Limit schützt nur noch vor endlosen Rümpfen, der
+// Speicherbedarf hängt nicht mehr von der Größe ab.
+constexpr size_t MAX_JSON_BODY_SIZE = 16384;
 constexpr size_t MIN_SSID_LENGTH = 2;
 constexpr size_t MIN_HOSTNAME_LENGTH = 2;
 constexpr char MANAGER_KEY_HEADER[] = "X-RiddleMatrix-Manager-Key";
 
-struct UpdateAllLettersContext {
-    String body;
-    bool overflow;
-
-    UpdateAllLettersContext() : body(), overflow(false) {}
-};
-
 bool looksLikeJsonContentType(String contentType) {
     contentType.trim();
     contentType.toLowerCase();
@@ -60,6 +63,9 @@ bool isJsonRequest(AsyncWebServerRequest *request) {
 }
 
 bool isSupportedLetter(char letter) {
+    if (isCustomSymbol(letter)) {
+        return true;
+    }
     const size_t optionCount = sizeof(availableLetters) / sizeof(availableLetters[0]);
     for (size_t idx = 0; idx < optionCount; ++idx) {
         if (availableLetters[idx] == letter) {
@@ -69,6 +75,46 @@ bool isSupportedLetter(char letter) {
     return false;
 }
 
+// Liest ein Zeichen/Symbol ab `start`: ein eingebautes Zeichen, "@<Id>" für ein Zusatz-Symbol des
+// Katalogs oder '0'..'7' (Zusatz-Symbole älterer Firmware). Liefert die Anzahl gelesener Zeichen, 0 bei Fehler.
+size_t parseSymbolTokenAt(const String &value, size_t start, char &symbol) {
+    if (start >= value.length()) {
+        return 0;
+    }
+    if (value.charAt(start) != '@') {
+        const char letter =
+            migrateLegacyCustomSymbol(static_cast<char>(std::toupper(static_cast<unsigned char>(value.charAt(start)))));
+        symbol = letter;
+        return isSupportedLetter(letter) ? 1 : 0;
+    }
+    size_t id = 0;
+    size_t end = start + 1;
+    while (end < value.length() && end - start <= 2 && std::isdigit(static_cast<unsigned char>(value.charAt(end)))) {
+        id = id * 10 + static_cast<size_t>(value.charAt(end) - '0');
+        ++end;
+    }
+    if (end == start + 1 || id >= CUSTOM_SYMBOL_COUNT) {
+        return 0;
+    }
+    symbol = customSymbolFromId(id);
+    return end - start;
+}
+
+// Ein einzelnes Zeichen/Symbol ohne Rest, z. B. aus einem Formularfeld.
+bool parseSymbolToken(const String &value, char &symbol) {
+    const size_t length = parseSymbolTokenAt(value, 0, symbol);
+    return length != 0 && length == value.length();
+}
+
+// Gegenstück zu parseSymbolToken(): Zusatz-Symbole als "@<Id>", alles andere als das Zeichen selbst.
+String symbolToken(char symbol) {
+    const int id = customSymbolId(symbol);
+    if (id < 0) {
+        return String(symbol);
+    }
+    return String("@") + String(id);
+}
+
 String currentManagerKey() {
     String key = String(wifi_local_ap_password);
     key.trim();
@@ -201,6 +247,18 @@ bool parseLetterColorModeValue(String value, uint8_t &mode) {
     return false;
 }
 
+// Gegenstück zu parseLetterColorModeValue().
+const char *letterColorModeValue(uint8_t mode) {
+    switch (static_cast<LetterColorMode>(mode)) {
+        case LetterColorMode::RandomSelected:
+            return "random_selected";
+        case LetterColorMode::RandomAll:
+            return "random_all";
+        default:
+            return "fixed";
+    }
+}
+
 bool parseDelayStringValue(String value, unsigned long &parsed) {
     value.trim();
     if (value.isEmpty()) {
@@ -235,28 +293,26 @@ bool parseNumericDelay(double numeric, unsigned long &parsed) {
     return parsed <= 999UL;
 }
 
-bool parseDelayJsonVariant(const JsonVariantConst &variant, unsigned long &parsed) {
-    if (variant.isNull()) {
-        return false;
-    }
+bool isJsonIntegerText(const char *text) {
+    return strpbrk(text, ".eE") == nullptr;
+}
 
-    if (variant.is<unsigned long>() || variant.is<unsigned int>() || variant.is<int>() || variant.is<long>()) {
-        const long candidate = variant.as<long>();
-        if (candidate < 0 || candidate > 999) {
-            return false;
+// Verzögerung aus einem JSON-Wert: ganze Zahl, Zahl ohne Nachkommaanteil oder Ziffern-String.
+bool parseDelayJsonValue(JsonStreamType type, const char *text, unsigned long &parsed) {
+    if (type == JsonStreamType::Number) {
+        if (isJsonIntegerText(text)) {
+            const long candidate = strtol(text, nullptr, 10);
+            if (candidate < 0 || candidate > 999) {
+                return false;
+            }
+            parsed = static_cast<unsigned long>(candidate);
+            return true;
         }
-        parsed = static_cast<unsigned long>(candidate);
-        return true;
-    }
-
-    if (variant.is<double>() || variant.is<float>()) {
-        const double numeric = variant.as<double>();
-        return parseNumericDelay(numeric, parsed);
+        return parseNumericDelay(strtod(text, nullptr), parsed);
     }
 
-    if (variant.is<const char *>()) {
-        String value = variant.as<const char *>();
-        return parseDelayStringValue(value, parsed);
+    if (type == JsonStreamType::String) {
+        return parseDelayStringValue(String(text), parsed);
     }
 
     return false;
@@ -350,37 +406,6 @@ void sendJsonStatus(AsyncWebServerRequest *request, uint16_t statusCode, const c
     request->send(statusCode, F("application/json"), responseBody);
 }
 
-String escapeHtml(const String &input) {
-    String escaped;
-    escaped.reserve(input.length());
-
-    for (size_t idx = 0; idx < input.length(); ++idx) {
-        const char character = input.charAt(idx);
-        switch (character) {
-            case '&':
-                escaped += F("&amp;");
-                break;
-            case '<':
-                escaped += F("&lt;");
-                break;
-            case '>':
-                escaped += F("&gt;");
-                break;
-            case '"':
-                escaped += F("&quot;");
-                break;
-            case '\'':
-                escaped += F("&#39;");
-                break;
-            default:
-                escaped += character;
-                break;
-        }
-    }
-
-    return escaped;
-}
-
 String getLetterOptionLabel(char letter) {
     switch (letter) {
         case '*':
@@ -393,35 +418,33 @@ String getLetterOptionLabel(char letter) {
             return F("Rad");
         case '?':
             return F("Riddler");
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-            return String(F("Symbol ")) + String(letter);
         default:
+            if (isCustomSymbol(letter)) {
+                return String(F("Symbol ")) + String(customSymbolId(letter));
+            }
             return String(letter);
     }
 }
 
-int customSymbolIndexFromChar(char value) {
-    if (value < '0' || value > '7') {
-        return -1;
+// Zufallspool als Text für das Formular, z. B. "AB@12#".
+String symbolPoolToText(const char *pool) {
+    String text;
+    for (size_t index = 0; index < RANDOM_SYMBOL_POOL_LENGTH && pool[index] != '\0'; ++index) {
+        text += symbolToken(pool[index]);
     }
-    return value - '0';
+    return text;
 }
 
-String bitmapToHex(const uint8_t *bitmap) {
+// Liest direkt aus Cache, RAM oder Flash; eine Zeile = acht Hex-Ziffern.
+String bitmapToHex(const SymbolView &view) {
     static const char hexChars[] = "0123456789ABCDEF";
     String result;
     result.reserve(SYMBOL_BITMAP_SIZE * 2);
-    for (size_t index = 0; index < SYMBOL_BITMAP_SIZE; ++index) {
-        const uint8_t value = bitmap[index];
-        result += hexChars[(value >> 4) & 0x0F];
-        result += hexChars[value & 0x0F];
+    for (uint8_t row = 0; row < SYMBOL_VIEW_ROWS; ++row) {
+        const uint32_t bits = view ? view.row(row) : 0U;
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            result += hexChars[(bits >> shift) & 0x0F];
+        }
     }
     return result;
 }
@@ -454,546 +477,996 @@ bool parseBitmapHex(const String &hex, uint8_t *bitmap) {
     return true;
 }
 
-String getColorModeOptionLabel(uint8_t mode) {
-    switch (static_cast<LetterColorMode>(mode)) {
-        case LetterColorMode::RandomSelected:
-            return F("Zufall (ausgewaehlt)");
-        case LetterColorMode::RandomAll:
-            return F("Zufall (alle)");
-        case LetterColorMode::Fixed:
-        default:
-            return F("Einfarbig");
-    }
-}
-
-static_assert(NUM_DAYS == 7, "Erwartete sieben Wochentage fuer die JSON-Abbildung");
-
-constexpr const char *const DAY_KEYS[NUM_DAYS] = {
-    "so", "mo", "di", "mi", "do", "fr", "sa",
+// Zustand einer /api/logs-Antwort: Einträge werden einzeln gerendert und stückweise
+// in die Sendepuffer kopiert, damit nie der ganze Ringpuffer als String im Heap liegt.
+struct LogStreamCursor {
+    uint32_t nextSequence;
+    uint32_t endSequence;
+    char chunk[384];
+    size_t chunkLength;
+    size_t chunkOffset;
+    bool headerSent;
+    bool entrySent;
+    bool closed;
 };
 
-} // namespace
+size_t renderLogEntryJson(const LogEntry &entry, bool first, char *destination, size_t capacity) {
+    char message[LOG_LINE_MAX_LENGTH];
+    formatLogMessage(entry, message, sizeof(message));
+    const char level[2] = {getLogLevelTag(entry.level), '\0'};
 
-const char scriptJS[] PROGMEM = R"rawliteral(
-    const riddleMatrixManagerKey = new URLSearchParams(window.location.search).get('rm_key') || '';
+    StaticJsonDocument<256> entryDoc;
+    entryDoc["seq"] = entry.sequence;
+    entryDoc["t"] = entry.timestamp;
+    entryDoc["module"] = getLogModuleTag(entry.module);
+    entryDoc["level"] = level;
+    entryDoc["id"] = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(entry.format));
+    entryDoc["msg"] = message;
 
-    function managerFetch(url, options) {
-        const fetchOptions = Object.assign({}, options || {});
-        const headers = new Headers(fetchOptions.headers || {});
-        if (riddleMatrixManagerKey) {
-            headers.set('X-RiddleMatrix-Manager-Key', riddleMatrixManagerKey);
-        }
-        fetchOptions.headers = headers;
-        return fetch(url, fetchOptions);
+    const size_t prefixLength = first ? 0 : 1;
+    if (measureJson(entryDoc) + prefixLength >= capacity) {
+        entryDoc["msg"] = "";
     }
-
-    function updateRtcInputs(timeText) {
-        const text = String(timeText || '');
-        const match = text.match(/(\d{4})-(\d{2})-(\d{2})\s+(\d{2}:\d{2}(?::\d{2})?)/);
-        const dateField = document.querySelector("input[name='date']");
-        const timeField = document.querySelector("input[name='time']");
-        const weekdayField = document.getElementById('rtcWeekday');
-        if (weekdayField) {
-            const weekday = text.split(',')[0].trim();
-            weekdayField.innerText = weekday && !/\d/.test(weekday) ? weekday : '-';
-        }
-        if (!match || !dateField || !timeField) {
-            return;
-        }
-        if (document.activeElement !== dateField) {
-            dateField.value = match[1] + '-' + match[2] + '-' + match[3];
-        }
-        if (document.activeElement !== timeField) {
-            timeField.value = match[4].length === 5 ? match[4] + ':00' : match[4];
-        }
-    }
-
-    // 🕒 Aktuelle Uhrzeit abrufen
-    function fetchRTC() {
-        managerFetch('/getTime')
-            .then(response => response.text())
-            .then(time => {
-                document.getElementById('rtcTime').innerText = time;
-                updateRtcInputs(time);
-            })
-            .catch(error => console.error('Fehler:', error));
-    }
-
-    // 📝 Freien RAM abrufen
-    function fetchMemory() {
-        managerFetch('/memory')
-            .then(response => response.text())
-            .then(memory => {
-                document.getElementById('memoryUsage').innerText = memory;
-            })
-            .catch(error => console.error('Fehler:', error));
-    }
-
-    // 🕒 RTC-Zeit setzen
-    function setRTC() {
-        let form = new FormData(document.getElementById('rtcForm'));
-        managerFetch('/setTime', { method: 'POST', body: form })
-            .then(response => response.text())
-            .then(alert)
-            .catch(error => alert('Fehler: ' + error));
-    }
-
-    // 🌐 Zeit per NTP synchronisieren
-    function syncNTP() {
-        managerFetch('/syncNTP')
-            .then(response => response.text().then(message => ({ ok: response.ok, message })))
-            .then(result => {
-                const text = result.message && result.message.trim() !== ''
-                    ? result.message
-                    : (result.ok ? 'NTP Synchronisierung erfolgreich!' : 'Fehler bei der NTP Synchronisierung.');
-                if (!result.ok) {
-                    console.warn('Serverfehler:', text);
-                } else {
-                    console.log('ℹ️ Serverantwort:', text);
-                }
-                alert(text);
-            })
-            .catch(error => {
-                console.error('Fehler:', error);
-                alert('Fehler: ' + error);
-            });
+    if (!first) {
+        destination[0] = ',';
     }
+    return prefixLength + serializeJson(entryDoc, destination + prefixLength, capacity - prefixLength);
+}
 
-    function loadWiFiNetworks() {
-        const select = document.getElementById('wifiNetworkSelect');
-        if (!select) {
-            return;
-        }
-        select.innerHTML = '<option>Suche Netzwerke...</option>';
-        managerFetch('/scanWiFi')
-            .then(response => response.json())
-            .then(networks => {
-                select.innerHTML = '<option value="">SSID aus Liste waehlen...</option>';
-                networks.forEach(network => {
-                    const option = document.createElement('option');
-                    option.value = network.ssid;
-                    option.textContent = network.ssid + ' (' + network.rssi + ' dBm' + (network.encrypted ? ', verschluesselt' : ', offen') + ')';
-                    select.appendChild(option);
-                });
-            })
-            .catch(error => {
-                select.innerHTML = '<option value="">Scan fehlgeschlagen</option>';
-                console.error('Fehler beim WLAN-Scan:', error);
-            });
+// Liefert das nächste Teilstück der Antwort; false, wenn alles gesendet ist.
+bool refillLogStreamChunk(LogStreamCursor &cursor) {
+    cursor.chunkOffset = 0;
+    if (!cursor.headerSent) {
+        cursor.headerSent = true;
+        const int length = snprintf(cursor.chunk, sizeof(cursor.chunk), "{\"next\":%lu,\"oldest\":%lu,\"entries\":[",
+                                    static_cast<unsigned long>(cursor.endSequence),
+                                    static_cast<unsigned long>(getLogOldestSequence()));
+        cursor.chunkLength = length > 0 ? static_cast<size_t>(length) : 0;
+        return true;
     }
 
-    function applySelectedWiFiNetwork() {
-        const select = document.getElementById('wifiNetworkSelect');
-        const ssidInput = document.querySelector('#wifiForm input[name="ssid"]');
-        if (select && ssidInput && select.value) {
-            ssidInput.value = select.value;
+    LogEntry entry;
+    while (cursor.nextSequence < cursor.endSequence) {
+        const uint32_t sequence = cursor.nextSequence++;
+        // Während des Sendens überschriebene Einträge fehlen einfach; der Client erkennt die Lücke an "seq".
+        if (readLogEntry(sequence, entry)) {
+            cursor.chunkLength = renderLogEntryJson(entry, !cursor.entrySent, cursor.chunk, sizeof(cursor.chunk));
+            cursor.entrySent = true;
+            return true;
         }
     }
 
-    function updateWiFiModeFields() {
-        const mode = document.querySelector('#wifiForm input[name="wifi_mode"]:checked')?.value || 'timed';
-        const persistentFields = document.getElementById('persistentWifiFields');
-        const apFields = document.getElementById('localApFields');
-        const symbolField = document.getElementById('wifiSymbolField');
-        const symbolCheckbox = document.getElementById('wifi_status_symbol_enabled');
-
-        if (persistentFields) {
-            persistentFields.style.display = mode === 'timed' ? 'none' : 'block';
-        }
-        if (apFields) {
-            apFields.style.display = mode === 'ap_sta' ? 'block' : 'none';
-        }
-        if (symbolField) {
-            symbolField.style.display = mode === 'timed' ? 'block' : 'none';
-        }
-        if (symbolCheckbox && mode !== 'timed') {
-            symbolCheckbox.checked = false;
-        }
+    if (!cursor.closed) {
+        cursor.closed = true;
+        cursor.chunk[0] = ']';
+        cursor.chunk[1] = '}';
+        cursor.chunkLength = 2;
+        return true;
     }
+    return false;
+}
 
-    function toggleStaticIpFields() {
-        const enabled = document.getElementById('wifi_static_ip_enabled')?.checked;
-        const fields = document.getElementById('staticIpFields');
-        if (fields) {
-            fields.style.display = enabled ? 'block' : 'none';
+// Kopiert Teilstücke in den Sendepuffer, bis er voll ist oder `refill` nichts mehr liefert.
+template <typename Cursor, typename Refill>
+size_t fillChunkedStream(Cursor &cursor, uint8_t *buffer, size_t maxLength, Refill refill) {
+    size_t written = 0;
+    while (written < maxLength) {
+        if (cursor.chunkOffset >= cursor.chunkLength && !refill(cursor)) {
+            break;
         }
+        const size_t count = std::min(maxLength - written, cursor.chunkLength - cursor.chunkOffset);
+        memcpy(buffer + written, cursor.chunk + cursor.chunkOffset, count);
+        cursor.chunkOffset += count;
+        written += count;
     }
+    return written;
+}
 
-    // 🔔 Zeichen-/Symbol-Trigger über Webinterface
-    function triggerLetter(triggerIndex) {
-        let query = '';
-        if (typeof triggerIndex === 'number' && triggerIndex >= 0) {
-            query = '?trigger=' + encodeURIComponent(triggerIndex + 1);
-        }
+size_t fillLogStream(LogStreamCursor &cursor, uint8_t *buffer, size_t maxLength) {
+    return fillChunkedStream(cursor, buffer, maxLength, refillLogStreamChunk);
+}
 
-        managerFetch('/triggerLetter' + query)
-            .then(response => response.text().then(message => ({ ok: response.ok, message })))
-            .then(result => {
-                const text = result.message && result.message.trim() !== '' ? result.message : (result.ok ? '✅ Trigger erfolgreich!' : '❌ Unbekannter Fehler beim Trigger!');
-                if (!result.ok) {
-                    console.warn('❌ Serverfehler:', text);
-                } else {
-                    console.log('ℹ️ Serverantwort:', text);
-                }
-                alert(text);
-            })
-            .catch(error => {
-                console.error('❌ Fehler:', error);
-                alert('❌ Fehler: ' + error);
-            });
-    }
+// Abschnitte der Startseite in Sendereihenfolge. Jeder Aufruf von refillConfigPageChunk()
+// rendert genau ein Teilstück (höchstens CONFIG_PAGE_CHUNK_SIZE Bytes) aus den aktuellen Werten.
+enum class ConfigPageSection : uint8_t {
+    Head,
+    Style,
+    WiFiIntro,
+    WiFiMode,
+    WiFiNetworks,
+    WiFiSsid,
+    WiFiPassword,
+    WiFiHostname,
+    WiFiSymbol,
+    WiFiPersistent,
+    WiFiStaticIp,
+    WiFiGatewaySubnet,
+    WiFiDns,
+    WiFiLocalApIntro,
+    WiFiLocalApSsid,
+    WiFiLocalApPassword,
+    Display,
+    DisplayPool,
+    DisplayAddress,
+    DisplayTimes,
+    DisplayActive,
+    DelaysIntro,
+    DelaysHead,
+    DelaysRow,
+    ClockStatus,
+    ClockForm,
+    LettersIntro,
+    LettersTableHead,
+    LettersSelectOpen,
+    LettersOption,
+    LettersColor,
+    LettersButton,
+    LettersFooter,
+    ManualTrigger,
+    Done,
+};
 
-    // 👁️ Zeichen/Symbol direkt anzeigen
-    function displayLetter(triggerIndex, letter) {
-        if (typeof letter !== 'string' || letter.length !== 1) {
-            console.warn('❌ Ungültiges Zeichen/Symbol:', letter);
-            alert('❌ Bitte ein einzelnes Zeichen/Symbol auswählen.');
-            return;
-        }
+constexpr size_t CONFIG_PAGE_CHUNK_SIZE = 512;
+constexpr size_t CONFIG_PAGE_DAY_ORDER[NUM_DAYS] = {1, 2, 3, 4, 5, 6, 0};
+constexpr size_t CONFIG_PAGE_LETTER_OPTIONS = sizeof(availableLetters) + CUSTOM_SYMBOL_COUNT;
+
+// Zustand einer Antwort auf GET /: statt der ganzen Seite als String liegen nur das aktuelle
+// Teilstück und die Schleifenzähler im Heap. Werte werden erst beim Rendern ihres Teilstücks gelesen.
+struct ConfigPageCursor {
+    ConfigPageSection section;
+    uint8_t trigger;
+    uint8_t column;   // Index in CONFIG_PAGE_DAY_ORDER bzw. Wochentag der Verzögerungstabelle
+    uint8_t option;   // Auswahlliste: erst availableLetters, dann die Zusatz-Symbole
+    uint8_t customSymbolFlags[CUSTOM_SYMBOL_COUNT];
+    char chunk[CONFIG_PAGE_CHUNK_SIZE];
+    size_t chunkLength;
+    size_t chunkOffset;
+};
 
-        let url = '/displayLetter?char=' + encodeURIComponent(letter);
-        if (typeof triggerIndex === 'number' && triggerIndex >= 0) {
-            url += '&trigger=' + encodeURIComponent(triggerIndex + 1);
-        }
+void appendPageText(ConfigPageCursor &cursor, const char *text) {
+    const size_t length = std::min(strlen(text), sizeof(cursor.chunk) - cursor.chunkLength);
+    memcpy(cursor.chunk + cursor.chunkLength, text, length);
+    cursor.chunkLength += length;
+}
 
-        managerFetch(url)
-            .then(response => response.text().then(message => ({ ok: response.ok, message })))
-            .then(result => {
-                const text = result.message && result.message.trim() !== '' ? result.message : (result.ok ? '✅ Zeichen/Symbol angezeigt!' : '❌ Anzeige fehlgeschlagen!');
-                if (!result.ok) {
-                    console.warn('❌ Serverfehler:', text);
-                } else {
-                    console.log('ℹ️ Serverantwort:', text);
-                }
-                alert(text);
-            })
-            .catch(error => {
-                console.error('❌ Fehler:', error);
-                alert('❌ Fehler: ' + error);
-            });
+void appendPageEscaped(ConfigPageCursor &cursor, const char *text) {
+    for (; *text != '\0'; ++text) {
+        switch (*text) {
+            case '&':
+                appendPageText(cursor, "&amp;");
+                break;
+            case '<':
+                appendPageText(cursor, "&lt;");
+                break;
+            case '>':
+                appendPageText(cursor, "&gt;");
+                break;
+            case '"':
+                appendPageText(cursor, "&quot;");
+                break;
+            case '\'':
+                appendPageText(cursor, "&#39;");
+                break;
+            default: {
+                const char single[2] = {*text, '\0'};
+                appendPageText(cursor, single);
+                break;
+            }
+        }
     }
+}
 
-    // 💾 WiFi-Daten speichern
-    let symbolEditorBitmap = new Array(128).fill(0);
+void appendPageNumber(ConfigPageCursor &cursor, unsigned long value) {
+    char digits[12];
+    snprintf(digits, sizeof(digits), "%lu", value);
+    appendPageText(cursor, digits);
+}
 
-    function symbolBitIsSet(x, y) {
-        const byteIndex = y * 4 + Math.floor(x / 8);
-        return (symbolEditorBitmap[byteIndex] & (1 << (7 - (x % 8)))) !== 0;
+void appendPageChecked(ConfigPageCursor &cursor, bool checked) {
+    if (checked) {
+        appendPageText(cursor, "checked");
     }
+}
 
-    function setSymbolBit(x, y, enabled) {
-        const byteIndex = y * 4 + Math.floor(x / 8);
-        const mask = 1 << (7 - (x % 8));
-        if (enabled) {
-            symbolEditorBitmap[byteIndex] |= mask;
-        } else {
-            symbolEditorBitmap[byteIndex] &= ~mask;
-        }
+// Wie symbolToken(), aber ohne String.
+void appendPageSymbolToken(ConfigPageCursor &cursor, char symbol) {
+    const int id = customSymbolId(symbol);
+    if (id < 0) {
+        const char single[2] = {symbol, '\0'};
+        appendPageEscaped(cursor, single);
+        return;
     }
+    appendPageText(cursor, "@");
+    appendPageNumber(cursor, static_cast<unsigned long>(id));
+}
 
-    function renderSymbolEditor() {
-        const grid = document.getElementById('symbolGrid');
-        if (!grid) {
-            return;
+void appendPageTriggerField(ConfigPageCursor &cursor, const char *prefix, size_t trigger, size_t day) {
+    appendPageText(cursor, prefix);
+    appendPageNumber(cursor, trigger);
+    appendPageText(cursor, "_");
+    appendPageNumber(cursor, day);
+}
+
+void appendPageTriggerColumnClass(ConfigPageCursor &cursor, size_t trigger) {
+    if (trigger != 0) {
+        appendPageText(cursor, " class='advanced-trigger-column'");
+    }
+}
+
+void advanceConfigPage(ConfigPageCursor &cursor) {
+    cursor.section = static_cast<ConfigPageSection>(static_cast<uint8_t>(cursor.section) + 1);
+}
+
+// Auswahlliste für ein Zeichen/Symbol. Zusatz-Symbole erscheinen nur, wenn sie im Symbol-Paket
+// gespeichert sind oder gerade ausgewählt sind; so bleibt die Seite unabhängig von der Kataloggröße.
+bool nextConfigPageLetterOption(ConfigPageCursor &cursor, char selectedLetter, char &optionChar) {
+    while (cursor.option < CONFIG_PAGE_LETTER_OPTIONS) {
+        const size_t option = cursor.option++;
+        if (option < sizeof(availableLetters)) {
+            optionChar = availableLetters[option];
+            return true;
         }
-        grid.innerHTML = '';
-        for (let y = 0; y < 32; y++) {
-            for (let x = 0; x < 32; x++) {
-                const cell = document.createElement('button');
-                cell.type = 'button';
-                cell.className = 'symbol-cell' + (symbolBitIsSet(x, y) ? ' on' : '');
-                cell.addEventListener('click', () => {
-                    setSymbolBit(x, y, !symbolBitIsSet(x, y));
-                    renderSymbolEditor();
-                });
-                grid.appendChild(cell);
-            }
+        const size_t id = option - sizeof(availableLetters);
+        optionChar = customSymbolFromId(id);
+        if ((cursor.customSymbolFlags[id] & SYMBOL_PACK_FLAG_STORED) != 0 || selectedLetter == optionChar) {
+            return true;
         }
     }
+    return false;
+}
 
-    function symbolBitmapToHex() {
-        return symbolEditorBitmap
-            .map(value => (value & 255).toString(16).padStart(2, '0'))
-            .join('')
-            .toUpperCase();
+void renderConfigPageLetterOption(ConfigPageCursor &cursor, char optionChar, bool selected) {
+    appendPageText(cursor, "<option value='");
+    appendPageSymbolToken(cursor, optionChar);
+    appendPageText(cursor, selected ? "' selected>" : "' >");
+    appendPageEscaped(cursor, getLetterOptionLabel(optionChar).c_str());
+    const int id = customSymbolId(optionChar);
+    if (id >= 0 && (cursor.customSymbolFlags[id] & SYMBOL_PACK_FLAG_ENABLED) == 0) {
+        appendPageText(cursor, " (inaktiv)");
     }
+    appendPageText(cursor, "</option>");
+}
 
-    function loadSymbolFromHex(hex) {
-        const clean = String(hex || '').trim();
-        if (!/^[0-9a-fA-F]{256}$/.test(clean)) {
-            symbolEditorBitmap = new Array(128).fill(0);
-        } else {
-            symbolEditorBitmap = [];
-            for (let index = 0; index < clean.length; index += 2) {
-                symbolEditorBitmap.push(parseInt(clean.slice(index, index + 2), 16));
+// Liefert das nächste Teilstück der Startseite; false, wenn alles gesendet ist.
+bool refillConfigPageChunk(ConfigPageCursor &cursor) {
+    cursor.chunkLength = 0;
+    cursor.chunkOffset = 0;
+    const size_t day = CONFIG_PAGE_DAY_ORDER[cursor.column % NUM_DAYS];
+
+    switch (cursor.section) {
+        case ConfigPageSection::Head:
+            appendPageText(cursor, "<!doctype html><html lang='de'><head><meta charset='utf-8'><meta name='viewport' content='width=device-width,initial-scale=1'>");
+            break;
+        case ConfigPageSection::Style:
+            appendPageText(cursor, "<link rel='stylesheet' href='/style.css?v=" WEB_ASSET_STYLE_CSS_HASH "'>");
+            appendPageText(cursor, "</head><body><h1>RiddleMatrix Einstellungen</h1>");
+            break;
+
+        // **WiFi-Einstellungen**
+        case ConfigPageSection::WiFiIntro:
+            appendPageText(cursor, "<h2>WiFi Konfiguration</h2><form id='wifiForm'><table>");
+            appendPageText(cursor, "<tr><th>Hinweis</th><td>Standard bleibt: Box verbindet sich nur beim Start zur Verwaltung und schaltet WLAN nach Inaktivität wieder ab.</td></tr>");
+            break;
+        case ConfigPageSection::WiFiMode:
+            appendPageText(cursor, "<tr><th>WLAN-Modus</th><td><label><input type='radio' name='wifi_mode' value='timed' ");
+            appendPageChecked(cursor, wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::TimedManager));
+            appendPageText(cursor, "> Standard: Manager/Hotspot zeitweise</label><br><label><input type='radio' name='wifi_mode' value='always' ");
+            appendPageChecked(cursor, wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::AlwaysConnected));
+            appendPageText(cursor, "> Dauerhaft mit bestehendem WLAN verbinden</label><br><label><input type='radio' name='wifi_mode' value='ap_sta' ");
+            appendPageChecked(cursor, wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::StaWithLocalAp));
+            appendPageText(cursor, "> AP+STA/Mesh-Kopie: WLAN verbinden und zusätzlichen Box-AP starten</label></td></tr>");
+            break;
+        case ConfigPageSection::WiFiNetworks:
+            appendPageText(cursor, "<tr><th>Pflichtfelder</th><td>SSID und Hostname sind Pflichtfelder (mindestens 2 Zeichen), das Passwort ist optional.</td></tr>");
+            appendPageText(cursor, "<tr><th>Netzwerke</th><td><select id='wifiNetworkSelect' onchange='applySelectedWiFiNetwork()'><option value=''>Noch nicht gesucht</option></select> ");
+            appendPageText(cursor, "<button type='button' onclick='loadWiFiNetworks()'>WLAN suchen</button></td></tr>");
+            break;
+        case ConfigPageSection::WiFiSsid:
+            appendPageText(cursor, "<tr><th>SSID</th><td><input type='text' name='ssid' value='");
+            appendPageEscaped(cursor, wifi_ssid);
+            appendPageText(cursor, "'></td></tr>");
+            break;
+        case ConfigPageSection::WiFiPassword:
+            appendPageText(cursor, "<tr><th>Passwort</th><td><input type='password' name='password' placeholder='Leer lassen, um es zu behalten'><br>");
+            appendPageText(cursor, "<label><input type='checkbox' id='password_remove' name='password_remove' value='on'> Passwort löschen</label>");
+            appendPageText(cursor, "<p style='margin-top:4px;'>Leer gelassenes Passwort ohne Haken lässt das bisherige Passwort unverändert.</p></td></tr>");
+            break;
+        case ConfigPageSection::WiFiHostname:
+            appendPageText(cursor, "<tr><th>Hostname</th><td><input type='text' name='hostname' value='");
+            appendPageEscaped(cursor, hostname);
+            appendPageText(cursor, "'></td></tr>");
+            break;
+        case ConfigPageSection::WiFiSymbol:
+            appendPageText(cursor, "<tr id='wifiSymbolField'><th>WiFi-Symbol</th><td><label><input type='checkbox' id='wifi_status_symbol_enabled' name='wifi_status_symbol_enabled' value='on' ");
+            appendPageChecked(cursor, wifi_status_symbol_enabled);
+            appendPageText(cursor, "> Im Standardmodus anzeigen</label></td></tr></table>");
+            break;
+        case ConfigPageSection::WiFiPersistent:
+            appendPageText(cursor, "<div id='persistentWifiFields' style='display:none; margin:8px 0;'>");
+            appendPageText(cursor, "<table><tr><th>Hinweis</th><td>In dauerhaften WLAN-Modi bleibt die Box online, reconnectet automatisch und zeigt kein WiFi-Symbol auf der Matrix.</td></tr>");
+            appendPageText(cursor, "<tr><th>IP-Modus</th><td><label><input type='checkbox' id='wifi_static_ip_enabled' name='wifi_static_ip_enabled' value='on' ");
+            appendPageChecked(cursor, wifi_static_ip_enabled);
+            appendPageText(cursor, "> Statische IP verwenden</label></td></tr></table>");
+            break;
+        case ConfigPageSection::WiFiStaticIp:
+            appendPageText(cursor, "<div id='staticIpFields' style='display:none; margin:6px 0;'><table>");
+            appendPageText(cursor, "<tr><th>IP</th><td><input type='text' name='static_ip' value='");
+            appendPageEscaped(cursor, wifi_static_ip);
+            appendPageText(cursor, "'></td></tr>");
+            break;
+        case ConfigPageSection::WiFiGatewaySubnet:
+            appendPageText(cursor, "<tr><th>Gateway</th><td><input type='text' name='gateway' value='");
+            appendPageEscaped(cursor, wifi_gateway);
+            appendPageText(cursor, "'></td></tr><tr><th>Subnetz</th><td><input type='text' name='subnet' value='");
+            appendPageEscaped(cursor, wifi_subnet);
+            appendPageText(cursor, "'></td></tr>");
+            break;
+        case ConfigPageSection::WiFiDns:
+            appendPageText(cursor, "<tr><th>DNS</th><td><input type='text' name='dns' value='");
+            appendPageEscaped(cursor, wifi_dns);
+            appendPageText(cursor, "'></td></tr></table></div></div>");
+            break;
+        case ConfigPageSection::WiFiLocalApIntro:
+            appendPageText(cursor, "<div id='localApFields' style='display:none; margin:8px 0;'><table>");
+            appendPageText(cursor, "<tr><th>Hinweis</th><td>AP+STA startet einen lokalen Box-AP mit denselben Zugangsdaten wie das Ziel-WLAN, sofern hier nichts anderes eingetragen wird.</td></tr>");
+            break;
+        case ConfigPageSection::WiFiLocalApSsid:
+            appendPageText(cursor, "<tr><th>Lokale AP-SSID</th><td><input type='text' name='local_ap_ssid' value='");
+            appendPageEscaped(cursor, wifi_local_ap_ssid);
+            appendPageText(cursor, "'></td></tr>");
+            break;
+        case ConfigPageSection::WiFiLocalApPassword:
+            appendPageText(cursor, "<tr><th>Lokales AP-Passwort</th><td><input type='password' name='local_ap_password' placeholder='Leer lassen = WLAN-Passwort übernehmen'></td></tr>");
+            appendPageText(cursor, "</table></div><button type='button' onclick='saveWiFi()'>Speichern</button></form>");
+            break;
+
+        // **Anzeige-Einstellungen**
+        case ConfigPageSection::Display:
+            appendPageText(cursor, "<h2>Anzeige-Einstellungen</h2><form id='displayForm'><table>");
+            appendPageText(cursor, "<tr><th>Helligkeit</th><td><input type='number' name='brightness' min='1' max='255' value='");
+            appendPageNumber(cursor, static_cast<unsigned long>(display_brightness));
+            appendPageText(cursor, "'> <span class='muted'>1-255</span></td></tr>");
+            break;
+        case ConfigPageSection::DisplayPool:
+            appendPageText(cursor, "<tr><th>Zufalls-Zeichen bei *</th><td><input type='text' name='random_symbol_pool' maxlength='160' value='");
+            for (size_t index = 0; index < RANDOM_SYMBOL_POOL_LENGTH && random_symbol_pool[index] != '\0'; ++index) {
+                appendPageSymbolToken(cursor, random_symbol_pool[index]);
+            }
+            appendPageText(cursor, "'></td></tr>");
+            break;
+        case ConfigPageSection::DisplayAddress:
+            appendPageText(cursor, "<tr><th>RS485-Boxadresse</th><td><input type='number' name='rs485_address' min='0' max='254' value='");
+            appendPageNumber(cursor, rs485_box_address);
+            appendPageText(cursor, "'> <span class='muted'>0 = alle Frames annehmen, 1-254</span></td></tr>");
+            appendPageText(cursor, "<tr><th>Automodus</th><td><label><input type='checkbox' id='auto_mode' name='auto_mode' ");
+            appendPageText(cursor, autoDisplayMode ? "checked='checked'" : "");
+            appendPageText(cursor, "> aktivieren</label></td></tr>");
+            break;
+        case ConfigPageSection::DisplayTimes:
+            appendPageText(cursor, "<tr><th>Zeichen-Anzeigezeit</th><td><input type='number' name='letter_time' min='1' max='60' value='");
+            appendPageNumber(cursor, letter_display_time);
+            appendPageText(cursor, "'> <span class='muted'>Sekunden, 1-60</span></td></tr>");
+            appendPageText(cursor, "<tr><th>Automodus-Intervall</th><td><input type='number' name='auto_interval' min='30' max='600' value='");
+            appendPageNumber(cursor, letter_auto_display_interval);
+            appendPageText(cursor, "'> <span class='muted'>Sekunden, 30-600</span></td></tr>");
+            break;
+        case ConfigPageSection::DisplayActive:
+            appendPageText(cursor, "<tr><th>Standalone aktiv</th><td>von <input type='time' name='active_start' value='");
+            appendPageText(cursor, formatMinutesAsTime(standalone_active_start_minutes).c_str());
+            appendPageText(cursor, "'> bis <input type='time' name='active_end' value='");
+            appendPageText(cursor, formatMinutesAsTime(standalone_active_end_minutes).c_str());
+            appendPageText(cursor, "'></td></tr>");
+            appendPageText(cursor, "<tr><th>Hinweis</th><td class='muted'>Aktivzeiten im Format HH:MM; gleicher Start- und Endwert bedeutet 24-Stunden-Betrieb.</td></tr>");
+            appendPageText(cursor, "</table><button type='button' onclick='saveDisplaySettings()'>Speichern</button></form>");
+            break;
+
+        // **Trigger-Verzögerungen**
+        case ConfigPageSection::DelaysIntro:
+            appendPageText(cursor, "<h2>Trigger-Verzögerungen pro Wochentag</h2>");
+            appendPageText(cursor, "<label><input type='checkbox' id='separate_trigger_editing' autocomplete='off' onchange='applyTriggerEditMode()'> Trigger 2 und 3 separat bearbeiten</label>");
+            appendPageText(cursor, "<p style='margin-top:4px;'>Ohne Haken werden die Werte von Trigger 1 beim Speichern auf alle Trigger kopiert.</p>");
+            break;
+        case ConfigPageSection::DelaysHead:
+            appendPageText(cursor, "<form id='delaysForm'><table border='1' style='width:100%; text-align:center;'><tr><th>Wochentag</th>");
+            for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+                appendPageText(cursor, "<th");
+                appendPageTriggerColumnClass(cursor, trigger);
+                appendPageText(cursor, ">Trigger ");
+                appendPageNumber(cursor, trigger + 1);
+                appendPageText(cursor, " (Sekunden)</th>");
+            }
+            appendPageText(cursor, "</tr>");
+            cursor.column = 0;
+            break;
+        case ConfigPageSection::DelaysRow:
+            // Die Verzögerungstabelle läuft in Speicherreihenfolge (Sonntag zuerst).
+            appendPageText(cursor, "<tr><td>");
+            appendPageEscaped(cursor, daysOfTheWeek[cursor.column]);
+            appendPageText(cursor, "</td>");
+            for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+                appendPageText(cursor, "<td");
+                appendPageTriggerColumnClass(cursor, trigger);
+                appendPageTriggerField(cursor, "><input type='number' min='0' max='999' step='1' name='delay_", trigger, cursor.column);
+                appendPageText(cursor, "' value='");
+                appendPageNumber(cursor, letter_trigger_delays[trigger][cursor.column]);
+                appendPageText(cursor, "'></td>");
             }
-        }
-        renderSymbolEditor();
+            appendPageText(cursor, "</tr>");
+            if (++cursor.column < NUM_DAYS) {
+                return true;
+            }
+            cursor.column = 0;
+            appendPageText(cursor, "</table><br><button type='button' onclick='saveTriggerDelays()'>Verzögerungen speichern</button></form>");
+            break;
+
+        // **RTC-Zeit anzeigen & ändern**
+        case ConfigPageSection::ClockStatus:
+            appendPageText(cursor, "<h2>Datum &amp; Uhrzeit</h2>");
+            appendPageText(cursor, "<table><tr><th>Aktuelle Zeit</th><td><span id='rtcTime'>Laden...</span></td></tr>");
+            appendPageText(cursor, "<tr><th>Freier RAM</th><td><span id='memoryUsage'>Laden...</span> bytes</td></tr></table>");
+            break;
+        case ConfigPageSection::ClockForm:
+            appendPageText(cursor, "<form id='rtcForm'><table><tr><th>Datum</th><td><input type='date' name='date'></td></tr>");
+            appendPageText(cursor, "<tr><th>Uhrzeit</th><td><input type='time' name='time' step='1'></td></tr></table>");
+            appendPageText(cursor, "<button type='button' onclick='setRTC()'>Speichern</button></form>");
+            appendPageText(cursor, "<button type='button' onclick='syncNTP()'>Zeit mit NTP synchronisieren</button>");
+            break;
+
+        // **Schnellbearbeitung Zeichen & Farben**: je Trigger eine Tabelle mit den Zeilen
+        // Zeichen, Farbe und Anzeigen; jede Zelle bzw. Option ist ein eigenes Teilstück.
+        case ConfigPageSection::LettersIntro:
+            appendPageText(cursor, "<h2>Schnellbearbeitung Zeichen &amp; Farben</h2>");
+            appendPageText(cursor, "<p class='muted'>Schnelle Änderungen direkt an der Box. Der große Zeicheneditor bleibt im RiddleMatrix-Manager.</p>");
+            appendPageText(cursor, "<label><input type='checkbox' id='separate_trigger_editing_letters' autocomplete='off' onchange='document.getElementById(\"separate_trigger_editing\").checked=this.checked; applyTriggerEditMode();'> Alle 3 Trigger separat anzeigen</label>");
+            appendPageText(cursor, "<form id='lettersForm'>");
+            cursor.trigger = 0;
+            break;
+        case ConfigPageSection::LettersTableHead:
+            appendPageText(cursor, "<table");
+            appendPageTriggerColumnClass(cursor, cursor.trigger);
+            appendPageText(cursor, " style='text-align:center; margin-top:8px;'><tr><th>Trigger ");
+            appendPageNumber(cursor, cursor.trigger + 1U);
+            appendPageText(cursor, "</th>");
+            for (size_t orderIndex = 0; orderIndex < NUM_DAYS; ++orderIndex) {
+                appendPageText(cursor, "<th>");
+                appendPageEscaped(cursor, daysOfTheWeek[CONFIG_PAGE_DAY_ORDER[orderIndex]]);
+                appendPageText(cursor, "</th>");
+            }
+            appendPageText(cursor, "</tr><tr><th>Zeichen</th>");
+            cursor.column = 0;
+            break;
+        case ConfigPageSection::LettersSelectOpen:
+            appendPageTriggerField(cursor, "<td><select id='letter_", cursor.trigger, day);
+            appendPageTriggerField(cursor, "' name='letter_", cursor.trigger, day);
+            appendPageText(cursor, "'>");
+            cursor.option = 0;
+            break;
+        case ConfigPageSection::LettersOption: {
+            const char selectedLetter = dailyLetters[cursor.trigger][day];
+            char optionChar = '\0';
+            if (nextConfigPageLetterOption(cursor, selectedLetter, optionChar)) {
+                renderConfigPageLetterOption(cursor, optionChar, optionChar == selectedLetter);
+                return true;
+            }
+            appendPageText(cursor, "</select></td>");
+            if (++cursor.column < NUM_DAYS) {
+                cursor.section = ConfigPageSection::LettersSelectOpen;
+                return true;
+            }
+            cursor.column = 0;
+            appendPageText(cursor, "</tr><tr><th>Farbe</th>");
+            break;
+        }
+        case ConfigPageSection::LettersColor:
+            appendPageTriggerField(cursor, "<td><input type='color' id='color_", cursor.trigger, day);
+            appendPageTriggerField(cursor, "' name='color_", cursor.trigger, day);
+            appendPageText(cursor, "' value='");
+            appendPageEscaped(cursor, dailyLetterColors[cursor.trigger][day]);
+            appendPageTriggerField(cursor, "'><input type='hidden' id='color_mode_", cursor.trigger, day);
+            appendPageTriggerField(cursor, "' name='color_mode_", cursor.trigger, day);
+            appendPageText(cursor, "' value='fixed'></td>");
+            if (++cursor.column < NUM_DAYS) {
+                return true;
+            }
+            cursor.column = 0;
+            appendPageText(cursor, "</tr><tr><th>Anzeigen</th>");
+            break;
+        case ConfigPageSection::LettersButton:
+            appendPageText(cursor, "<td><button type='button' onclick='displayLetter(");
+            appendPageNumber(cursor, cursor.trigger);
+            appendPageTriggerField(cursor, ", document.getElementById(\"letter_", cursor.trigger, day);
+            appendPageText(cursor, "\").value)'>Trigger ");
+            appendPageNumber(cursor, cursor.trigger + 1U);
+            appendPageText(cursor, "</button>");
+            if (cursor.trigger == 0) {
+                appendPageText(cursor, "<br><button type='button' onclick='displayDayTriggersSequential(");
+                appendPageNumber(cursor, day);
+                appendPageText(cursor, ")'>Alle</button>");
+            }
+            appendPageText(cursor, "</td>");
+            if (++cursor.column < NUM_DAYS) {
+                return true;
+            }
+            cursor.column = 0;
+            appendPageText(cursor, "</tr></table>");
+            if (++cursor.trigger < NUM_TRIGGERS) {
+                cursor.section = ConfigPageSection::LettersTableHead;
+                return true;
+            }
+            break;
+        case ConfigPageSection::LettersFooter:
+            appendPageText(cursor, "<br><button type='button' onclick='saveAllLetters()'>Zeichen &amp; Farben speichern</button></form>");
+            break;
+
+        case ConfigPageSection::ManualTrigger:
+            appendPageText(cursor, "<h2>Manueller Trigger</h2>");
+            for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+                appendPageText(cursor, "<button type='button' style='margin-right:8px;' onclick='triggerLetter(");
+                appendPageNumber(cursor, trigger);
+                appendPageText(cursor, ")'>Trigger ");
+                appendPageNumber(cursor, trigger + 1);
+                appendPageText(cursor, " auslösen</button>");
+            }
+            appendPageText(cursor, "<script src='/script.js?v=" WEB_ASSET_SCRIPT_JS_HASH "'></script></body></html>");
+            break;
+
+        case ConfigPageSection::Done:
+        default:
+            return false;
     }
+    advanceConfigPage(cursor);
+    return true;
+}
 
-    function loadCustomSymbol() {
-        const symbol = document.getElementById('symbolSlot')?.value || 'A';
-        managerFetch('/api/symbol-bitmap?char=' + encodeURIComponent(symbol))
-            .then(response => response.json())
-            .then(data => {
-                loadSymbolFromHex(data.bitmap || '');
-                const enabled = document.getElementById('symbolEnabled');
-                if (enabled) {
-                    enabled.checked = !!data.enabled;
-                }
-                const mode = document.getElementById('symbolEditorMode');
-                if (mode) {
-                    mode.textContent = data.builtin
-                        ? 'Standard-Zeichen: beim Speichern wird der eingebaute Default ueberschrieben.'
-                        : 'Zusatz-Zeichen: wird im Speicher abgelegt und kann direkt ausgewaehlt werden.';
-                }
-            })
-            .catch(error => alert('Symbol konnte nicht geladen werden: ' + error));
-    }
-
-    function saveCustomSymbol() {
-        const form = new FormData();
-        form.append('char', document.getElementById('symbolSlot')?.value || 'A');
-        form.append('enabled', document.getElementById('symbolEnabled')?.checked ? '1' : '0');
-        form.append('bitmap', symbolBitmapToHex());
-        managerFetch('/api/symbol-bitmap', { method: 'POST', body: form })
-            .then(response => response.text().then(message => ({ ok: response.ok, message })))
-            .then(result => alert(result.message || (result.ok ? 'Symbol gespeichert.' : 'Symbol konnte nicht gespeichert werden.')))
-            .catch(error => alert('Symbol konnte nicht gespeichert werden: ' + error));
-    }
-
-    function resetSymbolToDefault() {
-        const form = new FormData();
-        form.append('char', document.getElementById('symbolSlot')?.value || 'A');
-        form.append('clear', '1');
-        managerFetch('/api/symbol-bitmap', { method: 'POST', body: form })
-            .then(response => response.text().then(message => ({ ok: response.ok, message })))
-            .then(result => {
-                alert(result.message || (result.ok ? 'Default wiederhergestellt.' : 'Default konnte nicht wiederhergestellt werden.'));
-                loadCustomSymbol();
-            })
-            .catch(error => alert('Default konnte nicht wiederhergestellt werden: ' + error));
-    }
-
-    function clearCustomSymbol() {
-        symbolEditorBitmap = new Array(128).fill(0);
-        renderSymbolEditor();
-    }
-
-    function importSymbolImage(input) {
-        const file = input.files && input.files[0];
-        if (!file) {
-            return;
+size_t fillConfigPageStream(ConfigPageCursor &cursor, uint8_t *buffer, size_t maxLength) {
+    return fillChunkedStream(cursor, buffer, maxLength, refillConfigPageChunk);
+}
+
+// **Statische Dateien aus web_assets.h**
+// Die Startseite verweist mit ?v=<Hash> auf die Dateien; ändert sich der Inhalt, ändert sich die
+// URL. Darum dürfen Browser sie ein Jahr lang ungefragt behalten. Fragt einer trotzdem mit
+// If-None-Match nach, genügt ein leeres 304.
+
+// If-None-Match ist "*" oder eine Liste von Entity-Tags ("hash" bzw. schwach W/"hash"). Verglichen
+// wird schwach (RFC 7232, 3.2): das W/ zählt nicht, der Hash muss aber das ganze Tag sein.
+bool entityTagListMatches(const char *header, const char *hash) {
+    const size_t hashLength = strlen(hash);
+    const char *cursor = header;
+    while (*cursor != '\0') {
+        while (*cursor == ' ' || *cursor == '\t' || *cursor == ',') {
+            ++cursor;
+        }
+        if (*cursor == '*') {
+            return true;
         }
-        const image = new Image();
-        image.onload = () => {
-            const canvas = document.createElement('canvas');
-            canvas.width = 32;
-            canvas.height = 32;
-            const ctx = canvas.getContext('2d');
-            ctx.drawImage(image, 0, 0, 32, 32);
-            const pixels = ctx.getImageData(0, 0, 32, 32).data;
-            symbolEditorBitmap = new Array(128).fill(0);
-            for (let y = 0; y < 32; y++) {
-                for (let x = 0; x < 32; x++) {
-                    const offset = (y * 32 + x) * 4;
-                    const alpha = pixels[offset + 3];
-                    const brightness = (pixels[offset] + pixels[offset + 1] + pixels[offset + 2]) / 3;
-                    setSymbolBit(x, y, alpha > 32 && brightness < 220);
-                }
+        if (strncmp(cursor, "W/", 2) == 0) {
+            cursor += 2;
+        }
+        if (*cursor == '"') {
+            const char *tag = cursor + 1;
+            const char *tagEnd = strchr(tag, '"');
+            if (tagEnd == nullptr) {
+                return false;
             }
-            renderSymbolEditor();
-            URL.revokeObjectURL(image.src);
-        };
-        image.onerror = () => alert('Bild konnte nicht gelesen werden.');
-        image.src = URL.createObjectURL(file);
+            if (static_cast<size_t>(tagEnd - tag) == hashLength && strncmp(tag, hash, hashLength) == 0) {
+                return true;
+            }
+            cursor = tagEnd + 1;
+        }
+        while (*cursor != '\0' && *cursor != ',') {
+            ++cursor;
+        }
     }
+    return false;
+}
 
-    function displayDayTriggersSequential(dayIndex) {
-        const delayMs = 1500;
-        for (let trigger = 0; trigger < 3; trigger++) {
-            window.setTimeout(() => {
-                const select = document.getElementById('letter_' + trigger + '_' + dayIndex);
-                if (select) {
-                    displayLetter(trigger, select.value);
-                }
-            }, trigger * delayMs);
+void sendWebAsset(AsyncWebServerRequest *request, const char *contentType, const uint8_t *data, size_t length,
+                  const char *etag) {
+    const String quotedTag = String("\"") + etag + "\"";
+    if (request->hasHeader(F("If-None-Match"))) {
+        const String match = request->header(F("If-None-Match"));
+        if (entityTagListMatches(match.c_str(), etag)) {
+            AsyncWebServerResponse *response = request->beginResponse(304);
+            response->addHeader(F("ETag"), quotedTag);
+            response->addHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+            request->send(response);
+            return;
         }
     }
+    AsyncWebServerResponse *response = request->beginResponse_P(200, contentType, data, length);
+    response->addHeader(F("Content-Encoding"), F("gzip"));
+    response->addHeader(F("ETag"), quotedTag);
+    response->addHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+    request->send(response);
+}
 
-    function saveWiFi() {
-        const formElement = document.getElementById('wifiForm');
-        let form = new FormData(formElement);
+// **Sammel-Upload POST /api/symbols/bulk**
+// Rumpf (application/octet-stream): Folge von Records zu je SYMBOL_BULK_RECORD_SIZE Bytes
+//   Symbolcode (u8) | Flags (u8) | Bitmap (SYMBOL_BITMAP_SIZE Bytes)
+// Symbolcode ist das Zeichen eines editierbaren eingebauten Symbols bzw. 0x80 + Id eines
+// Zusatz-Symbols. Jeder vollständige Record geht sofort in die Kopie des Symbol-Pakets; erst nach
+// dem letzten wird das Paket einmal ersetzt. Die Antwort meldet je Record ein Bit (1 = übernommen).
+constexpr size_t SYMBOL_BULK_RECORD_SIZE = 2 + SYMBOL_BITMAP_SIZE;
+constexpr size_t SYMBOL_BULK_MAX_RECORDS = SYMBOL_PACK_SLOT_COUNT;
+constexpr uint8_t SYMBOL_BULK_FLAG_ENABLED = 0x01;
+constexpr uint8_t SYMBOL_BULK_FLAG_CLEAR = 0x02;  // Bitmap wird ignoriert, der Slot geleert
+
+enum class SymbolBulkState : uint8_t {
+    Receiving,
+    Unauthorized,
+    BadLength,
+    Busy,
+    NoStorage,
+};
 
-        // Checkbox explizit berücksichtigen: Nur wenn "Passwort löschen" gesetzt ist,
-        // wird das Flag gesendet, ansonsten entfernen wir den Parameter.
-        const removeCheckbox = document.getElementById('password_remove');
-        if (removeCheckbox) {
-            if (removeCheckbox.checked) {
-                form.set('password_remove', 'on');
-            } else {
-                form.delete('password_remove');
-            }
-        }
+struct SymbolBulkUploadContext {
+    SymbolBulkState state;
+    size_t records;
+    size_t stored;
+    size_t fill;
+    uint8_t record[SYMBOL_BULK_RECORD_SIZE];
+    uint8_t result[(SYMBOL_BULK_MAX_RECORDS + 7) / 8];
+};
 
-        const symbolCheckbox = document.getElementById('wifi_status_symbol_enabled');
-        form.set('wifi_status_symbol_enabled', symbolCheckbox && symbolCheckbox.checked ? 'on' : 'off');
-        const staticIpCheckbox = document.getElementById('wifi_static_ip_enabled');
-        form.set('wifi_static_ip_enabled', staticIpCheckbox && staticIpCheckbox.checked ? 'on' : 'off');
+// Anfrage, der der offene Sammel-Upload gehört; bricht sie ab, wird die Paket-Kopie verworfen.
+AsyncWebServerRequest *symbolBulkOwner = nullptr;
 
-        managerFetch('/updateWiFi', { method: 'POST', body: form })
-            .then(response => response.text())
-            .then(alert)
-            .catch(error => alert('❌ Fehler: ' + error));
+void applySymbolBulkRecord(SymbolBulkUploadContext &context) {
+    const size_t position = context.records++;
+    const char symbol = static_cast<char>(context.record[0]);
+    const uint8_t flags = context.record[1];
+    if ((!isEditableBuiltinSymbol(symbol) && !isCustomSymbol(symbol)) ||
+        (flags & ~(SYMBOL_BULK_FLAG_ENABLED | SYMBOL_BULK_FLAG_CLEAR)) != 0) {
+        return;
     }
-
-    // 💾 Anzeige-Einstellungen speichern
-    function saveDisplaySettings() {
-        let form = new FormData(document.getElementById('displayForm'));
-        let autoModeChecked = document.getElementById('auto_mode').checked;
-        form.set('auto_mode', autoModeChecked ? 'on' : 'off');
-        managerFetch('/updateDisplaySettings', { method: 'POST', body: form })
-            .then(response => response.text())
-            .then(alert)
-            .catch(error => alert('❌ Fehler: ' + error));
+    const uint8_t *bitmap = (flags & SYMBOL_BULK_FLAG_CLEAR) != 0 ? nullptr : context.record + 2;
+    if (stageSymbolBatchRecord(symbol, bitmap, (flags & SYMBOL_BULK_FLAG_ENABLED) != 0)) {
+        context.result[position / 8] |= static_cast<uint8_t>(1U << (position % 8));
+        ++context.stored;
     }
+}
 
-    // 💾 Trigger-Verzögerungen speichern
-    function saveTriggerDelays() {
-        syncSharedTriggerFormFields();
-        let form = new FormData(document.getElementById('delaysForm'));
-        managerFetch('/updateTriggerDelays', { method: 'POST', body: form })
-            .then(response => response.text())
-            .then(alert)
-            .catch(error => alert('❌ Fehler: ' + error));
+void releaseSymbolBulkUpload(AsyncWebServerRequest *request) {
+    if (symbolBulkOwner == request) {
+        abortSymbolBatch();
+        symbolBulkOwner = nullptr;
     }
+}
 
-    // 💾 Alle Zeichen/Symbole & Farben speichern
-    function saveAllLetters() {
-        syncSharedTriggerFormFields();
-        let formData = new FormData(document.getElementById('lettersForm'));
-        managerFetch('/updateAllLetters', { method: 'POST', body: formData })
-            .then(response => response.text())
-            .then(alert)
-            .catch(error => alert('❌ Fehler: ' + error));
+// Ergebnis-Bits als Hex, Record i = Bit (i % 8) von Byte i / 8.
+String symbolBulkResultHex(const SymbolBulkUploadContext &context) {
+    static const char hexChars[] = "0123456789abcdef";
+    String result;
+    for (size_t index = 0; index < (context.records + 7) / 8; ++index) {
+        result += hexChars[context.result[index] >> 4];
+        result += hexChars[context.result[index] & 0x0F];
     }
+    return result;
+}
 
-    function isSeparateTriggerEditingEnabled() {
-        const checkbox = document.getElementById('separate_trigger_editing');
-        return checkbox ? checkbox.checked : true;
-    }
+static_assert(NUM_DAYS == 7, "Erwartete sieben Wochentage fuer die JSON-Abbildung");
+
+constexpr const char *const DAY_KEYS[NUM_DAYS] = {
+    "so", "mo", "di", "mi", "do", "fr", "sa",
+};
 
-    function applyTriggerEditMode() {
-        const separate = isSeparateTriggerEditingEnabled();
-        const lettersCheckbox = document.getElementById('separate_trigger_editing_letters');
-        if (lettersCheckbox) {
-            lettersCheckbox.checked = separate;
+// **Box-Zustand für GET /api/state**
+// Schlüssel wie bei /updateAllLetters bzw. /updateDisplaySettings; je Wochentag ein Array mit einem
+// Wert pro Trigger. Hostname, Farben und Modusnamen werden nur verlinkt, kopiert werden
+// Symbolnamen, Zufallspool und Uhrzeiten.
+constexpr size_t BOX_STATE_DAY_MATRIX_SIZE = JSON_OBJECT_SIZE(NUM_DAYS) + NUM_DAYS * JSON_ARRAY_SIZE(NUM_TRIGGERS);
+constexpr size_t BOX_STATE_TEXT_SIZE = NUM_TRIGGERS * NUM_DAYS * 4 + (RANDOM_SYMBOL_POOL_LENGTH - 1) * 3 + 1 + 2 * 6;
+constexpr size_t BOX_STATE_JSON_CAPACITY = JSON_OBJECT_SIZE(9) + 5 * BOX_STATE_DAY_MATRIX_SIZE + JSON_OBJECT_SIZE(6) +
+                                           JSON_OBJECT_SIZE(2) + BOX_STATE_TEXT_SIZE;
+
+void writeBoxState(JsonObject root) {
+    root["hostname"] = static_cast<const char *>(hostname);
+    root["revision"] = configRevision;
+
+    JsonObject letters = root.createNestedObject("letters");
+    JsonObject colors = root.createNestedObject("colors");
+    JsonObject colorModes = root.createNestedObject("color_modes");
+    JsonObject paletteMasks = root.createNestedObject("color_palette_masks");
+    JsonObject delays = root.createNestedObject("delays");
+    for (size_t day = 0; day < NUM_DAYS; ++day) {
+        JsonArray dayLetters = letters.createNestedArray(DAY_KEYS[day]);
+        JsonArray dayColors = colors.createNestedArray(DAY_KEYS[day]);
+        JsonArray dayModes = colorModes.createNestedArray(DAY_KEYS[day]);
+        JsonArray dayMasks = paletteMasks.createNestedArray(DAY_KEYS[day]);
+        JsonArray dayDelays = delays.createNestedArray(DAY_KEYS[day]);
+        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+            dayLetters.add(symbolToken(dailyLetters[trigger][day]));
+            dayColors.add(static_cast<const char *>(dailyLetterColors[trigger][day]));
+            dayModes.add(letterColorModeValue(dailyLetterColorModes[trigger][day]));
+            dayMasks.add(dailyLetterRandomPaletteMasks[trigger][day]);
+            dayDelays.add(static_cast<unsigned long>(letter_trigger_delays[trigger][day]));
         }
-        document.querySelectorAll('.advanced-trigger-column').forEach(element => {
-            element.style.display = separate ? '' : 'none';
-        });
     }
 
-    function initializeTriggerEditMode() {
-        const delayCheckbox = document.getElementById('separate_trigger_editing');
-        const lettersCheckbox = document.getElementById('separate_trigger_editing_letters');
-        if (delayCheckbox) {
-            delayCheckbox.checked = false;
+    JsonObject display = root.createNestedObject("display");
+    display["brightness"] = display_brightness;
+    display["letter_time"] = letter_display_time;
+    display["auto_interval"] = letter_auto_display_interval;
+    display["auto_mode"] = autoDisplayMode;
+    display["random_symbol_pool"] = symbolPoolToText(random_symbol_pool);
+    display["rs485_address"] = rs485_box_address;
+
+    JsonObject activeWindow = root.createNestedObject("active_window");
+    activeWindow["start"] = formatMinutesAsTime(standalone_active_start_minutes);
+    activeWindow["end"] = formatMinutesAsTime(standalone_active_end_minutes);
+}
+
+// **Streamendes JSON-Update für POST /updateAllLetters**
+// Der Body-Callback reicht jedes empfangene Stück an den JsonStreamParser weiter; dessen Callback
+// prüft jeden Wert sofort und schreibt ihn in die parsed*-Matrizen. Weder der Rumpf noch ein
+// JSON-Dokument liegen je vollständig im RAM. Übernommen wird erst im Abschluss-Handler, wenn das
+// Dokument vollständig und gültig ist.
+enum LettersUpdateSection : uint8_t {
+    LettersUpdateLetters,
+    LettersUpdateColors,
+    LettersUpdateDelays,
+    LettersUpdateColorModes,
+    LettersUpdatePaletteMasks,
+    LettersUpdateSectionCount,
+    LettersUpdateNone = LettersUpdateSectionCount,
+};
+
+struct LettersUpdateSectionInfo {
+    const char *key;
+    const char *alias;       // ältere Schreibweise des Managers
+    const char *listError;   // + Wochentag
+    bool required;
+};
+
+constexpr LettersUpdateSectionInfo LETTERS_UPDATE_SECTIONS[LettersUpdateSectionCount] = {
+    {"letters", nullptr, "Ungültige Zeichenliste für Tag ", true},
+    {"colors", nullptr, "Ungültige Farbliste für Tag ", true},
+    {"delays", nullptr, "Ungültige Verzögerungsliste für Tag ", true},
+    {"color_modes", "colorModes", "Ungültige Farbmodus-Liste für Tag ", false},
+    {"color_palette_masks", "colorPaletteMasks", "Ungültige Zufallspalette für Tag ", false},
+};
+
+struct UpdateAllLettersContext {
+    JsonStreamParser parser;
+    size_t received;
+    bool overflow;
+    uint8_t section;        // gerade gelesener Abschnitt oder LettersUpdateNone
+    uint8_t day;            // gerade gelesenes Tages-Array oder NUM_DAYS
+    uint8_t daysSeen;       // Bit je Wochentag im aktuellen Abschnitt
+    uint8_t sectionsSeen;   // Bit je vollständig gelesenem Abschnitt
+    uint8_t primaryKeys;    // Bit je Abschnitt, der unter seinem Hauptschlüssel kam
+    char parsedLetters[NUM_TRIGGERS][NUM_DAYS];
+    char parsedColors[NUM_TRIGGERS][NUM_DAYS][COLOR_STRING_LENGTH];
+    uint8_t parsedColorModes[NUM_TRIGGERS][NUM_DAYS];
+    uint16_t parsedPaletteMasks[NUM_TRIGGERS][NUM_DAYS];
+    unsigned long parsedDelays[NUM_TRIGGERS][NUM_DAYS];
+    String validationMessage;
+};
+
+bool rejectLettersUpdate(UpdateAllLettersContext &context, const __FlashStringHelper *message, int trigger = -1,
+                         int day = -1) {
+    context.validationMessage = message;
+    if (trigger >= 0) {
+        context.validationMessage += String(trigger + 1);
+        context.validationMessage += F(" am Tag ");
+    }
+    if (day >= 0) {
+        context.validationMessage += DAY_KEYS[day];
+    }
+    return false;
+}
+
+bool rejectLettersUpdateList(UpdateAllLettersContext &context, uint8_t section, uint8_t day) {
+    context.validationMessage = LETTERS_UPDATE_SECTIONS[section].listError;
+    context.validationMessage += DAY_KEYS[day];
+    return false;
+}
+
+bool rejectLettersUpdateField(UpdateAllLettersContext &context, uint8_t section) {
+    context.validationMessage = F("JSON-Feld \"");
+    context.validationMessage += LETTERS_UPDATE_SECTIONS[section].key;
+    context.validationMessage += F("\" fehlt oder ist ungültig.");
+    return false;
+}
+
+bool beginLettersUpdateSection(UpdateAllLettersContext &context, const char *key, JsonStreamType type) {
+    context.section = LettersUpdateNone;
+    for (uint8_t section = 0; section < LettersUpdateSectionCount; ++section) {
+        const LettersUpdateSectionInfo &info = LETTERS_UPDATE_SECTIONS[section];
+        const bool primary = strcmp(key, info.key) == 0;
+        if (!primary && (info.alias == nullptr || strcmp(key, info.alias) != 0)) {
+            continue;
+        }
+        if (type != JsonStreamType::Object) {
+            if (!info.required) {
+                return true;
+            }
+            return rejectLettersUpdateField(context, section);
         }
-        if (lettersCheckbox) {
-            lettersCheckbox.checked = false;
+        // Kommt ein Abschnitt unter beiden Schlüsseln, gilt der Hauptschlüssel.
+        if (!primary && (context.primaryKeys & (1U << section)) != 0U) {
+            return true;
+        }
+        if (primary) {
+            context.primaryKeys |= static_cast<uint8_t>(1U << section);
         }
-        applyTriggerEditMode();
+        context.section = section;
+        context.daysSeen = 0;
+        return true;
     }
+    return true;
+}
 
-    function syncSharedTriggerFormFields() {
-        if (isSeparateTriggerEditingEnabled()) {
-            return;
+bool beginLettersUpdateDay(UpdateAllLettersContext &context, const char *key, JsonStreamType type) {
+    context.day = NUM_DAYS;
+    for (uint8_t day = 0; day < NUM_DAYS; ++day) {
+        if (strcmp(key, DAY_KEYS[day]) == 0) {
+            if (type != JsonStreamType::Array) {
+                return rejectLettersUpdateList(context, context.section, day);
+            }
+            context.day = day;
+            return true;
         }
+    }
+    return true;
+}
 
-        for (let day = 0; day < 7; day++) {
-            const sourceLetter = document.getElementById('letter_0_' + day);
-            const sourceColor = document.getElementById('color_0_' + day);
-            const sourceColorMode = document.getElementById('color_mode_0_' + day);
-            const sourceDelay = document.querySelector('input[name="delay_0_' + day + '"]');
-
-            for (let trigger = 1; trigger < 3; trigger++) {
-                const targetLetter = document.getElementById('letter_' + trigger + '_' + day);
-                const targetColor = document.getElementById('color_' + trigger + '_' + day);
-                const targetColorMode = document.getElementById('color_mode_' + trigger + '_' + day);
-                const targetDelay = document.querySelector('input[name="delay_' + trigger + '_' + day + '"]');
-
-                if (sourceLetter && targetLetter) {
-                    targetLetter.value = sourceLetter.value;
-                }
-                if (sourceColor && targetColor) {
-                    targetColor.value = sourceColor.value;
-                }
-                if (sourceColorMode && targetColorMode) {
-                    targetColorMode.value = sourceColorMode.value;
-                }
-                if (sourceDelay && targetDelay) {
-                    targetDelay.value = sourceDelay.value;
-                }
+bool storeLettersUpdateValue(UpdateAllLettersContext &context, size_t trigger, JsonStreamType type, const char *text) {
+    const uint8_t day = context.day;
+    if (trigger >= NUM_TRIGGERS) {
+        return rejectLettersUpdateList(context, context.section, day);
+    }
+    const bool isString = type == JsonStreamType::String && !jsonStreamTextTruncated(context.parser);
 
-                for (let paletteIndex = 0; paletteIndex < 8; paletteIndex++) {
-                    const sourcePalette = document.querySelector('input[name="palette_0_' + day + '_' + paletteIndex + '"]');
-                    const targetPalette = document.querySelector('input[name="palette_' + trigger + '_' + day + '_' + paletteIndex + '"]');
-                    if (sourcePalette && targetPalette) {
-                        targetPalette.checked = sourcePalette.checked;
-                    }
-                }
+    switch (context.section) {
+        case LettersUpdateLetters: {
+            if (type != JsonStreamType::String) {
+                return rejectLettersUpdate(context, F("Zeichen/Symbol fehlt für Trigger "), trigger, day);
             }
+            String letterValue = text;
+            letterValue.trim();
+            if (!isString || !parseSymbolToken(letterValue, context.parsedLetters[trigger][day])) {
+                return rejectLettersUpdate(context, F("Ungültiges Zeichen/Symbol für Trigger "), trigger, day);
+            }
+            return true;
+        }
+        case LettersUpdateColors: {
+            if (type != JsonStreamType::String) {
+                return rejectLettersUpdate(context, F("Farbe fehlt für Trigger "), trigger, day);
+            }
+            String colorValue = text;
+            colorValue.trim();
+            if (!isString || !isValidHexColorString(colorValue)) {
+                return rejectLettersUpdate(context, F("Ungültiger Farbwert für Trigger "), trigger, day);
+            }
+            colorValue.toUpperCase();
+            strncpy(context.parsedColors[trigger][day], colorValue.c_str(), COLOR_STRING_LENGTH);
+            context.parsedColors[trigger][day][COLOR_STRING_LENGTH - 1] = '\0';
+            return true;
         }
+        case LettersUpdateDelays:
+            if (jsonStreamTextTruncated(context.parser) ||
+                !parseDelayJsonValue(type, text, context.parsedDelays[trigger][day])) {
+                rejectLettersUpdate(context, F("Ungültige Verzögerung für Trigger "), trigger, day);
+                context.validationMessage += F(" (erlaubt: 0-999 Sekunden).");
+                return false;
+            }
+            return true;
+        case LettersUpdateColorModes:
+            if (!isString || !parseLetterColorModeValue(String(text), context.parsedColorModes[trigger][day])) {
+                return rejectLettersUpdate(context, F("Ungültiger Farbmodus für Trigger "), trigger, day);
+            }
+            return true;
+        case LettersUpdatePaletteMasks: {
+            if (type != JsonStreamType::Number || !isJsonIntegerText(text) || jsonStreamTextTruncated(context.parser)) {
+                return rejectLettersUpdate(context, F("Ungültige Zufallspalette für Trigger "), trigger, day);
+            }
+            const long maskValue = strtol(text, nullptr, 10);
+            if (maskValue < 0 || maskValue > 0xFFFFL) {
+                return rejectLettersUpdate(context, F("Zufallspalette außerhalb des gueltigen Bereichs."));
+            }
+            context.parsedPaletteMasks[trigger][day] = static_cast<uint16_t>(maskValue);
+            return true;
+        }
+        default:
+            return true;
     }
+}
 
-    // 🚀 Automatische Aktualisierung der Uhrzeit
-    let rtcInterval;
-    let memoryInterval;
+bool endLettersUpdateContainer(UpdateAllLettersContext &context, size_t depth) {
+    if (context.section == LettersUpdateNone) {
+        return true;
+    }
+    if (depth == 2 && context.day < NUM_DAYS) {
+        const uint8_t day = context.day;
+        context.day = NUM_DAYS;
+        if (jsonStreamCount(context.parser) != NUM_TRIGGERS) {
+            return rejectLettersUpdateList(context, context.section, day);
+        }
+        context.daysSeen |= static_cast<uint8_t>(1U << day);
+        return true;
+    }
+    if (depth == 1) {
+        const uint8_t section = context.section;
+        context.section = LettersUpdateNone;
+        for (uint8_t day = 0; day < NUM_DAYS; ++day) {
+            if ((context.daysSeen & (1U << day)) == 0U) {
+                return rejectLettersUpdateList(context, section, day);
+            }
+        }
+        context.sectionsSeen |= static_cast<uint8_t>(1U << section);
+    }
+    return true;
+}
 
-    function startRTCUpdates() {
-        rtcInterval = setInterval(fetchRTC, 5000); // Alle 5 Sekunden aktualisieren
-        memoryInterval = setInterval(fetchMemory, 5000);
+// Pfad: Wurzelobjekt / Abschnitt / Wochentag / Trigger-Index.
+bool onLettersUpdateJson(const JsonStreamParser &parser, JsonStreamEvent event, JsonStreamType type, void *user) {
+    UpdateAllLettersContext &context = *static_cast<UpdateAllLettersContext *>(user);
+    const size_t depth = jsonStreamDepth(parser);
+    if (event == JsonStreamEvent::End) {
+        return endLettersUpdateContainer(context, depth);
+    }
+    switch (depth) {
+        case 0:
+            return type == JsonStreamType::Object || rejectLettersUpdate(context, F("JSON-Payload fehlt."));
+        case 1:
+            return beginLettersUpdateSection(context, jsonStreamKey(parser, 0), type);
+        case 2:
+            return context.section == LettersUpdateNone ||
+                   beginLettersUpdateDay(context, jsonStreamKey(parser, 1), type);
+        case 3:
+            return context.section == LettersUpdateNone || context.day >= NUM_DAYS ||
+                   storeLettersUpdateValue(context, jsonStreamIndex(parser, 2), type, jsonStreamText(parser));
+        default:
+            return true;
     }
+}
 
-    function stopRTCUpdates() {
-        clearInterval(rtcInterval);
-        clearInterval(memoryInterval);
+void beginLettersUpdate(UpdateAllLettersContext &context) {
+    beginJsonStream(context.parser, onLettersUpdateJson, &context);
+    context.section = LettersUpdateNone;
+    context.day = NUM_DAYS;
+    uint16_t fullMask = 0;
+    for (size_t paletteIndex = 0; paletteIndex < RANDOM_COLOR_PALETTE_SIZE; ++paletteIndex) {
+        fullMask |= static_cast<uint16_t>(1U << paletteIndex);
     }
-
-    fetchRTC();
-    fetchMemory();
-    startRTCUpdates();
-
-    const dateInput = document.querySelector("input[name='date']");
-    const timeInput = document.querySelector("input[name='time']");
-
-    if (dateInput) {
-        dateInput.addEventListener('focus', stopRTCUpdates);
-        dateInput.addEventListener('blur', startRTCUpdates);
-    } else {
-        console.warn('⚠️ Datumseingabe nicht gefunden, automatische Aktualisierung bleibt aktiv.');
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        for (size_t day = 0; day < NUM_DAYS; ++day) {
+            context.parsedColorModes[trigger][day] = static_cast<uint8_t>(LetterColorMode::Fixed);
+            context.parsedPaletteMasks[trigger][day] = fullMask;
+        }
     }
+}
 
-    if (timeInput) {
-        timeInput.addEventListener('focus', stopRTCUpdates);
-        timeInput.addEventListener('blur', startRTCUpdates);
-    } else {
-        console.warn('⚠️ Uhrzeiteingabe nicht gefunden, automatische Aktualisierung bleibt aktiv.');
+// Abschluss nach dem letzten Stück: Syntax, Pflichtabschnitte und Zufallspaletten.
+bool finishLettersUpdate(UpdateAllLettersContext &context) {
+    if (!finishJsonStream(context.parser)) {
+        if (context.parser.error == JsonStreamError::EmptyInput) {
+            context.validationMessage = F("JSON-Nutzlast fehlt oder ist leer.");
+        } else if (context.parser.error != JsonStreamError::Aborted) {
+            context.validationMessage = F("JSON konnte nicht gelesen werden: ");
+            context.validationMessage += jsonStreamErrorText(context.parser.error);
+        }
+        return false;
     }
-
-    document.querySelectorAll('#wifiForm input[name="wifi_mode"]').forEach(input => {
-        input.addEventListener('change', updateWiFiModeFields);
-    });
-    const staticIpCheckbox = document.getElementById('wifi_static_ip_enabled');
-    if (staticIpCheckbox) {
-        staticIpCheckbox.addEventListener('change', toggleStaticIpFields);
+    for (uint8_t section = 0; section < LettersUpdateSectionCount; ++section) {
+        const LettersUpdateSectionInfo &info = LETTERS_UPDATE_SECTIONS[section];
+        if (info.required && (context.sectionsSeen & (1U << section)) == 0U) {
+            return rejectLettersUpdateField(context, section);
+        }
+    }
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        for (size_t day = 0; day < NUM_DAYS; ++day) {
+            if (context.parsedColorModes[trigger][day] == static_cast<uint8_t>(LetterColorMode::RandomSelected) &&
+                context.parsedPaletteMasks[trigger][day] == 0U) {
+                return rejectLettersUpdate(context, F("Zufall (ausgewaehlt) benoetigt mindestens eine Farbe."));
+            }
+        }
     }
-    updateWiFiModeFields();
-    toggleStaticIpFields();
+    return true;
+}
 
-    initializeTriggerEditMode();
-)rawliteral";
+} // namespace
 
 void setupWebServer() {
     DefaultHeaders::Instance().addHeader(F("Access-Control-Allow-Origin"), F("*"));
@@ -1015,284 +1488,34 @@ void setupWebServer() {
         request->send(200, F("application/json"), responseBody);
     });
 
+    // Die Seite wird abschnittsweise gestreamt; im Heap liegt nur der ConfigPageCursor (< 1 KB).
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
         if (!requireManagerAuth(request)) {
             return;
         }
         refreshWiFiIdleTimer(F("GET /"));
-        String html;
-        if (!html.reserve(24576)) {
+        std::shared_ptr<ConfigPageCursor> cursor(new (std::nothrow) ConfigPageCursor());
+        if (!cursor) {
             request->send(507, "text/plain; charset=utf-8", "Nicht genug Speicher für die Weboberfläche.");
             return;
         }
-        html = "<!doctype html><html lang='de'><head><meta charset='utf-8'><meta name='viewport' content='width=device-width,initial-scale=1'>";
-        html += "<style>body{font-family:sans-serif;max-width:980px;margin:0 auto;padding:12px;line-height:1.35}fieldset{margin:8px 0}input,select,button{margin:3px 2px;padding:4px}table{border-collapse:collapse;width:100%}td,th{padding:4px;border:1px solid #bbb}th{text-align:left;background:#f3f3f3}h1,h2{margin-bottom:6px}.muted{color:#555;font-size:.92em}</style>";
-        html += "</head><body><h1>RiddleMatrix Einstellungen</h1>";
-
-        // **WiFi-Einstellungen**
-        html += "<h2>WiFi Konfiguration</h2>";
-        html += "<form id='wifiForm'>";
-        html += "<table>";
-        html += "<tr><th>Hinweis</th><td>Standard bleibt: Box verbindet sich nur beim Start zur Verwaltung und schaltet WLAN nach Inaktivität wieder ab.</td></tr>";
-        html += "<tr><th>WLAN-Modus</th><td>";
-        html += "<label><input type='radio' name='wifi_mode' value='timed' ";
-        html += (wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::TimedManager) ? "checked" : "");
-        html += "> Standard: Manager/Hotspot zeitweise</label><br>";
-        html += "<label><input type='radio' name='wifi_mode' value='always' ";
-        html += (wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::AlwaysConnected) ? "checked" : "");
-        html += "> Dauerhaft mit bestehendem WLAN verbinden</label><br>";
-        html += "<label><input type='radio' name='wifi_mode' value='ap_sta' ";
-        html += (wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::StaWithLocalAp) ? "checked" : "");
-        html += "> AP+STA/Mesh-Kopie: WLAN verbinden und zusätzlichen Box-AP starten</label>";
-        html += "</td></tr>";
-        html += "<tr><th>Pflichtfelder</th><td>SSID und Hostname sind Pflichtfelder (mindestens 2 Zeichen), das Passwort ist optional.</td></tr>";
-        html += "<tr><th>Netzwerke</th><td><select id='wifiNetworkSelect' onchange='applySelectedWiFiNetwork()'><option value=''>Noch nicht gesucht</option></select> ";
-        html += "<button type='button' onclick='loadWiFiNetworks()'>WLAN suchen</button></td></tr>";
-        html += "<tr><th>SSID</th><td><input type='text' name='ssid' value='" + escapeHtml(String(wifi_ssid)) + "'></td></tr>";
-        html += "<tr><th>Passwort</th><td><input type='password' name='password' placeholder='Leer lassen, um es zu behalten'><br>";
-        html += "<label><input type='checkbox' id='password_remove' name='password_remove' value='on'> Passwort löschen</label>";
-        html += "<p style='margin-top:4px;'>Leer gelassenes Passwort ohne Haken lässt das bisherige Passwort unverändert.</p>";
-        html += "</td></tr>";
-        html += "<tr><th>Hostname</th><td><input type='text' name='hostname' value='" + escapeHtml(String(hostname)) + "'></td></tr>";
-        html += "<tr id='wifiSymbolField'><th>WiFi-Symbol</th><td><label><input type='checkbox' id='wifi_status_symbol_enabled' name='wifi_status_symbol_enabled' value='on' ";
-        html += (wifi_status_symbol_enabled ? "checked" : "");
-        html += "> Im Standardmodus anzeigen</label></td></tr>";
-        html += "</table>";
-        html += "<div id='persistentWifiFields' style='display:none; margin:8px 0;'>";
-        html += "<table><tr><th>Hinweis</th><td>In dauerhaften WLAN-Modi bleibt die Box online, reconnectet automatisch und zeigt kein WiFi-Symbol auf der Matrix.</td></tr>";
-        html += "<tr><th>IP-Modus</th><td><label><input type='checkbox' id='wifi_static_ip_enabled' name='wifi_static_ip_enabled' value='on' ";
-        html += (wifi_static_ip_enabled ? "checked" : "");
-        html += "> Statische IP verwenden</label></td></tr></table>";
-        html += "<div id='staticIpFields' style='display:none; margin:6px 0;'>";
-        html += "<table>";
-        html += "<tr><th>IP</th><td><input type='text' name='static_ip' value='" + escapeHtml(String(wifi_static_ip)) + "'></td></tr>";
-        html += "<tr><th>Gateway</th><td><input type='text' name='gateway' value='" + escapeHtml(String(wifi_gateway)) + "'></td></tr>";
-        html += "<tr><th>Subnetz</th><td><input type='text' name='subnet' value='" + escapeHtml(String(wifi_subnet)) + "'></td></tr>";
-        html += "<tr><th>DNS</th><td><input type='text' name='dns' value='" + escapeHtml(String(wifi_dns)) + "'></td></tr>";
-        html += "</table>";
-        html += "</div>";
-        html += "</div>";
-        html += "<div id='localApFields' style='display:none; margin:8px 0;'>";
-        html += "<table>";
-        html += "<tr><th>Hinweis</th><td>AP+STA startet einen lokalen Box-AP mit denselben Zugangsdaten wie das Ziel-WLAN, sofern hier nichts anderes eingetragen wird.</td></tr>";
-        html += "<tr><th>Lokale AP-SSID</th><td><input type='text' name='local_ap_ssid' value='" + escapeHtml(String(wifi_local_ap_ssid)) + "'></td></tr>";
-        html += "<tr><th>Lokales AP-Passwort</th><td><input type='password' name='local_ap_password' placeholder='Leer lassen = WLAN-Passwort übernehmen'></td></tr>";
-        html += "</table>";
-        html += "</div>";
-        html += "<button type='button' onclick='saveWiFi()'>Speichern</button>";
-        html += "</form>";
-        // **Anzeige-Einstellungen**
-        html += "<h2>Anzeige-Einstellungen</h2>";
-        html += "<form id='displayForm'>";
-        html += "<table>";
-        html += "<tr><th>Helligkeit</th><td><input type='number' name='brightness' min='1' max='255' value='" + escapeHtml(String(display_brightness)) + "'> <span class='muted'>1-255</span></td></tr>";
-        html += "<tr><th>Zufalls-Zeichen bei *</th><td><input type='text' name='random_symbol_pool' maxlength='39' value='" + escapeHtml(String(random_symbol_pool)) + "'></td></tr>";
-        html += "<tr><th>Automodus</th><td><label><input type='checkbox' id='auto_mode' name='auto_mode' " + String(autoDisplayMode ? "checked='checked'" : "") + "> aktivieren</label></td></tr>";
-        html += "<tr><th>Zeichen-Anzeigezeit</th><td><input type='number' name='letter_time' min='1' max='60' value='" + escapeHtml(String(letter_display_time)) + "'> <span class='muted'>Sekunden, 1-60</span></td></tr>";
-        html += "<tr><th>Automodus-Intervall</th><td><input type='number' name='auto_interval' min='30' max='600' value='" + escapeHtml(String(letter_auto_display_interval)) + "'> <span class='muted'>Sekunden, 30-600</span></td></tr>";
-        html += "<tr><th>Standalone aktiv</th><td>von <input type='time' name='active_start' value='" + escapeHtml(formatMinutesAsTime(standalone_active_start_minutes)) + "'> bis <input type='time' name='active_end' value='" + escapeHtml(formatMinutesAsTime(standalone_active_end_minutes)) + "'></td></tr>";
-        html += "<tr><th>Hinweis</th><td class='muted'>Aktivzeiten im Format HH:MM; gleicher Start- und Endwert bedeutet 24-Stunden-Betrieb.</td></tr>";
-        html += "</table>";
-        html += "<button type='button' onclick='saveDisplaySettings()'>Speichern</button>";
-        html += "</form>";
-
-        html += "<h2>Trigger-Verzögerungen pro Wochentag</h2>";
-        html += "<label><input type='checkbox' id='separate_trigger_editing' autocomplete='off' onchange='applyTriggerEditMode()'> Trigger 2 und 3 separat bearbeiten</label>";
-        html += "<p style='margin-top:4px;'>Ohne Haken werden die Werte von Trigger 1 beim Speichern auf alle Trigger kopiert.</p>";
-        html += "<form id='delaysForm'>";
-        html += "<table border='1' style='width:100%; text-align:center;'>";
-        html += "<tr><th>Wochentag</th>";
-        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-            String classAttribute = trigger == 0 ? "" : " class='advanced-trigger-column'";
-            html += "<th" + classAttribute + ">Trigger " + String(trigger + 1) + " (Sekunden)</th>";
-        }
-        html += "</tr>";
-
-        for (size_t day = 0; day < NUM_DAYS; ++day) {
-            html += "<tr>";
-            html += "<td>" + escapeHtml(String(daysOfTheWeek[day])) + "</td>";
-
-            for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                String fieldName = "delay_" + String(trigger) + "_" + String(day);
-                String classAttribute = trigger == 0 ? "" : " class='advanced-trigger-column'";
-                html += "<td" + classAttribute + "><input type='number' min='0' max='999' step='1' name='" + fieldName + "' value='" + escapeHtml(String(letter_trigger_delays[trigger][day])) + "'></td>";
-            }
-
-            html += "</tr>";
-        }
-
-        html += "</table>";
-        html += "<br><button type='button' onclick='saveTriggerDelays()'>Verzögerungen speichern</button>";
-        html += "</form>";
-
-        // **RTC-Zeit anzeigen & ändern**
-        html += "<h2>Datum &amp; Uhrzeit</h2>";
-        html += "<table><tr><th>Aktuelle Zeit</th><td><span id='rtcTime'>Laden...</span></td></tr>";
-        html += "<tr><th>Freier RAM</th><td><span id='memoryUsage'>Laden...</span> bytes</td></tr></table>";
-        html += "<form id='rtcForm'>";
-        html += "<table><tr><th>Datum</th><td><input type='date' name='date'></td></tr>";
-        html += "<tr><th>Uhrzeit</th><td><input type='time' name='time' step='1'></td></tr></table>";
-        html += "<button type='button' onclick='setRTC()'>Speichern</button>";
-        html += "</form>";
-        html += "<button type='button' onclick='syncNTP()'>Zeit mit NTP synchronisieren</button>";
-
-        html += "<h2>Schnellbearbeitung Zeichen &amp; Farben</h2>";
-        html += "<p class='muted'>Schnelle Änderungen direkt an der Box. Der große Zeicheneditor bleibt im RiddleMatrix-Manager.</p>";
-        html += "<label><input type='checkbox' id='separate_trigger_editing_letters' autocomplete='off' onchange='document.getElementById(\"separate_trigger_editing\").checked=this.checked; applyTriggerEditMode();'> Alle 3 Trigger separat anzeigen</label>";
-        html += "<form id='lettersForm'>";
-        const size_t displayDayOrder[NUM_DAYS] = {1, 2, 3, 4, 5, 6, 0};
-        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-            String tableClass = trigger == 0 ? "" : " class='advanced-trigger-column'";
-            html += "<table" + tableClass + " style='text-align:center; margin-top:8px;'><tr><th>Trigger " + String(trigger + 1) + "</th>";
-            for (size_t orderIndex = 0; orderIndex < NUM_DAYS; ++orderIndex) {
-                const size_t day = displayDayOrder[orderIndex];
-                html += "<th>" + escapeHtml(String(daysOfTheWeek[day])) + "</th>";
-            }
-            html += "</tr><tr><th>Zeichen</th>";
-            for (size_t orderIndex = 0; orderIndex < NUM_DAYS; ++orderIndex) {
-                const size_t day = displayDayOrder[orderIndex];
-                String selectId = "letter_" + String(trigger) + "_" + String(day);
-                html += "<td><select id='" + selectId + "' name='" + selectId + "'>";
-                for (size_t idx = 0; idx < sizeof(availableLetters); ++idx) {
-                    char optionChar = availableLetters[idx];
-                    const String optionValue = escapeHtml(String(optionChar));
-                    const String optionLabel = escapeHtml(getLetterOptionLabel(optionChar));
-                    html += "<option value='" + optionValue + "' ";
-                    html += (dailyLetters[trigger][day] == optionChar) ? "selected" : "";
-                    html += ">" + optionLabel + "</option>";
-                }
-                html += "</select></td>";
-            }
-            html += "</tr><tr><th>Farbe</th>";
-            for (size_t orderIndex = 0; orderIndex < NUM_DAYS; ++orderIndex) {
-                const size_t day = displayDayOrder[orderIndex];
-                String colorId = "color_" + String(trigger) + "_" + String(day);
-                String colorModeId = "color_mode_" + String(trigger) + "_" + String(day);
-                html += "<td><input type='color' id='" + colorId + "' name='" + colorId + "' value='" + escapeHtml(String(dailyLetterColors[trigger][day])) + "'>";
-                html += "<input type='hidden' id='" + colorModeId + "' name='" + colorModeId + "' value='fixed'></td>";
-            }
-            html += "</tr><tr><th>Anzeigen</th>";
-            for (size_t orderIndex = 0; orderIndex < NUM_DAYS; ++orderIndex) {
-                const size_t day = displayDayOrder[orderIndex];
-                String selectId = "letter_" + String(trigger) + "_" + String(day);
-                html += "<td><button type='button' onclick='displayLetter(" + String(trigger) + ", document.getElementById(\"" + selectId + "\").value)'>Trigger " + String(trigger + 1) + "</button>";
-                if (trigger == 0) {
-                    html += "<br><button type='button' onclick='displayDayTriggersSequential(" + String(day) + ")'>Alle</button>";
-                }
-                html += "</td>";
-            }
-            html += "</tr></table>";
-        }
-        html += "<br><button type='button' onclick='saveAllLetters()'>Zeichen &amp; Farben speichern</button>";
-        html += "</form>";
-
-        html += "<h2>Manueller Trigger</h2>";
-        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-            html += "<button type='button' style='margin-right:8px;' onclick='triggerLetter(" + String(trigger) + ")'>Trigger " + String(trigger + 1) + " auslösen</button>";
-        }
-        html += "<script src='/script.js'></script></body></html>";
-        request->send(200, "text/html; charset=utf-8", html);
-        return;
-
-#if 0
-        // **Zeichen-/Symbolauswahl pro Wochentag**
-        html += "<h2>Zeichen/Symbole pro Wochentag &amp; Trigger</h2>";
-        html += "<form id='lettersForm'>";
-        html += "<table border='1' style='width:100%; text-align:center;'>";
-        html += "<tr><th>Wochentag</th>";
-        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-            String classAttribute = trigger == 0 ? "" : " class='advanced-trigger-column'";
-            html += "<th" + classAttribute + ">Trigger " + String(trigger + 1) + "</th>";
-        }
-        html += "</tr>";
-
-        for (size_t day = 0; day < NUM_DAYS; ++day) {
-            html += "<tr>";
-            html += "<td>" + escapeHtml(String(daysOfTheWeek[day])) + "</td>";
-
-            for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                String selectId = "letter_" + String(trigger) + "_" + String(day);
-                String colorId = "color_" + String(trigger) + "_" + String(day);
-                String colorModeId = "color_mode_" + String(trigger) + "_" + String(day);
-                String classAttribute = trigger == 0 ? "" : " class='advanced-trigger-column'";
-                html += "<td" + classAttribute + ">";
-                html += "<select id='" + selectId + "' name='" + selectId + "'>";
-                for (size_t idx = 0; idx < sizeof(availableLetters); ++idx) {
-                    char optionChar = availableLetters[idx];
-                    const String optionValue = escapeHtml(String(optionChar));
-                    const String optionLabel = escapeHtml(getLetterOptionLabel(optionChar));
-                    html += "<option value='" + optionValue + "' ";
-                    html += (dailyLetters[trigger][day] == optionChar) ? "selected" : "";
-                    html += ">" + optionLabel + "</option>";
-                }
-                html += "</select>";
-                html += "<br><input type='color' id='" + colorId + "' name='" + colorId + "' value='" + escapeHtml(String(dailyLetterColors[trigger][day])) + "'>";
-                html += "<br><select id='" + colorModeId + "' name='" + colorModeId + "'>";
-                for (uint8_t modeValue = static_cast<uint8_t>(LetterColorMode::Fixed);
-                     modeValue <= static_cast<uint8_t>(LetterColorMode::RandomAll);
-                     ++modeValue) {
-                    html += "<option value='";
-                    if (modeValue == static_cast<uint8_t>(LetterColorMode::Fixed)) {
-                        html += "fixed";
-                    } else if (modeValue == static_cast<uint8_t>(LetterColorMode::RandomSelected)) {
-                        html += "random_selected";
-                    } else {
-                        html += "random_all";
-                    }
-                    html += "' ";
-                    if (dailyLetterColorModes[trigger][day] == modeValue) {
-                        html += "selected";
-                    }
-                    html += ">" + escapeHtml(getColorModeOptionLabel(modeValue)) + "</option>";
-                }
-                html += "</select>";
-                html += "<details style='margin-top:4px;'><summary>Zufallspalette</summary>";
-                for (size_t paletteIndex = 0; paletteIndex < RANDOM_COLOR_PALETTE_SIZE; ++paletteIndex) {
-                    String paletteField = "palette_" + String(trigger) + "_" + String(day) + "_" + String(paletteIndex);
-                    const bool paletteSelected =
-                        (dailyLetterRandomPaletteMasks[trigger][day] & static_cast<uint16_t>(1U << paletteIndex)) != 0U;
-                    html += "<label style='display:inline-block; margin:2px 6px 2px 0;'>";
-                    html += "<input type='checkbox' name='" + paletteField + "' value='1' ";
-                    if (paletteSelected) {
-                        html += "checked";
-                    }
-                    html += ">";
-                    html += "<span style='display:inline-block; width:10px; height:10px; border:1px solid #333; background:";
-                    html += escapeHtml(String(randomColorPalette[paletteIndex]));
-                    html += "; margin:0 4px;'></span>";
-                    html += escapeHtml(String(randomColorPaletteLabels[paletteIndex]));
-                    html += "</label>";
-                }
-                html += "</details>";
-                html += "<br><button type='button' onclick='displayLetter(" + String(trigger) + ", document.getElementById(\"" + selectId + "\").value)'>Anzeigen</button>";
-                html += "<br><button type='button' onclick='triggerLetter(" + String(trigger) + ")'>Triggern</button>";
-                html += "</td>";
-            }
-
-            html += "</tr>";
-        }
-
-        html += "</table>";
-        html += "<br><button type='button' onclick='saveAllLetters()'>Alle speichern</button>";
-        html += "</form>";
-
-        html += "<h2>Zeichen/Symbole bearbeiten</h2>";
-        html += "<p>Der grosse Zeichen-/Symbol-Editor laeuft im RiddleMatrix-Manager. Die Box-Firmware stellt hier nur die kompakten Anzeige- und Triggerfunktionen bereit, damit die Weboberflaeche auch auf ESP8266 stabil bleibt.</p>";
-        // **Manuellen Trigger starten**
-        html += "<h2>Manueller Trigger</h2>";
-        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-            html += "<button type='button' style='margin-right:8px;' onclick='triggerLetter(" + String(trigger) + ")'>Trigger " + String(trigger + 1) + " auslösen</button>";
-        }
-
-        // **JavaScript-Datei einbinden**
-        html += "<script src='/script.js'></script>";
-        request->send(200, "text/html", html);
-#endif
+        readCustomSymbolFlags(cursor->customSymbolFlags);
+        AsyncWebServerResponse *response = request->beginChunkedResponse("text/html; charset=utf-8",
+            [cursor](uint8_t *buffer, size_t maxLength, size_t) -> size_t {
+                return fillConfigPageStream(*cursor, buffer, maxLength);
+            });
+        request->send(response);
     });
 
     server.on("/script.js", HTTP_GET, [](AsyncWebServerRequest *request) {
         refreshWiFiIdleTimer(F("GET /script.js"));
-        request->send_P(200, "text/javascript; charset=utf-8", scriptJS);
+        sendWebAsset(request, "text/javascript; charset=utf-8", WEB_ASSET_SCRIPT_JS_GZ, WEB_ASSET_SCRIPT_JS_GZ_LENGTH,
+                     "\"" WEB_ASSET_SCRIPT_JS_HASH "\"");
+    });
+
+    server.on("/style.css", HTTP_GET, [](AsyncWebServerRequest *request) {
+        sendWebAsset(request, "text/css; charset=utf-8", WEB_ASSET_STYLE_CSS_GZ, WEB_ASSET_STYLE_CSS_GZ_LENGTH,
+                     "\"" WEB_ASSET_STYLE_CSS_HASH "\"");
     });
 
     server.on("/scanWiFi", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -1324,6 +1547,46 @@ void setupWebServer() {
         request->send(200, F("application/json"), responseBody);
     });
 
+    // Protokollabruf ist keine Nutzerinteraktion und verlängert den WLAN-Timeout daher nicht.
+    server.on("/api/logs", HTTP_GET, [](AsyncWebServerRequest *request) {
+        if (!requireManagerAuth(request)) {
+            return;
+        }
+        unsigned long since = 0;
+        if (request->hasParam(F("since")) &&
+            !parseUnsignedLongInRange(request->getParam(F("since"))->value(), 0UL, 0xFFFFFFFFUL, since)) {
+            request->send(400, F("text/plain"), F("ungueltiges since"));
+            return;
+        }
+
+        std::shared_ptr<LogStreamCursor> cursor(new (std::nothrow) LogStreamCursor());
+        if (!cursor) {
+            request->send(507, F("text/plain"), F("Nicht genug Speicher."));
+            return;
+        }
+        cursor->endSequence = getLogNextSequence();
+        cursor->nextSequence = std::max(static_cast<uint32_t>(since), getLogOldestSequence());
+        AsyncWebServerResponse *response = request->beginChunkedResponse(F("application/json"),
+            [cursor](uint8_t *buffer, size_t maxLength, size_t) -> size_t {
+                return fillLogStream(*cursor, buffer, maxLength);
+            });
+        response->addHeader(F("Cache-Control"), F("no-store"));
+        request->send(response);
+    });
+
+    // Schreibt verzögert gesammelte Änderungen sofort ins EEPROM (z. B. vor dem Abschalten).
+    server.on("/api/flush", HTTP_POST, [](AsyncWebServerRequest *request) {
+        if (!requireManagerAuth(request)) {
+            return;
+        }
+        refreshWiFiIdleTimer(F("POST /api/flush"));
+        if (flushConfig()) {
+            sendJsonStatus(request, 200, "ok", F("Einstellungen gespeichert."));
+        } else {
+            sendJsonStatus(request, 200, "ok", F("Keine ungespeicherten Änderungen."));
+        }
+    });
+
     server.on("/api/custom-symbol", HTTP_GET, [](AsyncWebServerRequest *request) {
         if (!requireManagerAuth(request)) {
             return;
@@ -1341,10 +1604,13 @@ void setupWebServer() {
             return;
         }
 
+        alignas(4) uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+        bool enabled = false;
+        const bool stored = readCustomSymbol(customSymbolFromId(static_cast<size_t>(slot)), bitmap, enabled);
         StaticJsonDocument<384> responseDoc;
         responseDoc["slot"] = slot;
-        responseDoc["enabled"] = customSymbolEnabled[slot] == 1;
-        responseDoc["bitmap"] = bitmapToHex(customSymbolBitmaps[slot]);
+        responseDoc["enabled"] = enabled;
+        responseDoc["bitmap"] = bitmapToHex(ramSymbolView(stored ? bitmap : nullptr));
         String responseBody;
         serializeJson(responseDoc, responseBody);
         request->send(200, F("application/json"), responseBody);
@@ -1360,39 +1626,40 @@ void setupWebServer() {
             return;
         }
 
-        const String charValue = request->getParam(F("char"))->value();
-        if (charValue.length() != 1 || charValue[0] == '*' || !isSupportedLetter(charValue[0])) {
+        char symbol = '\0';
+        if (!parseSymbolToken(request->getParam(F("char"))->value(), symbol) || symbol == '*') {
             request->send(400, F("text/plain"), F("ungueltiges Zeichen/Symbol"));
             return;
         }
 
-        const char symbol = charValue[0];
         StaticJsonDocument<1536> responseDoc;
-        responseDoc["char"] = charValue;
+        responseDoc["char"] = symbolToken(symbol);
         responseDoc["label"] = getLetterOptionLabel(symbol);
 
-        const int customSlot = customSymbolIndexFromChar(symbol);
-        if (customSlot >= 0) {
+        if (isCustomSymbol(symbol)) {
+            alignas(4) uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+            bool enabled = false;
+            const bool stored = readCustomSymbol(symbol, bitmap, enabled);
             responseDoc["builtin"] = false;
-            responseDoc["enabled"] = customSymbolEnabled[customSlot] == 1;
-            responseDoc["bitmap"] = bitmapToHex(customSymbolBitmaps[customSlot]);
+            responseDoc["id"] = customSymbolId(symbol);
+            responseDoc["enabled"] = enabled;
+            responseDoc["bitmap"] = bitmapToHex(ramSymbolView(stored ? bitmap : nullptr));
         } else {
-            uint8_t bitmap[SYMBOL_BITMAP_SIZE] = {};
-            const int builtinIndex = editableBuiltinSymbolIndexFromChar(symbol);
-            const bool overrideEnabled =
-                builtinIndex >= 0 && editableBuiltinSymbolEnabled[builtinIndex] == 1 &&
-                getEditableBuiltinSymbolBitmap(symbol, bitmap);
-            if (!overrideEnabled && !getDefaultBuiltinSymbolBitmap(symbol, bitmap)) {
+            const SymbolView overrideView = ramSymbolView(findEditableBuiltinSymbolBitmap(symbol));
+            const SymbolView defaultView = progmemSymbolView(getFactorySymbolBitmap(symbol));
+            if (!overrideView && !defaultView) {
                 request->send(404, F("text/plain"), F("kein Bitmap-Default gefunden"));
                 return;
             }
-            uint8_t defaultBitmap[SYMBOL_BITMAP_SIZE] = {};
-            getDefaultBuiltinSymbolBitmap(symbol, defaultBitmap);
             responseDoc["builtin"] = true;
-            responseDoc["enabled"] = overrideEnabled;
-            responseDoc["bitmap"] = bitmapToHex(bitmap);
-            responseDoc["defaultBitmap"] = bitmapToHex(defaultBitmap);
+            responseDoc["enabled"] = static_cast<bool>(overrideView);
+            responseDoc["bitmap"] = bitmapToHex(overrideView ? overrideView : defaultView);
+            responseDoc["defaultBitmap"] = bitmapToHex(defaultView);
         }
+        const SymbolCacheStats &cacheStats = getSymbolCacheStats();
+        JsonObject cache = responseDoc.createNestedObject("cache");
+        cache["hits"] = cacheStats.hits;
+        cache["misses"] = cacheStats.misses;
 
         String responseBody;
         serializeJson(responseDoc, responseBody);
@@ -1409,22 +1676,21 @@ void setupWebServer() {
             return;
         }
 
-        const String charValue = request->getParam(F("char"), true)->value();
-        if (charValue.length() != 1 || charValue[0] == '*' || !isSupportedLetter(charValue[0])) {
+        char symbol = '\0';
+        if (!parseSymbolToken(request->getParam(F("char"), true)->value(), symbol) || symbol == '*') {
             request->send(400, F("text/plain"), F("ungueltiges Zeichen/Symbol"));
             return;
         }
 
-        const char symbol = charValue[0];
         const bool clearRequested =
             request->hasParam(F("clear"), true) && request->getParam(F("clear"), true)->value() == F("1");
-        const int customSlot = customSymbolIndexFromChar(symbol);
 
         if (clearRequested) {
-            if (customSlot >= 0) {
-                memset(customSymbolBitmaps[customSlot], 0, SYMBOL_BITMAP_SIZE);
-                customSymbolEnabled[customSlot] = 0;
-                saveConfig();
+            if (isCustomSymbol(symbol)) {
+                if (!clearCustomSymbol(symbol)) {
+                    request->send(500, F("text/plain"), F("Zusatz-Zeichen konnte nicht geleert werden."));
+                    return;
+                }
                 request->send(200, F("text/plain"), F("Zusatz-Zeichen geleert."));
                 return;
             }
@@ -1450,10 +1716,11 @@ void setupWebServer() {
         const bool enabled =
             request->hasParam(F("enabled"), true) && request->getParam(F("enabled"), true)->value() == F("1");
 
-        if (customSlot >= 0) {
-            memcpy(customSymbolBitmaps[customSlot], parsedBitmap, SYMBOL_BITMAP_SIZE);
-            customSymbolEnabled[customSlot] = enabled ? 1 : 0;
-            saveConfig();
+        if (isCustomSymbol(symbol)) {
+            if (!saveCustomSymbol(symbol, parsedBitmap, enabled)) {
+                request->send(500, F("text/plain"), F("Zusatz-Zeichen konnte nicht gespeichert werden."));
+                return;
+            }
             request->send(200, F("text/plain"), F("Zusatz-Zeichen gespeichert."));
             return;
         }
@@ -1465,6 +1732,91 @@ void setupWebServer() {
         request->send(200, F("text/plain"), F("Zeichen/Symbol gespeichert."));
     });
 
+    server.on(
+        "/api/symbols/bulk",
+        HTTP_POST,
+        [](AsyncWebServerRequest *request) {
+            std::unique_ptr<SymbolBulkUploadContext> context(
+                static_cast<SymbolBulkUploadContext *>(request->_tempObject));
+            request->_tempObject = nullptr;
+            if (!requireManagerAuth(request)) {
+                releaseSymbolBulkUpload(request);
+                return;
+            }
+            refreshWiFiIdleTimer(F("POST /api/symbols/bulk"));
+
+            if (!context || context->state == SymbolBulkState::BadLength || context->fill != 0) {
+                releaseSymbolBulkUpload(request);
+                sendJsonStatus(request, 400, "error",
+                               F("Rumpf muss aus 1 bis 94 Records zu je 130 Bytes bestehen."));
+                return;
+            }
+            if (context->state == SymbolBulkState::Busy) {
+                sendJsonStatus(request, 409, "error", F("Es läuft bereits ein Sammel-Upload."));
+                return;
+            }
+            if (context->state == SymbolBulkState::NoStorage) {
+                sendJsonStatus(request, 507, "error", F("Kein Platz für die Kopie des Symbol-Pakets."));
+                return;
+            }
+
+            symbolBulkOwner = nullptr;
+            if (!commitSymbolBatch()) {
+                sendJsonStatus(request, 500, "error", F("Symbol-Paket konnte nicht ersetzt werden."));
+                return;
+            }
+            LOG_INFO(WEB, "📦 Sammel-Upload: %u von %u Symbolen übernommen.", static_cast<unsigned>(context->stored),
+                     static_cast<unsigned>(context->records));
+
+            StaticJsonDocument<256> responseDoc;
+            responseDoc["status"] = "ok";
+            responseDoc["records"] = context->records;
+            responseDoc["stored"] = context->stored;
+            responseDoc["result"] = symbolBulkResultHex(*context);
+            String responseBody;
+            serializeJson(responseDoc, responseBody);
+            request->send(200, F("application/json"), responseBody);
+        },
+        nullptr,
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            SymbolBulkUploadContext *context = static_cast<SymbolBulkUploadContext *>(request->_tempObject);
+            if (index == 0 && context == nullptr) {
+                context = new (std::nothrow) SymbolBulkUploadContext();
+                if (context == nullptr) {
+                    return;
+                }
+                request->_tempObject = context;
+                if (!isManagerAuthorized(request)) {
+                    context->state = SymbolBulkState::Unauthorized;
+                } else if (total == 0 || total % SYMBOL_BULK_RECORD_SIZE != 0 ||
+                           total / SYMBOL_BULK_RECORD_SIZE > SYMBOL_BULK_MAX_RECORDS) {
+                    context->state = SymbolBulkState::BadLength;
+                } else if (symbolBulkOwner != nullptr) {
+                    context->state = SymbolBulkState::Busy;
+                } else if (!beginSymbolBatch()) {
+                    context->state = SymbolBulkState::NoStorage;
+                } else {
+                    symbolBulkOwner = request;
+                    request->onDisconnect([request]() { releaseSymbolBulkUpload(request); });
+                }
+            }
+            if (context == nullptr || context->state != SymbolBulkState::Receiving) {
+                return;
+            }
+
+            while (len > 0) {
+                const size_t take = std::min(len, SYMBOL_BULK_RECORD_SIZE - context->fill);
+                memcpy(context->record + context->fill, data, take);
+                context->fill += take;
+                data += take;
+                len -= take;
+                if (context->fill == SYMBOL_BULK_RECORD_SIZE) {
+                    applySymbolBulkRecord(*context);
+                    context->fill = 0;
+                }
+            }
+        });
+
     server.on("/api/custom-symbol", HTTP_POST, [](AsyncWebServerRequest *request) {
         if (!requireManagerAuth(request)) {
             return;
@@ -1487,12 +1839,12 @@ void setupWebServer() {
             return;
         }
 
-        memcpy(customSymbolBitmaps[slot], parsedBitmap, SYMBOL_BITMAP_SIZE);
-        customSymbolEnabled[slot] =
-            request->hasParam(F("enabled"), true) && request->getParam(F("enabled"), true)->value() == F("1")
-                ? 1
-                : 0;
-        saveConfig();
+        const bool enabled =
+            request->hasParam(F("enabled"), true) && request->getParam(F("enabled"), true)->value() == F("1");
+        if (!saveCustomSymbol(customSymbolFromId(static_cast<size_t>(slot)), parsedBitmap, enabled)) {
+            request->send(500, F("text/plain"), F("Symbol konnte nicht gespeichert werden."));
+            return;
+        }
         request->send(200, F("text/plain"), F("Symbol gespeichert."));
     });
 
@@ -1647,7 +1999,7 @@ void setupWebServer() {
                 for (size_t idx = 0; idx < sizeof(wifi_password); ++idx) {
                     wifi_password[idx] = '\0';
                 }
-                Serial.println(F("[WebManager] WLAN-Passwort zurückgesetzt."));
+                LOG_INFO(WEB, "WLAN-Passwort zurückgesetzt.");
                 passwordCleared = true;
             } else {
                 passwordUnchanged = true;
@@ -1682,7 +2034,8 @@ void setupWebServer() {
             copyWithTermination(localApSsidToStore, wifi_local_ap_ssid, sizeof(wifi_local_ap_ssid));
             copyWithTermination(localApPasswordToStore, wifi_local_ap_password, sizeof(wifi_local_ap_password));
 
-            saveConfig();
+            // Sofort speichern: auf diese Antwort folgt meist ein Neustart der Box.
+            saveConfig(CONFIG_SECTION_WIFI);
 
             String response = "✅ WiFi-Einstellungen gespeichert!";
             if (ssidTruncated) {
@@ -1741,7 +2094,14 @@ void setupWebServer() {
         const AsyncWebParameter *activeEndParam = request->getParam("active_end", true);
         const String randomPoolParam = request->hasParam("random_symbol_pool", true)
             ? request->getParam("random_symbol_pool", true)->value()
-            : String(random_symbol_pool);
+            : symbolPoolToText(random_symbol_pool);
+
+        unsigned long rs485AddressCandidate = rs485_box_address;
+        if (request->hasParam("rs485_address", true) &&
+            !parseUnsignedLongInRange(request->getParam("rs485_address", true)->value(), 0UL, RS485_MAX_BOX_ADDRESS, rs485AddressCandidate)) {
+            request->send(400, "text/plain", "❌ Fehler: rs485_address muss eine Ganzzahl zwischen 0 und 254 sein.");
+            return;
+        }
 
         long brightnessCandidate = 0;
         if (!parseSignedLongInRange(brightnessParam->value(), 1L, 255L, brightnessCandidate)) {
@@ -1793,12 +2153,11 @@ void setupWebServer() {
 
         char randomPoolCandidate[RANDOM_SYMBOL_POOL_LENGTH] = {};
         size_t randomPoolWriteIndex = 0;
-        for (size_t index = 0; index < randomPoolParam.length() && randomPoolWriteIndex < RANDOM_SYMBOL_POOL_LENGTH - 1; ++index) {
-            char current = static_cast<char>(std::toupper(static_cast<unsigned char>(randomPoolParam.charAt(index))));
-            if (current == '*') {
-                continue;
-            }
-            if (!isSupportedLetter(current)) {
+        for (size_t index = 0; index < randomPoolParam.length() && randomPoolWriteIndex < RANDOM_SYMBOL_POOL_LENGTH - 1;) {
+            char current = '\0';
+            const size_t tokenLength = parseSymbolTokenAt(randomPoolParam, index, current);
+            index += tokenLength != 0 ? tokenLength : 1;
+            if (tokenLength == 0 || current == '*') {
                 continue;
             }
             bool duplicate = false;
@@ -1826,13 +2185,15 @@ void setupWebServer() {
         letter_auto_display_interval = autoIntervalCandidate;
         standalone_active_start_minutes = activeStartCandidate;
         standalone_active_end_minutes = activeEndCandidate;
+        requestClockEventCheck();
         strncpy(random_symbol_pool, randomPoolCandidate, sizeof(random_symbol_pool));
         random_symbol_pool[sizeof(random_symbol_pool) - 1] = '\0';
+        rs485_box_address = static_cast<uint8_t>(rs485AddressCandidate);
         if (autoModeProvided) {
             autoDisplayMode = autoModeCandidate;
         }
 
-        saveConfig();
+        markConfigDirty(CONFIG_SECTION_DISPLAY);
 
         String responseMessage = F("✅ Anzeigeeinstellungen gespeichert!");
         if (autoModeProvided) {
@@ -1910,7 +2271,7 @@ void setupWebServer() {
                 }
             }
 
-            saveConfig();
+            markConfigDirty(CONFIG_SECTION_TRIGGER_DELAYS);
             request->send(200, "text/plain", "✅ Verzögerungsmatrix gespeichert!");
         } else {
             request->send(400, "text/plain", "❌ Fehler: Ungültige oder fehlende Verzögerungswerte!");
@@ -1938,6 +2299,31 @@ void setupWebServer() {
         request->send(response);
     });
 
+    // Ersetzt für den Manager das Auslesen der Startseite (ca. 1 KB statt über 30 KB HTML).
+    server.on("/api/state", HTTP_GET, [](AsyncWebServerRequest *request) {
+        if (!requireManagerAuth(request)) {
+            return;
+        }
+        refreshWiFiIdleTimer(F("GET /api/state"));
+        DynamicJsonDocument stateDoc(BOX_STATE_JSON_CAPACITY);
+        if (stateDoc.capacity() == 0) {
+            request->send(507, "text/plain; charset=utf-8", "Nicht genug Speicher für den Box-Zustand.");
+            return;
+        }
+        writeBoxState(stateDoc.to<JsonObject>());
+        if (stateDoc.overflowed()) {
+            LOG_ERROR(WEB, "❌ Box-Zustand passt nicht in %u Bytes.", static_cast<unsigned>(BOX_STATE_JSON_CAPACITY));
+            sendJsonStatus(request, 500, "error", F("Box-Zustand unvollständig."));
+            return;
+        }
+
+        String responseBody;
+        serializeJson(stateDoc, responseBody);
+        AsyncWebServerResponse *response = request->beginResponse(200, F("application/json"), responseBody);
+        response->addHeader("Cache-Control", "no-store, no-cache, must-revalidate");
+        request->send(response);
+    });
+
     server.on(
         "/updateAllLetters",
         HTTP_POST,
@@ -1958,14 +2344,14 @@ void setupWebServer() {
 
             if (isJsonRequest(request)) {
                 if (context == nullptr) {
-                    Serial.println(F("❌ JSON-Update fehlgeschlagen: Keine Nutzlast empfangen."));
+                    LOG_WARN(WEB, "❌ JSON-Update fehlgeschlagen: Keine Nutzlast empfangen.");
                     sendJsonStatus(request, 400, "error", F("JSON-Nutzlast fehlt oder konnte nicht gelesen werden."));
                     cleanup();
                     return;
                 }
 
                 if (context->overflow) {
-                    Serial.println(F("❌ JSON-Update fehlgeschlagen: Nutzlast überschreitet Limit."));
+                    LOG_WARN(WEB, "❌ JSON-Update fehlgeschlagen: Nutzlast überschreitet Limit.");
                     String overflowMessage = F("JSON-Nutzlast überschreitet die zulässige Größe von ");
                     overflowMessage += static_cast<unsigned long>(MAX_JSON_BODY_SIZE);
                     overflowMessage += F(" Bytes.");
@@ -1974,284 +2360,27 @@ void setupWebServer() {
                     return;
                 }
 
-                if (context->body.isEmpty()) {
-                    Serial.println(F("❌ JSON-Update fehlgeschlagen: Leerer Request-Body."));
-                    sendJsonStatus(request, 400, "error", F("JSON-Nutzlast fehlt oder ist leer."));
-                    cleanup();
-                    return;
-                }
-
-                DynamicJsonDocument doc(UPDATE_JSON_CAPACITY);
-                DeserializationError jsonError = deserializeJson(doc, context->body);
-                if (jsonError) {
-                    String errorMessage = F("JSON konnte nicht gelesen werden: ");
-                    errorMessage += jsonError.c_str();
-                    Serial.println(String(F("❌ JSON-Parsing fehlgeschlagen: ")) + jsonError.c_str());
-                    sendJsonStatus(request, 400, "error", errorMessage);
-                    cleanup();
-                    return;
-                }
-
-                JsonObjectConst payload = doc.as<JsonObjectConst>();
-                if (payload.isNull()) {
-                    Serial.println(F("❌ JSON-Update fehlgeschlagen: Payload fehlt."));
-                    sendJsonStatus(request, 400, "error", F("JSON-Payload fehlt."));
-                    cleanup();
-                    return;
-                }
-
-                char parsedLetters[NUM_TRIGGERS][NUM_DAYS];
-                char parsedColors[NUM_TRIGGERS][NUM_DAYS][COLOR_STRING_LENGTH];
-                uint8_t parsedColorModes[NUM_TRIGGERS][NUM_DAYS];
-                uint16_t parsedPaletteMasks[NUM_TRIGGERS][NUM_DAYS];
-                unsigned long parsedDelays[NUM_TRIGGERS][NUM_DAYS];
-
-                for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                    for (size_t day = 0; day < NUM_DAYS; ++day) {
-                        parsedColorModes[trigger][day] = static_cast<uint8_t>(LetterColorMode::Fixed);
-                        uint16_t fullMask = 0;
-                        for (size_t paletteIndex = 0; paletteIndex < RANDOM_COLOR_PALETTE_SIZE; ++paletteIndex) {
-                            fullMask |= static_cast<uint16_t>(1U << paletteIndex);
-                        }
-                        parsedPaletteMasks[trigger][day] = fullMask;
-                    }
-                }
-
-                bool validationFailed = false;
-                String validationMessage;
-
-                JsonObjectConst lettersObject = payload["letters"].as<JsonObjectConst>();
-                if (lettersObject.isNull()) {
-                    validationFailed = true;
-                    validationMessage = F("JSON-Feld \"letters\" fehlt oder ist ungültig.");
-                } else {
-                    for (size_t day = 0; day < NUM_DAYS && !validationFailed; ++day) {
-                        JsonArrayConst dayLetters = lettersObject[DAY_KEYS[day]].as<JsonArrayConst>();
-                        if (dayLetters.isNull() || dayLetters.size() != NUM_TRIGGERS) {
-                            validationFailed = true;
-                            validationMessage = F("Ungültige Zeichenliste für Tag ");
-                            validationMessage += DAY_KEYS[day];
-                            break;
-                        }
-
-                        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                            JsonVariantConst letterVariant = dayLetters[trigger];
-                            const char *letterRaw = letterVariant.as<const char *>();
-                            if (letterRaw == nullptr) {
-                                validationFailed = true;
-                                validationMessage = F("Zeichen/Symbol fehlt für Trigger ");
-                                validationMessage += String(trigger + 1);
-                                validationMessage += F(" am Tag ");
-                                validationMessage += DAY_KEYS[day];
-                                break;
-                            }
-
-                            String letterValue = letterRaw;
-                            letterValue.trim();
-                            if (letterValue.length() != 1) {
-                                validationFailed = true;
-                                validationMessage = F("Auswahl muss genau ein Zeichen/Symbol besitzen (Tag ");
-                                validationMessage += DAY_KEYS[day];
-                                validationMessage += F(", Trigger ");
-                                validationMessage += String(trigger + 1);
-                                validationMessage += F(").");
-                                break;
-                            }
-
-                            const char letterChar = letterValue.charAt(0);
-                            if (!isSupportedLetter(letterChar)) {
-                                validationFailed = true;
-                                validationMessage = F("Ungültiges Zeichen/Symbol für Trigger ");
-                                validationMessage += String(trigger + 1);
-                                validationMessage += F(" am Tag ");
-                                validationMessage += DAY_KEYS[day];
-                                break;
-                            }
-
-                            parsedLetters[trigger][day] = letterChar;
-                        }
-                    }
-                }
-
-                JsonObjectConst colorsObject = payload["colors"].as<JsonObjectConst>();
-                if (!validationFailed) {
-                    if (colorsObject.isNull()) {
-                        validationFailed = true;
-                        validationMessage = F("JSON-Feld \"colors\" fehlt oder ist ungültig.");
-                    } else {
-                        for (size_t day = 0; day < NUM_DAYS && !validationFailed; ++day) {
-                            JsonArrayConst dayColors = colorsObject[DAY_KEYS[day]].as<JsonArrayConst>();
-                            if (dayColors.isNull() || dayColors.size() != NUM_TRIGGERS) {
-                                validationFailed = true;
-                                validationMessage = F("Ungültige Farbliste für Tag ");
-                                validationMessage += DAY_KEYS[day];
-                                break;
-                            }
-
-                            for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                                JsonVariantConst colorVariant = dayColors[trigger];
-                                const char *colorRaw = colorVariant.as<const char *>();
-                                if (colorRaw == nullptr) {
-                                    validationFailed = true;
-                                    validationMessage = F("Farbe fehlt für Trigger ");
-                                    validationMessage += String(trigger + 1);
-                                    validationMessage += F(" am Tag ");
-                                    validationMessage += DAY_KEYS[day];
-                                    break;
-                                }
-
-                                String colorValue = colorRaw;
-                                colorValue.trim();
-                                if (!isValidHexColorString(colorValue)) {
-                                    validationFailed = true;
-                                    validationMessage = F("Ungültiger Farbwert für Trigger ");
-                                    validationMessage += String(trigger + 1);
-                                    validationMessage += F(" am Tag ");
-                                    validationMessage += DAY_KEYS[day];
-                                    break;
-                                }
-
-                                colorValue.toUpperCase();
-                                strncpy(parsedColors[trigger][day], colorValue.c_str(), COLOR_STRING_LENGTH);
-                                parsedColors[trigger][day][COLOR_STRING_LENGTH - 1] = '\0';
-                            }
-                        }
-                    }
-                }
-
-                JsonObjectConst delaysObject = payload["delays"].as<JsonObjectConst>();
-                if (!validationFailed) {
-                    if (delaysObject.isNull()) {
-                        validationFailed = true;
-                        validationMessage = F("JSON-Feld \"delays\" fehlt oder ist ungültig.");
-                    } else {
-                        for (size_t day = 0; day < NUM_DAYS && !validationFailed; ++day) {
-                            JsonArrayConst dayDelays = delaysObject[DAY_KEYS[day]].as<JsonArrayConst>();
-                            if (dayDelays.isNull() || dayDelays.size() != NUM_TRIGGERS) {
-                                validationFailed = true;
-                                validationMessage = F("Ungültige Verzögerungsliste für Tag ");
-                                validationMessage += DAY_KEYS[day];
-                                break;
-                            }
-
-                            for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                                unsigned long parsedDelay = 0;
-                                if (!parseDelayJsonVariant(dayDelays[trigger], parsedDelay)) {
-                                    validationFailed = true;
-                                    validationMessage = F("Ungültige Verzögerung für Trigger ");
-                                    validationMessage += String(trigger + 1);
-                                    validationMessage += F(" am Tag ");
-                                    validationMessage += DAY_KEYS[day];
-                                    validationMessage += F(" (erlaubt: 0-999 Sekunden).");
-                                    break;
-                                }
-                                parsedDelays[trigger][day] = parsedDelay;
-                            }
-                        }
-                    }
-                }
-
-                JsonObjectConst colorModesObject = payload["color_modes"].as<JsonObjectConst>();
-                if (colorModesObject.isNull()) {
-                    colorModesObject = payload["colorModes"].as<JsonObjectConst>();
-                }
-                if (!validationFailed && !colorModesObject.isNull()) {
-                    for (size_t day = 0; day < NUM_DAYS && !validationFailed; ++day) {
-                        JsonArrayConst dayModes = colorModesObject[DAY_KEYS[day]].as<JsonArrayConst>();
-                        if (dayModes.isNull() || dayModes.size() != NUM_TRIGGERS) {
-                            validationFailed = true;
-                            validationMessage = F("Ungültige Farbmodus-Liste für Tag ");
-                            validationMessage += DAY_KEYS[day];
-                            break;
-                        }
-
-                        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                            const char *modeRaw = dayModes[trigger].as<const char *>();
-                            if (modeRaw == nullptr ||
-                                !parseLetterColorModeValue(String(modeRaw), parsedColorModes[trigger][day])) {
-                                validationFailed = true;
-                                validationMessage = F("Ungültiger Farbmodus für Trigger ");
-                                validationMessage += String(trigger + 1);
-                                validationMessage += F(" am Tag ");
-                                validationMessage += DAY_KEYS[day];
-                                break;
-                            }
-                        }
-                    }
-                }
-
-                JsonObjectConst paletteMasksObject = payload["color_palette_masks"].as<JsonObjectConst>();
-                if (paletteMasksObject.isNull()) {
-                    paletteMasksObject = payload["colorPaletteMasks"].as<JsonObjectConst>();
-                }
-                if (!validationFailed && !paletteMasksObject.isNull()) {
-                    for (size_t day = 0; day < NUM_DAYS && !validationFailed; ++day) {
-                        JsonArrayConst dayMasks = paletteMasksObject[DAY_KEYS[day]].as<JsonArrayConst>();
-                        if (dayMasks.isNull() || dayMasks.size() != NUM_TRIGGERS) {
-                            validationFailed = true;
-                            validationMessage = F("Ungültige Zufallspalette für Tag ");
-                            validationMessage += DAY_KEYS[day];
-                            break;
-                        }
-
-                        for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
-                            JsonVariantConst maskVariant = dayMasks[trigger];
-                            if (!(maskVariant.is<unsigned int>() || maskVariant.is<int>() || maskVariant.is<long>() || maskVariant.is<unsigned long>())) {
-                                validationFailed = true;
-                                validationMessage = F("Ungültige Zufallspalette für Trigger ");
-                                validationMessage += String(trigger + 1);
-                                validationMessage += F(" am Tag ");
-                                validationMessage += DAY_KEYS[day];
-                                break;
-                            }
-
-                            unsigned long maskValue = maskVariant.as<unsigned long>();
-                            if (maskValue > 0xFFFFUL) {
-                                validationFailed = true;
-                                validationMessage = F("Zufallspalette außerhalb des gueltigen Bereichs.");
-                                break;
-                            }
-
-                            parsedPaletteMasks[trigger][day] = static_cast<uint16_t>(maskValue);
-                        }
-                    }
-                }
-
-                if (!validationFailed) {
-                    for (size_t trigger = 0; trigger < NUM_TRIGGERS && !validationFailed; ++trigger) {
-                        for (size_t day = 0; day < NUM_DAYS; ++day) {
-                            if (parsedColorModes[trigger][day] == static_cast<uint8_t>(LetterColorMode::RandomSelected) &&
-                                parsedPaletteMasks[trigger][day] == 0U) {
-                                validationFailed = true;
-                                validationMessage = F("Zufall (ausgewaehlt) benoetigt mindestens eine Farbe.");
-                                break;
-                            }
-                        }
-                    }
-                }
-
-                if (validationFailed) {
-                    Serial.print(F("❌ JSON-Validierung fehlgeschlagen: "));
-                    Serial.println(validationMessage);
-                    sendJsonStatus(request, 400, "error", validationMessage);
+                if (!finishLettersUpdate(*context)) {
+                    LOG_WARN(WEB, "❌ JSON-Update fehlgeschlagen: %s", context->validationMessage.c_str());
+                    sendJsonStatus(request, 400, "error", context->validationMessage);
                     cleanup();
                     return;
                 }
 
                 for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
                     for (size_t day = 0; day < NUM_DAYS; ++day) {
-                        dailyLetters[trigger][day] = parsedLetters[trigger][day];
-                        strncpy(dailyLetterColors[trigger][day], parsedColors[trigger][day], COLOR_STRING_LENGTH);
+                        dailyLetters[trigger][day] = context->parsedLetters[trigger][day];
+                        strncpy(dailyLetterColors[trigger][day], context->parsedColors[trigger][day], COLOR_STRING_LENGTH);
                         dailyLetterColors[trigger][day][COLOR_STRING_LENGTH - 1] = '\0';
-                        dailyLetterColorModes[trigger][day] = parsedColorModes[trigger][day];
-                        dailyLetterRandomPaletteMasks[trigger][day] = parsedPaletteMasks[trigger][day];
-                        letter_trigger_delays[trigger][day] = parsedDelays[trigger][day];
+                        dailyLetterColorModes[trigger][day] = context->parsedColorModes[trigger][day];
+                        dailyLetterRandomPaletteMasks[trigger][day] = context->parsedPaletteMasks[trigger][day];
+                        letter_trigger_delays[trigger][day] = context->parsedDelays[trigger][day];
                     }
                 }
 
-                saveConfig();
+                markConfigDirty(CONFIG_SECTION_LETTERS | CONFIG_SECTION_TRIGGER_DELAYS);
                 refreshWiFiIdleTimer(F("POST /updateAllLetters JSON"));
-                Serial.println(F("✅ JSON-Update: Zeichen/Symbole, Farben, Farbmodi & Verzögerungen übernommen."));
+                LOG_INFO(WEB, "✅ JSON-Update: Zeichen/Symbole, Farben, Farbmodi & Verzögerungen übernommen.");
                 cleanup();
                 sendJsonStatus(request, 200, "ok", F("Zeichen/Symbole, Farben, Farbmodi & Verzögerungen gespeichert."));
                 return;
@@ -2294,14 +2423,8 @@ void setupWebServer() {
 
                     String letterValue = request->getParam(letterParam, true)->value();
                     letterValue.trim();
-                    if (letterValue.length() != 1) {
-                        success = false;
-                        errorMessage = F("Auswahl muss genau ein Zeichen/Symbol besitzen.");
-                        break;
-                    }
-
-                    const char letterChar = letterValue.charAt(0);
-                    if (!isSupportedLetter(letterChar)) {
+                    char letterChar = '\0';
+                    if (!parseSymbolToken(letterValue, letterChar)) {
                         success = false;
                         errorMessage = F("Ungültiges Zeichen/Symbol im Formular.");
                         break;
@@ -2377,8 +2500,7 @@ void setupWebServer() {
             }
 
             if (!success) {
-                Serial.print(F("❌ Formular-Update fehlgeschlagen: "));
-                Serial.println(errorMessage);
+                LOG_WARN(WEB, "❌ Formular-Update fehlgeschlagen: %s", errorMessage.c_str());
                 cleanup();
                 request->send(400, "text/plain", "❌ Fehler: " + errorMessage);
                 return;
@@ -2395,12 +2517,12 @@ void setupWebServer() {
                 }
             }
 
-            saveConfig();
+            markConfigDirty(CONFIG_SECTION_LETTERS | CONFIG_SECTION_TRIGGER_DELAYS);
             refreshWiFiIdleTimer(F("POST /updateAllLetters Formular"));
             if (expectDelays) {
-                Serial.println(F("✅ Formular-Update: Zeichen/Symbole, Farben, Farbmodi & Verzögerungen gespeichert."));
+                LOG_INFO(WEB, "✅ Formular-Update: Zeichen/Symbole, Farben, Farbmodi & Verzögerungen gespeichert.");
             } else {
-                Serial.println(F("✅ Formular-Update: Zeichen/Symbole, Farben & Farbmodi gespeichert."));
+                LOG_INFO(WEB, "✅ Formular-Update: Zeichen/Symbole, Farben & Farbmodi gespeichert.");
             }
             cleanup();
 
@@ -2416,32 +2538,26 @@ void setupWebServer() {
 
             UpdateAllLettersContext *context = static_cast<UpdateAllLettersContext *>(request->_tempObject);
             if (context == nullptr) {
-                context = new UpdateAllLettersContext();
+                context = new (std::nothrow) UpdateAllLettersContext();
+                if (context == nullptr) {
+                    return;
+                }
                 request->_tempObject = context;
+                beginLettersUpdate(*context);
             }
 
             if (context->overflow) {
                 return;
             }
 
-            if (total > MAX_JSON_BODY_SIZE) {
-                context->overflow = true;
-                return;
-            }
-
-            if (index == 0) {
-                context->body = String();
-                context->body.reserve(std::min(MAX_JSON_BODY_SIZE, total) + 1);
-            }
-
-            if (context->body.length() + len > MAX_JSON_BODY_SIZE) {
+            if (total > MAX_JSON_BODY_SIZE || context->received + len > MAX_JSON_BODY_SIZE) {
                 context->overflow = true;
                 return;
             }
 
-            for (size_t idx = 0; idx < len; ++idx) {
-                context->body += static_cast<char>(data[idx]);
-            }
+            // Jedes Stück wird sofort geparst und geprüft; gepuffert wird nichts.
+            context->received += len;
+            feedJsonStream(context->parser, data, len);
         });
 
     server.on("/displayLetter", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -2454,8 +2570,9 @@ void setupWebServer() {
             return;
         }
 
-        String letter = request->getParam("char")->value();
-        if (letter.length() != 1) {
+        const String letter = request->getParam("char")->value();
+        char symbol = '\0';
+        if (!parseSymbolToken(letter, symbol)) {
             request->send(400, "text/plain", "❌ Fehler: Auswahl muss genau ein Zeichen/Symbol sein!");
             return;
         }
@@ -2470,7 +2587,7 @@ void setupWebServer() {
             triggerIndex = static_cast<uint8_t>(triggerValue - 1);
         }
 
-        bool displayed = displayLetter(triggerIndex, letter[0]);
+        bool displayed = displayLetter(triggerIndex, symbol);
 
         if (displayed) {
             alreadyCleared = false;
@@ -2527,25 +2644,15 @@ void setupWebServer() {
         }
 
         char todayLetter = dailyLetters[triggerIndex][today];
-        const int customIndex = customSymbolIndexFromChar(todayLetter);
-        const bool customAvailable =
-            customIndex >= 0 &&
-            customIndex < static_cast<int>(CUSTOM_SYMBOL_COUNT) &&
-            customSymbolEnabled[customIndex] == 1;
-        if (todayLetter != '*' && !customAvailable && !factorySymbolExists(todayLetter)) {
+        if (todayLetter != '*' && !hasCustomSymbol(todayLetter) && !factorySymbolExists(todayLetter)) {
             request->send(500, "text/plain", "❌ Fehler: Kein Muster für das heutige Zeichen/Symbol vorhanden!");
             return;
         }
 
         unsigned long delaySeconds = letter_trigger_delays[triggerIndex][static_cast<size_t>(today)];
         const bool displayWasActive = triggerActive;
-        const bool alreadyPendingBeforeEnqueue = isTriggerPending(triggerIndex);
         if (!enqueuePendingTrigger(triggerIndex, true)) {
-            if (alreadyPendingBeforeEnqueue || isTriggerPending(triggerIndex)) {
-                request->send(409, "text/plain", "❌ Fehler: Für diesen Trigger ist bereits eine Ausführung geplant!");
-            } else {
-                request->send(503, "text/plain", "❌ Fehler: Trigger konnte nicht eingeplant werden!");
-            }
+            request->send(503, "text/plain", "❌ Fehler: Trigger konnte nicht eingeplant werden! Warteschlange voll.");
             return;
         }
 
@@ -2620,5 +2727,5 @@ void setupWebServer() {
 
     server.begin();
     webServerRunning = true;
-    Serial.println(F("✅ Webserver gestartet und Listener aktiv."));
+    LOG_INFO(WEB, "✅ Webserver gestartet und Listener aktiv.");
 }
@@ -9,8 +9,6 @@
 #include <ArduinoJson.h>
 #include <stdlib.h>
 
-extern const char scriptJS[] PROGMEM;
-
 void setupWebServer();
 
 #endif
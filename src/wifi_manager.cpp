@@ -1,5 +1,7 @@
 #include "wifi_manager.h"
 #include "rtc_manager.h"
+#include "symbol_renderer.h"
+#include "log_manager.h"
 
 // Funktionen aus wifi_manager.h implementiert
 
@@ -14,6 +16,12 @@ bool ntpSyncedSinceBoot = false;
 bool temporaryStartupApActive = false;
 unsigned long temporaryStartupApLastIdle = 0;
 
+// logWrite kopiert nur %s-Texte aus dem RAM; F()-Texte vorher hierher holen.
+void copyFlashText(const __FlashStringHelper *text, char *destination, size_t capacity) {
+    strncpy_P(destination, reinterpret_cast<PGM_P>(text), capacity - 1);
+    destination[capacity - 1] = '\0';
+}
+
 uint8_t connectedSoftApClients() {
     return WiFi.softAPgetStationNum();
 }
@@ -24,11 +32,10 @@ void startTemporaryStartupAccessPoint() {
     const bool apStarted = WiFi.softAP(apSsid, apPassword);
     temporaryStartupApActive = apStarted;
     temporaryStartupApLastIdle = millis();
-    Serial.print(F("Temporärer Start-AP "));
-    Serial.println(apStarted ? F("gestartet.") : F("konnte nicht gestartet werden."));
     if (apStarted) {
-        Serial.print(F("Start-AP-IP-Adresse: "));
-        Serial.println(WiFi.softAPIP());
+        LOG_INFO(WIFI, "Temporärer Start-AP gestartet, IP-Adresse: %s", WiFi.softAPIP().toString().c_str());
+    } else {
+        LOG_WARN(WIFI, "Temporärer Start-AP konnte nicht gestartet werden.");
     }
 }
 
@@ -43,7 +50,7 @@ void stopTemporaryStartupAccessPoint() {
     WiFi.softAPdisconnect(true);
     temporaryStartupApActive = false;
     temporaryStartupApLastIdle = 0;
-    Serial.println(F("Temporärer Start-AP beendet, dauerhaftes WLAN bleibt aktiv."));
+    LOG_INFO(WIFI, "Temporärer Start-AP beendet, dauerhaftes WLAN bleibt aktiv.");
 }
 
 void syncTimeAfterWiFiConnection(const __FlashStringHelper *reason) {
@@ -54,14 +61,15 @@ void syncTimeAfterWiFiConnection(const __FlashStringHelper *reason) {
     }
 
     lastNtpSyncAttempt = now;
-    if (reason != nullptr) {
-        Serial.print(F("NTP-Synchronisierung wegen WLAN-Verbindung: "));
-        Serial.println(reason);
+    if (reason != nullptr && RIDDLEMATRIX_LOG_LEVEL_WIFI >= LOG_LEVEL_DEBUG) {
+        char reasonText[LOG_ENTRY_TEXT_LENGTH];
+        copyFlashText(reason, reasonText, sizeof(reasonText));
+        LOG_DEBUG(WIFI, "NTP-Synchronisierung wegen WLAN-Verbindung: %s", reasonText);
     }
     if (syncTimeWithNTP()) {
         ntpSyncedSinceBoot = true;
     } else {
-        Serial.println(F("⚠️ Hinweis: NTP Synchronisierung fehlgeschlagen, wird spaeter erneut versucht."));
+        LOG_WARN(WIFI, "⚠️ Hinweis: NTP Synchronisierung fehlgeschlagen, wird spaeter erneut versucht.");
     }
 }
 
@@ -71,8 +79,7 @@ void startFallbackAccessPoint() {
     WiFi.mode(WIFI_AP_STA);
     const bool apStarted = WiFi.softAP(fallbackSsid, fallbackPassword);
     temporaryStartupApActive = false;
-    Serial.print(F("Fallback-Konfigurations-AP "));
-    Serial.println(apStarted ? F("gestartet.") : F("konnte nicht gestartet werden."));
+    LOG_INFO(WIFI, "Fallback-Konfigurations-AP %s", apStarted ? "gestartet." : "konnte nicht gestartet werden.");
     wifiDisabled = false;
     if (!webServerRunning) {
         setupWebServer();
@@ -83,9 +90,10 @@ void startFallbackAccessPoint() {
 void refreshWiFiIdleTimer(const __FlashStringHelper *reason) {
     wifiStartTime = millis();
 
-    if (reason != nullptr) {
-        Serial.print(F("🔄 WiFi-Idle-Timer aktualisiert: "));
-        Serial.println(reason);
+    if (reason != nullptr && RIDDLEMATRIX_LOG_LEVEL_WIFI >= LOG_LEVEL_DEBUG) {
+        char reasonText[LOG_ENTRY_TEXT_LENGTH];
+        copyFlashText(reason, reasonText, sizeof(reasonText));
+        LOG_DEBUG(WIFI, "🔄 WiFi-Idle-Timer aktualisiert: %s", reasonText);
     }
 }
 
@@ -99,7 +107,7 @@ void maintainWiFiAccessWindow(unsigned long timeoutMs) {
                 return;
             }
             if (now - wifiStartTime >= timeoutMs) {
-                Serial.println(F("Keine Manager-Verbindung - deaktiviere WiFi & Webserver."));
+                LOG_INFO(WIFI, "Keine Manager-Verbindung - deaktiviere WiFi & Webserver.");
                 disableWiFiAndServer();
             }
         }
@@ -124,123 +132,111 @@ void maintainWiFiAccessWindow(unsigned long timeoutMs) {
 
 void clearWiFiSymbol() {
     if (triggerActive) {
-        Serial.println(F("⏳ WiFi-Symbol bleibt, weil ein Zeichen/Symbol aktiv ist."));
+        LOG_DEBUG(WIFI, "⏳ WiFi-Symbol bleibt, weil ein Zeichen/Symbol aktiv ist.");
         return;
     }
 
     if (!wifiSymbolVisible) {
-        Serial.println(F("ℹ️ WiFi-Symbol ist bereits ausgeblendet."));
+        LOG_DEBUG(WIFI, "ℹ️ WiFi-Symbol ist bereits ausgeblendet.");
         return;
     }
 
-    Serial.println(F("🚫 WiFi-Symbol wird entfernt."));
+    LOG_INFO(WIFI, "🚫 WiFi-Symbol wird entfernt.");
+    beginDisplayFrame();
     display.fillScreen(display.color565(0, 0, 0));
-    display.display();
+    presentDisplayFrame();
     wifiSymbolVisible = false;
 }
 
-#define SCALE_FACTOR 2
-
 void drawWiFiSymbol() {
     const uint8_t *wifiBitmap = getFactorySymbolBitmap('~');
     if (wifiBitmap == nullptr) {
-        Serial.println(F("WiFi-Symbol ist nicht verfuegbar."));
+        LOG_DEBUG(WIFI, "WiFi-Symbol ist nicht verfuegbar.");
         wifiSymbolVisible = false;
         return;
     }
 
     if (!wifi_status_symbol_enabled ||
         wifi_operation_mode != static_cast<uint8_t>(WiFiOperationMode::TimedManager)) {
-        Serial.println(F("WiFi-Symbol ist fuer diesen WLAN-Modus deaktiviert."));
+        LOG_DEBUG(WIFI, "WiFi-Symbol ist fuer diesen WLAN-Modus deaktiviert.");
         wifiSymbolVisible = false;
         return;
     }
 
     if (!wifiConnected) {
-        Serial.println(F("ℹ️ WiFi-Symbol wird nicht angezeigt: keine aktive WLAN-Verbindung."));
+        LOG_DEBUG(WIFI, "ℹ️ WiFi-Symbol wird nicht angezeigt: keine aktive WLAN-Verbindung.");
         wifiSymbolVisible = false;
         return;
     }
 
     if (wifiDisabled) {
-        Serial.println(F("ℹ️ WiFi-Symbol bleibt deaktiviert, weil WiFi abgeschaltet ist."));
+        LOG_DEBUG(WIFI, "ℹ️ WiFi-Symbol bleibt deaktiviert, weil WiFi abgeschaltet ist.");
         wifiSymbolVisible = false;
         return;
     }
 
     if (triggerActive) {
-        Serial.println(F("⏳ WiFi-Symbol NICHT angezeigt, weil ein Zeichen/Symbol aktiv ist."));
+        LOG_DEBUG(WIFI, "⏳ WiFi-Symbol NICHT angezeigt, weil ein Zeichen/Symbol aktiv ist.");
         wifiSymbolVisible = false;
         return;
     }
 
     if (wifiSymbolVisible) {
-        Serial.println(F("ℹ️ WiFi-Symbol ist bereits aktiv – erneutes Zeichnen entfällt."));
+        LOG_DEBUG(WIFI, "ℹ️ WiFi-Symbol ist bereits aktiv – erneutes Zeichnen entfällt.");
         return;
     }
 
-    Serial.println(F("📶 WiFi-Symbol wird angezeigt."));
+    LOG_INFO(WIFI, "📶 WiFi-Symbol wird angezeigt.");
 
+    beginDisplayFrame();
     display.fillScreen(display.color565(0, 0, 255));
-
-    int x_pos = (64 - (32 * SCALE_FACTOR)) / 2;
-    int y_pos = (64 - (32 * SCALE_FACTOR)) / 2;
-
-    for (int y = 0; y < 32; y++) {
-        for (int x = 0; x < 32; x++) {
-            uint8_t rowValue = pgm_read_byte(&wifiBitmap[y * 4 + (x / 8)]);
-            if (rowValue & (1 << (7 - (x % 8)))) {
-                display.fillRect(x_pos + x * SCALE_FACTOR, y_pos + y * SCALE_FACTOR, SCALE_FACTOR, SCALE_FACTOR, display.color565(0, 0, 0));
-            }
-        }
-    }
-    display.display();
+    renderFactorySymbol('~', display.color565(0, 0, 0));
+    presentDisplayFrame();
     wifiSymbolVisible = true;
 }
 
 void disableWiFiAndServer() {
     if (wifiDisabled) {
-        Serial.println(F("ℹ️ WiFi & Webserver sind bereits deaktiviert."));
+        LOG_DEBUG(WIFI, "ℹ️ WiFi & Webserver sind bereits deaktiviert.");
         return;
     }
 
-    Serial.println(F("⏹️ Deaktiviere WiFi & Webserver."));
+    LOG_INFO(WIFI, "⏹️ Deaktiviere WiFi & Webserver.");
 
     if (!triggerActive) {
         clearWiFiSymbol();
     } else {
-        Serial.println(F("⏳ Aktive Anzeige – WiFi-Symbol bleibt vorerst bestehen."));
+        LOG_DEBUG(WIFI, "⏳ Aktive Anzeige – WiFi-Symbol bleibt vorerst bestehen.");
     }
 
     if (webServerRunning) {
         server.end();
         webServerRunning = false;
     } else {
-        Serial.println(F("ℹ️ Webserver war bereits gestoppt."));
+        LOG_DEBUG(WIFI, "ℹ️ Webserver war bereits gestoppt.");
     }
     WiFi.disconnect();
     WiFi.mode(WIFI_OFF);
     WiFi.softAPdisconnect(true);
-    Serial.println(F("ℹ️ SoftAP nach Abschaltung getrennt."));
+    LOG_DEBUG(WIFI, "ℹ️ SoftAP nach Abschaltung getrennt.");
 
     wifiConnected = false;
     wifiDisabled = true;
 }
 
 void connectWiFi() {
-    Serial.println(F("🌐 Verbinde mit WiFi..."));
+    LOG_INFO(WIFI, "🌐 Verbinde mit WiFi...");
     WiFi.persistent(false);
 
     if (wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::TimedManager)) {
         WiFi.mode(WIFI_AP);
         const bool apStarted = WiFi.softAP(wifi_ssid, wifi_password);
-        Serial.print(F("Manager-Hotspot "));
-        Serial.println(apStarted ? F("gestartet.") : F("konnte nicht gestartet werden."));
         wifiConnected = apStarted;
         wifiDisabled = !apStarted;
-        if (apStarted) {
-            Serial.print(F("AP-IP-Adresse: "));
-            Serial.println(WiFi.softAPIP());
+        if (!apStarted) {
+            LOG_WARN(WIFI, "Manager-Hotspot konnte nicht gestartet werden.");
+        } else {
+            LOG_INFO(WIFI, "Manager-Hotspot gestartet, AP-IP-Adresse: %s", WiFi.softAPIP().toString().c_str());
             drawWiFiSymbol();
             setupWebServer();
             refreshWiFiIdleTimer(F("connectWiFi AP"));
@@ -252,17 +248,15 @@ void connectWiFi() {
     WiFi.mode((staWithLocalAp || alwaysConnected) ? WIFI_AP_STA : WIFI_STA);
     if (staWithLocalAp) {
         const bool apStarted = WiFi.softAP(wifi_local_ap_ssid, wifi_local_ap_password);
-        Serial.print(F("Lokaler Box-AP "));
-        Serial.println(apStarted ? F("gestartet.") : F("konnte nicht gestartet werden."));
+        LOG_INFO(WIFI, "Lokaler Box-AP %s", apStarted ? "gestartet." : "konnte nicht gestartet werden.");
         temporaryStartupApActive = false;
     } else if (alwaysConnected) {
         startTemporaryStartupAccessPoint();
     } else {
         WiFi.softAPdisconnect(true);
-        Serial.println(F("STA-Modus aktiviert, SoftAP getrennt."));
         temporaryStartupApActive = false;
     }
-    Serial.println(F("ℹ️ STA-Modus aktiviert, SoftAP getrennt."));
+    LOG_INFO(WIFI, "ℹ️ STA-Modus aktiviert, SoftAP getrennt.");
     WiFi.hostname(hostname);
     if (wifi_static_ip_enabled) {
         IPAddress localIp;
@@ -274,33 +268,25 @@ void connectWiFi() {
             subnet.fromString(wifi_subnet) &&
             dns.fromString(wifi_dns)) {
             WiFi.config(localIp, gateway, subnet, dns);
-            Serial.print(F("Statische IP konfiguriert: "));
-            Serial.println(localIp);
+            LOG_INFO(WIFI, "Statische IP konfiguriert: %s", localIp.toString().c_str());
         } else {
-            Serial.println(F("Statische IP ungueltig, nutze DHCP."));
+            LOG_INFO(WIFI, "Statische IP ungueltig, nutze DHCP.");
             WiFi.config(0U, 0U, 0U);
         }
     } else {
         WiFi.config(0U, 0U, 0U);
-        Serial.println(F("DHCP aktiviert."));
+        LOG_INFO(WIFI, "DHCP aktiviert.");
     }
     WiFi.begin(wifi_ssid, wifi_password);
 
     unsigned long startAttempt = millis();
-    unsigned long lastDot = startAttempt;
     while (WiFi.status() != WL_CONNECTED &&
            (millis() - startAttempt < (wifi_connect_timeout * 1000UL))) {
-        if (millis() - lastDot >= 2000) {
-            Serial.print(".");
-            lastDot = millis();
-        }
         delay(10);
     }
 
     if (WiFi.status() == WL_CONNECTED) {
-        Serial.println(F("\n✅ WiFi verbunden!"));
-        Serial.print(F("IP-Adresse: "));
-        Serial.println(WiFi.localIP());
+        LOG_INFO(WIFI, "✅ WiFi verbunden! IP-Adresse: %s", WiFi.localIP().toString().c_str());
         wifiConnected = true;
         wifiDisabled = false;
         drawWiFiSymbol();
@@ -308,11 +294,11 @@ void connectWiFi() {
         setupWebServer();
         refreshWiFiIdleTimer(F("connectWiFi"));
     } else {
-        Serial.println(F("\n⛔ WiFi Timeout! Verbindung fehlgeschlagen. WiFi bleibt aus."));
+        LOG_WARN(WIFI, "⛔ WiFi Timeout! Verbindung fehlgeschlagen. WiFi bleibt aus.");
         wifiConnected = false;
         if (wifi_operation_mode != static_cast<uint8_t>(WiFiOperationMode::TimedManager)) {
             startFallbackAccessPoint();
-            Serial.println(F("Lokaler Box-AP bleibt fuer Konfiguration aktiv."));
+            LOG_INFO(WIFI, "Lokaler Box-AP bleibt fuer Konfiguration aktiv.");
         } else {
             WiFi.disconnect();
             WiFi.mode(WIFI_OFF);
@@ -331,7 +317,7 @@ void checkWiFi() {
             static unsigned long lastReconnectAttempt = 0;
             const unsigned long now = millis();
             if (now - lastReconnectAttempt >= 30000UL) {
-                Serial.println(F("WLAN-Verbindung verloren. Permanenter Modus versucht Reconnect..."));
+                LOG_INFO(WIFI, "WLAN-Verbindung verloren. Permanenter Modus versucht Reconnect...");
                 lastReconnectAttempt = now;
                 WiFi.disconnect();
                 if (wifi_operation_mode == static_cast<uint8_t>(WiFiOperationMode::AlwaysConnected)) {
@@ -340,15 +326,13 @@ void checkWiFi() {
                 WiFi.begin(wifi_ssid, wifi_password);
             }
         } else if (!wifiDisabled) {
-            Serial.println(F("⚠️ WLAN-Verbindung verloren. Schalte WiFi & Webserver aus..."));
+            LOG_WARN(WIFI, "⚠️ WLAN-Verbindung verloren. Schalte WiFi & Webserver aus...");
             disableWiFiAndServer();
-            Serial.println(F("🌐 Webserver gestoppt. Neustart erforderlich für neue Verbindung."));
+            LOG_INFO(WIFI, "🌐 Webserver gestoppt. Neustart erforderlich für neue Verbindung.");
         }
     } else {
         if (!wifiConnected) {
-            Serial.println(F("✅ WLAN verbunden!"));
-            Serial.print(F("IP-Adresse: "));
-            Serial.println(WiFi.localIP());
+            LOG_INFO(WIFI, "✅ WLAN verbunden! IP-Adresse: %s", WiFi.localIP().toString().c_str());
 
             wifiConnected = true;
             wifiDisabled = false;
@@ -356,7 +340,7 @@ void checkWiFi() {
             syncTimeAfterWiFiConnection(F("checkWiFi reconnect"));
 
             if (!webServerRunning) {
-                Serial.println(F("🌐 Webserver war gestoppt – starte Listener neu."));
+                LOG_INFO(WIFI, "🌐 Webserver war gestoppt – starte Listener neu.");
                 server.begin();
                 webServerRunning = true;
             }
@@ -0,0 +1,69 @@
+#include "clock_events.h"
+
+#include <iostream>
+
+namespace {
+
+// 04.03.2024 00:00:00 Ortszeit
+constexpr uint32_t MONDAY = 1709510400UL;
+
+constexpr uint32_t at(uint32_t hour, uint32_t minute, uint32_t second = 0, uint32_t day = 0) {
+    return MONDAY + day * 86400UL + hour * 3600UL + minute * 60UL + second;
+}
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+// Aktivfenster 08:00–21:59: Beginn um 08:00:00, Ende (inklusive Endminute) um 22:00:00.
+bool verifyWindowBoundariesFireOnce() {
+    resetClockEvents();
+    const uint16_t start = 8 * 60;
+    const uint16_t end = 21 * 60 + 59;
+    return expect(advanceClockEvents(at(7, 59, 58), start, end) == CLOCK_EVENT_RESYNC, "Erster Abgleich ohne RESYNC") &&
+           expect(secondsUntilNextClockBoundary(at(7, 59, 58)) == 2, "Abstand zum Fensterbeginn falsch") &&
+           expect(advanceClockEvents(at(7, 59, 59), start, end) == CLOCK_EVENT_NONE, "Ereignis vor der Grenze") &&
+           expect(advanceClockEvents(at(8, 0), start, end) == CLOCK_EVENT_ACTIVE_START, "Fensterbeginn nicht gemeldet") &&
+           expect(advanceClockEvents(at(8, 0), start, end) == CLOCK_EVENT_NONE, "Fensterbeginn doppelt gemeldet") &&
+           expect(secondsUntilNextClockBoundary(at(8, 0)) == 14UL * 3600UL, "Abstand zum Fensterende falsch") &&
+           expect(advanceClockEvents(at(21, 59, 59), start, end) == CLOCK_EVENT_NONE, "Endminute gehört nicht zum Fenster") &&
+           expect(advanceClockEvents(at(22, 0), start, end) == CLOCK_EVENT_ACTIVE_END, "Fensterende nicht gemeldet") &&
+           expect(secondsUntilNextClockBoundary(at(22, 0)) == 2UL * 3600UL, "Abstand zu Mitternacht falsch") &&
+           expect(advanceClockEvents(at(0, 0, 0, 1), start, end) == CLOCK_EVENT_MIDNIGHT, "Mitternacht nicht gemeldet");
+}
+
+bool verifyWrappingWindowAndGaps() {
+    resetClockEvents();
+    const uint16_t start = 22 * 60;
+    const uint16_t end = 5 * 60 + 59;
+    advanceClockEvents(at(12, 0), start, end);
+    const uint8_t overnight = advanceClockEvents(at(6, 30, 0, 1), start, end);
+    return expect(overnight == (CLOCK_EVENT_ACTIVE_START | CLOCK_EVENT_MIDNIGHT | CLOCK_EVENT_ACTIVE_END),
+                  "Überschrittene Grenzen einer Lücke fehlen") &&
+           expect(secondsUntilNextClockBoundary(at(5, 59, 30, 2)) == 30, "Ende des Nachtfensters falsch");
+}
+
+bool verifyResyncTriggers() {
+    resetClockEvents();
+    advanceClockEvents(at(10, 0), 600, 600);
+    const bool alwaysActive = expect(secondsUntilNextClockBoundary(at(10, 0)) == 14UL * 3600UL,
+                                     "Dauerhaft aktives Fenster meldet Fenstergrenzen") &&
+                              expect(advanceClockEvents(at(10, 0, 1), 600, 600) == CLOCK_EVENT_NONE,
+                                     "Fenstergrenze bei Start = Ende gemeldet");
+    return alwaysActive &&
+           expect(advanceClockEvents(at(9, 0), 600, 600) == CLOCK_EVENT_RESYNC, "Rücksprung ohne RESYNC") &&
+           expect(advanceClockEvents(at(9, 0, 1), 480, 1320) == CLOCK_EVENT_RESYNC, "Geändertes Fenster ohne RESYNC") &&
+           expect(advanceClockEvents(at(9, 0, 1, 1), 480, 1320) == CLOCK_EVENT_RESYNC, "Sprung über einen Tag ohne RESYNC");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyWindowBoundariesFireOnce() || !verifyWrappingWindowAndGaps() || !verifyResyncTriggers()) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "config.h"
+#include "symbol_pack.h"
+#include "web_assets.h"
+
+#include <LittleFS.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+namespace {
+
+// Ersatz für die String-Helfer aus web_manager.cpp, die der Host-String nicht abbildet.
+std::string getLetterOptionLabel(char letter) {
+    const int id = customSymbolId(letter);
+    return id >= 0 ? "Symbol " + std::to_string(id) : std::string(1, letter);
+}
+
+std::string formatMinutesAsTime(uint16_t minutesOfDay) {
+    return std::to_string(minutesOfDay / 60U) + ":" + std::to_string(minutesOfDay % 60U);
+}
+
+// Von test_config_page_stream.py aus src/web_manager.cpp herausgelöst.
+#include "config_page_stream.inc"
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+std::string renderPage(size_t sendBufferSize, size_t &largestChunk) {
+    std::unique_ptr<ConfigPageCursor> cursor(new ConfigPageCursor());
+    readCustomSymbolFlags(cursor->customSymbolFlags);
+    std::string page;
+    uint8_t buffer[1460];
+    size_t written = 0;
+    while ((written = fillConfigPageStream(*cursor, buffer, sendBufferSize)) > 0) {
+        page.append(reinterpret_cast<const char *>(buffer), written);
+        largestChunk = std::max(largestChunk, cursor->chunkLength);
+    }
+    return page;
+}
+
+} // namespace
+
+int main() {
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.fill(0xFF);
+    loadConfig();
+    initEditableSymbolStore();
+
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE] = {0x80};
+    saveCustomSymbol(customSymbolFromId(12), bitmap, true);
+    std::memset(wifi_ssid, '\'', sizeof(wifi_ssid) - 1);  // längster Wert nach dem Escapen
+    wifi_ssid[sizeof(wifi_ssid) - 1] = '\0';
+    std::strcpy(hostname, "box<1>");
+    dailyLetters[1][3] = customSymbolFromId(40);
+
+    size_t largestChunk = 0;
+    const std::string page = renderPage(64, largestChunk);
+    if (!expect(renderPage(1, largestChunk) == page && renderPage(1460, largestChunk) == page,
+                "Seite hängt von der Größe des Sendepuffers ab") ||
+        !expect(largestChunk < CONFIG_PAGE_CHUNK_SIZE, "Teilstück füllt den Puffer – Ausgabe womöglich abgeschnitten") ||
+        !expect(sizeof(ConfigPageCursor) < 1024, "Seitenzustand belegt zu viel Heap")) {
+        return 1;
+    }
+
+    const size_t end = page.find("</body></html>");
+    const bool complete = expect(page.rfind("<!doctype html>", 0) == 0 && end != std::string::npos && end + 14 == page.size(),
+                  "Seite unvollständig") &&
+           expect(page.find("name='hostname' value='box&lt;1&gt;'") != std::string::npos, "Hostname nicht escaped") &&
+           expect(page.find("<option value='@12' >Symbol 12</option>") != std::string::npos,
+                  "Gespeichertes Zusatz-Symbol fehlt in der Auswahl") &&
+           expect(page.find("<option value='@40' selected>Symbol 40 (inaktiv)</option>") != std::string::npos,
+                  "Ausgewähltes, leeres Zusatz-Symbol fehlt") &&
+           expect(page.find("value='@13'") == std::string::npos, "Leere Zusatz-Symbole werden aufgelistet") &&
+           expect(page.find("name='delay_2_6'") != std::string::npos && page.find("id='color_mode_2_0'") != std::string::npos,
+                  "Trigger-Tabellen unvollständig") &&
+           expect(page.find("href='/style.css?v=" WEB_ASSET_STYLE_CSS_HASH "'") != std::string::npos &&
+                      page.find("src='/script.js?v=" WEB_ASSET_SCRIPT_JS_HASH "'") != std::string::npos &&
+                      page.find("<style>") == std::string::npos,
+                  "Statische Dateien nicht versioniert eingebunden");
+    return complete ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+#include "config.h"
+#include "config_record_log.h"
+#include "crc32.h"
+
+#include <LittleFS.h>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+bool appendRecord(uint8_t id, uint32_t value) {
+    return beginConfigLogRecord(id, sizeof(value)) && writeConfigLogField(&value, sizeof(value)) &&
+           commitConfigLogRecord();
+}
+
+uint32_t readRecord(uint8_t id) {
+    uint32_t value = 0;
+    if (openConfigLogRecord(id) == 0 || !readConfigLogField(&value, sizeof(value))) {
+        value = 0xFFFFFFFFUL;
+    }
+    closeConfigLogRecord();
+    return value;
+}
+
+std::vector<uint8_t> &activeLogFile() {
+    return LittleFS.files[getConfigLogStats().generation % 2 == 1 ? "/cfg_a.log" : "/cfg_b.log"];
+}
+
+bool verifyCrcReference() {
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    return expect(crc32Update(check, sizeof(check)) == 0xCBF43926UL, "CRC-32 Prüfwert falsch");
+}
+
+bool verifyReplayKeepsLatestRecord() {
+    LittleFS.format();
+    LittleFS.writeBudget = SIZE_MAX;
+    if (!expect(!openConfigLog(), "Leeres Dateisystem als vorhandenes Log erkannt") ||
+        !expect(LittleFS.exists("/cfg_a.log"), "Neues Log nicht angelegt")) {
+        return false;
+    }
+    appendRecord(0, 11);
+    appendRecord(1, 21);
+    appendRecord(0, 12);
+    // Neuerer Firmware-Datensatz mit unbekannter Kennung wird übersprungen.
+    appendRecord(CONFIG_LOG_RECORD_IDS - 1, 99);
+
+    const size_t bytes = getConfigLogStats().bytes;
+    return expect(openConfigLog(), "Vorhandenes Log nicht erkannt") &&
+           expect(readRecord(0) == 12 && readRecord(1) == 21, "Nicht der letzte Datensatz je Kennung") &&
+           expect(!hasConfigLogRecord(2) && readRecord(2) == 0xFFFFFFFFUL, "Fehlender Datensatz gelesen") &&
+           expect(getConfigLogStats().bytes == bytes && getConfigLogStats().droppedBytes == 0, "Log-Länge nach Neustart falsch");
+}
+
+bool verifyTornAppendLosesOnlyThatRecord() {
+    LittleFS.writeBudget = 6;  // Kopf und zwei Nutzbytes, dann Stromausfall
+    appendRecord(0, 13);
+    LittleFS.writeBudget = SIZE_MAX;
+
+    if (!expect(openConfigLog(), "Log nach abgerissenem Datensatz verworfen") ||
+        !expect(readRecord(0) == 12 && readRecord(1) == 21, "Abgerissener Datensatz hat ältere Werte beschädigt") ||
+        !expect(getConfigLogStats().droppedBytes == 6, "Unvollständige Bytes nicht erkannt") ||
+        !expect(getConfigLogStats().compactions == 1, "Log nach Abriss nicht verdichtet")) {
+        return false;
+    }
+    appendRecord(0, 14);
+    return expect(openConfigLog() && readRecord(0) == 14, "Nach dem Abriss angehängter Datensatz unerreichbar");
+}
+
+bool verifyCorruptedRecordEndsReplay() {
+    appendRecord(1, 22);
+    appendRecord(0, 15);
+    std::vector<uint8_t> &file = activeLogFile();
+    file[file.size() - 6] ^= 0x01U;  // Nutzbyte des letzten Datensatzes
+    return expect(openConfigLog(), "Log mit beschädigtem Datensatz verworfen") &&
+           expect(readRecord(0) == 14 && readRecord(1) == 22, "CRC-Fehler nicht erkannt");
+}
+
+bool verifyCompactionSwitchesFilesAndSurvivesPowerLoss() {
+    const uint32_t generation = getConfigLogStats().generation;
+    uint32_t value = 100;
+    while (getConfigLogStats().generation == generation) {
+        appendRecord(2, ++value);
+    }
+    if (!expect(readRecord(2) == value && readRecord(0) == 14 && readRecord(1) == 22, "Verdichtung hat Datensätze verloren") ||
+        !expect(getConfigLogStats().bytes <= CONFIG_LOG_MAX_BYTES, "Log größer als CONFIG_LOG_MAX_BYTES")) {
+        return false;
+    }
+
+    // Stromausfall während der nächsten Verdichtung: die alte Datei bleibt maßgeblich.
+    const uint32_t committedGeneration = getConfigLogStats().generation;
+    while (getConfigLogStats().bytes + CONFIG_LOG_RECORD_OVERHEAD + sizeof(value) <= CONFIG_LOG_MAX_BYTES) {
+        appendRecord(2, ++value);
+    }
+    LittleFS.writeBudget = 30;
+    appendRecord(2, value + 1);
+    LittleFS.writeBudget = SIZE_MAX;
+    return expect(openConfigLog(), "Log nach abgebrochener Verdichtung verloren") &&
+           expect(getConfigLogStats().generation == committedGeneration, "Unvollständige Verdichtung übernommen") &&
+           expect(readRecord(2) == value && readRecord(0) == 14, "Werte nach abgebrochener Verdichtung falsch");
+}
+
+bool verifyShortRecordKeepsNewFieldDefaults() {
+    const uint16_t older = 7;
+    beginConfigLogRecord(3, sizeof(older));
+    writeConfigLogField(&older, sizeof(older));
+    commitConfigLogRecord();
+
+    uint16_t first = 0;
+    uint32_t added = 0xABCD;
+    return expect(openConfigLogRecord(3) == sizeof(older), "Datensatzlänge falsch") &&
+           expect(readConfigLogField(&first, sizeof(first)) && first == 7, "Bekanntes Feld nicht gelesen") &&
+           expect(!readConfigLogField(&added, sizeof(added)) && added == 0xABCD, "Neues Feld überschrieben");
+}
+
+bool verifyConfigUsesRecordLog() {
+    LittleFS.format();
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.fill(0xFF);
+    EEPROM.put(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, 77);
+    uint16_t version = EEPROM_CONFIG_VERSION;
+    EEPROM.put(EEPROM_OFFSET_CONFIG_VERSION, version);
+    loadConfig();  // leeres Log: EEPROM-Stand wird übernommen und als Datensätze geschrieben
+    if (!expect(display_brightness == 77, "EEPROM-Stand beim Umstieg nicht übernommen") ||
+        !expect(getDirtyConfigSections() == CONFIG_SECTION_NONE, "Übernommene Abschnitte nicht gespeichert")) {
+        return false;
+    }
+
+    const size_t commits = EEPROM.commitCount;
+    const size_t bytes = getConfigLogStats().bytes;
+    const unsigned long compactions = getConfigLogStats().compactions;
+    display_brightness = 55;
+    saveConfig(CONFIG_SECTION_DISPLAY);
+    const size_t displayRecord = getConfigLogStats().bytes - bytes;
+    if (!expect(EEPROM.commitCount == commits, "EEPROM trotz Konfigurations-Log geschrieben") ||
+        !expect(getConfigLogStats().compactions == compactions, "Verdichtung ohne überholte Datensätze") ||
+        !expect(displayRecord > CONFIG_LOG_RECORD_OVERHEAD && displayRecord < 128, "Mehr als der geänderte Datensatz geschrieben")) {
+        return false;
+    }
+
+    display_brightness = 1;
+    loadConfig();
+    return expect(display_brightness == 55, "Wert nicht aus dem Konfigurations-Log geladen") &&
+           expect(std::string(wifi_ssid) == RIDDLEMATRIX_DEFAULT_WIFI_SSID, "WLAN-Abschnitt nicht übernommen") &&
+           expect(EEPROM.commitCount == commits, "Laden aus dem Log schreibt ins EEPROM");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyCrcReference() || !verifyReplayKeepsLatestRecord() || !verifyTornAppendLosesOnlyThatRecord() ||
+        !verifyCorruptedRecordEndsReplay() || !verifyCompactionSwitchesFilesAndSurvivesPowerLoss() ||
+        !verifyShortRecordKeepsNewFieldDefaults() || !verifyConfigUsesRecordLog()) {
+        return 1;
+    }
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "config.h"
 
+#include <LittleFS.h>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
@@ -7,6 +8,7 @@
 SerialClass Serial;
 ESPClass ESP;
 FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
 Ticker display_ticker;
 bool triggerActive = false;
 unsigned long letterStartTime = 0;
@@ -0,0 +1,106 @@
+#include "config.h"
+
+#include <LittleFS.h>
+#include <cstdint>
+#include <iostream>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+int storedBrightness() {
+    int value = 0;
+    EEPROM.get(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, value);
+    return value;
+}
+
+char storedFirstLetter() {
+    return static_cast<char>(EEPROM.raw()[EEPROM_OFFSET_DAILY_LETTERS]);
+}
+
+bool verifyCleanSaveSkipsCommit() {
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.fill(0xFF);
+    loadConfig();  // leerer EEPROM: Standardwerte werden vollständig gespeichert
+
+    const size_t commits = EEPROM.commitCount;
+    saveConfig(CONFIG_SECTION_NONE);
+    return expect(getDirtyConfigSections() == CONFIG_SECTION_NONE, "Abschnitte nach loadConfig noch markiert") &&
+           expect(EEPROM.commitCount == commits, "Commit ohne geänderte Abschnitte");
+}
+
+bool verifyOnlyDirtySectionsAreWritten() {
+    const size_t commits = EEPROM.commitCount;
+    const char originalLetter = storedFirstLetter();
+    display_brightness = 42;
+    dailyLetters[0][0] = originalLetter == 'B' ? 'C' : 'B';
+
+    saveConfig(CONFIG_SECTION_DISPLAY);
+    if (!expect(storedBrightness() == 42, "Geänderter Abschnitt nicht geschrieben") ||
+        !expect(storedFirstLetter() == originalLetter, "Nicht markierter Abschnitt wurde geschrieben") ||
+        !expect(EEPROM.commitCount == commits + 1, "Genau ein Commit erwartet")) {
+        return false;
+    }
+
+    markConfigDirty(CONFIG_SECTION_LETTERS);
+    if (!expect(getDirtyConfigSections() == CONFIG_SECTION_LETTERS, "Markierung nicht gemerkt")) {
+        return false;
+    }
+    saveConfig(CONFIG_SECTION_NONE);
+    return expect(storedFirstLetter() == dailyLetters[0][0], "Vorgemerkter Abschnitt nicht geschrieben") &&
+           expect(EEPROM.commitCount == commits + 2, "Genau ein weiterer Commit erwartet") &&
+           expect(getDirtyConfigSections() == CONFIG_SECTION_NONE, "Markierung nach dem Speichern nicht gelöscht");
+}
+
+bool verifyDeferredFlushCoalescesBursts() {
+    const size_t commits = EEPROM.commitCount;
+    const uint16_t revision = configRevision;
+    hostMillis() = 100000UL;
+    markConfigDirty(CONFIG_SECTION_LETTERS);
+    hostMillis() += 1500UL;
+    markConfigDirty(CONFIG_SECTION_DISPLAY);
+    if (!expect(configRevision == revision + 2, "Tagesplan erfährt nichts von markierten Änderungen") ||
+        !expect(!isConfigFlushDue(hostMillis() + CONFIG_FLUSH_QUIET_MS - 1UL), "Speichern vor Ende der Ruhephase") ||
+        !expect(isConfigFlushDue(hostMillis() + CONFIG_FLUSH_QUIET_MS), "Speichern nach Ruhephase nicht fällig")) {
+        return false;
+    }
+
+    // Dauerfeuer: spätestens CONFIG_FLUSH_MAX_DELAY_MS nach der ersten Änderung wird gespeichert.
+    const unsigned long firstChange = 100000UL;
+    while (hostMillis() - firstChange < CONFIG_FLUSH_MAX_DELAY_MS) {
+        serviceConfigFlush();
+        if (!expect(EEPROM.commitCount == commits, "Während des Bursts gespeichert")) {
+            return false;
+        }
+        hostMillis() += CONFIG_FLUSH_QUIET_MS / 2UL;
+        markConfigDirty(CONFIG_SECTION_DISPLAY);
+    }
+    serviceConfigFlush();
+    return expect(EEPROM.commitCount == commits + 1, "Burst nicht in einem Commit gespeichert") &&
+           expect(getDirtyConfigSections() == CONFIG_SECTION_NONE, "Abschnitte nach dem Speichern markiert") &&
+           expect(!flushConfig(), "flushConfig meldet Arbeit ohne Änderungen");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyCleanSaveSkipsCommit() || !verifyOnlyDirtySectionsAreWritten() || !verifyDeferredFlushCoalescesBursts()) {
+        return 1;
+    }
+    return 0;
+}
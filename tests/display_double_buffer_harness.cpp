@@ -0,0 +1,71 @@
+#include "config.h"
+
+#include <LittleFS.h>
+#include <iostream>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+} // namespace
+
+int main() {
+    const uint16_t black = display.color565(0, 0, 0);
+    const uint16_t red = display.color565(255, 0, 0);
+    const uint16_t blue = display.color565(0, 0, 255);
+    const uint16_t green = display.color565(0, 255, 0);
+
+    setupMatrix();
+    display_updater();
+    display.resetCounters();
+
+    // Refresh mitten in der Zeichnung: der sichtbare Puffer bleibt unverändert.
+    beginDisplayFrame();
+    display.fillScreen(red);
+    display_updater();
+    if (!expect(display.visiblePixel(0, 0) == black, "Halb gezeichneter Frame wurde sichtbar") ||
+        !expect(display.showBufferCalls == 0, "Puffer vor presentDisplayFrame() getauscht")) {
+        return 1;
+    }
+
+    presentDisplayFrame();
+    display_updater();
+    display_updater();
+    if (!expect(display.visiblePixel(0, 0) == red, "Fertiger Frame wurde nicht veröffentlicht") ||
+        !expect(display.showBufferCalls == 1, "Frame wurde mehr als einmal getauscht") ||
+        !expect(display.displayCalls == 3, "display_updater() muss bei jedem Tick ausgeben")) {
+        return 1;
+    }
+
+    // Ein neuer Frame vor dem nächsten Refresh ersetzt den noch nicht getauschten.
+    beginDisplayFrame();
+    display.fillScreen(blue);
+    presentDisplayFrame();
+    beginDisplayFrame();
+    display.fillScreen(green);
+    presentDisplayFrame();
+    display_updater();
+    if (!expect(display.visiblePixel(0, 0) == green, "Neuester Frame wurde nicht angezeigt") ||
+        !expect(display.showBufferCalls == 2, "Verworfener Frame wurde trotzdem getauscht")) {
+        return 1;
+    }
+
+    std::cout << "Doppelpuffer: " << display.showBufferCalls << " Tausch(e) bei " << display.displayCalls
+              << " Refreshes" << std::endl;
+    return 0;
+}
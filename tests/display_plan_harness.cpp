@@ -0,0 +1,104 @@
+#include "display_plan.h"
+
+#include <LittleFS.h>
+#include <cstring>
+#include <iostream>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+void setTrigger(size_t trigger, size_t day, char letter, const char *color, LetterColorMode mode,
+                uint16_t paletteMask, unsigned long delaySeconds) {
+    dailyLetters[trigger][day] = letter;
+    std::strncpy(dailyLetterColors[trigger][day], color, COLOR_STRING_LENGTH);
+    dailyLetterColors[trigger][day][COLOR_STRING_LENGTH - 1] = '\0';
+    dailyLetterColorModes[trigger][day] = static_cast<uint8_t>(mode);
+    dailyLetterRandomPaletteMasks[trigger][day] = paletteMask;
+    letter_trigger_delays[trigger][day] = delaySeconds;
+}
+
+} // namespace
+
+int main() {
+    constexpr size_t DAY = 2;
+    const char customSymbol = customSymbolFromId(3);
+    uint8_t customBitmap[SYMBOL_BITMAP_SIZE];
+    std::memset(customBitmap, 0x3C, sizeof(customBitmap));
+    if (!expect(initEditableSymbolStore() && saveCustomSymbol(customSymbol, customBitmap, true),
+                "Zusatz-Symbol nicht gespeichert")) {
+        return 1;
+    }
+    setTrigger(0, DAY, 'A', "#FFA500", LetterColorMode::Fixed, 0, 7);
+    setTrigger(1, DAY, customSymbol, "kaputt", LetterColorMode::RandomSelected, 1U << 2, 0);
+    setTrigger(2, DAY, '*', "#00FF00", LetterColorMode::RandomSelected, 0, 1);
+    ++configRevision;
+
+    const DisplayPlanEntry *factory = getDisplayPlanEntry(0, DAY);
+    const DisplayPlanEntry *custom = getDisplayPlanEntry(1, DAY);
+    const DisplayPlanEntry *random = getDisplayPlanEntry(2, DAY);
+    if (!expect(factory && custom && random, "Planeinträge fehlen") ||
+        !expect(getDisplayPlanEntry(NUM_TRIGGERS, DAY) == nullptr, "Ungültiger Trigger liefert Eintrag") ||
+        !expect(getDisplayPlanEntry(0, -1) == nullptr, "Ungültiger Wochentag liefert Eintrag")) {
+        return 1;
+    }
+
+    if (!expect(factory->symbol.source == DisplaySymbolSource::Factory, "Factory-Quelle falsch") ||
+        !expect(factory->color565 == display.color565(255, 165, 0), "Feste Farbe falsch vorberechnet") ||
+        !expect(pickDisplayPlanColor(*factory) == factory->color565, "Fester Modus liefert andere Farbe") ||
+        !expect(factory->delayMs == 7000UL, "Verzögerung nicht in Millisekunden")) {
+        return 1;
+    }
+
+    if (!expect(custom->symbol.source == DisplaySymbolSource::Custom, "Eigenes Symbol nicht erkannt") ||
+        !expect(custom->symbol.letter == customSymbol, "Eigenes Symbol zeigt auf falsche Id") ||
+        !expect(std::memcmp(findCustomSymbolBitmap(customSymbol), customBitmap, SYMBOL_BITMAP_SIZE) == 0,
+                "Eigenes Symbol liefert falsche Bitmap") ||
+        !expect(custom->color565 == display.color565(255, 255, 255), "Ungültige Farbe nicht auf Weiß gesetzt") ||
+        !expect(pickDisplayPlanColor(*custom) == display.color565(0, 0, 255), "Palettenfarbe falsch")) {
+        return 1;
+    }
+
+    if (!expect(random->symbol.source == DisplaySymbolSource::RandomSelection, "'*' nicht als Zufall markiert") ||
+        !expect(pickDisplayPlanColor(*random) == display.color565(0, 255, 0), "Leere Palette ohne Rückfall")) {
+        return 1;
+    }
+
+    // Ohne neue Revision bleibt der Plan stehen, danach wird er neu aufgebaut.
+    setTrigger(0, DAY, 'B', "#000000", LetterColorMode::Fixed, 0, 7);
+    if (!expect(getDisplayPlanEntry(0, DAY)->symbol.letter == 'A', "Plan ohne Revision neu aufgebaut")) {
+        return 1;
+    }
+    ++configRevision;
+    if (!expect(getDisplayPlanEntry(0, DAY)->symbol.letter == 'B', "Plan nach Revision nicht neu aufgebaut")) {
+        return 1;
+    }
+
+    setTrigger(0, DAY + 1, 'C', "#FFFFFF", LetterColorMode::Fixed, 0, 0);
+    if (!expect(getDisplayPlanEntry(0, DAY + 1)->symbol.letter == 'C', "Tageswechsel baut Plan nicht neu")) {
+        return 1;
+    }
+
+    DisplaySymbol missing = {};
+    if (!expect(!resolveDisplaySymbol('!', missing) && missing.source == DisplaySymbolSource::Missing,
+                "Unbekanntes Zeichen wurde aufgelöst")) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "config.h"
+#include "crc32.h"
+
+#include <LittleFS.h>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+uint16_t storedVersion() {
+    uint16_t version = 0;
+    EEPROM.get(EEPROM_OFFSET_CONFIG_VERSION, version);
+    return version;
+}
+
+// Eine Zeile je Schema-Feld für die Layout-Prüfung in test_eeprom_layout.py.
+void dumpSchema() {
+    size_t count = 0;
+    const EepromField *schema = getEepromSchema(count);
+    for (size_t index = 0; index < count; ++index) {
+        std::cout << schema[index].offset << ' ' << schema[index].size << ' ' << schema[index].sinceVersion << ' '
+                  << schema[index].section << ' ' << static_cast<unsigned>(schema[index].kind) << '\n';
+    }
+}
+
+bool verifyRoundTrip() {
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.fill(0xFF);
+    loadConfig();
+
+    display_brightness = 77;
+    letter_trigger_delays[2][6] = 42;
+    letter_auto_display_interval = 120;
+    autoDisplayMode = true;
+    wifi_static_ip_enabled = true;
+    std::strcpy(wifi_static_ip, "10.0.0.5");
+    rs485_box_address = 3;
+    saveConfig();
+
+    display_brightness = 1;
+    letter_auto_display_interval = 0;
+    loadConfig();
+    return expect(storedVersion() == EEPROM_CONFIG_VERSION, "Versionskennung nicht geschrieben") &&
+           expect(display_brightness == 77 && letter_trigger_delays[2][6] == 42 &&
+                      letter_auto_display_interval == 120 && autoDisplayMode,
+                  "Anzeige-/Verzögerungsfelder nach dem Laden verändert") &&
+           expect(wifi_static_ip_enabled && std::strcmp(wifi_static_ip, "10.0.0.5") == 0, "Statische IP verloren") &&
+           expect(rs485_box_address == 3,
+                  "Felder späterer Versionen verloren");
+}
+
+// Version 7 kannte Farbmodi, aber weder WLAN-Optionen noch RS485-Adresse.
+bool verifyMigrationKeepsDefaultsForNewerFields() {
+    dailyLetterColorModes[0][0] = static_cast<uint8_t>(LetterColorMode::RandomAll);
+    saveConfig();
+    const uint16_t version7 = 7;
+    EEPROM.put(EEPROM_OFFSET_CONFIG_VERSION, version7);
+    const size_t commits = EEPROM.commitCount;
+
+    loadConfig();
+    return expect(display_brightness == 77 && letter_trigger_delays[2][6] == 42, "Alte Felder nicht übernommen") &&
+           expect(dailyLetterColorModes[0][0] == static_cast<uint8_t>(LetterColorMode::RandomAll),
+                  "Feld der Version 7 nicht übernommen") &&
+           expect(!wifi_static_ip_enabled && rs485_box_address == 0, "Neuere Felder nicht auf Standardwerte gesetzt") &&
+           expect(EEPROM.commitCount == commits + 1 && storedVersion() == EEPROM_CONFIG_VERSION,
+                  "Migration nicht im aktuellen Layout gespeichert");
+}
+
+// Version 4 speicherte hinter dem Hostnamen noch 64 Byte Auth-Token und ein Flag.
+bool verifyVersion4LayoutShift() {
+    EEPROM.fill(0xFF);
+    const uint16_t version4 = 4;
+    const int authBytes = 65;
+    EEPROM.put(EEPROM_OFFSET_CONFIG_VERSION, version4);
+    const char ssid[] = "Werkstatt";
+    EEPROM.put(EEPROM_OFFSET_WIFI_SSID, ssid);
+    EEPROM.raw()[EEPROM_OFFSET_DAILY_LETTERS + authBytes] = 'Q';
+    EEPROM.put(EEPROM_OFFSET_DISPLAY_BRIGHTNESS + authBytes, 55);
+    EEPROM.put(EEPROM_OFFSET_WIFI_CONNECT_TIMEOUT + authBytes, 45);
+
+    loadConfig();
+    return expect(dailyLetters[0][0] == 'Q', "Zeichen aus Version 4 nicht verschoben gelesen") &&
+           expect(display_brightness == 55 && wifi_connect_timeout == 45, "Werte aus Version 4 nicht verschoben gelesen");
+}
+
+// Prüfsumme wie saveConfig(): über alle Bytes bis zum Ende des letzten Schema-Felds.
+void storeMatchingCrc() {
+    size_t count = 0;
+    const EepromField *schema = getEepromSchema(count);
+    const size_t end = schema[count - 1].offset + schema[count - 1].size;
+    const uint32_t crc = crc32Update(EEPROM.raw(), end);
+    EEPROM.put(EEPROM_OFFSET_CONFIG_CRC, crc);
+}
+
+bool verifyCrcGuardsFastBoot() {
+    saveConfig();
+
+    // Bitfehler ohne passende Prüfsumme: alle Felder werden geprüft und korrigiert neu gespeichert.
+    EEPROM.put(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, 0);
+    size_t commits = EEPROM.commitCount;
+    loadConfig();
+    if (!expect(display_brightness == 100, "Fehlerhaftes Abbild nicht geprüft") ||
+        !expect(EEPROM.commitCount == commits + 1, "Korrigiertes Abbild nicht gespeichert")) {
+        return false;
+    }
+    const std::vector<uint8_t> repaired = EEPROM.data();
+    storeMatchingCrc();
+    if (!expect(EEPROM.data() == repaired, "saveConfig() schreibt eine andere Prüfsumme")) {
+        return false;
+    }
+
+    // Passende Prüfsumme: das Abbild gilt als geprüft und wird ohne Einzelprüfung übernommen.
+    EEPROM.put(EEPROM_OFFSET_DISPLAY_BRIGHTNESS, 300);
+    storeMatchingCrc();
+    commits = EEPROM.commitCount;
+    loadConfig();
+    return expect(display_brightness == 300, "Abbild mit passender Prüfsumme trotzdem geprüft") &&
+           expect(EEPROM.commitCount == commits, "Schnellstart hat gespeichert");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--dump") == 0) {
+        dumpSchema();
+        return 0;
+    }
+    if (!verifyRoundTrip() || !verifyMigrationKeepsDefaultsForNewerFields() || !verifyVersion4LayoutShift() ||
+        !verifyCrcGuardsFastBoot()) {
+        return 1;
+    }
+    return 0;
+}
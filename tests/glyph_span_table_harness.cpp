@@ -0,0 +1,73 @@
+#include "glyph_span_table.h"
+#include "symbol_renderer.h"
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+SerialClass Serial;
+PxMATRIX display(64, 64, P_LAT, P_OE, P_A, P_B, P_C, P_D, P_E);
+
+namespace {
+
+std::vector<uint16_t> captureDrawBuffer() {
+    std::vector<uint16_t> pixels;
+    pixels.reserve(static_cast<size_t>(display.width()) * display.height());
+    for (int16_t y = 0; y < display.height(); ++y) {
+        for (int16_t x = 0; x < display.width(); ++x) {
+            pixels.push_back(display.drawBufferPixel(x, y));
+        }
+    }
+    return pixels;
+}
+
+} // namespace
+
+int main() {
+    const uint16_t color = display.color565(255, 255, 255);
+    size_t tableGlyphs = 0;
+
+    std::cout << "Symbol  Läufe  Bytes" << std::endl;
+    for (int value = 0x20; value < 0x7F; ++value) {
+        const char symbol = static_cast<char>(value);
+        const uint8_t *bitmap = getFactorySymbolBitmap(symbol);
+        uint16_t first = 0;
+        uint16_t count = 0;
+        const bool inTable = findFactoryGlyphSpans(symbol, first, count);
+
+        if (inTable != (bitmap != nullptr)) {
+            std::cerr << "Lauf-Tabelle und getFactorySymbolBitmap() uneinig für " << symbol << std::endl;
+            return 1;
+        }
+        if (!inTable) {
+            continue;
+        }
+        ++tableGlyphs;
+
+        display.resetPanel();
+        const uint16_t bitmapSpans = renderSymbolView(progmemSymbolView(bitmap), color);
+        const std::vector<uint16_t> expected = captureDrawBuffer();
+        const unsigned long expectedLines = display.fastHLineCalls;
+
+        display.resetPanel();
+        const uint16_t tableSpans = renderFactorySymbol(symbol, color);
+        if (tableSpans != bitmapSpans || tableSpans != count || display.fastHLineCalls != expectedLines ||
+            captureDrawBuffer() != expected) {
+            std::cerr << "Lauf-Tabelle zeichnet " << symbol << " anders als die Bitmap" << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(6) << symbol << std::setw(7) << count << std::setw(7)
+                  << (count * sizeof(uint16_t)) << std::endl;
+    }
+
+    if (tableGlyphs != FACTORY_GLYPH_COUNT) {
+        std::cerr << "Lauf-Tabelle enthält unerwartete Symbole" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Größenbericht: " << FACTORY_GLYPH_SPAN_COUNT << " Läufe, Lauf-Tabelle "
+              << FACTORY_GLYPH_SPAN_TABLE_BYTES << " Bytes Flash, Quell-Bitmaps " << FACTORY_GLYPH_BITMAP_BYTES
+              << " Bytes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include "json_stream.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+const char *typeName(JsonStreamType type) {
+    switch (type) {
+        case JsonStreamType::Object:
+            return "obj";
+        case JsonStreamType::Array:
+            return "arr";
+        case JsonStreamType::String:
+            return "str";
+        case JsonStreamType::Number:
+            return "num";
+        case JsonStreamType::Boolean:
+            return "bool";
+        default:
+            return "null";
+    }
+}
+
+// Protokolliert jedes Ereignis als "<Pfad>=<Typ>:<Text>" bzw. "<Pfad>/end:<Anzahl>".
+struct EventLog {
+    std::string text;
+    size_t abortAfter;
+};
+
+bool recordEvent(const JsonStreamParser &parser, JsonStreamEvent event, JsonStreamType type, void *user) {
+    EventLog &log = *static_cast<EventLog *>(user);
+    std::string path;
+    for (size_t level = 0; level < jsonStreamDepth(parser); ++level) {
+        const char *key = jsonStreamKey(parser, level);
+        path += "/";
+        path += *key != '\0' ? std::string(key) : std::to_string(jsonStreamIndex(parser, level));
+    }
+    log.text += path.empty() ? "." : path;
+    if (event == JsonStreamEvent::End) {
+        log.text += "/end:" + std::to_string(jsonStreamCount(parser));
+    } else {
+        log.text += std::string("=") + typeName(type);
+        if (type != JsonStreamType::Object && type != JsonStreamType::Array) {
+            log.text += std::string(":") + jsonStreamText(parser);
+            if (jsonStreamTextTruncated(parser)) {
+                log.text += "...";
+            }
+        }
+    }
+    log.text += " ";
+    return log.text.size() < log.abortAfter;
+}
+
+// Parst `json` einmal am Stück und einmal Byte für Byte; beide Durchläufe müssen übereinstimmen.
+JsonStreamError parse(const char *json, std::string &events, size_t abortAfter = 100000) {
+    JsonStreamError errors[2] = {};
+    std::string logs[2];
+    for (size_t pass = 0; pass < 2; ++pass) {
+        EventLog log = {std::string(), abortAfter};
+        JsonStreamParser parser;
+        beginJsonStream(parser, recordEvent, &log);
+        const uint8_t *data = reinterpret_cast<const uint8_t *>(json);
+        const size_t length = strlen(json);
+        if (pass == 0) {
+            feedJsonStream(parser, data, length);
+        } else {
+            for (size_t index = 0; index < length; ++index) {
+                feedJsonStream(parser, data + index, 1);
+            }
+        }
+        finishJsonStream(parser);
+        errors[pass] = parser.error;
+        logs[pass] = log.text;
+    }
+    if (errors[0] != errors[1] || logs[0] != logs[1]) {
+        std::cerr << "Stückelung ändert das Ergebnis: " << logs[0] << "| " << logs[1] << std::endl;
+        return JsonStreamError::Aborted;
+    }
+    events = logs[0];
+    return errors[0];
+}
+
+bool verifyPathsAndValues() {
+    std::string events;
+    const JsonStreamError error =
+        parse(" {\"letters\": {\"mo\": [\"A\", \"@12\"]}, \"delays\":{\"di\":[0, -1.5e+2, true, null]}, \"x\": [[1]]} ",
+              events);
+    const std::string expected =
+        ".=obj /letters=obj /letters/mo=arr /letters/mo/0=str:A /letters/mo/1=str:@12 /letters/mo/end:2 "
+        "/letters/end:1 /delays=obj /delays/di=arr /delays/di/0=num:0 /delays/di/1=num:-1.5e+2 "
+        "/delays/di/2=bool:true /delays/di/3=null:null /delays/di/end:4 /delays/end:1 /x=arr /x/0=arr "
+        "/x/0/0=num:1 /x/0/end:1 /x/end:1 ./end:3 ";
+    return expect(error == JsonStreamError::None, "Gültiges Dokument abgelehnt") &&
+           expect(events == expected, ("Falsche Ereignisse: " + events).c_str());
+}
+
+bool verifyStrings() {
+    std::string events;
+    const JsonStreamError error =
+        parse("[\"a\\\"b\\\\\\/\\n\", \"\\u0041\\u00e4\", \"0123456789012345678901234567\"]", events);
+    return expect(error == JsonStreamError::None, "Escapes abgelehnt") &&
+           expect(events == ".=arr /0=str:a\"b\\/\n /1=str:A\xC3\xA4 /2=str:01234567890123456789012... ./end:3 ",
+                  ("Falsche Zeichenketten: " + events).c_str());
+}
+
+bool verifyLongKeysNeverMatch() {
+    std::string events;
+    parse("{\"lettersxxxxxxxxxxxxxxxxxxxxxxxxx\": 1}", events);
+    return expect(events == ".=obj /0=num:1 ./end:1 ", ("Abgeschnittener Schlüssel gemeldet: " + events).c_str());
+}
+
+bool verifyErrors() {
+    std::string events;
+    const struct {
+        const char *json;
+        JsonStreamError error;
+    } cases[] = {
+        {"", JsonStreamError::EmptyInput},
+        {"  \n", JsonStreamError::EmptyInput},
+        {"{\"a\": [1, 2", JsonStreamError::IncompleteInput},
+        {"{\"a\": \"x", JsonStreamError::IncompleteInput},
+        {"{\"a\" 1}", JsonStreamError::InvalidInput},
+        {"[1,]", JsonStreamError::InvalidInput},
+        {"[1 2]", JsonStreamError::InvalidInput},
+        {"{\"a\": 1]", JsonStreamError::InvalidInput},
+        {"[01]", JsonStreamError::InvalidInput},
+        {"[-]", JsonStreamError::InvalidInput},
+        {"[1.]", JsonStreamError::InvalidInput},
+        {"[1e]", JsonStreamError::InvalidInput},
+        {"[tru]", JsonStreamError::InvalidInput},
+        {"[\"\\x\"]", JsonStreamError::InvalidInput},
+        {"[\"a\nb\"]", JsonStreamError::InvalidInput},
+        {"{} {}", JsonStreamError::InvalidInput},
+        {"[[[[[[[[[[[]]]]]]]]]]]", JsonStreamError::TooDeep},
+    };
+    for (const auto &entry : cases) {
+        if (!expect(parse(entry.json, events) == entry.error, entry.json)) {
+            return false;
+        }
+    }
+    return expect(parse("[[[[[[[[[[]]]]]]]]]]", events) == JsonStreamError::None, "Zehn Ebenen abgelehnt") &&
+           expect(parse("12", events) == JsonStreamError::None && events == ".=num:12 ", "Zahl als Wurzel abgelehnt");
+}
+
+bool verifyCallbackAborts() {
+    std::string events;
+    const JsonStreamError error = parse("[1, 2, 3]", events, 12);
+    return expect(error == JsonStreamError::Aborted && events == ".=arr /0=num:1 ", "Abbruch durch Callback ignoriert");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyPathsAndValues() || !verifyStrings() || !verifyLongKeysNeverMatch() || !verifyErrors() ||
+        !verifyCallbackAborts()) {
+        return 1;
+    }
+    return 0;
+}
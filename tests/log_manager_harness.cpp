@@ -0,0 +1,118 @@
+#include "log_manager.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+SerialClass Serial;
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+// Setzt alle Einträge ab `since` so zusammen, wie /api/logs sie ausliefert.
+std::string render(uint32_t since = 0) {
+    std::string lines;
+    LogEntry entry;
+    char message[LOG_LINE_MAX_LENGTH];
+    for (uint32_t sequence = since; sequence < getLogNextSequence(); ++sequence) {
+        if (!readLogEntry(sequence, entry)) {
+            continue;
+        }
+        formatLogMessage(entry, message, sizeof(message));
+        lines += std::to_string(entry.timestamp) + " " + getLogModuleTag(entry.module) + " " +
+                 getLogLevelTag(entry.level) + " " + message + "\n";
+    }
+    return lines;
+}
+
+int evaluated = 0;
+
+int countEvaluation() {
+    return ++evaluated;
+}
+
+bool verifyFormattingAndTags() {
+    clearLogBuffer();
+    hostMillis() = 1234;
+    LOG_INFO(TRIGGER, "Trigger %u aus Quelle %s", 2U, "Web");
+    LOG_WARN(CONFIG, "Helligkeit %d, Farbe 0x%04X, Zeichen %c, %lu s, 100%%", -1, 0xF800U, 'A', 60UL);
+    return expect(render() == "1234 TRG I Trigger 2 aus Quelle Web\n"
+                              "1234 CFG W Helligkeit -1, Farbe 0xF800, Zeichen A, 60 s, 100%\n",
+                  "Zeilenformat beim Auslesen falsch");
+}
+
+bool verifyCompiledOutLevels() {
+    clearLogBuffer();
+    evaluated = 0;
+    LOG_DEBUG(DISPLAY, "nie sichtbar %d", countEvaluation());
+    LOG_INFO(WEB, "Web ist abgeschaltet %d", countEvaluation());
+    LOG_ERROR(WIFI, "WLAN-Fehler %d", countEvaluation());
+    return expect(evaluated == 1, "Argumente abgeschalteter Stufen wurden ausgewertet") &&
+           expect(getLogNextSequence() == 1, "Abgeschaltete Stufe hat Eintrag belegt") &&
+           expect(render().find("WIFI E WLAN-Fehler 1") != std::string::npos, "Aktive Stufe fehlt im Puffer");
+}
+
+bool verifyStringArgumentsAreCopied() {
+    clearLogBuffer();
+    hostMillis() = 5;
+    char ssid[] = "Werkstatt";
+    LOG_INFO(WIFI, "Verbunden mit %-10s|%s", ssid, "");
+    std::strcpy(ssid, "xxxxxxxx");
+
+    const std::string longText(LOG_ENTRY_TEXT_LENGTH * 2, 'y');
+    LOG_INFO(WIFI, "%s und %s", longText.c_str(), "weg");
+    LOG_INFO(WIFI, "%u %u %u %u %u %u", 1U, 2U, 3U, 4U, 5U, 6U);
+
+    const std::string expected = "5 WIFI I Verbunden mit Werkstatt |\n"
+                                 "5 WIFI I " + std::string(LOG_ENTRY_TEXT_LENGTH - 1, 'y') + " und ?\n"
+                                 "5 WIFI I 1 2 3 4 5 ?\n";
+    return expect(render() == expected, "String-Kopie, Kürzung oder Argumentgrenze falsch");
+}
+
+bool verifySequenceCursorAcrossWraparound() {
+    clearLogBuffer();
+    hostMillis() = 7;
+    const uint32_t total = LOG_ENTRY_COUNT + 3;
+    for (uint32_t index = 0; index < total; ++index) {
+        LOG_INFO(TRIGGER, "Zeile %u", static_cast<unsigned>(index));
+    }
+
+    LogEntry entry;
+    const bool cursor = expect(getLogNextSequence() == total && getLogOldestSequence() == 3,
+                               "Sequenzgrenzen nach Überlauf falsch") &&
+                        expect(!readLogEntry(2, entry), "Überschriebener Eintrag noch lesbar") &&
+                        expect(readLogEntry(3, entry) && entry.sequence == 3, "Ältester Eintrag nicht lesbar") &&
+                        expect(!readLogEntry(total, entry), "Eintrag hinter dem Ende lesbar");
+    const std::string lastLine = "7 TRG I Zeile " + std::to_string(total - 1) + "\n";
+    return cursor &&
+           expect(render(total - 1) == lastLine, "Inkrementelles Lesen liefert nicht nur neue Einträge") &&
+           expect(render(total).empty(), "Leser ohne neue Einträge bekommt Daten") &&
+           expect(render().rfind("7 TRG I Zeile 3\n", 0) == 0, "Auslesen beginnt nicht beim ältesten Eintrag");
+}
+
+bool verifyLineTruncation() {
+    clearLogBuffer();
+    LOG_INFO(CONFIG, "%s%s%s%s", std::string(39, 'a').c_str(), "b", "c", "d");
+    LogEntry entry;
+    char small[8];
+    return expect(readLogEntry(0, entry), "Eintrag fehlt") &&
+           expect(formatLogMessage(entry, small, sizeof(small)) == sizeof(small) - 1 &&
+                      std::string(small) == "aaaaaaa",
+                  "Ausgabe nicht auf Zielpuffer gekürzt");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyFormattingAndTags() || !verifyCompiledOutLevels() || !verifyStringArgumentsAreCopied() ||
+        !verifySequenceCursorAcrossWraparound() || !verifyLineTruncation()) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include "config.h"
+#include "rtc_manager.h"
+#include "trigger_handler.h"
+#include "wifi_manager.h"
+
+#include <LittleFS.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+WiFiClass WiFi;
+Ticker display_ticker;
+bool triggerActive = false;
+bool alreadyCleared = false;
+bool wifiDisabled = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+// **Host-Ersatz für rtc_manager/web_manager**
+// Fester Wochentag, damit Farbe und Bitmap jedes Durchlaufs reproduzierbar sind.
+namespace {
+constexpr int GOLDEN_WEEKDAY = 3;
+}
+
+void enableRTC() {}
+void enableRS485() {}
+void initializeTimezone() {}
+bool updateCachedWeekday(bool) { return true; }
+bool isWeekdayCacheValid() { return true; }
+int getCachedWeekday() { return GOLDEN_WEEKDAY; }
+void invalidateWeekdayCache() {}
+bool getRTCMinutesOfDay(uint16_t &minutesOfDay) {
+    minutesOfDay = 12 * 60;
+    return true;
+}
+String getRTCTime() { return "12:00:00"; }
+int getRTCWeekday() { return GOLDEN_WEEKDAY; }
+bool setRTCFromWeb(const String &, const String &) { return false; }
+bool syncTimeWithNTP() { return false; }
+void setupWebServer() {}
+
+namespace {
+
+struct FrameResult {
+    std::string name;
+    bool drawn;
+};
+
+void resetRenderState() {
+    display.resetPanel();
+    triggerActive = false;
+    alreadyCleared = false;
+    wifiSymbolVisible = false;
+    wifiConnected = false;
+    wifiDisabled = true;
+}
+
+// Übernimmt einen präsentierten Frame wie der display_ticker in den sichtbaren Puffer.
+void refreshPanel() {
+    display_updater();
+}
+
+std::string frameName(char symbol) {
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "symbol_%02X", static_cast<unsigned char>(symbol));
+    return buffer;
+}
+
+void printFrame(const std::string &name, bool drawn) {
+    char hash[9];
+    std::snprintf(hash, sizeof(hash), "%08x", display.visibleFrameHash());
+    std::cout << name << ' ' << (drawn ? "ok" : "fail") << ' ' << hash << ' '
+              << display.countVisiblePixelsNot(display.visiblePixel(0, 0)) << ' '
+              << (display.drawCalls() + display.fillScreenCalls + display.clearDisplayCalls) << ' '
+              << display.showBufferCalls << std::endl;
+}
+
+// ASCII-Abbild des sichtbaren Frames: '.' = Farbe von Pixel (0,0), '#' = alles andere.
+void printAsciiFrame(const std::string &name) {
+    const uint16_t background = display.visiblePixel(0, 0);
+    std::cout << "== " << name << " ==" << std::endl;
+    for (int16_t y = 0; y < display.height(); ++y) {
+        std::string line;
+        for (int16_t x = 0; x < display.width(); ++x) {
+            line.push_back(display.visiblePixel(x, y) == background ? '.' : '#');
+        }
+        std::cout << line << std::endl;
+    }
+}
+
+void emit(const std::string &name, bool drawn, const char *asciiTarget) {
+    if (asciiTarget == nullptr) {
+        printFrame(name, drawn);
+    } else if (name == asciiTarget) {
+        printAsciiFrame(name);
+    }
+}
+
+} // namespace
+
+// Aufruf ohne Argument: eine Zeile "<name> <ok|fail> <hash> <pixel> <aufrufe> <tausch>" pro Frame.
+// Aufruf mit "--ascii <name>": ASCII-Abbild genau dieses Frames.
+int main(int argc, char **argv) {
+    const char *asciiTarget = nullptr;
+    if (argc == 3 && std::strcmp(argv[1], "--ascii") == 0) {
+        asciiTarget = argv[2];
+    }
+
+    display_brightness = 100;
+    for (size_t trigger = 0; trigger < NUM_TRIGGERS; ++trigger) {
+        std::strncpy(dailyLetterColors[trigger][GOLDEN_WEEKDAY], "#FFA500", COLOR_STRING_LENGTH);
+        dailyLetterColorModes[trigger][GOLDEN_WEEKDAY] = static_cast<uint8_t>(LetterColorMode::Fixed);
+    }
+
+    for (int value = 0x20; value < 0x7F; ++value) {
+        const char symbol = static_cast<char>(value);
+        if (getFactorySymbolBitmap(symbol) == nullptr) {
+            continue;
+        }
+
+        resetRenderState();
+        const bool drawn = displayLetter(0, symbol);
+        refreshPanel();
+        emit(frameName(symbol), drawn, asciiTarget);
+    }
+
+    resetRenderState();
+    wifi_status_symbol_enabled = true;
+    wifi_operation_mode = static_cast<uint8_t>(WiFiOperationMode::TimedManager);
+    wifiConnected = true;
+    wifiDisabled = false;
+    drawWiFiSymbol();
+    refreshPanel();
+    emit("wifi_symbol", wifiSymbolVisible, asciiTarget);
+
+    triggerActive = false;
+    alreadyCleared = false;
+    display.resetCounters();
+    wifiConnected = false;
+    clearDisplay();
+    refreshPanel();
+    emit("clear_display", alreadyCleared, asciiTarget);
+
+    return 0;
+}
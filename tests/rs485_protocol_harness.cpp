@@ -0,0 +1,121 @@
+#include "rs485_protocol.h"
+
+#include <iostream>
+#include <vector>
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+std::vector<uint8_t> buildFrame(uint8_t address, std::initializer_list<uint8_t> triggerIds) {
+    std::vector<uint8_t> frame = {RS485_FRAME_START, address, static_cast<uint8_t>(triggerIds.size())};
+    frame.insert(frame.end(), triggerIds.begin(), triggerIds.end());
+    frame.push_back(rs485Crc8(frame.data() + 1, frame.size() - 1));
+    return frame;
+}
+
+// Speist alle Bytes ein und sammelt die gemeldeten Trigger-Indizes.
+std::vector<uint8_t> feed(const std::vector<uint8_t> &bytes, uint8_t boxAddress, unsigned long now = 1000UL) {
+    std::vector<uint8_t> triggers;
+    for (uint8_t value : bytes) {
+        Rs485ParseResult result = {};
+        if (feedRs485Byte(value, now, boxAddress, result)) {
+            triggers.insert(triggers.end(), result.triggerIndices, result.triggerIndices + result.triggerCount);
+        }
+    }
+    return triggers;
+}
+
+bool verifyCrcReference() {
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    return expect(rs485Crc8(check, sizeof(check)) == 0xF4, "CRC-8 (0x07) Prüfwert falsch");
+}
+
+bool verifyMultiTriggerFrameAndLegacy() {
+    resetRs485Parser();
+    std::vector<uint8_t> stream = {'1', '\r', '\n'};
+    const std::vector<uint8_t> frame = buildFrame(5, {3, 1, 2});
+    stream.insert(stream.end(), frame.begin(), frame.end());
+    stream.push_back('2');
+
+    const std::vector<uint8_t> triggers = feed(stream, 5);
+    const Rs485ReceiveStats &stats = getRs485ReceiveStats();
+    return expect(triggers == std::vector<uint8_t>({0, 2, 0, 1, 1}), "Trigger-Reihenfolge aus Frame/Legacy falsch") &&
+           expect(stats.frames == 1 && stats.legacyTriggers == 2, "Frame-/Legacy-Zähler falsch") &&
+           expect(stats.noiseBytes == 0, "Zeilenende als Störbyte gezählt");
+}
+
+bool verifyAddressing() {
+    resetRs485Parser();
+    std::vector<uint8_t> stream = buildFrame(7, {1});
+    const std::vector<uint8_t> broadcast = buildFrame(RS485_BROADCAST_ADDRESS, {2});
+    stream.insert(stream.end(), broadcast.begin(), broadcast.end());
+
+    const bool filtered = expect(feed(stream, 5) == std::vector<uint8_t>({1}), "Fremde Adresse nicht gefiltert") &&
+                          expect(getRs485ReceiveStats().foreignFrames == 1, "Fremder Frame nicht gezählt");
+    resetRs485Parser();
+    return filtered &&
+           expect(feed(stream, RS485_BROADCAST_ADDRESS) == std::vector<uint8_t>({0, 1}),
+                  "Box ohne Adresse nimmt nicht alle Frames an");
+}
+
+bool verifyCorruptionAndNoise() {
+    resetRs485Parser();
+    std::vector<uint8_t> corrupted = buildFrame(0, {1, 2});
+    corrupted[3] = 3;  // Trigger-ID nach CRC-Berechnung verändert
+    std::vector<uint8_t> stream = {0x00, 0xFF, 'x'};
+    stream.insert(stream.end(), corrupted.begin(), corrupted.end());
+    const std::vector<uint8_t> invalidId = buildFrame(0, {4});
+    stream.insert(stream.end(), invalidId.begin(), invalidId.end());
+    const std::vector<uint8_t> valid = buildFrame(0, {3});
+    stream.insert(stream.end(), valid.begin(), valid.end());
+
+    const std::vector<uint8_t> triggers = feed(stream, 0);
+    const Rs485ReceiveStats &stats = getRs485ReceiveStats();
+    return expect(triggers == std::vector<uint8_t>({2}), "Beschädigter Frame wurde ausgewertet") &&
+           expect(stats.crcErrors == 1 && stats.malformedFrames == 1, "CRC-/Formatfehler nicht gezählt") &&
+           expect(stats.noiseBytes == 3, "Störbytes nicht gezählt");
+}
+
+bool verifySplitFrameAndTimeout() {
+    resetRs485Parser();
+    const std::vector<uint8_t> frame = buildFrame(0, {2});
+    std::vector<uint8_t> triggers = feed({frame.begin(), frame.begin() + 2}, 0, 1000UL);
+    std::vector<uint8_t> rest = feed({frame.begin() + 2, frame.end()}, 0, 1000UL + RS485_FRAME_TIMEOUT_MS);
+    if (!expect(triggers.empty() && rest == std::vector<uint8_t>({1}), "Über zwei Durchläufe verteilter Frame verloren")) {
+        return false;
+    }
+
+    // Abgerissener Frame: Rest kommt zu spät und darf nicht als Frame zählen.
+    triggers = feed({frame.begin(), frame.begin() + 3}, 0, 2000UL);
+    rest = feed({frame.begin() + 3, frame.end()}, 0, 2001UL + RS485_FRAME_TIMEOUT_MS);
+    const std::vector<uint8_t> recovered = feed({'3'}, 0, 2100UL);
+    return expect(triggers.empty() && rest.empty(), "Verspäteter Frame-Rest wurde ausgewertet") &&
+           expect(getRs485ReceiveStats().timeouts == 1, "Frame-Timeout nicht gezählt") &&
+           expect(recovered == std::vector<uint8_t>({2}), "Parser nach Timeout nicht wieder bereit");
+}
+
+bool verifyLengthLimits() {
+    resetRs485Parser();
+    const std::vector<uint8_t> oversized = {RS485_FRAME_START, 0, RS485_FRAME_MAX_TRIGGERS + 1};
+    const std::vector<uint8_t> full = buildFrame(0, {1, 2, 3, 1, 2, 3, 1, 2});
+    std::vector<uint8_t> stream = oversized;
+    stream.insert(stream.end(), full.begin(), full.end());
+    return expect(feed(stream, 0).size() == RS485_FRAME_MAX_TRIGGERS, "Voller Frame nicht vollständig ausgewertet") &&
+           expect(getRs485ReceiveStats().malformedFrames == 1, "Überlanger Frame nicht verworfen");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyCrcReference() || !verifyMultiTriggerFrameAndLegacy() || !verifyAddressing() ||
+        !verifyCorruptionAndNoise() || !verifySplitFrameAndTimeout() || !verifyLengthLimits()) {
+        return 1;
+    }
+    return 0;
+}
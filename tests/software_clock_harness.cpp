@@ -0,0 +1,98 @@
+#include "software_clock.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+// 04.03.2024 (Montag) 13:45:30 Ortszeit
+constexpr uint32_t MONDAY_AFTERNOON = 1709559930UL;
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+bool verifyCalendarHelpers() {
+    return expect(minutesOfDayFromEpoch(MONDAY_AFTERNOON) == 13U * 60U + 45U, "Minuten des Tages falsch") &&
+           expect(weekdayFromEpoch(MONDAY_AFTERNOON) == 1, "Wochentag falsch") &&
+           expect(weekdayFromEpoch(0) == 4, "01.01.1970 ist kein Donnerstag") &&
+           expect(minutesOfDayFromEpoch(MONDAY_AFTERNOON - 49530UL - 1UL) == 23U * 60U + 59U, "Mitternacht falsch");
+}
+
+bool verifyExtrapolationBetweenSyncs() {
+    resetSoftwareClock();
+    if (!expect(!isSoftwareClockValid() && isSoftwareClockResyncDue(0), "Ungestellte Uhr gilt als gültig")) {
+        return false;
+    }
+    disciplineSoftwareClock(MONDAY_AFTERNOON, 5000UL);
+    return expect(isSoftwareClockValid(), "Uhr nach Abgleich ungültig") &&
+           expect(getSoftwareClockEpoch(5000UL + 600000UL) == MONDAY_AFTERNOON + 600UL, "Fortschreibung falsch") &&
+           expect(!isSoftwareClockResyncDue(5000UL + RTC_RESYNC_INTERVAL_MS - 1UL), "Abgleich zu früh fällig") &&
+           expect(isSoftwareClockResyncDue(5000UL + RTC_RESYNC_INTERVAL_MS), "Abgleich nicht fällig");
+}
+
+bool verifyStepAndMillisRollover() {
+    resetSoftwareClock();
+    const unsigned long beforeRollover = 0xFFFFFFFFUL - 30000UL;
+    disciplineSoftwareClock(MONDAY_AFTERNOON, beforeRollover);
+    const unsigned long afterRollover = beforeRollover + 60000UL;  // läuft über
+    if (!expect(getSoftwareClockEpoch(afterRollover) == MONDAY_AFTERNOON + 60UL, "millis()-Überlauf verfälscht Zeit")) {
+        return false;
+    }
+    disciplineSoftwareClock(MONDAY_AFTERNOON + 3600UL, afterRollover);
+    return expect(getSoftwareClockEpoch(afterRollover) == MONDAY_AFTERNOON + 3600UL, "Gestellte Zeit nicht übernommen");
+}
+
+// millis() läuft 150 ppm zu langsam; abgeglichen wird im Firmware-Intervall über zwölf Stunden.
+bool verifyDriftIsLearned() {
+    resetSoftwareClock();
+    const double millisPerSecond = 1000.0 * (1.0 - 150e-6);
+    double worstError = 0.0;
+    for (uint32_t elapsedSeconds = 0; elapsedSeconds <= 12UL * 3600UL; elapsedSeconds += 60UL) {
+        const unsigned long now = static_cast<unsigned long>(std::llround(elapsedSeconds * millisPerSecond));
+        if (isSoftwareClockResyncDue(now)) {
+            disciplineSoftwareClock(MONDAY_AFTERNOON + elapsedSeconds, now);
+        }
+        const double error = static_cast<double>(getSoftwareClockEpoch(now)) - (MONDAY_AFTERNOON + elapsedSeconds);
+        worstError = std::max(worstError, std::fabs(error));
+    }
+    const int32_t drift = getSoftwareClockDriftPpm();
+    return expect(drift >= 100 && drift <= 200, "Gangabweichung nicht geschätzt") &&
+           expect(worstError <= 1.0, "Fortgeschriebene Zeit weicht mehr als eine Sekunde ab");
+}
+
+// Wie verifyDriftIsLearned(), aber über 60 Tage mit 32-Bit-millis() wie auf dem Gerät: nach dem
+// Überlauf darf die Messstrecke nicht auf wenige Stunden schrumpfen und die Schätzung sättigen.
+bool verifyDriftSurvivesMillisWrap() {
+    resetSoftwareClock();
+    const double millisPerSecond = 1000.0 * (1.0 - 150e-6);
+    const uint32_t resyncSeconds = RTC_RESYNC_INTERVAL_MS / 1000UL;
+    double worstError = 0.0;
+    for (uint32_t elapsedSeconds = 0; elapsedSeconds <= 60UL * 86400UL; elapsedSeconds += resyncSeconds) {
+        const uint32_t now = static_cast<uint32_t>(std::llround(elapsedSeconds * millisPerSecond));
+        const uint32_t beforeSync = now - 1000U;
+        if (elapsedSeconds > 0) {
+            const double error =
+                static_cast<double>(getSoftwareClockEpoch(beforeSync)) - (MONDAY_AFTERNOON + elapsedSeconds - 1UL);
+            worstError = std::max(worstError, std::fabs(error));
+        }
+        disciplineSoftwareClock(MONDAY_AFTERNOON + elapsedSeconds, now);
+    }
+    const int32_t drift = getSoftwareClockDriftPpm();
+    return expect(drift >= 100 && drift <= 200, "Gangabweichung nach millis()-Überlauf falsch geschätzt") &&
+           expect(worstError <= 1.0, "Fortgeschriebene Zeit weicht nach millis()-Überlauf ab");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyCalendarHelpers() || !verifyExtrapolationBetweenSyncs() || !verifyStepAndMillisRollover() ||
+        !verifyDriftIsLearned() || !verifyDriftSurvivesMillisWrap()) {
+        return 1;
+    }
+    return 0;
+}
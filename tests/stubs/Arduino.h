@@ -9,6 +9,12 @@ using String = std::string;
 
 #define PROGMEM
 #define F(x) x
+using __FlashStringHelper = char;
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+#define pgm_read_word(address) (*reinterpret_cast<const uint16_t *>(address))
+#define pgm_read_dword(address) (*reinterpret_cast<const uint32_t *>(address))
+#define PGM_P const char *
+#define strncpy_P strncpy
 
 #define D0 0
 #define D1 1
@@ -20,7 +26,35 @@ using String = std::string;
 #define D7 7
 #define D8 8
 
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
 struct SerialClass {
+    // Eingabepuffer für Tests: push() legt Bytes ab, read() entnimmt sie in Reihenfolge.
+    void push(const std::string &bytes) { input += bytes; }
+    int available() const { return static_cast<int>(input.size()); }
+    int read() {
+        if (input.empty()) {
+            return -1;
+        }
+        const int value = static_cast<unsigned char>(input.front());
+        input.erase(input.begin());
+        return value;
+    }
+    size_t readBytes(uint8_t *buffer, size_t length) {
+        size_t count = 0;
+        while (count < length && !input.empty()) {
+            buffer[count++] = static_cast<uint8_t>(read());
+        }
+        return count;
+    }
+    size_t setRxBufferSize(size_t size) { return size; }
+    void begin(unsigned long) {}
+    void flush() {}
+    void end() {}
+
     template <typename T>
     SerialClass &print(const T &) {
         return *this;
@@ -34,6 +68,8 @@ struct SerialClass {
     SerialClass &println() {
         return *this;
     }
+
+    std::string input;
 };
 
 extern SerialClass Serial;
@@ -44,6 +80,39 @@ struct ESPClass {
 
 extern ESPClass ESP;
 
-inline void delay(unsigned long) {}
+// Virtuelle Zeit: Tests stellen sie über hostMillis() direkt ein, delay() schiebt sie weiter.
+inline unsigned long &hostMillis() {
+    static unsigned long value = 0;
+    return value;
+}
+
+inline unsigned long millis() { return hostMillis(); }
+
+inline void delay(unsigned long ms) { hostMillis() += ms; }
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+
+// Deterministischer Zufall (LCG), damit Host-Läufe reproduzierbar bleiben.
+inline uint32_t &hostRandomState() {
+    static uint32_t state = 1;
+    return state;
+}
+
+inline void randomSeed(unsigned long seed) { hostRandomState() = static_cast<uint32_t>(seed); }
+
+inline long random(long maxValue) {
+    if (maxValue <= 0) {
+        return 0;
+    }
+    hostRandomState() = (hostRandomState() * 1103515245UL) + 12345UL;
+    return static_cast<long>((hostRandomState() >> 16) % static_cast<uint32_t>(maxValue));
+}
+
+inline long random(long minValue, long maxValue) {
+    return maxValue <= minValue ? minValue : minValue + random(maxValue - minValue);
+}
+inline void noInterrupts() {}
+inline void interrupts() {}
 
 #endif
@@ -0,0 +1,4 @@
+#ifndef ARDUINOJSON_H
+#define ARDUINOJSON_H
+
+#endif
@@ -31,7 +31,22 @@ class FakeEEPROMClass {
         std::memcpy(buffer.data() + address, &value, storedSize);
     }
 
-    void commit() {}
+    uint8_t read(int address) const {
+        ensureCapacity(address, 1);
+        return buffer[static_cast<size_t>(address)];
+    }
+
+    void write(int address, uint8_t value) {
+        ensureCapacity(address, 1);
+        buffer[static_cast<size_t>(address)] = value;
+    }
+
+    bool commit() {
+        ++commitCount;
+        return true;
+    }
+
+    size_t commitCount = 0;
 
     void fill(uint8_t value) {
         std::fill(buffer.begin(), buffer.end(), value);
@@ -1,11 +1,19 @@
 #ifndef ESP8266WIFI_H
 #define ESP8266WIFI_H
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 
+#include "Arduino.h"
+
 class IPAddress {
 public:
+    IPAddress() = default;
+    IPAddress(uint32_t) {}
+
+    String toString() const { return "0.0.0.0"; }
+
     bool fromString(const char *value) {
         if (value == nullptr || *value == '\0') {
             return false;
@@ -35,4 +43,31 @@ public:
     }
 };
 
+enum WiFiMode_t { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 };
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 };
+
+// Minimaler WLAN-Ersatz: Verbindungen schlagen fehl, ein SoftAP startet immer.
+class WiFiClass {
+public:
+    bool mode(WiFiMode_t value) {
+        currentMode = value;
+        return true;
+    }
+    void persistent(bool) {}
+    bool hostname(const char *) { return true; }
+    bool config(IPAddress, IPAddress, IPAddress, IPAddress = IPAddress()) { return true; }
+    wl_status_t begin(const char *, const char *) { return WL_DISCONNECTED; }
+    bool disconnect(bool = false) { return true; }
+    wl_status_t status() const { return WL_DISCONNECTED; }
+    IPAddress localIP() const { return IPAddress(); }
+    bool softAP(const char *, const char *) { return true; }
+    bool softAPdisconnect(bool = false) { return true; }
+    IPAddress softAPIP() const { return IPAddress(); }
+    uint8_t softAPgetStationNum() const { return 0; }
+
+    WiFiMode_t currentMode = WIFI_OFF;
+};
+
+extern WiFiClass WiFi;
+
 #endif
@@ -4,6 +4,8 @@
 class AsyncWebServer {
   public:
     explicit AsyncWebServer(int) {}
+    void begin() {}
+    void end() {}
 };
 
 #endif
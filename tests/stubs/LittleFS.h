@@ -0,0 +1,118 @@
+#ifndef LITTLEFS_H
+#define LITTLEFS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Dateisystem im RAM: Dateien überleben close()/open(), bis ein Test sie in `files` verändert.
+// writeBudget begrenzt die insgesamt noch schreibbaren Bytes (Stromausfall mitten im Schreiben).
+class File {
+  public:
+    File() = default;
+    File(std::vector<uint8_t> *data, size_t position, size_t *writeBudget)
+        : data(data), offset(position), writeBudget(writeBudget) {}
+
+    explicit operator bool() const { return data != nullptr; }
+    size_t size() const { return data != nullptr ? data->size() : 0; }
+    size_t position() const { return offset; }
+    int available() const { return static_cast<int>(size() - offset); }
+
+    bool seek(size_t position) {
+        if (data == nullptr || position > data->size()) {
+            return false;
+        }
+        offset = position;
+        return true;
+    }
+
+    int read() {
+        uint8_t value = 0;
+        return read(&value, 1) == 1 ? value : -1;
+    }
+
+    size_t read(uint8_t *buffer, size_t length) {
+        if (data == nullptr) {
+            return 0;
+        }
+        const size_t count = std::min(length, data->size() - offset);
+        std::copy(data->begin() + offset, data->begin() + offset + count, buffer);
+        offset += count;
+        return count;
+    }
+
+    size_t write(uint8_t value) { return write(&value, 1); }
+
+    size_t write(const uint8_t *buffer, size_t length) {
+        if (data == nullptr || writeBudget == nullptr) {
+            return 0;
+        }
+        const size_t count = std::min(length, *writeBudget);
+        *writeBudget -= count;
+        if (data->size() < offset + count) {
+            data->resize(offset + count);
+        }
+        std::copy(buffer, buffer + count, data->begin() + offset);
+        offset += count;
+        return count;
+    }
+
+    void flush() {}
+    void close() { data = nullptr; }
+
+  private:
+    std::vector<uint8_t> *data = nullptr;
+    size_t offset = 0;
+    size_t *writeBudget = nullptr;
+};
+
+class FakeFileSystem {
+  public:
+    bool begin() { return true; }
+    bool format() {
+        files.clear();
+        return true;
+    }
+    bool exists(const std::string &path) const { return files.count(path) != 0; }
+    bool remove(const std::string &path) { return files.erase(path) != 0; }
+    // Wie SPIFFS: ein vorhandenes Ziel wird nicht ersetzt (LittleFS würde es atomar überschreiben).
+    bool rename(const std::string &from, const std::string &to) {
+        auto source = files.find(from);
+        if (source == files.end() || files.count(to) != 0) {
+            return false;
+        }
+        std::vector<uint8_t> data = std::move(source->second);
+        files.erase(source);
+        files[to] = std::move(data);
+        return true;
+    }
+
+    // Modi wie beim Arduino-FS: "r" lesen, "r+" vorhandene Datei überschreiben, "w" neu anlegen, "a" anhängen.
+    File open(const std::string &path, const char *mode) {
+        const std::string openMode = mode != nullptr ? mode : "r";
+        ++openCount;
+        if (openMode == "r" || openMode == "r+") {
+            auto existing = files.find(path);
+            if (existing == files.end()) {
+                return File();
+            }
+            return File(&existing->second, 0, openMode == "r+" ? &writeBudget : nullptr);
+        }
+        std::vector<uint8_t> &data = files[path];
+        if (openMode == "w") {
+            data.clear();
+        }
+        return File(&data, openMode == "a" ? data.size() : 0, &writeBudget);
+    }
+
+    std::map<std::string, std::vector<uint8_t>> files;
+    size_t writeBudget = SIZE_MAX;
+    size_t openCount = 0;  // Zähler für Tests, die Dateizugriffe beim Start begrenzen
+};
+
+extern FakeFileSystem LittleFS;
+
+#endif
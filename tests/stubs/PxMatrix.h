@@ -1,15 +1,187 @@
 #ifndef PXMATRIX_H
 #define PXMATRIX_H
 
+#include <cstdint>
+#include <cstring>
+
+// **Virtuelle 64x64-Matrix für Host-Tests**
+// Hält zwei RGB565-Framebuffer (sichtbar/unsichtbar) und zählt alle
+// Zeichenaufrufe, damit Tests Bildinhalt und Renderaufwand prüfen können.
 class PxMATRIX {
   public:
-    PxMATRIX(int, int, int, int, int, int, int, int, int) {}
+    static constexpr int16_t MAX_WIDTH = 64;
+    static constexpr int16_t MAX_HEIGHT = 64;
+
+    PxMATRIX(int width, int height, int, int, int, int, int, int, int)
+        : panelWidth(static_cast<int16_t>(width > MAX_WIDTH ? MAX_WIDTH : width)),
+          panelHeight(static_cast<int16_t>(height > MAX_HEIGHT ? MAX_HEIGHT : height)) {}
+
     void begin(int) {}
-    void setBrightness(int) {}
+    void setBrightness(int value) {
+        ++setBrightnessCalls;
+        brightness = value;
+    }
     void setFastUpdate(bool) {}
     void setDriverChip(int) {}
-    void display() {}
-    void clearDisplay() {}
+    void display() { ++displayCalls; }
+
+    // Doppelpuffer: gezeichnet wird in den unsichtbaren Puffer, showBuffer() tauscht.
+    void showBuffer() {
+        ++showBufferCalls;
+        activeBuffer = !activeBuffer;
+    }
+
+    int16_t width() const { return panelWidth; }
+    int16_t height() const { return panelHeight; }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) const {
+        return static_cast<uint16_t>(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+        ++drawPixelCalls;
+        plot(x, y, color);
+    }
+
+    void clearDisplay() {
+        ++clearDisplayCalls;
+        fillBuffer(drawBufferIndex(), 0);
+    }
+
+    void fillScreen(uint16_t color) {
+        ++fillScreenCalls;
+        fillBuffer(drawBufferIndex(), color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        ++fillRectCalls;
+        for (int16_t row = 0; row < h; ++row) {
+            for (int16_t column = 0; column < w; ++column) {
+                plot(static_cast<int16_t>(x + column), static_cast<int16_t>(y + row), color);
+            }
+        }
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        ++fastHLineCalls;
+        for (int16_t column = 0; column < w; ++column) {
+            plot(static_cast<int16_t>(x + column), y, color);
+        }
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        ++fastVLineCalls;
+        for (int16_t row = 0; row < h; ++row) {
+            plot(x, static_cast<int16_t>(y + row), color);
+        }
+    }
+
+    // **Auswertung**
+    uint16_t visiblePixel(int16_t x, int16_t y) const { return pixelAt(visibleBufferIndex(), x, y); }
+    uint16_t drawBufferPixel(int16_t x, int16_t y) const { return pixelAt(drawBufferIndex(), x, y); }
+    const uint16_t *visibleFrame() const { return buffers[visibleBufferIndex()]; }
+
+    // Zählt alle Pixel des sichtbaren Frames, die nicht die Hintergrundfarbe haben.
+    unsigned long countVisiblePixelsNot(uint16_t background) const {
+        unsigned long count = 0;
+        const uint16_t *frame = visibleFrame();
+        for (int16_t y = 0; y < panelHeight; ++y) {
+            for (int16_t x = 0; x < panelWidth; ++x) {
+                if (frame[(y * MAX_WIDTH) + x] != background) {
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+
+    // FNV-1a über den sichtbaren Frame (Little-Endian RGB565, zeilenweise).
+    uint32_t visibleFrameHash() const {
+        uint32_t hash = 2166136261UL;
+        const uint16_t *frame = visibleFrame();
+        for (int16_t y = 0; y < panelHeight; ++y) {
+            for (int16_t x = 0; x < panelWidth; ++x) {
+                const uint16_t value = frame[(y * MAX_WIDTH) + x];
+                hash = (hash ^ static_cast<uint8_t>(value & 0xFF)) * 16777619UL;
+                hash = (hash ^ static_cast<uint8_t>(value >> 8)) * 16777619UL;
+            }
+        }
+        return hash;
+    }
+
+    unsigned long drawCalls() const {
+        return drawPixelCalls + fillRectCalls + fastHLineCalls + fastVLineCalls;
+    }
+
+    void resetCounters() {
+        setBrightnessCalls = 0;
+        clearDisplayCalls = 0;
+        fillScreenCalls = 0;
+        drawPixelCalls = 0;
+        fillRectCalls = 0;
+        fastHLineCalls = 0;
+        fastVLineCalls = 0;
+        paintedPixels = 0;
+        displayCalls = 0;
+        showBufferCalls = 0;
+    }
+
+    // Setzt Framebuffer, Puffertausch und Zähler auf den Einschaltzustand zurück.
+    void resetPanel() {
+        resetCounters();
+        std::memset(buffers, 0, sizeof(buffers));
+        activeBuffer = false;
+        brightness = 0;
+    }
+
+    int brightness = 0;
+    unsigned long setBrightnessCalls = 0;
+    unsigned long clearDisplayCalls = 0;
+    unsigned long fillScreenCalls = 0;
+    unsigned long drawPixelCalls = 0;
+    unsigned long fillRectCalls = 0;
+    unsigned long fastHLineCalls = 0;
+    unsigned long fastVLineCalls = 0;
+    unsigned long paintedPixels = 0;
+    unsigned long displayCalls = 0;
+    unsigned long showBufferCalls = 0;
+
+  private:
+    int visibleBufferIndex() const { return activeBuffer ? 1 : 0; }
+
+    int drawBufferIndex() const {
+#ifdef PxMATRIX_double_buffer
+        return activeBuffer ? 0 : 1;
+#else
+        return visibleBufferIndex();
+#endif
+    }
+
+    uint16_t pixelAt(int index, int16_t x, int16_t y) const {
+        if (x < 0 || y < 0 || x >= panelWidth || y >= panelHeight) {
+            return 0;
+        }
+        return buffers[index][(y * MAX_WIDTH) + x];
+    }
+
+    void plot(int16_t x, int16_t y, uint16_t color) {
+        if (x < 0 || y < 0 || x >= panelWidth || y >= panelHeight) {
+            return;
+        }
+        buffers[drawBufferIndex()][(y * MAX_WIDTH) + x] = color;
+        ++paintedPixels;
+    }
+
+    void fillBuffer(int index, uint16_t color) {
+        for (size_t pixel = 0; pixel < static_cast<size_t>(MAX_WIDTH) * MAX_HEIGHT; ++pixel) {
+            buffers[index][pixel] = color;
+        }
+    }
+
+    int16_t panelWidth;
+    int16_t panelHeight;
+    bool activeBuffer = false;
+    uint16_t buffers[2][MAX_WIDTH * MAX_HEIGHT] = {};
 };
 
 #define FM6126A 0
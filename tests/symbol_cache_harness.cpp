@@ -0,0 +1,124 @@
+#include "config.h"
+#include "display_plan.h"
+#include "symbol_pack.h"
+
+#include <LittleFS.h>
+#include <cstring>
+#include <iostream>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+AsyncWebServer server(80);
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+// Bitmap mit dem Symbol als Füllmuster, damit Verwechslungen auffallen.
+void fillBitmap(char symbol, uint8_t (&bitmap)[SYMBOL_BITMAP_SIZE]) {
+    memset(bitmap, static_cast<uint8_t>(symbol), sizeof(bitmap));
+}
+
+bool showsOverride(char symbol) {
+    const uint8_t *bitmap = findEditableBuiltinSymbolBitmap(symbol);
+    return bitmap != nullptr && bitmap[0] == static_cast<uint8_t>(symbol) &&
+           bitmap[SYMBOL_BITMAP_SIZE - 1] == static_cast<uint8_t>(symbol);
+}
+
+uint32_t misses() {
+    return getSymbolCacheStats().misses;
+}
+
+bool verifyBootReadsOnlyFlags() {
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+    for (size_t index = 0; index < SYMBOL_CACHE_ENTRIES + 2; ++index) {
+        const char symbol = editableBuiltinSymbols[index];
+        fillBitmap(symbol, bitmap);
+        if (!saveEditableBuiltinSymbol(symbol, bitmap, true)) {
+            return expect(false, "Override nicht gespeichert");
+        }
+    }
+    fillBitmap('Z', bitmap);
+    saveEditableBuiltinSymbol('Z', bitmap, false);
+
+    initEditableSymbolStore();  // wie nach einem Neustart: Cache leer
+    const SymbolCacheStats before = getSymbolCacheStats();
+    DisplaySymbol symbol = {};
+    return expect(hasEditableBuiltinSymbolOverride(editableBuiltinSymbols[0]), "Freigabe nicht aus dem Index gelesen") &&
+           expect(!hasEditableBuiltinSymbolOverride('Z'), "Gesperrter Override gilt als aktiv") &&
+           expect(resolveDisplaySymbol(editableBuiltinSymbols[0], symbol) &&
+                      symbol.source == DisplaySymbolSource::BuiltinOverride,
+                  "Override nicht aufgelöst") &&
+           expect(getSymbolCacheStats().hits == before.hits && getSymbolCacheStats().misses == before.misses,
+                  "Auflösen liest Bitmaps");
+}
+
+bool verifyLeastRecentlyUsedEviction() {
+    const char first = editableBuiltinSymbols[0];
+    const uint32_t startMisses = misses();
+    for (size_t index = 0; index < SYMBOL_CACHE_ENTRIES; ++index) {
+        if (!expect(showsOverride(editableBuiltinSymbols[index]), "Override aus dem Paket falsch geladen")) {
+            return false;
+        }
+    }
+    const uint32_t hits = getSymbolCacheStats().hits;
+    if (!expect(misses() == startMisses + SYMBOL_CACHE_ENTRIES, "Erster Zugriff nicht als Fehlgriff gezählt") ||
+        !expect(showsOverride(first) && getSymbolCacheStats().hits == hits + 1, "Wiederholter Zugriff kein Treffer")) {
+        return false;
+    }
+
+    // Neues Symbol verdrängt den am längsten unbenutzten Eintrag (Index 1), nicht den eben benutzten.
+    const char extra = editableBuiltinSymbols[SYMBOL_CACHE_ENTRIES];
+    if (!expect(showsOverride(extra), "Verdrängendes Symbol falsch geladen")) {
+        return false;
+    }
+    const uint32_t afterEviction = misses();
+    return expect(showsOverride(first) && misses() == afterEviction, "Zuletzt benutzter Eintrag verdrängt") &&
+           expect(showsOverride(editableBuiltinSymbols[1]) && misses() == afterEviction + 1,
+                  "Ältester Eintrag nicht verdrängt");
+}
+
+bool verifyWritesAndClearsInvalidate() {
+    const char symbol = editableBuiltinSymbols[0];
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+    fillBitmap('x', bitmap);
+    saveEditableBuiltinSymbol(symbol, bitmap, true);
+    const uint8_t *cached = findEditableBuiltinSymbolBitmap(symbol);
+    if (!expect(cached != nullptr && cached[0] == 'x', "Gespeicherte Bitmap nicht im Cache")) {
+        return false;
+    }
+
+    uint8_t copy[SYMBOL_BITMAP_SIZE] = {};
+    clearEditableBuiltinSymbol(symbol);
+    if (!expect(findEditableBuiltinSymbolBitmap(symbol) == nullptr && !getEditableBuiltinSymbolBitmap(symbol, copy),
+                "Gelöschter Override noch im Cache")) {
+        return false;
+    }
+
+    // Abgeschnittenes Paket: Override wird abgeschaltet, Anzeige fällt auf den Default zurück.
+    const size_t brokenSlot = SYMBOL_CACHE_ENTRIES + 1;
+    const char broken = editableBuiltinSymbols[brokenSlot];
+    LittleFS.files["/symbols.pak"].resize(SYMBOL_PACK_FIRST_RECORD_OFFSET + brokenSlot * SYMBOL_BITMAP_SIZE + 1);
+    return expect(findEditableBuiltinSymbolBitmap(broken) == nullptr && !hasEditableBuiltinSymbolOverride(broken),
+                  "Defekter Symbol-Record nicht erkannt");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyBootReadsOnlyFlags() || !verifyLeastRecentlyUsedEviction() || !verifyWritesAndClearsInvalidate()) {
+        return 1;
+    }
+    return 0;
+}
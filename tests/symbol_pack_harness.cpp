@@ -0,0 +1,280 @@
+#include "config.h"
+#include "symbol_pack.h"
+
+#include <LittleFS.h>
+#include <cstring>
+#include <iostream>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+
+namespace {
+
+constexpr char PACK_PATH[] = "/symbols.pak";
+constexpr size_t COPY_STATE_OFFSET = 7;
+constexpr uint8_t COPY_COMPLETE = 0xC5;
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+std::vector<uint8_t> &packFile() {
+    return LittleFS.files[PACK_PATH];
+}
+
+uint8_t packRecordByte(size_t slot) {
+    return packFile()[SYMBOL_PACK_FIRST_RECORD_OFFSET + slot * SYMBOL_BITMAP_SIZE];
+}
+
+// Einzeldatei älterer Firmware: Freigabe-Byte + Bitmap.
+void storeLegacySymbolFile(const char *path, uint8_t enabled, uint8_t fill, size_t bitmapSize) {
+    std::vector<uint8_t> &file = LittleFS.files[path];
+    file.assign(bitmapSize + 1, fill);
+    file[0] = enabled;
+}
+
+bool verifyLegacyFilesAreImported() {
+    LittleFS.files.clear();
+    storeLegacySymbolFile("/sym_41.bin", 1, 0xA1, SYMBOL_BITMAP_SIZE);  // 'A' freigegeben
+    storeLegacySymbolFile("/sym_42.bin", 0, 0xB2, SYMBOL_BITMAP_SIZE);  // 'B' gesperrt
+    storeLegacySymbolFile("/sym_43.bin", 1, 0xC3, 10);                  // 'C' abgeschnitten
+
+    if (!expect(initEditableSymbolStore(), "Symbol-Paket nicht angelegt")) {
+        return false;
+    }
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE] = {};
+    return expect(LittleFS.files.size() == 1 && packFile().size() == SYMBOL_PACK_FILE_SIZE,
+                  "Einzeldateien nach der Übernahme nicht gelöscht") &&
+           expect(getEditableBuiltinSymbolBitmap('A', bitmap) && bitmap[SYMBOL_BITMAP_SIZE - 1] == 0xA1,
+                  "Freigegebener Override nicht übernommen") &&
+           expect(!hasEditableBuiltinSymbolOverride('B') && packRecordByte(symbolPackSlot('B')) == 0xB2,
+                  "Gesperrter Override nicht samt Bitmap übernommen") &&
+           expect(!hasEditableBuiltinSymbolOverride('C'), "Abgeschnittene Datei übernommen");
+}
+
+bool verifyBootOpensPackOnce() {
+    const size_t opens = LittleFS.openCount;
+    initEditableSymbolStore();
+    return expect(LittleFS.openCount == opens + 1, "Start öffnet mehr als das Symbol-Paket") &&
+           expect(hasEditableBuiltinSymbolOverride('A'), "Freigabe nach dem Neustart verloren");
+}
+
+bool verifyUpdatesRewriteInPlace() {
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+    memset(bitmap, 0x5A, sizeof(bitmap));
+    const std::vector<uint8_t> before = packFile();
+    const size_t slot = static_cast<size_t>(symbolPackSlot('Z'));
+    if (!expect(saveEditableBuiltinSymbol('Z', bitmap, true), "Override nicht gespeichert")) {
+        return false;
+    }
+
+    const std::vector<uint8_t> &after = packFile();
+    size_t changed = 0;
+    for (size_t offset = 0; offset < after.size(); ++offset) {
+        if (after[offset] != before[offset]) {
+            const bool inRecord = offset >= SYMBOL_PACK_FIRST_RECORD_OFFSET + slot * SYMBOL_BITMAP_SIZE &&
+                                  offset < SYMBOL_PACK_FIRST_RECORD_OFFSET + (slot + 1) * SYMBOL_BITMAP_SIZE;
+            const bool inIndex = offset == SYMBOL_PACK_HEADER_SIZE + slot * SYMBOL_PACK_INDEX_ENTRY_SIZE + 1;
+            if (!inRecord && !inIndex) {
+                return expect(false, "Speichern verändert fremde Bytes");
+            }
+            ++changed;
+        }
+    }
+    if (!expect(after.size() == SYMBOL_PACK_FILE_SIZE && changed == SYMBOL_BITMAP_SIZE + 1,
+                "Record nicht an Ort und Stelle überschrieben")) {
+        return false;
+    }
+
+    clearEditableBuiltinSymbol('Z');
+    initEditableSymbolStore();
+    return expect(!hasEditableBuiltinSymbolOverride('Z') && packFile().size() == SYMBOL_PACK_FILE_SIZE,
+                  "Gelöschter Override nach dem Neustart aktiv");
+}
+
+bool verifyCustomSymbolsMoveIntoPack() {
+    // Stand älterer Firmware: Zusatz-Symbole nur im EEPROM, kein Paket.
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.fill(0xFF);
+    loadConfig();
+    LittleFS.files.clear();
+    EEPROM.raw()[EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_BITMAPS + 2 * SYMBOL_BITMAP_SIZE] = 0x3C;
+    EEPROM.raw()[EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_ENABLED + 2] = 1;
+
+    loadConfig();
+    flushConfig();
+    const char symbol = customSymbolFromId(2);
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE] = {};
+    bool enabled = false;
+    if (!expect(readCustomSymbol(symbol, bitmap, enabled) && enabled && bitmap[0] == 0x3C,
+                "Zusatz-Symbol aus EEPROM verloren") ||
+        !expect(packRecordByte(symbolPackSlot(symbol)) == 0x3C, "Zusatz-Symbol nicht ins Paket geschrieben") ||
+        !expect(!hasCustomSymbol(customSymbolFromId(3)), "Leerer EEPROM-Slot als Zusatz-Symbol übernommen")) {
+        return false;
+    }
+
+    // Ab jetzt gilt das Paket; der alte EEPROM-Inhalt wird ignoriert.
+    EEPROM.raw()[EEPROM_LEGACY_OFFSET_CUSTOM_SYMBOL_BITMAPS + 2 * SYMBOL_BITMAP_SIZE] = 0x00;
+    loadConfig();
+    initEditableSymbolStore();  // wie setup(): Freigaben nach loadConfig() einlesen
+    const size_t opens = LittleFS.openCount;
+    if (!expect(hasCustomSymbol(symbol) && !hasCustomSymbol(customSymbolFromId(3)) && LittleFS.openCount == opens,
+                "Freigabe eines Zusatz-Symbols liest das Symbol-Paket")) {
+        return false;
+    }
+    return expect(readCustomSymbol(symbol, bitmap, enabled) && bitmap[0] == 0x3C, "Zusatz-Symbol nicht aus dem Paket") &&
+           expect(!symbolPackAwaitsLegacyCustomSymbols(), "Übernahme nicht im Paketkopf vermerkt") &&
+           expect(getDirtyConfigSections() == CONFIG_SECTION_NONE, "Zusatz-Symbole erneut übernommen");
+}
+
+// Tagesbelegung älterer Firmware nennt Zusatz-Symbole '0'..'7'.
+bool verifyLegacySymbolCodesAreMigrated() {
+    EEPROM.raw()[EEPROM_OFFSET_DAILY_LETTERS] = '2';
+    loadConfig();
+    flushConfig();
+    return expect(dailyLetters[0][0] == customSymbolFromId(2), "Zeichen '2' nicht auf Id 2 umgestellt") &&
+           expect(EEPROM.raw()[EEPROM_OFFSET_DAILY_LETTERS] == static_cast<uint8_t>(customSymbolFromId(2)),
+                  "Umgestellte Belegung nicht gespeichert");
+}
+
+// Paket im Format 1: 30 eingebaute Slots, dahinter die acht Zusatz-Symbole '0'..'7'.
+bool verifyFormat1PackIsUpgraded() {
+    constexpr size_t slots = EDITABLE_BUILTIN_SYMBOL_COUNT + LEGACY_CUSTOM_SYMBOL_COUNT;
+    constexpr size_t firstRecord = 256;
+    std::vector<uint8_t> &file = packFile();
+    file.assign(firstRecord + slots * SYMBOL_BITMAP_SIZE, 0);
+    const uint8_t header[] = {'R', 'M', 'S', 'P', 1, static_cast<uint8_t>(slots), 0, 0};
+    memcpy(file.data(), header, sizeof(header));
+    for (size_t slot = 0; slot < slots; ++slot) {
+        uint8_t *entry = &file[SYMBOL_PACK_HEADER_SIZE + slot * SYMBOL_PACK_INDEX_ENTRY_SIZE];
+        const size_t offset = firstRecord + slot * SYMBOL_BITMAP_SIZE;
+        entry[0] = static_cast<uint8_t>(slot < EDITABLE_BUILTIN_SYMBOL_COUNT
+                                            ? editableBuiltinSymbols[slot]
+                                            : '0' + (slot - EDITABLE_BUILTIN_SYMBOL_COUNT));
+        entry[2] = static_cast<uint8_t>(offset & 0xFF);
+        entry[3] = static_cast<uint8_t>(offset >> 8);
+    }
+    const size_t customSlot = EDITABLE_BUILTIN_SYMBOL_COUNT + 5;
+    file[SYMBOL_PACK_HEADER_SIZE + customSlot * SYMBOL_PACK_INDEX_ENTRY_SIZE + 1] =
+        SYMBOL_PACK_FLAG_STORED | SYMBOL_PACK_FLAG_ENABLED;
+    memset(&file[firstRecord + customSlot * SYMBOL_BITMAP_SIZE], 0x77, SYMBOL_BITMAP_SIZE);
+
+    initEditableSymbolStore();
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE] = {};
+    bool enabled = false;
+    return expect(packFile().size() == SYMBOL_PACK_FILE_SIZE && LittleFS.files.count("/symbols.tmp") == 0,
+                  "Paket nicht im aktuellen Format neu aufgebaut") &&
+           expect(readCustomSymbol(customSymbolFromId(5), bitmap, enabled) && enabled && bitmap[0] == 0x77,
+                  "Zusatz-Symbol '5' nicht auf Id 5 übernommen") &&
+           expect(!symbolPackAwaitsLegacyCustomSymbols(), "EEPROM würde nach dem Format-Wechsel erneut übernommen");
+}
+
+// Sammel-Upload: Änderungen landen in /symbols.new und werden erst mit dem Commit sichtbar.
+bool verifyBatchReplacesPackOnce() {
+    uint8_t bitmap[SYMBOL_BITMAP_SIZE];
+    memset(bitmap, 0x42, sizeof(bitmap));
+    const char custom = customSymbolFromId(7);
+    const std::vector<uint8_t> before = packFile();
+    if (!expect(beginSymbolBatch(), "Sammel-Upload nicht begonnen") ||
+        !expect(stageSymbolBatchRecord('Y', bitmap, true) && stageSymbolBatchRecord(custom, bitmap, false),
+                "Records nicht in die Kopie geschrieben") ||
+        !expect(!stageSymbolBatchRecord('\x01', bitmap, true), "Unbekanntes Symbol angenommen") ||
+        !expect(!saveEditableBuiltinSymbol('X', bitmap, true), "Einzel-Schreibzugriff trotz offenem Upload") ||
+        !expect(packFile() == before, "Paket vor dem Commit verändert") ||
+        !expect(LittleFS.files["/symbols.new"][COPY_STATE_OFFSET] != COPY_COMPLETE, "Halbe Kopie als fertig markiert") ||
+        !expect(commitSymbolBatch(), "Sammel-Upload nicht übernommen")) {
+        return false;
+    }
+
+    uint8_t stored[SYMBOL_BITMAP_SIZE] = {};
+    bool enabled = true;
+    if (!expect(LittleFS.files.count("/symbols.new") == 0 && packFile().size() == SYMBOL_PACK_FILE_SIZE &&
+                    packFile()[COPY_STATE_OFFSET] == COPY_COMPLETE,
+                "Kopie nach dem Commit nicht umbenannt") ||
+        !expect(getEditableBuiltinSymbolBitmap('Y', stored) && stored[0] == 0x42, "Override nicht übernommen") ||
+        !expect(readCustomSymbol(custom, stored, enabled) && !enabled && stored[0] == 0x42,
+                "Zusatz-Symbol nicht übernommen")) {
+        return false;
+    }
+
+    const std::vector<uint8_t> committed = packFile();
+    beginSymbolBatch();
+    stageSymbolBatchRecord('Y', nullptr, false);
+    abortSymbolBatch();
+    return expect(packFile() == committed && LittleFS.files.count("/symbols.new") == 0,
+                  "Abgebrochener Upload verändert das Paket") &&
+           expect(hasEditableBuiltinSymbolOverride('Y'), "Override nach dem Abbruch verloren") &&
+           expect(saveEditableBuiltinSymbol('X', bitmap, true), "Einzel-Schreibzugriff nach dem Abbruch gesperrt");
+}
+
+bool verifyInterruptedRebuildIsRecovered() {
+    std::vector<uint8_t> rebuilt = packFile();
+    rebuilt[SYMBOL_PACK_FIRST_RECORD_OFFSET + symbolPackSlot('Q') * SYMBOL_BITMAP_SIZE] = 0x5A;
+    rebuilt[COPY_STATE_OFFSET] = 0;
+    LittleFS.files["/symbols.tmp"] = rebuilt;
+    LittleFS.files.erase(PACK_PATH);
+
+    initEditableSymbolStore();
+    if (!expect(packFile() != rebuilt, "Unfertige Temporärdatei übernommen")) {
+        return false;
+    }
+
+    rebuilt[COPY_STATE_OFFSET] = COPY_COMPLETE;
+    LittleFS.files["/symbols.tmp"] = rebuilt;
+    LittleFS.files.erase(PACK_PATH);
+    initEditableSymbolStore();
+    return expect(packFile() == rebuilt && LittleFS.files.count("/symbols.tmp") == 0,
+                  "Temporärdatei nach abgebrochenem Neuaufbau nicht übernommen");
+}
+
+bool verifyInterruptedBatchIsRecovered() {
+    std::vector<uint8_t> staged = packFile();
+    staged[SYMBOL_PACK_FIRST_RECORD_OFFSET + symbolPackSlot('R') * SYMBOL_BITMAP_SIZE] = 0x6B;
+    staged[COPY_STATE_OFFSET] = COPY_COMPLETE;
+    LittleFS.files["/symbols.new"] = std::vector<uint8_t>(staged.begin(), staged.end() - 1);
+    packFile()[0] = 0;
+
+    initEditableSymbolStore();
+    if (!expect(packFile() != staged && LittleFS.files.count("/symbols.new") == 1,
+                "Abgeschnittene Sammel-Kopie übernommen")) {
+        return false;
+    }
+
+    staged[COPY_STATE_OFFSET] = 0;
+    LittleFS.files["/symbols.new"] = staged;
+    packFile()[0] = 0;
+    initEditableSymbolStore();
+    if (!expect(packFile() != staged && LittleFS.files.count("/symbols.new") == 1,
+                "Halb geschriebene Sammel-Kopie übernommen")) {
+        return false;
+    }
+
+    // Unbrauchbares Paket liegt noch: auf SPIFFS muss es vor dem Umbenennen gelöscht werden.
+    staged[COPY_STATE_OFFSET] = COPY_COMPLETE;
+    LittleFS.files["/symbols.new"] = staged;
+    packFile()[0] = 0;
+    initEditableSymbolStore();
+    return expect(packFile() == staged && LittleFS.files.count("/symbols.new") == 0,
+                  "Sammel-Kopie nach abgebrochenem Commit nicht übernommen");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyLegacyFilesAreImported() || !verifyBootOpensPackOnce() || !verifyUpdatesRewriteInPlace() ||
+        !verifyCustomSymbolsMoveIntoPack() || !verifyLegacySymbolCodesAreMigrated() || !verifyFormat1PackIsUpgraded() ||
+        !verifyBatchReplacesPackOnce() || !verifyInterruptedRebuildIsRecovered() ||
+        !verifyInterruptedBatchIsRecovered()) {
+        return 1;
+    }
+    return 0;
+}
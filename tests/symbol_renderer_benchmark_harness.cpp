@@ -0,0 +1,112 @@
+#include "symbol_renderer.h"
+#include "symbol_defaults.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+SerialClass Serial;
+PxMATRIX display(64, 64, P_LAT, P_OE, P_A, P_B, P_C, P_D, P_E);
+
+namespace {
+
+// Referenz: bisherige Zeichenschleife aus displayLetter() mit einem
+// fillRect-Aufruf und setBrightness() pro gesetztem Pixel.
+void renderLegacyPerPixel(const uint8_t *bitmap, uint16_t color) {
+    for (int y = 0; y < 32; y++) {
+        for (int x = 0; x < 32; x++) {
+            uint8_t rowValue = pgm_read_byte(&bitmap[y * 4 + (x / 8)]);
+            if (rowValue & (1 << (7 - (x % 8)))) {
+                display.setBrightness(100);
+                display.fillRect(x * 2, y * 2, 2, 2, color);
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    const char symbols[] = {
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+        'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+        '#', '~', '&', '?'};
+    const uint16_t color = display.color565(255, 255, 255);
+
+    unsigned long legacyTotal = 0;
+    unsigned long spanTotal = 0;
+    std::cout << "Symbol  Legacy-Aufrufe  Lauf-Aufrufe  Läufe" << std::endl;
+
+    for (char symbol : symbols) {
+        const uint8_t *bitmap = getFactorySymbolBitmap(symbol);
+        if (bitmap == nullptr) {
+            std::cerr << "Factory-Bitmap fehlt: " << symbol << std::endl;
+            return 1;
+        }
+
+        display.resetCounters();
+        renderLegacyPerPixel(bitmap, color);
+        const unsigned long legacyCalls = display.drawCalls() + display.setBrightnessCalls;
+        const unsigned long legacyPixels = display.paintedPixels;
+
+        display.resetCounters();
+        display.setBrightness(100);
+        const uint16_t spans = renderSymbolView(progmemSymbolView(bitmap), color);
+        const unsigned long spanCalls = display.drawCalls() + display.setBrightnessCalls;
+        const unsigned long spanPixels = display.paintedPixels;
+
+        std::cout << std::setw(6) << symbol << std::setw(16) << legacyCalls << std::setw(14) << spanCalls
+                  << std::setw(7) << spans << std::endl;
+
+        if (spanPixels != legacyPixels) {
+            std::cerr << "Pixelfläche weicht ab für " << symbol << ": " << spanPixels << " statt "
+                      << legacyPixels << std::endl;
+            return 1;
+        }
+        if (display.fastHLineCalls != static_cast<unsigned long>(spans) * SYMBOL_RENDER_SCALE) {
+            std::cerr << "Unerwartete Anzahl H-Linien für " << symbol << std::endl;
+            return 1;
+        }
+        if (legacyPixels > 0 && spanCalls >= legacyCalls) {
+            std::cerr << "Lauf-Renderer spart keine Aufrufe für " << symbol << std::endl;
+            return 1;
+        }
+
+        legacyTotal += legacyCalls;
+        spanTotal += spanCalls;
+    }
+
+    std::cout << "Gesamt: " << legacyTotal << " -> " << spanTotal << " Zeichenaufrufe" << std::endl;
+
+    alignas(4) uint8_t edgeCases[SYMBOL_BITMAP_SIZE] = {};
+    for (size_t index = 0; index < SYMBOL_BYTES_PER_ROW; ++index) {
+        edgeCases[index] = 0xFF;
+    }
+    edgeCases[SYMBOL_BYTES_PER_ROW] = 0x80;
+    edgeCases[(SYMBOL_BYTES_PER_ROW * 2) - 1] = 0x01;
+    edgeCases[SYMBOL_BYTES_PER_ROW * 2] = 0xAA;
+    edgeCases[(SYMBOL_BYTES_PER_ROW * 2) + 3] = 0x55;
+
+    display.resetCounters();
+    const uint16_t edgeSpans = renderSymbolView(ramSymbolView(edgeCases), color);
+    // Zeile 0: ein Lauf über 32 Pixel, Zeile 1: zwei Randpixel, Zeile 2: 4 + 4 Einzelpixel.
+    if (edgeSpans != 11 || display.paintedPixels != (32 + 2 + 8) * 4) {
+        std::cerr << "Randfälle falsch zerlegt: " << edgeSpans << " Läufe, " << display.paintedPixels
+                  << " Pixel" << std::endl;
+        return 1;
+    }
+
+    // Ohne 4-Byte-Ausrichtung liest SymbolView bytweise – das Ergebnis muss gleich bleiben.
+    alignas(4) uint8_t shifted[SYMBOL_BITMAP_SIZE + 1] = {};
+    memcpy(shifted + 1, edgeCases, SYMBOL_BITMAP_SIZE);
+    const unsigned long alignedPixels = display.paintedPixels;
+    display.resetCounters();
+    if (renderSymbolView(ramSymbolView(shifted + 1), color) != edgeSpans || display.paintedPixels != alignedPixels ||
+        ramSymbolView(shifted + 1).row(2) != 0xAA000055U || ramSymbolView(edgeCases).row(2) != 0xAA000055U) {
+        std::cerr << "Unausgerichtete Bitmap anders gelesen" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _build_test_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "clock_events"
+    sources = [
+        "tests/clock_events_harness.cpp",
+        "src/clock_events.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_clock_events_fire_once_per_boundary(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side clock events harness")
+
+    binary = _build_test_binary(Path(tmp_path))
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
@@ -0,0 +1,65 @@
+from __future__ import annotations
+
+import re
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _web_manager_source() -> str:
+    return Path("src/web_manager.cpp").read_text(encoding="utf-8")
+
+
+def _extract_config_page_stream(code: str) -> str:
+    start = code.index("// Kopiert Teilstücke in den Sendepuffer")
+    log_fill = code.index("size_t fillLogStream(LogStreamCursor")
+    page_start = code.index("// Abschnitte der Startseite")
+    page_end = code.index("size_t fillConfigPageStream(")
+    page_end = code.index("\n}\n", page_end) + 3
+    return code[start:log_fill] + code[page_start:page_end]
+
+
+def test_root_page_is_streamed_in_chunks() -> None:
+    code = _web_manager_source()
+    match = re.search(r'server\.on\("/", HTTP_GET.*?\n    \}\);', code, re.S)
+    assert match, "Handler-Definition für / nicht gefunden"
+    handler = match.group(0)
+
+    assert "beginChunkedResponse" in handler
+    assert "fillConfigPageStream" in handler
+    assert "reserve(" not in handler, "Startseite reserviert weiterhin einen großen String"
+    assert "String html" not in code
+
+
+def test_config_page_stream_renders_same_page_for_any_buffer_size(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side page harness")
+
+    build_dir = Path(tmp_path)
+    (build_dir / "config_page_stream.inc").write_text(_extract_config_page_stream(_web_manager_source()), encoding="utf-8")
+    binary = build_dir / "config_page"
+    sources = [
+        "tests/config_page_harness.cpp",
+        "src/config.cpp",
+        "src/crc32.cpp",
+        "src/log_manager.cpp",
+        "src/symbol_store.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/symbol_defaults.cpp",
+    ]
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        f"-I{build_dir}",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
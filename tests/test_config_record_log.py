@@ -0,0 +1,46 @@
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _build_test_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "config_record_log"
+    sources = [
+        "tests/config_record_log_harness.cpp",
+        "src/config.cpp",
+        "src/crc32.cpp",
+        "src/config_record_log.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/log_manager.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-DRIDDLEMATRIX_CONFIG_STORE_LOG=1",
+        "-DRIDDLEMATRIX_CONFIG_LOG_MAX_BYTES=256",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_config_record_log_replays_compacts_and_survives_power_loss(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side config harness")
+
+    binary = _build_test_binary(Path(tmp_path))
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
@@ -15,6 +15,10 @@ def _build_test_binary(tmp_path: Path) -> Path:
     sources = [
         "tests/config_sanitization_harness.cpp",
         "src/config.cpp",
+        "src/crc32.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/log_manager.cpp",
     ]
 
     command = [
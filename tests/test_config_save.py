@@ -0,0 +1,43 @@
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _build_test_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "config_save"
+    sources = [
+        "tests/config_save_harness.cpp",
+        "src/config.cpp",
+        "src/crc32.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/log_manager.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_save_config_writes_only_dirty_sections_and_coalesces_flushes(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side config harness")
+
+    binary = _build_test_binary(Path(tmp_path))
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
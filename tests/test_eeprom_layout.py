@@ -1,8 +1,12 @@
 from __future__ import annotations
 
 import re
+import shutil
+import subprocess
 from pathlib import Path
 
+import pytest
+
 
 def _parse_constants() -> dict[str, int]:
     header = Path("src/config.h").read_text(encoding="utf-8")
@@ -72,3 +76,63 @@ def test_eeprom_usage_fits_into_memory() -> None:
     assert constants["EEPROM_OFFSET_COLOR_PALETTE_MASK_MATRIX"] >= color_mode_end
     assert constants["EEPROM_OFFSET_CONFIG_VERSION"] >= matrix_end
     assert constants["EEPROM_CONFIG_VERSION"] >= 7
+
+
+def _build_schema_harness(tmp_path: Path) -> Path:
+    binary = tmp_path / "eeprom_schema"
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+        "tests/eeprom_schema_harness.cpp",
+        "src/config.cpp",
+        "src/crc32.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/log_manager.cpp",
+    ]
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_schema_table_covers_layout(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side schema harness")
+
+    constants = _parse_constants()
+    binary = _build_schema_harness(Path(tmp_path))
+    dump = subprocess.run([str(binary), "--dump"], check=True, capture_output=True, text=True).stdout
+    rows = [tuple(int(value) for value in line.split()) for line in dump.splitlines()]
+    assert rows, "Schema ist leer"
+
+    version_offset = constants["EEPROM_OFFSET_CONFIG_VERSION"]
+    crc_offset = constants["EEPROM_OFFSET_CONFIG_CRC"]
+    previous_end = 0
+    for offset, size, since, section, _kind in rows:
+        assert offset >= previous_end, f"Schema-Feld an Offset {offset} überschneidet sich oder ist nicht sortiert"
+        assert size > 0
+        assert since <= constants["EEPROM_CONFIG_VERSION"]
+        assert section in (1, 2, 4, 8), f"Feld an Offset {offset} gehört zu keinem Abschnitt"
+        assert not (offset < version_offset + 2 and version_offset < offset + size), "Feld überdeckt die Versionskennung"
+        previous_end = offset + size
+    assert previous_end <= crc_offset, "Schema reicht in die Konfigurations-Prüfsumme"
+
+    offsets = {row[0] for row in rows}
+    for name, value in constants.items():
+        if name.startswith("EEPROM_OFFSET_") and name not in ("EEPROM_OFFSET_CONFIG_VERSION", "EEPROM_OFFSET_CONFIG_CRC"):
+            assert value in offsets, f"{name} fehlt im EEPROM-Schema"
+
+    # Erst mit Version 4 gab es die mehrspurige Trigger-Matrix; alles Frühere läuft über migrateLegacyLayout().
+    assert {row[2] for row in rows} <= {0, *range(4, constants["EEPROM_CONFIG_VERSION"] + 1)}
+
+
+def test_schema_drives_load_save_and_migration(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side schema harness")
+
+    binary = _build_schema_harness(Path(tmp_path))
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
@@ -0,0 +1,43 @@
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _build_test_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "glyph_span_table"
+    sources = [
+        "tests/glyph_span_table_harness.cpp",
+        "src/glyph_span_table.cpp",
+        "src/symbol_renderer.cpp",
+        "src/symbol_defaults.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_span_table_matches_factory_bitmaps(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side glyph table harness")
+
+    binary = _build_test_binary(Path(tmp_path))
+    result = subprocess.run([str(binary)], check=True, cwd=Path.cwd(), capture_output=True, text=True)
+    print(result.stdout)
+    assert "Größenbericht:" in result.stdout
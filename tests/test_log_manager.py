@@ -0,0 +1,49 @@
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _build_test_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "log_manager"
+    sources = [
+        "tests/log_manager_harness.cpp",
+        "src/log_manager.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-DRIDDLEMATRIX_LOG_LEVEL_DISPLAY=LOG_LEVEL_INFO",
+        "-DRIDDLEMATRIX_LOG_LEVEL_WEB=LOG_LEVEL_NONE",
+        "-DRIDDLEMATRIX_LOG_ENTRIES=8",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_log_levels_compile_out_and_binary_ring_reads_by_sequence(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side log harness")
+
+    binary = _build_test_binary(Path(tmp_path))
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
+
+
+def test_web_server_exposes_incremental_log_endpoint() -> None:
+    code = Path("src/web_manager.cpp").read_text(encoding="utf-8")
+    assert 'server.on("/api/logs", HTTP_GET' in code
+    assert "beginChunkedResponse" in code
+    assert "getLogOldestSequence()" in code
@@ -0,0 +1,114 @@
+from __future__ import annotations
+
+import os
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+GOLDEN_FILE = Path("tests/golden/render_frames.txt")
+UPDATE_ENV = "RIDDLEMATRIX_UPDATE_GOLDEN"
+
+
+def _build_render_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "render_golden"
+    sources = [
+        "tests/render_golden_harness.cpp",
+        "src/trigger_handler.cpp",
+        "src/wifi_manager.cpp",
+        "src/config.cpp",
+        "src/crc32.cpp",
+        "src/log_manager.cpp",
+        "src/symbol_store.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/symbol_defaults.cpp",
+        "src/symbol_renderer.cpp",
+        "src/glyph_span_table.cpp",
+        "src/display_plan.cpp",
+        "src/trigger_scheduler.cpp",
+        "src/rs485_protocol.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def _parse_frames(text: str) -> dict[str, list[str]]:
+    frames: dict[str, list[str]] = {}
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        name, *fields = line.split()
+        frames[name] = fields
+    return frames
+
+
+def _ascii_frame(binary: Path, name: str) -> str:
+    result = subprocess.run(
+        [str(binary), "--ascii", name], check=True, cwd=Path.cwd(), capture_output=True, text=True
+    )
+    return result.stdout
+
+
+def test_rendered_frames_match_golden_images(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side render harness")
+
+    binary = _build_render_binary(Path(tmp_path))
+    result = subprocess.run([str(binary)], check=True, cwd=Path.cwd(), capture_output=True, text=True)
+    actual = _parse_frames(result.stdout)
+
+    if os.environ.get(UPDATE_ENV):
+        header = "# name status fnv1a lit_pixels draw_calls buffer_swaps\n"
+        GOLDEN_FILE.write_text(header + result.stdout, encoding="utf-8")
+        return
+
+    expected = _parse_frames(GOLDEN_FILE.read_text(encoding="utf-8"))
+    assert sorted(actual) == sorted(expected), "Menge der gerenderten Frames weicht von der Golden-Datei ab"
+
+    failures = []
+    for name, fields in expected.items():
+        if actual[name] != fields:
+            failures.append(
+                f"{name}: erwartet {' '.join(fields)}, erhalten {' '.join(actual[name])}\n"
+                + _ascii_frame(binary, name)
+            )
+
+    assert not failures, (
+        "Gerenderte Frames weichen ab (Aktualisieren mit "
+        f"{UPDATE_ENV}=1 pytest tests/test_render_golden.py):\n" + "\n".join(failures)
+    )
+
+
+def test_every_factory_symbol_is_drawn(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side render harness")
+
+    binary = _build_render_binary(Path(tmp_path))
+    result = subprocess.run([str(binary)], check=True, cwd=Path.cwd(), capture_output=True, text=True)
+    frames = _parse_frames(result.stdout)
+
+    symbol_frames = {name: fields for name, fields in frames.items() if name.startswith("symbol_")}
+    assert len(symbol_frames) == 30
+    for name, (status, _hash, lit_pixels, _calls, swaps) in symbol_frames.items():
+        assert status == "ok", f"{name} wurde nicht gezeichnet"
+        assert int(lit_pixels) > 0, f"{name} ist leer"
+        assert swaps == "1", f"{name} wurde nicht genau einmal veröffentlicht"
+
+    assert frames["clear_display"][2] == "0"
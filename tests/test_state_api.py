@@ -0,0 +1,56 @@
+from __future__ import annotations
+
+import re
+from pathlib import Path
+
+# Schlüssel, die webserver.py und index.html aus GET /api/state lesen.
+MANAGER_KEYS = ("hostname", "letters", "colors", "color_modes", "color_palette_masks", "delays")
+
+
+def _web_manager_source() -> str:
+    return Path("src/web_manager.cpp").read_text(encoding="utf-8")
+
+
+def _extract_state_handler(code: str) -> str:
+    match = re.search(r'server\.on\("/api/state", HTTP_GET.*?\n    \}\);', code, re.S)
+    assert match, "Handler-Definition für /api/state nicht gefunden"
+    return match.group(0)
+
+
+def _extract_write_box_state(code: str) -> str:
+    match = re.search(r"void writeBoxState\(JsonObject root\) \{.*?\n\}\n", code, re.S)
+    assert match, "writeBoxState nicht gefunden"
+    return match.group(0)
+
+
+def test_state_handler_requires_auth_and_reports_overflow() -> None:
+    handler = _extract_state_handler(_web_manager_source())
+    assert "requireManagerAuth(request)" in handler
+    assert "DynamicJsonDocument stateDoc(BOX_STATE_JSON_CAPACITY)" in handler
+    assert "writeBoxState(" in handler
+    assert "stateDoc.overflowed()" in handler
+    assert "no-store" in handler
+
+
+def test_state_document_contains_every_key_the_manager_reads() -> None:
+    writer = _extract_write_box_state(_web_manager_source())
+    for key in MANAGER_KEYS:
+        assert f'"{key}"' in writer, f"/api/state liefert {key} nicht"
+    for key in ("brightness", "letter_time", "auto_interval", "auto_mode", "random_symbol_pool", "rs485_address"):
+        assert f'display["{key}"]' in writer, f"Anzeige-Einstellung {key} fehlt"
+    assert 'activeWindow["start"]' in writer and 'activeWindow["end"]' in writer
+
+    manager = Path("USBStick-Setup/files/usr/local/bin/webserver.py").read_text(encoding="utf-8")
+    fetch = re.search(r"def fetch_box_state\(ip\):.*?\n\n\n", manager, re.S)
+    assert fetch, "fetch_box_state nicht gefunden"
+    for key in MANAGER_KEYS[1:]:
+        assert f'data.get("{key}")' in fetch.group(0), f"Manager liest {key} nicht aus /api/state"
+
+
+def test_state_capacity_covers_all_day_matrices() -> None:
+    code = _web_manager_source()
+    writer = _extract_write_box_state(code)
+    matrices = writer.count("createNestedArray(DAY_KEYS[day])")
+    capacity = re.search(r"constexpr size_t BOX_STATE_JSON_CAPACITY = (.*?);", code, re.S)
+    assert capacity, "BOX_STATE_JSON_CAPACITY nicht gefunden"
+    assert f"{matrices} * BOX_STATE_DAY_MATRIX_SIZE" in capacity.group(1)
@@ -0,0 +1,49 @@
+from __future__ import annotations
+
+import re
+from pathlib import Path
+
+
+def _web_manager_source() -> str:
+    return Path("src/web_manager.cpp").read_text(encoding="utf-8")
+
+
+def _extract_bulk_handler(code: str) -> str:
+    match = re.search(r'server\.on\(\s*"/api/symbols/bulk",\s*HTTP_POST.*?\n        \}\);', code, re.S)
+    assert match, "Handler-Definition für /api/symbols/bulk nicht gefunden"
+    return match.group(0)
+
+
+def test_bulk_body_is_streamed_record_by_record() -> None:
+    handler = _extract_bulk_handler(_web_manager_source())
+    body = handler[handler.index("uint8_t *data, size_t len, size_t index, size_t total"):]
+    # Der Rumpf wird nie komplett gepuffert, nur der gerade ankommende Record.
+    assert "String" not in body
+    assert "context->record + context->fill" in body
+    assert "applySymbolBulkRecord(*context)" in body
+    assert "total % SYMBOL_BULK_RECORD_SIZE != 0" in body
+    assert "isManagerAuthorized(request)" in body
+    assert "beginSymbolBatch()" in body
+    assert "onDisconnect" in body
+
+
+def test_bulk_upload_commits_once_and_reports_per_record_result() -> None:
+    code = _web_manager_source()
+    handler = _extract_bulk_handler(code)
+    final = handler[: handler.index("uint8_t *data, size_t len, size_t index, size_t total")]
+    assert "requireManagerAuth(request)" in final
+    assert final.count("commitSymbolBatch()") == 1
+    assert "stageSymbolBatchRecord" not in final
+    for status in ("400", "409", "507", "500"):
+        assert f"sendJsonStatus(request, {status}" in final
+    assert 'responseDoc["result"] = symbolBulkResultHex(*context)' in final
+    assert "constexpr size_t SYMBOL_BULK_RECORD_SIZE = 2 + SYMBOL_BITMAP_SIZE;" in code
+
+
+def test_manager_record_layout_matches_firmware() -> None:
+    manager = Path("USBStick-Setup/files/usr/local/bin/webserver.py").read_text(encoding="utf-8")
+    assert "SYMBOL_BULK_MAX_RECORDS = 94" in manager
+    page = Path("USBStick-Setup/files/usr/local/etc/index.html").read_text(encoding="utf-8")
+    assert "const SYMBOL_BULK_RECORD_SIZE = 130;" in page
+    header = Path("src/symbol_pack.h").read_text(encoding="utf-8")
+    assert "EDITABLE_BUILTIN_SYMBOL_COUNT + CUSTOM_SYMBOL_COUNT" in header
@@ -0,0 +1,48 @@
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _build_test_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "symbol_cache"
+    sources = [
+        "tests/symbol_cache_harness.cpp",
+        "src/display_plan.cpp",
+        "src/config.cpp",
+        "src/crc32.cpp",
+        "src/log_manager.cpp",
+        "src/symbol_store.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/symbol_defaults.cpp",
+        "src/symbol_renderer.cpp",
+        "src/glyph_span_table.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_symbol_cache_loads_on_demand_and_evicts_lru(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side symbol cache harness")
+
+    binary = _build_test_binary(Path(tmp_path))
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
@@ -0,0 +1,43 @@
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _build_benchmark_binary(tmp_path: Path) -> Path:
+    build_dir = tmp_path / "build"
+    build_dir.mkdir()
+
+    binary = build_dir / "symbol_renderer_benchmark"
+    sources = [
+        "tests/symbol_renderer_benchmark_harness.cpp",
+        "src/symbol_renderer.cpp",
+        "src/glyph_span_table.cpp",
+        "src/symbol_defaults.cpp",
+    ]
+
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    return binary
+
+
+def test_span_renderer_reduces_draw_calls(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side renderer benchmark")
+
+    binary = _build_benchmark_binary(Path(tmp_path))
+    result = subprocess.run([str(binary)], check=True, cwd=Path.cwd(), capture_output=True, text=True)
+    print(result.stdout)
+    assert "Gesamt:" in result.stdout
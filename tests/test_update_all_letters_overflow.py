@@ -1,10 +1,18 @@
 from __future__ import annotations
 
+import shutil
+import subprocess
 from pathlib import Path
 
+import pytest
+
+
+def _web_manager_source() -> str:
+    return Path("src/web_manager.cpp").read_text(encoding="utf-8")
+
 
 def _extract_update_all_letters_handler() -> str:
-    code = Path("src/web_manager.cpp").read_text(encoding="utf-8")
+    code = _web_manager_source()
     anchor = code.find("\"/updateAllLetters\"")
     assert anchor != -1, "Pfad /updateAllLetters nicht gefunden"
     start = code.rfind("server.on", 0, anchor)
@@ -52,16 +60,68 @@ def _extract_body_callback(handler: str) -> str:
     raise AssertionError("Ende des Body-Callbacks nicht gefunden")
 
 
+def _extract_update_stream(code: str) -> str:
+    """Symbolprüfung, Wertparser und der streamende JSON-Teil von /updateAllLetters."""
+    symbols = code[code.index("bool isSupportedLetter(char letter)") : code.index("// Gegenstück zu parseSymbolToken()")]
+    values = code[code.index("bool isValidHexColorString(") : code.index("bool parseSignedLongInRange(")]
+    start = code.index("// **Streamendes JSON-Update")
+    end = code.index("\n} // namespace\n", start)
+    return symbols + values + code[start : end + 1]
+
+
 def test_chunked_request_larger_than_limit_results_in_overflow() -> None:
     handler = _extract_update_all_letters_handler()
     body_callback = _extract_body_callback(handler)
 
     assert "context->overflow = true;" in body_callback, "Overflow-Flag wird nicht gesetzt"
-    overflow_check_pos = body_callback.index("context->body.length() + len > MAX_JSON_BODY_SIZE")
-    loop_pos = body_callback.index("for (size_t idx = 0; idx < len; ++idx)")
-    assert overflow_check_pos < loop_pos, "Overflow-Prüfung erfolgt erst nach dem Append-Loop"
-    assert "return;" in body_callback[overflow_check_pos:loop_pos], "Overflow-Abbruch fehlt"
-    assert "context->body.reserve(std::min(MAX_JSON_BODY_SIZE, total) + 1);" in body_callback
+    overflow_check_pos = body_callback.index("context->received + len > MAX_JSON_BODY_SIZE")
+    feed_pos = body_callback.index("feedJsonStream(context->parser, data, len);")
+    assert overflow_check_pos < feed_pos, "Overflow-Prüfung erfolgt erst nach dem Parsen"
+    assert "return;" in body_callback[overflow_check_pos:feed_pos], "Overflow-Abbruch fehlt"
 
     assert "sendJsonStatus(request, 413" in handler, "HTTP 413 wird für übergroße JSON-Bodies nicht gesendet"
 
+
+def test_json_body_is_parsed_while_streaming() -> None:
+    handler = _extract_update_all_letters_handler()
+    body_callback = _extract_body_callback(handler)
+
+    assert "context->body" not in handler, "Rumpf wird weiterhin gepuffert"
+    assert "DynamicJsonDocument" not in handler, "Finalizer baut weiterhin ein JSON-Dokument auf"
+    assert "beginLettersUpdate(*context)" in body_callback
+    assert "finishLettersUpdate(*context)" in handler
+
+
+def test_streamed_update_validates_like_the_document_parser(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side update harness")
+
+    build_dir = Path(tmp_path)
+    (build_dir / "update_all_letters_stream.inc").write_text(
+        _extract_update_stream(_web_manager_source()), encoding="utf-8"
+    )
+    binary = build_dir / "update_all_letters"
+    sources = [
+        "tests/update_all_letters_harness.cpp",
+        "src/json_stream.cpp",
+        "src/config.cpp",
+        "src/crc32.cpp",
+        "src/log_manager.cpp",
+        "src/symbol_store.cpp",
+        "src/symbol_pack.cpp",
+        "src/storage_fs.cpp",
+        "src/symbol_defaults.cpp",
+    ]
+    command = [
+        "g++",
+        "-std=c++17",
+        "-DRIDDLEMATRIX_HOST_TEST",
+        "-Itests/stubs",
+        "-Isrc",
+        f"-I{build_dir}",
+        "-o",
+        str(binary),
+    ] + sources
+
+    subprocess.run(command, check=True, cwd=Path.cwd())
+    subprocess.run([str(binary)], check=True, cwd=Path.cwd())
@@ -0,0 +1,93 @@
+from __future__ import annotations
+
+import gzip
+import importlib.util
+import re
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+def _load_generator():
+    spec = importlib.util.spec_from_file_location("embed_web_assets", "tools/embed_web_assets.py")
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+def test_committed_web_assets_match_sources() -> None:
+    generator = _load_generator()
+    assert generator.header_is_current(), "src/web_assets.h veraltet – tools/embed_web_assets.py ausführen"
+
+    embedded = generator.embedded_assets(Path("src/web_assets.h").read_text(encoding="utf-8"))
+    for source, name in generator.ASSETS:
+        data = Path(source).read_bytes()
+        assert embedded[name] == (generator.asset_hash(data), data)
+
+
+def test_generator_output_is_reproducible() -> None:
+    generator = _load_generator()
+    header = generator.render_header()
+    assert header == generator.render_header()
+
+    for source, name in generator.ASSETS:
+        match = re.search(rf"WEB_ASSET_{name}_GZ_LENGTH = (\d+);", header)
+        assert match, f"Länge für {source} fehlt"
+        packed = generator.compress(Path(source).read_bytes())
+        assert int(match.group(1)) == len(packed)
+        assert packed[4:8] == b"\0\0\0\0", "gzip-Kopf enthält einen Zeitstempel"
+        assert gzip.decompress(packed) == Path(source).read_bytes()
+
+
+def test_static_assets_are_served_compressed_with_etag() -> None:
+    code = Path("src/web_manager.cpp").read_text(encoding="utf-8")
+    match = re.search(r"void sendWebAsset\(.*?\n}\n", code, re.S)
+    assert match, "sendWebAsset nicht gefunden"
+    helper = match.group(0)
+
+    assert "If-None-Match" in helper
+    assert "beginResponse(304)" in helper
+    assert 'F("Content-Encoding"), F("gzip")' in helper
+    assert 'F("ETag"), quotedTag' in helper
+    assert "indexOf(etag)" not in helper, "ETag wird als Teilstring verglichen"
+    assert "max-age=31536000" in helper
+
+    for path, name in (("/script.js", "SCRIPT_JS"), ("/style.css", "STYLE_CSS")):
+        handler = re.search(rf'server\.on\("{re.escape(path)}", HTTP_GET.*?\n    \}}\);', code, re.S)
+        assert handler, f"Handler für {path} fehlt"
+        assert f"WEB_ASSET_{name}_GZ" in handler.group(0)
+    assert "rawliteral" not in code, "Statische Dateien wieder als Literal eingebettet"
+
+
+def test_if_none_match_compares_quoted_entity_tags(tmp_path) -> None:
+    if shutil.which("g++") is None:
+        pytest.skip("g++ is required for the host-side entity tag check")
+
+    code = Path("src/web_manager.cpp").read_text(encoding="utf-8")
+    match = re.search(r"bool entityTagListMatches\(.*?\n}\n", code, re.S)
+    assert match, "entityTagListMatches nicht gefunden"
+    source = Path(tmp_path) / "entity_tag.cpp"
+    source.write_text(
+        "#include <cstring>\n"
+        + match.group(0)
+        + """
+int main() {
+    const char *hash = "4ea9bce236190c34";
+    const bool ok = entityTagListMatches("\\"4ea9bce236190c34\\"", hash) &&
+                    entityTagListMatches("W/\\"4ea9bce236190c34\\"", hash) &&
+                    entityTagListMatches("\\"0000\\", W/\\"4ea9bce236190c34\\"", hash) &&
+                    entityTagListMatches("*", hash) &&
+                    !entityTagListMatches("4ea9bce236190c34", hash) &&
+                    !entityTagListMatches("\\"x4ea9bce236190c34\\"", hash) &&
+                    !entityTagListMatches("\\"4ea9bce2\\"", hash) &&
+                    !entityTagListMatches("\\"4ea9bce236190c34", hash);
+    return ok ? 0 : 1;
+}
+""",
+        encoding="utf-8",
+    )
+    binary = Path(tmp_path) / "entity_tag"
+    subprocess.run(["g++", "-std=c++17", "-o", str(binary), str(source)], check=True)
+    subprocess.run([str(binary)], check=True)
@@ -38,6 +38,16 @@ def _empty_box(module, ip="1.2.3.4"):
     return {"ip": ip, "letters": letters, "colors": colors, "delays": delays}
 
 
+class _MissingStateEndpoint:
+    """Antwort einer Firmware ohne GET /api/state; der Manager liest dann die Startseite."""
+
+    status_code = 404
+    ok = False
+    text = "Not Found"
+    is_redirect = False
+    is_permanent_redirect = False
+
+
 @pytest.fixture
 def webserver_app(tmp_path):
     module = _load_webserver(tmp_path)
@@ -539,6 +549,8 @@ def test_transfer_box_rejects_redirects(webserver_app, monkeypatch):
             self.is_permanent_redirect = False
 
     def fake_get(url, *args, **kwargs):
+        if url.endswith("/api/state"):
+            return _MissingStateEndpoint()
         assert kwargs.get("allow_redirects") is False
         if url == f"http://{box['ip']}/":
             return RedirectResponse()
@@ -586,6 +598,8 @@ def test_transfer_box_blocks_trigger_delay_redirect(webserver_app, monkeypatch):
     call_state = {"trigger": False}
 
     def fake_get(url, *args, **kwargs):
+        if url.endswith("/api/state"):
+            return _MissingStateEndpoint()
         assert kwargs.get("allow_redirects") is False
         if url.endswith("/api/trigger-delays"):
             assert not call_state["trigger"], "Trigger-Delays API darf nur einmal abgefragt werden"
@@ -857,6 +871,8 @@ def test_update_box_sanitizes_letters_and_transfer(webserver_app, monkeypatch):
             self.ok = ok
 
     def fake_get(url, *args, **kwargs):
+        if url.endswith("/api/state"):
+            return _MissingStateEndpoint()
         assert kwargs.get("allow_redirects") is False
         assert url == "http://1.2.3.4/"
         return FakeResponse("<html></html>", True)
@@ -900,6 +916,23 @@ def test_update_box_sanitizes_letters_and_transfer(webserver_app, monkeypatch):
     assert payload["letters"]["di"][2] == "?"
 
 
+def test_update_box_accepts_catalogue_symbol_ids(webserver_app):
+    module, client = webserver_app
+    box = _empty_box(module, ip="1.2.3.4")
+    module.save_config({"boxen": {"TestBox": box}, "boxOrder": ["TestBox"]})
+
+    response = client.post(
+        "/update_box",
+        json={"hostname": "TestBox", "letters": {"mo": ["@12", " 3 ", "@07"]}},
+    )
+    assert response.status_code == 200
+
+    letters = module.load_config()["boxen"]["TestBox"]["letters"]
+    assert letters["mo"] == ["@12", "@3", "@7"]
+    assert module.sanitize_letter("@64") == ""
+    assert module.sanitize_letter("8") == ""
+
+
 def test_devices_sanitizes_invalid_ip_addresses(webserver_app):
     module, client = webserver_app
     module.save_config({"boxen": {}, "boxOrder": []})
@@ -1050,6 +1083,8 @@ def test_devices_blocks_redirect_during_learn_box(webserver_app, monkeypatch, tm
     call_state = {"count": 0}
 
     def fake_get(url, *args, **kwargs):
+        if url.endswith("/api/state"):
+            return _MissingStateEndpoint()
         assert kwargs.get("allow_redirects") is False
         if url == "http://1.2.3.4/":
             call_state["count"] += 1
@@ -1579,6 +1614,8 @@ def test_transfer_box_ignores_remote_color_case_differences(webserver_app, monke
             return self._json
 
     def fake_get(url, *args, **kwargs):
+        if url.endswith("/api/state"):
+            return _MissingStateEndpoint()
         assert kwargs.get("allow_redirects") is False
         if url.endswith("/api/trigger-delays"):
             return FakeResponse(ok=True, json_data=delays_payload)
@@ -1698,6 +1735,185 @@ def test_fetch_trigger_delays_returns_numeric_matrix(webserver_app, monkeypatch)
     assert delays["so"] == [module._coerce_delay_value(value) for value in payload["delays"]["so"]]
 
 
+def _firmware_state_payload(module):
+    payload = {
+        "hostname": "Box1",
+        "revision": 7,
+        "letters": {},
+        "colors": {},
+        "color_modes": {},
+        "color_palette_masks": {},
+        "delays": {},
+        "display": {"brightness": 100, "letter_time": 10, "auto_interval": 300, "auto_mode": False},
+        "active_window": {"start": "08:00", "end": "22:00"},
+    }
+    for day in module.DAYS:
+        payload["letters"][day] = ["A", "@12", "*"]
+        payload["colors"][day] = ["#FF0000", "#00ff00", "#0000ff"]
+        payload["color_modes"][day] = ["fixed", "random_selected", "random_all"]
+        payload["color_palette_masks"][day] = [255, 3, 255]
+        payload["delays"][day] = [0, 5, 12]
+    return payload
+
+
+def test_learn_box_reads_state_api_without_html(webserver_app, monkeypatch):
+    module, _ = webserver_app
+    payload = _firmware_state_payload(module)
+
+    class StateResponse:
+        ok = True
+        status_code = 200
+        is_redirect = False
+        is_permanent_redirect = False
+
+        @staticmethod
+        def json():
+            return payload
+
+    requested = []
+
+    def fake_get(url, *args, **kwargs):
+        assert kwargs.get("allow_redirects") is False
+        requested.append(url)
+        if url == "http://1.2.3.4/api/state":
+            return StateResponse()
+        pytest.fail(f"Unerwarteter GET-Aufruf: {url}")
+
+    monkeypatch.setattr(module.requests, "get", fake_get)
+    monkeypatch.setattr(module, "BeautifulSoup", lambda *args, **kwargs: pytest.fail("HTML darf nicht geparst werden"))
+
+    module.learn_box("1.2.3.4", "StateBox")
+
+    box = module.load_config()["boxen"]["StateBox"]
+    assert requested == ["http://1.2.3.4/api/state"]
+    assert box["letters"]["mo"] == ["A", "@12", "*"]
+    assert box["colors"]["so"] == ["#ff0000", "#00ff00", "#0000ff"]
+    assert box["delays"]["sa"] == [0, 5, 12]
+    assert box["colorModes"]["di"] == ["fixed", "random_selected", "random_all"]
+    assert box["colorPaletteMasks"]["fr"] == [255, 3, 255]
+
+
+def test_transfer_box_compares_against_state_api(webserver_app, monkeypatch):
+    module, client = webserver_app
+    payload = _firmware_state_payload(module)
+    box = {
+        "ip": "1.2.3.4",
+        "letters": {day: ["A", "@12", "*"] for day in module.DAYS},
+        "colors": {day: ["#ff0000", "#00ff00", "#0000ff"] for day in module.DAYS},
+        "delays": {day: [0, 5, 12] for day in module.DAYS},
+        "colorModes": {day: ["fixed", "random_selected", "random_all"] for day in module.DAYS},
+        "colorPaletteMasks": {day: [255, 3, 255] for day in module.DAYS},
+    }
+    module.save_config({"boxen": {"TestBox": box}, "boxOrder": []})
+
+    class StateResponse:
+        ok = True
+        status_code = 200
+        is_redirect = False
+        is_permanent_redirect = False
+
+        @staticmethod
+        def json():
+            return payload
+
+    def fake_get(url, *args, **kwargs):
+        assert url == "http://1.2.3.4/api/state", f"Unerwarteter GET-Aufruf: {url}"
+        return StateResponse()
+
+    monkeypatch.setattr(module.requests, "get", fake_get)
+    monkeypatch.setattr(module.requests, "post", lambda *args, **kwargs: pytest.fail("Box ist bereits aktuell"))
+
+    response = client.post("/transfer_box", json={"hostname": "TestBox"})
+    assert response.status_code == 200
+    assert "Bereits aktuell" in response.get_json()["status"]
+
+
+def test_transfer_symbols_sends_one_bulk_request(webserver_app, monkeypatch):
+    module, client = webserver_app
+    module.save_config({"boxen": {"TestBox": _empty_box(module)}, "boxOrder": []})
+    posted = []
+
+    class BulkResponse:
+        ok = True
+        status_code = 200
+        is_redirect = False
+        is_permanent_redirect = False
+
+        @staticmethod
+        def json():
+            # Record 0 und 2 übernommen, Record 1 abgelehnt.
+            return {"status": "ok", "records": 3, "stored": 2, "result": "05"}
+
+    def fake_post(url, *args, **kwargs):
+        assert kwargs.get("allow_redirects") is False
+        posted.append((url, kwargs))
+        return BulkResponse()
+
+    monkeypatch.setattr(module.requests, "post", fake_post)
+
+    symbols = [
+        {"char": "A", "bitmap": "ff" * 128, "enabled": True},
+        {"char": "@12", "bitmap": "0F" * 128, "enabled": False},
+        {"char": "3", "bitmap": "00" * 128},
+    ]
+    response = client.post("/transfer_symbols", json={"hostname": "TestBox", "symbols": symbols})
+
+    assert response.status_code == 200
+    assert response.get_json() == {"stored": 2, "rejected": ["@12"]}
+    assert [url for url, _ in posted] == ["http://1.2.3.4/api/symbols/bulk"]
+    body = posted[0][1]["data"]
+    assert posted[0][1]["headers"]["Content-Type"] == "application/octet-stream"
+    assert len(body) == 3 * 130
+    assert body[0:2] == bytes((ord("A"), 0x01)) and body[2:130] == b"\xff" * 128
+    assert body[130:132] == bytes((0x80 + 12, 0x00)) and body[132:260] == b"\x0f" * 128
+    assert body[260:262] == bytes((0x80 + 3, 0x01))
+
+
+def test_transfer_symbols_falls_back_to_single_uploads(webserver_app, monkeypatch):
+    module, client = webserver_app
+    module.save_config({"boxen": {"TestBox": _empty_box(module)}, "boxOrder": []})
+    posted = []
+
+    class OkResponse:
+        ok = True
+        status_code = 200
+        text = "OK"
+        is_redirect = False
+        is_permanent_redirect = False
+
+    def fake_post(url, *args, **kwargs):
+        posted.append((url, kwargs.get("data")))
+        if url.endswith("/api/symbols/bulk"):
+            return _MissingStateEndpoint()
+        return OkResponse()
+
+    monkeypatch.setattr(module.requests, "post", fake_post)
+
+    symbols = [{"char": "B", "bitmap": "aa" * 128}, {"char": "@1", "bitmap": "bb" * 128}]
+    response = client.post("/transfer_symbols", json={"hostname": "TestBox", "symbols": symbols})
+
+    assert response.status_code == 200
+    assert response.get_json() == {"stored": 2, "rejected": []}
+    assert [url for url, _ in posted] == [
+        "http://1.2.3.4/api/symbols/bulk",
+        "http://1.2.3.4/api/symbol-bitmap",
+        "http://1.2.3.4/api/symbol-bitmap",
+    ]
+    assert posted[2][1]["char"] == "@1"
+
+
+def test_transfer_symbols_rejects_invalid_entries(webserver_app, monkeypatch):
+    module, client = webserver_app
+    module.save_config({"boxen": {"TestBox": _empty_box(module)}, "boxOrder": []})
+    monkeypatch.setattr(module.requests, "post", lambda *args, **kwargs: pytest.fail("Ungültige Symbole gesendet"))
+
+    response = client.post(
+        "/transfer_symbols",
+        json={"hostname": "TestBox", "symbols": [{"char": "A", "bitmap": "ff" * 128}, {"char": "@64", "bitmap": "ff" * 128}]},
+    )
+    assert response.status_code == 400
+
+
 def test_learn_box_uses_html_delays_when_api_unavailable(webserver_app, monkeypatch):
     module, _ = webserver_app
 
@@ -1736,6 +1952,8 @@ def test_learn_box_uses_html_delays_when_api_unavailable(webserver_app, monkeypa
             self.ok = ok
 
     def fake_get(url, *args, **kwargs):
+        if url.endswith("/api/state"):
+            return _MissingStateEndpoint()
         if url.endswith("/api/trigger-delays"):
             raise module.requests.RequestException("api down")
         assert url == "http://1.2.3.4/"
@@ -0,0 +1,92 @@
+#include "trigger_scheduler.h"
+
+#include <iostream>
+
+SerialClass Serial;
+
+namespace {
+
+bool expect(bool condition, const char *message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+bool expectPop(unsigned long now, uint8_t triggerIndex, unsigned long executeAt, const char *message) {
+    PendingTrigger trigger = {};
+    return expect(popDueScheduledTrigger(now, trigger) && trigger.triggerIndex == triggerIndex &&
+                      trigger.executeAt == executeAt,
+                  message);
+}
+
+bool verifyDeadlineOrderAndFifo() {
+    clearScheduledTriggers();
+    scheduleTrigger({2, 300, false});
+    scheduleTrigger({0, 100, true});
+    scheduleTrigger({1, 100, false});
+    scheduleTrigger({0, 200, false});
+
+    PendingTrigger next = {};
+    return expect(peekNextScheduledTrigger(next) && next.executeAt == 100, "Frühester Termin nicht oben") &&
+           expect(isTriggerScheduled(0) && isTriggerScheduled(2), "Trigger nicht als geplant markiert") &&
+           expect(millisUntilNextScheduledTrigger(40) == 60, "Restzeit bis zum nächsten Termin falsch") &&
+           expect(!popDueScheduledTrigger(99, next), "Nicht fälliger Trigger wurde entnommen") &&
+           expectPop(100, 0, 100, "FIFO bei gleichem Termin verletzt (erster)") &&
+           expectPop(100, 1, 100, "FIFO bei gleichem Termin verletzt (zweiter)") &&
+           expect(isTriggerScheduled(0) && !isTriggerScheduled(1), "Zähler pro Trigger falsch") &&
+           expectPop(500, 0, 200, "Termin 200 nicht an dritter Stelle") &&
+           expectPop(500, 2, 300, "Termin 300 nicht an letzter Stelle") &&
+           expect(millisUntilNextScheduledTrigger(500) == TRIGGER_SCHEDULE_IDLE, "Leerer Scheduler meldet Termin");
+}
+
+bool verifyMillisWraparound() {
+    clearScheduledTriggers();
+    const unsigned long beforeWrap = ULONG_MAX - 50UL;
+    const unsigned long afterWrap = 25UL;  // liegt zeitlich 76 ms nach beforeWrap
+    scheduleTrigger({1, afterWrap, false});
+    scheduleTrigger({0, beforeWrap, false});
+
+    return expect(millisUntilNextScheduledTrigger(ULONG_MAX - 60UL) == 10, "Restzeit über den Überlauf falsch") &&
+           expectPop(ULONG_MAX - 50UL, 0, beforeWrap, "Termin vor dem Überlauf nicht zuerst") &&
+           expect(millisUntilNextScheduledTrigger(ULONG_MAX) == 26, "Restzeit nach dem Überlauf falsch") &&
+           expectPop(30UL, 1, afterWrap, "Termin nach dem Überlauf nicht fällig");
+}
+
+bool verifyCapacityAndBurst() {
+    clearScheduledTriggers();
+    for (size_t index = 0; index < TRIGGER_QUEUE_CAPACITY; ++index) {
+        if (!expect(scheduleTrigger({static_cast<uint8_t>(index % NUM_TRIGGERS),
+                                     1000UL - static_cast<unsigned long>(index), false}),
+                    "Scheduler voll vor Erreichen der Kapazität")) {
+            return false;
+        }
+    }
+    if (!expect(!scheduleTrigger({0, 0, false}), "Kapazität wird überschritten") ||
+        !expect(!scheduleTrigger({NUM_TRIGGERS, 0, false}), "Ungültiger Trigger wird angenommen")) {
+        return false;
+    }
+
+    unsigned long previous = 0;
+    PendingTrigger trigger = {};
+    size_t popped = 0;
+    while (popDueScheduledTrigger(2000UL, trigger)) {
+        if (!expect(popped == 0 || trigger.executeAt >= previous, "Heap liefert Termine nicht aufsteigend")) {
+            return false;
+        }
+        previous = trigger.executeAt;
+        ++popped;
+    }
+    return expect(popped == TRIGGER_QUEUE_CAPACITY, "Nicht alle Trigger entnommen") &&
+           expect(!isTriggerScheduled(0) && !isTriggerScheduled(1) && !isTriggerScheduled(2),
+                  "Trigger nach dem Leeren weiterhin als geplant markiert");
+}
+
+} // namespace
+
+int main() {
+    if (!verifyDeadlineOrderAndFifo() || !verifyMillisWraparound() || !verifyCapacityAndBurst()) {
+        return 1;
+    }
+    return 0;
+}
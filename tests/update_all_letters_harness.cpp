@@ -0,0 +1,190 @@
+#include "config.h"
+#include "json_stream.h"
+
+#include <LittleFS.h>
+#include <cctype>
+#include <math.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+SerialClass Serial;
+ESPClass ESP;
+FakeEEPROMClass EEPROM;
+FakeFileSystem LittleFS;
+Ticker display_ticker;
+bool triggerActive = false;
+unsigned long letterStartTime = 0;
+unsigned long wifiStartTime = 0;
+
+namespace harness {
+
+// Die Teile der Arduino-String-API, die der herausgelöste Code benutzt; der Host-Stub kennt nur std::string.
+struct String : std::string {
+    using std::string::string;
+    using std::string::operator=;
+    String() = default;
+    String(const std::string &value) : std::string(value) {}
+    explicit String(int value) : std::string(std::to_string(value)) {}
+    explicit String(size_t value) : std::string(std::to_string(value)) {}
+
+    char charAt(size_t index) const { return index < size() ? (*this)[index] : '\0'; }
+    bool isEmpty() const { return empty(); }
+    long toInt() const { return std::strtol(c_str(), nullptr, 10); }
+    void trim() {
+        const size_t first = find_first_not_of(" \t\r\n");
+        const size_t last = find_last_not_of(" \t\r\n");
+        *this = first == npos ? String() : String(substr(first, last - first + 1));
+    }
+    void toUpperCase() {
+        for (char &value : *this) {
+            value = static_cast<char>(std::toupper(static_cast<unsigned char>(value)));
+        }
+    }
+    void toLowerCase() {
+        for (char &value : *this) {
+            value = static_cast<char>(std::tolower(static_cast<unsigned char>(value)));
+        }
+    }
+};
+
+constexpr const char *const DAY_KEYS[NUM_DAYS] = {
+    "so", "mo", "di", "mi", "do", "fr", "sa",
+};
+
+// Von test_update_all_letters_overflow.py aus src/web_manager.cpp herausgelöst.
+#include "update_all_letters_stream.inc"
+
+bool expect(bool condition, const std::string &message) {
+    if (!condition) {
+        std::cerr << message << std::endl;
+    }
+    return condition;
+}
+
+std::string dayMatrix(const char *value) {
+    std::string json = "{";
+    for (size_t day = 0; day < NUM_DAYS; ++day) {
+        json += std::string(day == 0 ? "" : ",") + "\"" + DAY_KEYS[day] + "\":[" + value + "," + value + "," + value + "]";
+    }
+    return json + "}";
+}
+
+std::string payload(const std::string &extra = std::string()) {
+    return "{\"letters\":" + dayMatrix("\"a\"") + ",\"colors\":" + dayMatrix("\"#00ff7f\"") +
+           ",\"delays\":" + dayMatrix("5") + extra + "}";
+}
+
+// Speist den Rumpf in Stücken von `chunk` Bytes ein wie der Body-Callback und schließt ab.
+bool runUpdate(const std::string &body, UpdateAllLettersContext &context, size_t chunk) {
+    beginLettersUpdate(context);
+    for (size_t offset = 0; offset < body.size(); offset += chunk) {
+        const size_t length = std::min(chunk, body.size() - offset);
+        feedJsonStream(context.parser, reinterpret_cast<const uint8_t *>(body.data() + offset), length);
+    }
+    return finishLettersUpdate(context);
+}
+
+bool verifyAccepted(const std::string &body, UpdateAllLettersContext &context) {
+    UpdateAllLettersContext bytewise;
+    const bool accepted = runUpdate(body, context, body.size());
+    const bool acceptedBytewise = runUpdate(body, bytewise, 1);
+    if (!expect(accepted, "Gültiges Update abgelehnt: " + context.validationMessage) ||
+        !expect(acceptedBytewise, "Byteweise gelesenes Update abgelehnt: " + bytewise.validationMessage)) {
+        return false;
+    }
+    return expect(memcmp(context.parsedLetters, bytewise.parsedLetters, sizeof(context.parsedLetters)) == 0 &&
+                      memcmp(context.parsedColors, bytewise.parsedColors, sizeof(context.parsedColors)) == 0 &&
+                      memcmp(context.parsedDelays, bytewise.parsedDelays, sizeof(context.parsedDelays)) == 0 &&
+                      memcmp(context.parsedColorModes, bytewise.parsedColorModes, sizeof(context.parsedColorModes)) == 0 &&
+                      memcmp(context.parsedPaletteMasks, bytewise.parsedPaletteMasks, sizeof(context.parsedPaletteMasks)) == 0,
+                  "Stückelung ändert das Ergebnis");
+}
+
+bool verifyRejected(const std::string &body, const std::string &message) {
+    for (size_t chunk : {body.size(), static_cast<size_t>(1)}) {
+        UpdateAllLettersContext context;
+        const bool accepted = runUpdate(body, context, chunk);
+        if (!expect(!accepted && context.validationMessage == message,
+                    "Erwartet \"" + message + "\", erhalten \"" + context.validationMessage + "\"")) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool verifyFullWeekUpdate() {
+    UpdateAllLettersContext context;
+    const std::string body =
+        payload(",\"ignored\":{\"mo\":[[1,{\"x\":2}]]},\"color_modes\":" + dayMatrix("\"random_selected\"") +
+                ",\"colorModes\":" + dayMatrix("\"bogus\"") + ",\"color_palette_masks\":" + dayMatrix("3"));
+    if (!verifyAccepted(body, context)) {
+        return false;
+    }
+    return expect(context.parsedLetters[2][6] == 'A', "Zeichen nicht übernommen") &&
+           expect(std::string(context.parsedColors[0][0]) == "#00FF7F", "Farbe nicht normalisiert") &&
+           expect(context.parsedDelays[1][3] == 5UL, "Verzögerung nicht übernommen") &&
+           expect(context.parsedColorModes[0][1] == static_cast<uint8_t>(LetterColorMode::RandomSelected),
+                  "Hauptschlüssel color_modes nicht bevorzugt") &&
+           expect(context.parsedPaletteMasks[2][2] == 3U, "Zufallspalette nicht übernommen") &&
+           expect(sizeof(UpdateAllLettersContext) < 1024, "Kontext belegt mehr als ein paar hundert Byte");
+}
+
+bool verifyValueForms() {
+    UpdateAllLettersContext context;
+    std::string letters = dayMatrix("\"@12\"");
+    letters.replace(letters.find("\"@12\""), 5, "\" 3 \"");
+    std::string delays = dayMatrix("\"12\"");
+    delays.replace(delays.find("\"12\""), 4, "7.0");
+    const std::string body = "{\"letters\":" + letters + ",\"colors\":" + dayMatrix("\"#ABCDEF\"") +
+                             ",\"delays\":" + delays + ",\"colorModes\":" + dayMatrix("\"FIXED\"") + "}";
+    return verifyAccepted(body, context) &&
+           expect(context.parsedLetters[0][0] == customSymbolFromId(3), "Altes Zusatzzeichen nicht umgestellt") &&
+           expect(context.parsedLetters[1][0] == customSymbolFromId(12), "Katalog-Symbol nicht erkannt") &&
+           expect(context.parsedDelays[0][0] == 7UL && context.parsedDelays[1][0] == 12UL,
+                  "Verzögerung als Kommazahl bzw. String nicht erkannt") &&
+           expect(context.parsedPaletteMasks[0][0] == 0xFFU, "Zufallspalette nicht vorbelegt");
+}
+
+bool verifyValidationMessages() {
+    std::string shortDay = payload();
+    shortDay.replace(shortDay.find("\"mo\":[\"a\",\"a\",\"a\"]"), 19, "\"mo\":[\"a\",\"a\"]");
+    std::string longDay = payload();
+    longDay.replace(longDay.find("\"di\":[\"a\",\"a\",\"a\"]"), 19, "\"di\":[\"a\",\"a\",\"a\",\"a\"]");
+    std::string missingDay = payload();
+    missingDay.replace(missingDay.find(",\"sa\":[5,5,5]"), 13, "");
+    std::string badColor = payload();
+    badColor.replace(badColor.find("\"#00ff7f\",\"#00ff7f\"],\"di\""), 9, "\"#00ff7g\"");
+    std::string badDelay = payload();
+    badDelay.replace(badDelay.find("\"so\":[5"), 7, "\"so\":[1000");
+    std::string numberLetter = payload();
+    numberLetter.replace(numberLetter.find("\"a\""), 3, "1");
+
+    return verifyRejected(shortDay, "Ungültige Zeichenliste für Tag mo") &&
+           verifyRejected(longDay, "Ungültige Zeichenliste für Tag di") &&
+           verifyRejected(missingDay, "Ungültige Verzögerungsliste für Tag sa") &&
+           verifyRejected(badColor, "Ungültiger Farbwert für Trigger 2 am Tag mo") &&
+           verifyRejected(badDelay, "Ungültige Verzögerung für Trigger 1 am Tag so (erlaubt: 0-999 Sekunden).") &&
+           verifyRejected(numberLetter, "Zeichen/Symbol fehlt für Trigger 1 am Tag so") &&
+           verifyRejected("{\"letters\":" + dayMatrix("\"a\"") + ",\"colors\":" + dayMatrix("\"#000000\"") + "}",
+                          "JSON-Feld \"delays\" fehlt oder ist ungültig.") &&
+           verifyRejected(payload(",\"color_modes\":" + dayMatrix("\"random_selected\"") +
+                                  ",\"color_palette_masks\":" + dayMatrix("0")),
+                          "Zufall (ausgewaehlt) benoetigt mindestens eine Farbe.") &&
+           verifyRejected(payload(",\"color_palette_masks\":" + dayMatrix("70000")),
+                          "Zufallspalette außerhalb des gueltigen Bereichs.") &&
+           verifyRejected("{\"letters\":[]}", "JSON-Feld \"letters\" fehlt oder ist ungültig.") &&
+           verifyRejected("[1]", "JSON-Payload fehlt.") &&
+           verifyRejected(" ", "JSON-Nutzlast fehlt oder ist leer.") &&
+           verifyRejected(payload().substr(0, 40), "JSON konnte nicht gelesen werden: IncompleteInput");
+}
+
+} // namespace harness
+
+int main() {
+    if (!harness::verifyFullWeekUpdate() || !harness::verifyValueForms() || !harness::verifyValidationMessages()) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+"""Packt die statischen Dateien der Weboberfläche gzip-komprimiert nach src/web_assets.h.
+
+Läuft als PlatformIO-Pre-Script vor jedem Build (extra_scripts = pre:tools/embed_web_assets.py)
+und lässt sich auch direkt aufrufen:
+
+    python3 tools/embed_web_assets.py           # Header neu schreiben
+    python3 tools/embed_web_assets.py --check   # nur prüfen, ob der Header aktuell ist
+
+Der Header wird mit eingecheckt, damit auch Builds ohne das Script die Assets finden. Er ändert
+sich nur, wenn sich eine Quelldatei unter web/ ändert: gzip läuft ohne Zeitstempel und Dateiname,
+der Inhalts-Hash (ETag) wird aus den unkomprimierten Bytes berechnet.
+"""
+
+from __future__ import annotations
+
+import gzip
+import hashlib
+import re
+import sys
+from pathlib import Path
+
+try:
+    ROOT = Path(__file__).resolve().parent.parent
+except NameError:  # Unter SCons ist __file__ nicht gesetzt.
+    ROOT = Path.cwd()
+
+OUTPUT = ROOT / "src" / "web_assets.h"
+
+# Quelldatei, Name im Header
+ASSETS = (
+    ("web/script.js", "SCRIPT_JS"),
+    ("web/style.css", "STYLE_CSS"),
+)
+
+BYTES_PER_LINE = 16
+HASH_LENGTH = 16
+
+
+def asset_hash(data: bytes) -> str:
+    return hashlib.sha256(data).hexdigest()[:HASH_LENGTH]
+
+
+def compress(data: bytes) -> bytes:
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def render_asset(source: str, name: str) -> str:
+    data = (ROOT / source).read_bytes()
+    packed = compress(data)
+    lines = [
+        f"// {source}: {len(data)} Bytes, gzip {len(packed)} Bytes",
+        f'#define WEB_ASSET_{name}_HASH "{asset_hash(data)}"',
+        f"static constexpr size_t WEB_ASSET_{name}_GZ_LENGTH = {len(packed)};",
+        f"static const uint8_t WEB_ASSET_{name}_GZ[] PROGMEM = {{",
+    ]
+    for offset in range(0, len(packed), BYTES_PER_LINE):
+        row = packed[offset:offset + BYTES_PER_LINE]
+        lines.append("    " + ", ".join(f"0x{value:02x}" for value in row) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def render_header() -> str:
+    parts = [
+        "// **Automatisch erzeugt von tools/embed_web_assets.py – nicht von Hand bearbeiten**",
+        "// Statische Dateien der Weboberfläche, gzip-komprimiert im Flash. WEB_ASSET_*_HASH dient",
+        "// als ETag und als Versionsparameter in den Verweisen der Startseite.",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+    ]
+    for source, name in ASSETS:
+        parts.append(render_asset(source, name))
+        parts.append("")
+    parts.append("#endif")
+    return "\n".join(parts) + "\n"
+
+
+def embedded_assets(header: str) -> dict[str, tuple[str, bytes]]:
+    """Liest Hash und entpackten Inhalt jedes Assets aus einem erzeugten Header."""
+    assets = {}
+    for _, name in ASSETS:
+        hash_match = re.search(rf'#define WEB_ASSET_{name}_HASH "([0-9a-f]+)"', header)
+        data_match = re.search(rf"WEB_ASSET_{name}_GZ\[\] PROGMEM = \{{(.*?)\}};", header, re.S)
+        if hash_match and data_match:
+            packed = bytes(int(value, 16) for value in re.findall(r"0x([0-9a-f]{2})", data_match.group(1)))
+            assets[name] = (hash_match.group(1), gzip.decompress(packed))
+    return assets
+
+
+def header_is_current() -> bool:
+    # Verglichen wird der entpackte Inhalt: andere zlib-Versionen dürfen anders komprimieren.
+    if not OUTPUT.exists():
+        return False
+    embedded = embedded_assets(OUTPUT.read_text(encoding="utf-8"))
+    for source, name in ASSETS:
+        data = (ROOT / source).read_bytes()
+        if embedded.get(name) != (asset_hash(data), data):
+            return False
+    return True
+
+
+def write_header() -> bool:
+    if header_is_current():
+        return False
+    OUTPUT.write_text(render_header(), encoding="utf-8")
+    return True
+
+
+def main(argv: list[str]) -> int:
+    if "--check" in argv:
+        if not header_is_current():
+            print(f"{OUTPUT.relative_to(ROOT)} ist veraltet – tools/embed_web_assets.py ausführen")
+            return 1
+        return 0
+    if write_header():
+        print(f"{OUTPUT.relative_to(ROOT)} neu erzeugt")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
+else:
+    # PlatformIO lädt das Script über SCons; dort liefert env das Projektverzeichnis.
+    try:
+        Import("env")  # noqa: F821
+        ROOT = Path(env["PROJECT_DIR"])  # noqa: F821
+        OUTPUT = ROOT / "src" / "web_assets.h"
+        if write_header():
+            print("web_assets.h neu erzeugt")
+    except NameError:
+        pass
@@ -0,0 +1,518 @@
+const riddleMatrixManagerKey = new URLSearchParams(window.location.search).get('rm_key') || '';
+
+function managerFetch(url, options) {
+    const fetchOptions = Object.assign({}, options || {});
+    const headers = new Headers(fetchOptions.headers || {});
+    if (riddleMatrixManagerKey) {
+        headers.set('X-RiddleMatrix-Manager-Key', riddleMatrixManagerKey);
+    }
+    fetchOptions.headers = headers;
+    return fetch(url, fetchOptions);
+}
+
+function updateRtcInputs(timeText) {
+    const text = String(timeText || '');
+    const match = text.match(/(\d{4})-(\d{2})-(\d{2})\s+(\d{2}:\d{2}(?::\d{2})?)/);
+    const dateField = document.querySelector("input[name='date']");
+    const timeField = document.querySelector("input[name='time']");
+    const weekdayField = document.getElementById('rtcWeekday');
+    if (weekdayField) {
+        const weekday = text.split(',')[0].trim();
+        weekdayField.innerText = weekday && !/\d/.test(weekday) ? weekday : '-';
+    }
+    if (!match || !dateField || !timeField) {
+        return;
+    }
+    if (document.activeElement !== dateField) {
+        dateField.value = match[1] + '-' + match[2] + '-' + match[3];
+    }
+    if (document.activeElement !== timeField) {
+        timeField.value = match[4].length === 5 ? match[4] + ':00' : match[4];
+    }
+}
+
+// 🕒 Aktuelle Uhrzeit abrufen
+function fetchRTC() {
+    managerFetch('/getTime')
+        .then(response => response.text())
+        .then(time => {
+            document.getElementById('rtcTime').innerText = time;
+            updateRtcInputs(time);
+        })
+        .catch(error => console.error('Fehler:', error));
+}
+
+// 📝 Freien RAM abrufen
+function fetchMemory() {
+    managerFetch('/memory')
+        .then(response => response.text())
+        .then(memory => {
+            document.getElementById('memoryUsage').innerText = memory;
+        })
+        .catch(error => console.error('Fehler:', error));
+}
+
+// 🕒 RTC-Zeit setzen
+function setRTC() {
+    let form = new FormData(document.getElementById('rtcForm'));
+    managerFetch('/setTime', { method: 'POST', body: form })
+        .then(response => response.text())
+        .then(alert)
+        .catch(error => alert('Fehler: ' + error));
+}
+
+// 🌐 Zeit per NTP synchronisieren
+function syncNTP() {
+    managerFetch('/syncNTP')
+        .then(response => response.text().then(message => ({ ok: response.ok, message })))
+        .then(result => {
+            const text = result.message && result.message.trim() !== ''
+                ? result.message
+                : (result.ok ? 'NTP Synchronisierung erfolgreich!' : 'Fehler bei der NTP Synchronisierung.');
+            if (!result.ok) {
+                console.warn('Serverfehler:', text);
+            } else {
+                console.log('ℹ️ Serverantwort:', text);
+            }
+            alert(text);
+        })
+        .catch(error => {
+            console.error('Fehler:', error);
+            alert('Fehler: ' + error);
+        });
+}
+
+function loadWiFiNetworks() {
+    const select = document.getElementById('wifiNetworkSelect');
+    if (!select) {
+        return;
+    }
+    select.innerHTML = '<option>Suche Netzwerke...</option>';
+    managerFetch('/scanWiFi')
+        .then(response => response.json())
+        .then(networks => {
+            select.innerHTML = '<option value="">SSID aus Liste waehlen...</option>';
+            networks.forEach(network => {
+                const option = document.createElement('option');
+                option.value = network.ssid;
+                option.textContent = network.ssid + ' (' + network.rssi + ' dBm' + (network.encrypted ? ', verschluesselt' : ', offen') + ')';
+                select.appendChild(option);
+            });
+        })
+        .catch(error => {
+            select.innerHTML = '<option value="">Scan fehlgeschlagen</option>';
+            console.error('Fehler beim WLAN-Scan:', error);
+        });
+}
+
+function applySelectedWiFiNetwork() {
+    const select = document.getElementById('wifiNetworkSelect');
+    const ssidInput = document.querySelector('#wifiForm input[name="ssid"]');
+    if (select && ssidInput && select.value) {
+        ssidInput.value = select.value;
+    }
+}
+
+function updateWiFiModeFields() {
+    const mode = document.querySelector('#wifiForm input[name="wifi_mode"]:checked')?.value || 'timed';
+    const persistentFields = document.getElementById('persistentWifiFields');
+    const apFields = document.getElementById('localApFields');
+    const symbolField = document.getElementById('wifiSymbolField');
+    const symbolCheckbox = document.getElementById('wifi_status_symbol_enabled');
+
+    if (persistentFields) {
+        persistentFields.style.display = mode === 'timed' ? 'none' : 'block';
+    }
+    if (apFields) {
+        apFields.style.display = mode === 'ap_sta' ? 'block' : 'none';
+    }
+    if (symbolField) {
+        symbolField.style.display = mode === 'timed' ? 'block' : 'none';
+    }
+    if (symbolCheckbox && mode !== 'timed') {
+        symbolCheckbox.checked = false;
+    }
+}
+
+function toggleStaticIpFields() {
+    const enabled = document.getElementById('wifi_static_ip_enabled')?.checked;
+    const fields = document.getElementById('staticIpFields');
+    if (fields) {
+        fields.style.display = enabled ? 'block' : 'none';
+    }
+}
+
+// 🔔 Zeichen-/Symbol-Trigger über Webinterface
+function triggerLetter(triggerIndex) {
+    let query = '';
+    if (typeof triggerIndex === 'number' && triggerIndex >= 0) {
+        query = '?trigger=' + encodeURIComponent(triggerIndex + 1);
+    }
+
+    managerFetch('/triggerLetter' + query)
+        .then(response => response.text().then(message => ({ ok: response.ok, message })))
+        .then(result => {
+            const text = result.message && result.message.trim() !== '' ? result.message : (result.ok ? '✅ Trigger erfolgreich!' : '❌ Unbekannter Fehler beim Trigger!');
+            if (!result.ok) {
+                console.warn('❌ Serverfehler:', text);
+            } else {
+                console.log('ℹ️ Serverantwort:', text);
+            }
+            alert(text);
+        })
+        .catch(error => {
+            console.error('❌ Fehler:', error);
+            alert('❌ Fehler: ' + error);
+        });
+}
+
+// 👁️ Zeichen/Symbol direkt anzeigen
+function displayLetter(triggerIndex, letter) {
+    if (typeof letter !== 'string' || letter.length !== 1) {
+        console.warn('❌ Ungültiges Zeichen/Symbol:', letter);
+        alert('❌ Bitte ein einzelnes Zeichen/Symbol auswählen.');
+        return;
+    }
+
+    let url = '/displayLetter?char=' + encodeURIComponent(letter);
+    if (typeof triggerIndex === 'number' && triggerIndex >= 0) {
+        url += '&trigger=' + encodeURIComponent(triggerIndex + 1);
+    }
+
+    managerFetch(url)
+        .then(response => response.text().then(message => ({ ok: response.ok, message })))
+        .then(result => {
+            const text = result.message && result.message.trim() !== '' ? result.message : (result.ok ? '✅ Zeichen/Symbol angezeigt!' : '❌ Anzeige fehlgeschlagen!');
+            if (!result.ok) {
+                console.warn('❌ Serverfehler:', text);
+            } else {
+                console.log('ℹ️ Serverantwort:', text);
+            }
+            alert(text);
+        })
+        .catch(error => {
+            console.error('❌ Fehler:', error);
+            alert('❌ Fehler: ' + error);
+        });
+}
+
+// 💾 WiFi-Daten speichern
+let symbolEditorBitmap = new Array(128).fill(0);
+
+function symbolBitIsSet(x, y) {
+    const byteIndex = y * 4 + Math.floor(x / 8);
+    return (symbolEditorBitmap[byteIndex] & (1 << (7 - (x % 8)))) !== 0;
+}
+
+function setSymbolBit(x, y, enabled) {
+    const byteIndex = y * 4 + Math.floor(x / 8);
+    const mask = 1 << (7 - (x % 8));
+    if (enabled) {
+        symbolEditorBitmap[byteIndex] |= mask;
+    } else {
+        symbolEditorBitmap[byteIndex] &= ~mask;
+    }
+}
+
+function renderSymbolEditor() {
+    const grid = document.getElementById('symbolGrid');
+    if (!grid) {
+        return;
+    }
+    grid.innerHTML = '';
+    for (let y = 0; y < 32; y++) {
+        for (let x = 0; x < 32; x++) {
+            const cell = document.createElement('button');
+            cell.type = 'button';
+            cell.className = 'symbol-cell' + (symbolBitIsSet(x, y) ? ' on' : '');
+            cell.addEventListener('click', () => {
+                setSymbolBit(x, y, !symbolBitIsSet(x, y));
+                renderSymbolEditor();
+            });
+            grid.appendChild(cell);
+        }
+    }
+}
+
+function symbolBitmapToHex() {
+    return symbolEditorBitmap
+        .map(value => (value & 255).toString(16).padStart(2, '0'))
+        .join('')
+        .toUpperCase();
+}
+
+function loadSymbolFromHex(hex) {
+    const clean = String(hex || '').trim();
+    if (!/^[0-9a-fA-F]{256}$/.test(clean)) {
+        symbolEditorBitmap = new Array(128).fill(0);
+    } else {
+        symbolEditorBitmap = [];
+        for (let index = 0; index < clean.length; index += 2) {
+            symbolEditorBitmap.push(parseInt(clean.slice(index, index + 2), 16));
+        }
+    }
+    renderSymbolEditor();
+}
+
+function loadCustomSymbol() {
+    const symbol = document.getElementById('symbolSlot')?.value || 'A';
+    managerFetch('/api/symbol-bitmap?char=' + encodeURIComponent(symbol))
+        .then(response => response.json())
+        .then(data => {
+            loadSymbolFromHex(data.bitmap || '');
+            const enabled = document.getElementById('symbolEnabled');
+            if (enabled) {
+                enabled.checked = !!data.enabled;
+            }
+            const mode = document.getElementById('symbolEditorMode');
+            if (mode) {
+                mode.textContent = data.builtin
+                    ? 'Standard-Zeichen: beim Speichern wird der eingebaute Default ueberschrieben.'
+                    : 'Zusatz-Zeichen: wird im Speicher abgelegt und kann direkt ausgewaehlt werden.';
+            }
+        })
+        .catch(error => alert('Symbol konnte nicht geladen werden: ' + error));
+}
+
+function saveCustomSymbol() {
+    const form = new FormData();
+    form.append('char', document.getElementById('symbolSlot')?.value || 'A');
+    form.append('enabled', document.getElementById('symbolEnabled')?.checked ? '1' : '0');
+    form.append('bitmap', symbolBitmapToHex());
+    managerFetch('/api/symbol-bitmap', { method: 'POST', body: form })
+        .then(response => response.text().then(message => ({ ok: response.ok, message })))
+        .then(result => alert(result.message || (result.ok ? 'Symbol gespeichert.' : 'Symbol konnte nicht gespeichert werden.')))
+        .catch(error => alert('Symbol konnte nicht gespeichert werden: ' + error));
+}
+
+function resetSymbolToDefault() {
+    const form = new FormData();
+    form.append('char', document.getElementById('symbolSlot')?.value || 'A');
+    form.append('clear', '1');
+    managerFetch('/api/symbol-bitmap', { method: 'POST', body: form })
+        .then(response => response.text().then(message => ({ ok: response.ok, message })))
+        .then(result => {
+            alert(result.message || (result.ok ? 'Default wiederhergestellt.' : 'Default konnte nicht wiederhergestellt werden.'));
+            loadCustomSymbol();
+        })
+        .catch(error => alert('Default konnte nicht wiederhergestellt werden: ' + error));
+}
+
+function clearCustomSymbol() {
+    symbolEditorBitmap = new Array(128).fill(0);
+    renderSymbolEditor();
+}
+
+function importSymbolImage(input) {
+    const file = input.files && input.files[0];
+    if (!file) {
+        return;
+    }
+    const image = new Image();
+    image.onload = () => {
+        const canvas = document.createElement('canvas');
+        canvas.width = 32;
+        canvas.height = 32;
+        const ctx = canvas.getContext('2d');
+        ctx.drawImage(image, 0, 0, 32, 32);
+        const pixels = ctx.getImageData(0, 0, 32, 32).data;
+        symbolEditorBitmap = new Array(128).fill(0);
+        for (let y = 0; y < 32; y++) {
+            for (let x = 0; x < 32; x++) {
+                const offset = (y * 32 + x) * 4;
+                const alpha = pixels[offset + 3];
+                const brightness = (pixels[offset] + pixels[offset + 1] + pixels[offset + 2]) / 3;
+                setSymbolBit(x, y, alpha > 32 && brightness < 220);
+            }
+        }
+        renderSymbolEditor();
+        URL.revokeObjectURL(image.src);
+    };
+    image.onerror = () => alert('Bild konnte nicht gelesen werden.');
+    image.src = URL.createObjectURL(file);
+}
+
+function displayDayTriggersSequential(dayIndex) {
+    const delayMs = 1500;
+    for (let trigger = 0; trigger < 3; trigger++) {
+        window.setTimeout(() => {
+            const select = document.getElementById('letter_' + trigger + '_' + dayIndex);
+            if (select) {
+                displayLetter(trigger, select.value);
+            }
+        }, trigger * delayMs);
+    }
+}
+
+function saveWiFi() {
+    const formElement = document.getElementById('wifiForm');
+    let form = new FormData(formElement);
+
+    // Checkbox explizit berücksichtigen: Nur wenn "Passwort löschen" gesetzt ist,
+    // wird das Flag gesendet, ansonsten entfernen wir den Parameter.
+    const removeCheckbox = document.getElementById('password_remove');
+    if (removeCheckbox) {
+        if (removeCheckbox.checked) {
+            form.set('password_remove', 'on');
+        } else {
+            form.delete('password_remove');
+        }
+    }
+
+    const symbolCheckbox = document.getElementById('wifi_status_symbol_enabled');
+    form.set('wifi_status_symbol_enabled', symbolCheckbox && symbolCheckbox.checked ? 'on' : 'off');
+    const staticIpCheckbox = document.getElementById('wifi_static_ip_enabled');
+    form.set('wifi_static_ip_enabled', staticIpCheckbox && staticIpCheckbox.checked ? 'on' : 'off');
+
+    managerFetch('/updateWiFi', { method: 'POST', body: form })
+        .then(response => response.text())
+        .then(alert)
+        .catch(error => alert('❌ Fehler: ' + error));
+}
+
+// 💾 Anzeige-Einstellungen speichern
+function saveDisplaySettings() {
+    let form = new FormData(document.getElementById('displayForm'));
+    let autoModeChecked = document.getElementById('auto_mode').checked;
+    form.set('auto_mode', autoModeChecked ? 'on' : 'off');
+    managerFetch('/updateDisplaySettings', { method: 'POST', body: form })
+        .then(response => response.text())
+        .then(alert)
+        .catch(error => alert('❌ Fehler: ' + error));
+}
+
+// 💾 Trigger-Verzögerungen speichern
+function saveTriggerDelays() {
+    syncSharedTriggerFormFields();
+    let form = new FormData(document.getElementById('delaysForm'));
+    managerFetch('/updateTriggerDelays', { method: 'POST', body: form })
+        .then(response => response.text())
+        .then(alert)
+        .catch(error => alert('❌ Fehler: ' + error));
+}
+
+// 💾 Alle Zeichen/Symbole & Farben speichern
+function saveAllLetters() {
+    syncSharedTriggerFormFields();
+    let formData = new FormData(document.getElementById('lettersForm'));
+    managerFetch('/updateAllLetters', { method: 'POST', body: formData })
+        .then(response => response.text())
+        .then(alert)
+        .catch(error => alert('❌ Fehler: ' + error));
+}
+
+function isSeparateTriggerEditingEnabled() {
+    const checkbox = document.getElementById('separate_trigger_editing');
+    return checkbox ? checkbox.checked : true;
+}
+
+function applyTriggerEditMode() {
+    const separate = isSeparateTriggerEditingEnabled();
+    const lettersCheckbox = document.getElementById('separate_trigger_editing_letters');
+    if (lettersCheckbox) {
+        lettersCheckbox.checked = separate;
+    }
+    document.querySelectorAll('.advanced-trigger-column').forEach(element => {
+        element.style.display = separate ? '' : 'none';
+    });
+}
+
+function initializeTriggerEditMode() {
+    const delayCheckbox = document.getElementById('separate_trigger_editing');
+    const lettersCheckbox = document.getElementById('separate_trigger_editing_letters');
+    if (delayCheckbox) {
+        delayCheckbox.checked = false;
+    }
+    if (lettersCheckbox) {
+        lettersCheckbox.checked = false;
+    }
+    applyTriggerEditMode();
+}
+
+function syncSharedTriggerFormFields() {
+    if (isSeparateTriggerEditingEnabled()) {
+        return;
+    }
+
+    for (let day = 0; day < 7; day++) {
+        const sourceLetter = document.getElementById('letter_0_' + day);
+        const sourceColor = document.getElementById('color_0_' + day);
+        const sourceColorMode = document.getElementById('color_mode_0_' + day);
+        const sourceDelay = document.querySelector('input[name="delay_0_' + day + '"]');
+
+        for (let trigger = 1; trigger < 3; trigger++) {
+            const targetLetter = document.getElementById('letter_' + trigger + '_' + day);
+            const targetColor = document.getElementById('color_' + trigger + '_' + day);
+            const targetColorMode = document.getElementById('color_mode_' + trigger + '_' + day);
+            const targetDelay = document.querySelector('input[name="delay_' + trigger + '_' + day + '"]');
+
+            if (sourceLetter && targetLetter) {
+                targetLetter.value = sourceLetter.value;
+            }
+            if (sourceColor && targetColor) {
+                targetColor.value = sourceColor.value;
+            }
+            if (sourceColorMode && targetColorMode) {
+                targetColorMode.value = sourceColorMode.value;
+            }
+            if (sourceDelay && targetDelay) {
+                targetDelay.value = sourceDelay.value;
+            }
+
+            for (let paletteIndex = 0; paletteIndex < 8; paletteIndex++) {
+                const sourcePalette = document.querySelector('input[name="palette_0_' + day + '_' + paletteIndex + '"]');
+                const targetPalette = document.querySelector('input[name="palette_' + trigger + '_' + day + '_' + paletteIndex + '"]');
+                if (sourcePalette && targetPalette) {
+                    targetPalette.checked = sourcePalette.checked;
+                }
+            }
+        }
+    }
+}
+
+// 🚀 Automatische Aktualisierung der Uhrzeit
+let rtcInterval;
+let memoryInterval;
+
+function startRTCUpdates() {
+    rtcInterval = setInterval(fetchRTC, 5000); // Alle 5 Sekunden aktualisieren
+    memoryInterval = setInterval(fetchMemory, 5000);
+}
+
+function stopRTCUpdates() {
+    clearInterval(rtcInterval);
+    clearInterval(memoryInterval);
+}
+
+fetchRTC();
+fetchMemory();
+startRTCUpdates();
+
+const dateInput = document.querySelector("input[name='date']");
+const timeInput = document.querySelector("input[name='time']");
+
+if (dateInput) {
+    dateInput.addEventListener('focus', stopRTCUpdates);
+    dateInput.addEventListener('blur', startRTCUpdates);
+} else {
+    console.warn('⚠️ Datumseingabe nicht gefunden, automatische Aktualisierung bleibt aktiv.');
+}
+
+if (timeInput) {
+    timeInput.addEventListener('focus', stopRTCUpdates);
+    timeInput.addEventListener('blur', startRTCUpdates);
+} else {
+    console.warn('⚠️ Uhrzeiteingabe nicht gefunden, automatische Aktualisierung bleibt aktiv.');
+}
+
+document.querySelectorAll('#wifiForm input[name="wifi_mode"]').forEach(input => {
+    input.addEventListener('change', updateWiFiModeFields);
+});
+const staticIpCheckbox = document.getElementById('wifi_static_ip_enabled');
+if (staticIpCheckbox) {
+    staticIpCheckbox.addEventListener('change', toggleStaticIpFields);
+}
+updateWiFiModeFields();
+toggleStaticIpFields();
+
+initializeTriggerEditMode();